@@ -0,0 +1,62 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <iostream>
+#include <string>
+
+#include "tudat/astro/earth_orientation/tabulatedEarthOrientation.h"
+
+//! Application to precompute an Earth orientation table, for use by GcrsToItrsRotationModelSettings::setEarthOrientationTableFile
+/*!
+ *  Usage: create_earth_orientation_table <output file> <start time> <end time> [time step (default 3600 s)]
+ *  Times are in seconds since J2000 (TDB). After writing the table, the interpolation error w.r.t. the direct computation is
+ *  reported at the midpoints between table nodes.
+ */
+int main( int argc, char* argv[ ] )
+{
+    using namespace tudat;
+    using namespace tudat::earth_orientation;
+
+    if( argc < 4 )
+    {
+        std::cerr << "Usage: " << argv[ 0 ] << " <output file> <start time> <end time> [time step]" << std::endl;
+        return 1;
+    }
+
+    std::string fileName = argv[ 1 ];
+    double startTime = std::stod( argv[ 2 ] );
+    double endTime = std::stod( argv[ 3 ] );
+    double timeStep = ( argc > 4 ) ? std::stod( argv[ 4 ] ) : 3600.0;
+
+    // Compute and write table
+    std::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator =
+            createStandardEarthOrientationCalculator( );
+    writeEarthOrientationTableToFile( fileName, earthOrientationCalculator, startTime, endTime, timeStep );
+
+    // Check interpolation error at a subset of the interval midpoints
+    std::shared_ptr< TabulatedEarthOrientationAngles > tabulatedEarthOrientation =
+            getTabulatedEarthOrientationAngles( fileName );
+    std::vector< double > testTimes;
+    uint64_t testInterval = std::max< uint64_t >( 1, tabulatedEarthOrientation->getNumberOfEpochs( ) / 10000 );
+    for( uint64_t i = 0; i < tabulatedEarthOrientation->getNumberOfEpochs( ) - 1; i += testInterval )
+    {
+        testTimes.push_back( startTime + ( static_cast< double >( i ) + 0.5 ) * timeStep );
+    }
+    Eigen::Vector6d maximumErrors = computeMaximumEarthOrientationTableErrors(
+                tabulatedEarthOrientation, earthOrientationCalculator, testTimes );
+
+    std::cout << "Wrote Earth orientation table with " << tabulatedEarthOrientation->getNumberOfEpochs( )
+              << " epochs to " << fileName << std::endl;
+    std::cout << "Maximum interpolation errors (X, Y, s, xp, yp [rad]; UT1 [s]): "
+              << maximumErrors.transpose( ) << std::endl;
+
+    return 0;
+}
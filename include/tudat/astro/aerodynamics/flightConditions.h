@@ -327,12 +327,61 @@ public:
 
     //! Function to update all flight conditions.
     /*!
-     *  Function to update all flight conditions (altitude, density, force coefficients) to
-     *  current state of vehicle and central body.
+     *  Function to update the flight conditions to current state of vehicle and central body. Only the vehicle state
+     *  and the aerodynamic angles are updated directly; all other quantities (altitude, density, aerodynamic coefficient
+     *  independent variables, aerodynamic coefficients, etc.) are computed when first retrieved at the current time,
+     *  including the quantities on which they depend (e.g. speed of sound when retrieving Mach number).
      *  \param currentTime Time to which conditions are to be updated.
      */
     void updateConditions( const double currentTime );
 
+    //! Function to update the aerodynamic coefficients to the current flight conditions
+    /*!
+     * Function to update the aerodynamic coefficients of the aerodynamic coefficient interface to the current flight
+     * conditions, if this has not yet been done at the current time. This function must be called before retrieving
+     * the current coefficients directly from the aerodynamic coefficient interface.
+     */
+    void updateAerodynamicCoefficients( )
+    {
+        if( !areAerodynamicCoefficientsUpdated_ )
+        {
+            computeAerodynamicCoefficients( );
+        }
+    }
+
+    //! Function to retrieve (and compute if necessary) the current aerodynamic force coefficients
+    /*!
+     * Function to retrieve (and compute if necessary) the current aerodynamic force coefficients
+     * \return Current aerodynamic force coefficients
+     */
+    Eigen::Vector3d getCurrentForceCoefficients( )
+    {
+        updateAerodynamicCoefficients( );
+        return aerodynamicCoefficientInterface_->getCurrentForceCoefficients( );
+    }
+
+    //! Function to retrieve (and compute if necessary) the current aerodynamic force coefficients by reference
+    /*!
+     * Function to retrieve (and compute if necessary) the current aerodynamic force coefficients by reference
+     * \return Current aerodynamic force coefficients
+     */
+    Eigen::Vector3d& getCurrentForceCoefficientsReference( )
+    {
+        updateAerodynamicCoefficients( );
+        return aerodynamicCoefficientInterface_->getCurrentForceCoefficientsReference( );
+    }
+
+    //! Function to retrieve (and compute if necessary) the current aerodynamic moment coefficients
+    /*!
+     * Function to retrieve (and compute if necessary) the current aerodynamic moment coefficients
+     * \return Current aerodynamic moment coefficients
+     */
+    Eigen::Vector3d getCurrentMomentCoefficients( )
+    {
+        updateAerodynamicCoefficients( );
+        return aerodynamicCoefficientInterface_->getCurrentMomentCoefficients( );
+    }
+
     //! Function to retrieve (and compute if necessary) the current freestream density
     /*!
      * Function to retrieve (and compute if necessary) the current freestream density
@@ -514,8 +563,7 @@ public:
                         "Error when getting aerodynamic coefficient independent variables, no coefficient interface is defined" );
         }
 
-        if( aerodynamicCoefficientIndependentVariables_.size( ) !=
-                aerodynamicCoefficientInterface_->getNumberOfIndependentVariables( ) )
+        if( !isAerodynamicCoefficientInputComputed_ )
         {
             updateAerodynamicCoefficientInput( );
         }
@@ -537,8 +585,7 @@ public:
                         "Error when getting control surface aerodynamic coefficient independent variables, no coefficient interface is defined" );
         }
 
-        if( controlSurfaceAerodynamicCoefficientIndependentVariables_.size( ) !=
-                aerodynamicCoefficientInterface_->getNumberOfControlSurfaces( ) )
+        if( !isAerodynamicCoefficientInputComputed_ )
         {
             updateAerodynamicCoefficientInput( );
         }
@@ -560,11 +607,13 @@ public:
         aerodynamicAngleCalculator_->resetCurrentTime( );
         aerodynamicCoefficientIndependentVariables_.clear( );
         controlSurfaceAerodynamicCoefficientIndependentVariables_.clear( );
+        resetAerodynamicCoefficientStatus( );
     }
 
     void resetAerodynamicCoefficientInterface( const std::shared_ptr< AerodynamicCoefficientInterface > coefficientInterface )
     {
         aerodynamicCoefficientInterface_ = coefficientInterface;
+        resetAerodynamicCoefficientStatus( );
     }
 
 private:
@@ -691,6 +740,18 @@ private:
     //! Function to update the independent variables of the aerodynamic coefficient interface
     void updateAerodynamicCoefficientInput( );
 
+    //! Function to update the aerodynamic coefficients to the current flight conditions (computing input if needed)
+    void computeAerodynamicCoefficients( );
+
+    //! Function to indicate that the aerodynamic coefficients, their independent variables and the number densities
+    //! are to be recomputed when next retrieved.
+    void resetAerodynamicCoefficientStatus( )
+    {
+        isAerodynamicCoefficientInputComputed_ = false;
+        areAerodynamicCoefficientsUpdated_ = false;
+        currentNumberDensities_.clear( );
+    }
+
 
     //! Atmosphere model of atmosphere through which vehicle is flying
     std::shared_ptr< aerodynamics::AtmosphereModel > atmosphereModel_;
@@ -714,6 +775,12 @@ private:
     //! List of independent variables of the control surface aerodynamic coefficient interface, with map key
     //! control surface identifiers.
     std::map< std::string, std::vector< double > > controlSurfaceAerodynamicCoefficientIndependentVariables_;
+
+    //! Boolean denoting whether the independent variables of the aerodynamic coefficients are computed at current time
+    bool isAerodynamicCoefficientInputComputed_;
+
+    //! Boolean denoting whether the aerodynamic coefficients are updated to the current time
+    bool areAerodynamicCoefficientsUpdated_;
 };
 
 } // namespace aerodynamics
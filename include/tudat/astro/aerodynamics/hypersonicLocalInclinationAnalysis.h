@@ -18,6 +18,7 @@
 #ifndef TUDAT_HYPERSONIC_LOCAL_INCLINATION_ANALYSIS_H
 #define TUDAT_HYPERSONIC_LOCAL_INCLINATION_ANALYSIS_H
 
+#include <cstdint>
 #include <map>
 #include <string>
 #include <vector>
@@ -56,6 +57,33 @@ std::vector< double > getDefaultHypersonicLocalInclinationAngleOfAttackPoints( )
  */
 std::vector< double > getDefaultHypersonicLocalInclinationAngleOfSideslipPoints( );
 
+//! Version of the binary HypersonicLocalInclinationAnalysis coefficient cache file format
+static const uint32_t HYPERSONIC_LOCAL_INCLINATION_CACHE_FILE_VERSION = 1;
+
+//! Header of binary HypersonicLocalInclinationAnalysis coefficient cache file.
+/*!
+ *  Header of binary HypersonicLocalInclinationAnalysis coefficient cache file. The header is followed directly by the
+ *  aerodynamic coefficients, stored as 6 doubles per data point, with the indices in order of Mach number, angle of
+ *  attack and angle of sideslip (row-major, angle of sideslip index running fastest).
+ */
+struct HypersonicLocalInclinationCacheFileHeader
+{
+    //! File identifier, must be equal to "TUDATHLI"
+    char fileIdentifier_[ 8 ];
+
+    //! Version of the file format
+    uint32_t fileVersion_;
+
+    //! Marker used to detect files written on a machine with different byte order
+    uint32_t byteOrderMarker_;
+
+    //! Hash of the vehicle geometry and analysis settings with which the coefficients were computed
+    uint64_t analysisHash_;
+
+    //! Number of data points of each of the independent variables
+    uint64_t numberOfDataPoints_[ 3 ];
+};
+
 //! Class for inviscid hypersonic aerodynamic analysis using local inclination methods.
 /*!
  * Class for inviscid hypersonic aerodynamic analysis using local inclination
@@ -100,6 +128,12 @@ public:
      *  \param referenceLength Reference length used to non-dimensionalize aerodynamic moments.
      *  \param momentReferencePoint Reference point wrt which aerodynamic moments are calculated.
      *  \param savePressureCoefficients Boolean denoting whether to save the pressure coefficients that are computed to files
+     *  \param numberOfThreads Number of threads over which the computation of the data points is distributed (0 to use
+     *  the number of concurrent threads supported by the hardware). The coefficients do not depend on this setting.
+     *  \param cacheDirectory Directory in which the computed coefficients are stored, in a file named after a hash of the
+     *  panel geometry and analysis settings (see getCoefficientCacheFile). If a file with identical hash is present, the
+     *  coefficients are loaded from it instead of being recomputed (unless savePressureCoefficients is true, in which
+     *  case the coefficients are always recomputed). If empty, no cache is used.
      */
     HypersonicLocalInclinationAnalysis(
             const std::vector< std::vector< double > >& dataPointsOfIndependentVariables,
@@ -111,7 +145,9 @@ public:
             const double referenceArea,
             const double referenceLength,
             const Eigen::Vector3d& momentReferencePoint,
-            const bool savePressureCoefficients = false );
+            const bool savePressureCoefficients = false,
+            const unsigned int numberOfThreads = 1,
+            const std::string& cacheDirectory = "" );
 
     //! Default destructor.
     /*!
@@ -131,15 +167,17 @@ public:
     Eigen::Vector6d getAerodynamicCoefficientsDataPoint(
             const boost::array< int, 3 > independentVariables );
 
-    //! Determine inclination angles of panels on a given part.
+    //! Determine inclination angles of panels on all parts.
     /*!
-     * Determines panel inclinations for all panels on all parts for given attitude.
+     * Determines panel inclinations for all panels on all parts for given attitude, from the same (const) computation
+     * that is used for the coefficient generation.
      * Outward pointing surface-normals are assumed!
      * \param angleOfAttack Angle of attack at which to determine inclination angles.
      * \param angleOfSideslip Angle of sideslip at which to determine inclination angles.
+     * \return Three-dimensional array of panel inclination angles. Indices indicate part-line-point.
      */
-    void determineInclinations( const double angleOfAttack,
-                                const double angleOfSideslip );
+    std::vector< std::vector< std::vector< double > > > determineInclinations(
+            const double angleOfAttack, const double angleOfSideslip ) const;
 
     //! Get the number of vehicle parts.
     /*!
@@ -212,6 +250,37 @@ public:
         return pressureCoefficientList_.at( independentVariables );
     }
 
+    //! Function to retrieve the hash of the panel geometry and analysis settings
+    /*!
+     * Function to retrieve the hash of the panel geometry and analysis settings, which uniquely (up to hash collisions)
+     * determines the aerodynamic coefficients, and which is used to identify the coefficient cache file.
+     * \return Hash of the panel geometry and analysis settings
+     */
+    uint64_t getAnalysisHash( ) const
+    {
+        return analysisHash_;
+    }
+
+    //! Function to retrieve the name of the coefficient cache file
+    /*!
+     * Function to retrieve the name of the coefficient cache file
+     * \return Name of the coefficient cache file (empty if no cache directory was provided)
+     */
+    std::string getCoefficientCacheFile( ) const
+    {
+        return coefficientCacheFile_;
+    }
+
+    //! Function to retrieve whether the coefficients were loaded from the cache file
+    /*!
+     * Function to retrieve whether the coefficients were loaded from the cache file
+     * \return True if the coefficients were loaded from the cache file, false if they were computed
+     */
+    bool areCoefficientsLoadedFromCache( ) const
+    {
+        return areCoefficientsLoadedFromCache_;
+    }
+
     void clearData( )
     {
         std::vector< std::shared_ptr< geometric_shapes::LawgsPartGeometry > > vehicleParts_;
@@ -227,18 +296,9 @@ public:
 
         isCoefficientGenerated_.resize( numberOfPointsPerIndependentVariables );
 
-        for( unsigned int i = 0; i < inclination_.size( ); i++ )
-        {
-            for( unsigned int j = 0; j < inclination_.at( i ).size( ); j++ )
-            {
-                inclination_.at( i ).at( j ).clear( );
-                pressureCoefficient_.at( i ).at( j ).clear( );
-            }
-            inclination_.at( i ).clear( );
-            pressureCoefficient_.at( i ).clear( );
-        }
-        inclination_.clear( );
-        pressureCoefficient_.clear( );
+        panelSurfaceNormals_.clear( );
+        panelCoefficientContributions_.clear( );
+        panelInclinations_.clear( );
 
         for( unsigned int i = 0; i < selectedMethods_.size( ); i++ )
         {
@@ -246,7 +306,7 @@ public:
         }
         selectedMethods_.clear( );
 
-        previouslyComputedInclinations_.clear( );
+        pressureCoefficientList_.clear( );
         clearBaseData( );
 
     }
@@ -258,7 +318,7 @@ private:
     /*!
      * Generates aerodynamic database. Settings of geometry,
      * reference quantities, database point settings and analysis methods
-     * should have been set previously.
+     * should have been set previously. The data points are distributed over numberOfThreads_ threads.
      */
     void generateCoefficients( );
 
@@ -271,63 +331,123 @@ private:
      */
     void determineVehicleCoefficients( const boost::array< int, 3 > independentVariableIndices );
 
-    //! Determine aerodynamic coefficients for a single LaWGS part.
+    //! Save the pressure coefficients at a single set of independent variables.
     /*!
-     * Determines aerodynamic coefficients for a single LaWGS part,
-     * calls determinepressureCoefficient_ function for given vehicle part.
-     * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \param independentVariableIndices Array of indices of independent variables.
-     * \return Force and moment coefficients for requested vehicle part.
+     * Saves the pressure coefficients at a single set of independent variables in pressureCoefficientList_, in
+     * part-line-point ordering.
+     * \param independentVariableIndices Array of indices from lists of Mach number,
+     *          angle of attack and angle of sideslip points.
+     * \param pressureCoefficients Pressure coefficients of the panels of each vehicle part.
+     */
+    void setPressureCoefficientList( const boost::array< int, 3 > independentVariableIndices,
+                                     const std::vector< Eigen::VectorXd >& pressureCoefficients );
+
+    //! Compute aerodynamic coefficients at a single set of independent variables.
+    /*!
+     * Computes aerodynamic coefficients at a single set of independent variables, by summing the contributions of all
+     * vehicle parts. This function does not modify any member variables, and may be called concurrently.
+     * \param independentVariableIndices Array of indices from lists of Mach number,
+     *          angle of attack and angle of sideslip points at which to perform analysis.
+     * \param pressureCoefficients Pressure coefficients of the panels of each vehicle part (returned by reference).
+     * \return Force and moment coefficients of the vehicle.
      */
-    Eigen::Vector6d determinePartCoefficients(
-            const int partNumber, const boost::array< int, 3 > independentVariableIndices );
+    Eigen::Vector6d computeVehicleCoefficients(
+            const boost::array< int, 3 > independentVariableIndices,
+            std::vector< Eigen::VectorXd >& pressureCoefficients ) const;
 
     //! Determine pressure coefficients on a given part.
     /*!
      * Determines pressure coefficients on a single vehicle part.
      * Calls the updateExpansionPressures and updateCompressionPressures for given vehicle part.
+     * \param machNumber Mach number at which to perform analysis.
      * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \param independentVariableIndices Array of indices of independent variables.
+     * \param inclinations Inclination angles of the panels of the vehicle part.
+     * \param pressureCoefficients Pressure coefficients of the panels of the vehicle part (returned by reference).
      */
-    void determinePressureCoefficients( const int partNumber,
-                                        const boost::array< int, 3 > independentVariableIndices );
+    void determinePressureCoefficients( const double machNumber,
+                                        const int partNumber,
+                                        const Eigen::VectorXd& inclinations,
+                                        Eigen::VectorXd& pressureCoefficients ) const;
 
-    //! Determine force coefficients of a part.
+    //! Determine force and moment coefficients of a part.
     /*!
-     * Sums the pressure coefficients of given part and determines force coefficients from it by
-     * non-dimensionalization with reference area.
-     * \param partNumber Index from vehicleParts_ array for which determine coefficients.
-     * \return Force coefficients for requested vehicle part.
-     */
-    Eigen::Vector3d calculateForceCoefficients( const int partNumber );
-
-    //! Determine moment coefficients of a part.
-    /*!
-     * Determines the moment coefficients of a given part by summing the contributions of all
-     * panels on the part. Moment arms are taken from panel centroid to momentReferencePoint. Non-
-     * dimensionalization is performed by product of referenceLength and referenceArea.
+     * Determines the force and moment coefficients of a part from the panel pressure coefficients, as the product of
+     * the (precomputed) panelCoefficientContributions_ of the part with the pressure coefficients. Moment arms are taken
+     * from panel centroid to momentReferencePoint. Non-dimensionalization is performed by referenceArea (force) and
+     * by product of referenceLength and referenceArea (moment).
      * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \return Moment coefficients for requested vehicle part.
+     * \param pressureCoefficients Pressure coefficients of the panels of the vehicle part.
+     * \return Force and moment coefficients for requested vehicle part.
      */
-    Eigen::Vector3d calculateMomentCoefficients( const int partNumber );
+    Eigen::Vector6d calculatePartCoefficients( const int partNumber,
+                                               const Eigen::VectorXd& pressureCoefficients ) const;
 
     //! Determine the compression pressure coefficients of a given part.
     /*!
-     * Sets the values of pressureCoefficient_ on given part and at given Mach number for which
+     * Sets the values of the pressure coefficients on given part and at given Mach number for which
      * inclination > 0.
      * \param machNumber Mach number at which to perform analysis.
      * \param partNumber of part from vehicleParts_ which is to be analyzed.
+     * \param inclinations Inclination angles of the panels of the vehicle part.
+     * \param pressureCoefficients Pressure coefficients of the panels of the vehicle part (modified by reference).
      */
-    void updateCompressionPressures( const double machNumber, const int partNumber );
+    void updateCompressionPressures( const double machNumber, const int partNumber,
+                                     const Eigen::VectorXd& inclinations,
+                                     Eigen::VectorXd& pressureCoefficients ) const;
 
     //! Determine the expansion pressure coefficients of a given part.
     /*!
-     * Determine the values of pressureCoefficient_ on given part and at given Mach number for
+     * Determine the values of the pressure coefficients on given part and at given Mach number for
      * which inclination <= 0.
      * \param machNumber Mach number at which to perform analysis.
      * \param partNumber of part from vehicleParts_ which is to be analyzed.
+     * \param inclinations Inclination angles of the panels of the vehicle part.
+     * \param pressureCoefficients Pressure coefficients of the panels of the vehicle part (modified by reference).
      */
-    void updateExpansionPressures( const double machNumber, const int partNumber );
+    void updateExpansionPressures( const double machNumber, const int partNumber,
+                                   const Eigen::VectorXd& inclinations,
+                                   Eigen::VectorXd& pressureCoefficients ) const;
+
+    //! Compute the inclination angles of the panels of all parts.
+    /*!
+     * Computes the inclination angles of the panels of all parts for given attitude.
+     * Outward pointing surface-normals are assumed!
+     * \param angleOfAttack Angle of attack at which to determine inclination angles.
+     * \param angleOfSideslip Angle of sideslip at which to determine inclination angles.
+     * \param inclinations Inclination angles of the panels of each vehicle part (returned by reference).
+     */
+    void computePanelInclinations( const double angleOfAttack,
+                                   const double angleOfSideslip,
+                                   std::vector< Eigen::VectorXd >& inclinations ) const;
+
+    //! Set the panel data of all parts in the contiguous representation used for the analysis.
+    /*!
+     * Sets the panelSurfaceNormals_ and panelCoefficientContributions_ of all parts from the vehicle parts.
+     */
+    void setPanelData( );
+
+    //! Compute the hash of the panel geometry and analysis settings.
+    /*!
+     * Computes the hash (64-bit FNV-1a) of the panel geometry and analysis settings, from the panel data, the selected
+     * methods, the data points of the independent variables, the reference quantities and the ratio of specific heats.
+     * \return Hash of the panel geometry and analysis settings.
+     */
+    uint64_t computeAnalysisHash( ) const;
+
+    //! Read the aerodynamic coefficients from the cache file.
+    /*!
+     * Reads the aerodynamic coefficients from the cache file, if it exists and is consistent with the current
+     * analysis (identical hash and number of data points).
+     * \return True if the coefficients were read from the file, false otherwise.
+     */
+    bool readCoefficientsFromCacheFile( );
+
+    //! Write the aerodynamic coefficients to the cache file.
+    /*!
+     * Writes the aerodynamic coefficients to the cache file. The file is first written to a temporary file, which is
+     * subsequently renamed, so that concurrent analyses never read a partially written file.
+     */
+    void writeCoefficientsToCacheFile( ) const;
 
     //! Array of vehicle parts.
     /*!
@@ -342,42 +462,38 @@ private:
      */
     boost::multi_array< bool, 3 > isCoefficientGenerated_;
 
-    //! Three-dimensional array of panel inclination angles.
+    //! Surface normals of the panels of each vehicle part.
     /*!
-     * Three-dimensional array of panel inclination angles at current values of
-     * independent variables. Indices indicate part-line-point.
+     * Surface normals of the panels of each vehicle part, with the panels stored column-wise, in order of line index,
+     * then point index (i.e. column index lineIndex * ( numberOfPoints - 1 ) + pointIndex).
      */
-    std::vector< std::vector< std::vector< double > > > inclination_;
+    std::vector< Eigen::Matrix3Xd > panelSurfaceNormals_;
 
-    //! Map of angle of attack and -sideslip pair and associated panel inclinations.
+    //! Contribution of the pressure coefficient of each panel to the force and moment coefficients, per vehicle part.
     /*!
-     * Map of angle of attack and -sideslip pair and associated panel inclinations.
+     * Contribution of the pressure coefficient of each panel to the force and moment coefficients, per vehicle part,
+     * with panel ordering as in panelSurfaceNormals_. The first three rows contain -A*n/S_ref, the last three rows
+     * -A*(r x n)/(S_ref*L_ref), with A the panel area, n the panel surface normal and r the panel centroid w.r.t. the
+     * moment reference point.
      */
-    std::map< std::pair< double, double >, std::vector< std::vector< std::vector< double > > > >
-    previouslyComputedInclinations_;
+    std::vector< Eigen::Matrix< double, 6, Eigen::Dynamic > > panelCoefficientContributions_;
 
-    //! Three-dimensional array of panel pressure coefficients.
+    //! Panel inclinations of each vehicle part, for each combination of angle of attack and -sideslip.
     /*!
-     * Three-dimensional array of panel pressure coefficients at current values
-     * of independent variables. Indices indicate part-line-point.
+     * Panel inclinations of each vehicle part, for each combination of angle of attack and -sideslip (outer index,
+     * angleOfAttackIndex * numberOfAnglesOfSideslip + angleOfSideslipIndex), with panel ordering as in
+     * panelSurfaceNormals_.
      */
-    std::vector< std::vector< std::vector< double > > > pressureCoefficient_;
+    std::vector< std::vector< Eigen::VectorXd > > panelInclinations_;
 
     std::map< boost::array< int, 3 >,  std::vector< std::vector< std::vector< double > > > > pressureCoefficientList_;
 
-    //! Stagnation pressure coefficient.
-    /*!
-     * Stagnation pressure coefficient for flow which has passed through a
-     * normal shock wave at current Mach number.
-     */
-    double stagnationPressureCoefficient;
-
     //! Ratio of specific heats.
     /*!
      * Ratio of specific heat at constant pressure to specific heat at constant pressure.
      */
     double ratioOfSpecificHeats;
-    \
+
     //! Array of selected methods.
     /*!
      * Array of selected methods, first index represents compression/expansion,
@@ -386,6 +502,18 @@ private:
     std::vector< std::vector< int > > selectedMethods_;
 
     bool savePressureCoefficients_;
+
+    //! Number of threads over which the computation of the data points is distributed.
+    unsigned int numberOfThreads_;
+
+    //! Hash of the panel geometry and analysis settings.
+    uint64_t analysisHash_;
+
+    //! Name of the coefficient cache file (empty if no cache is used).
+    std::string coefficientCacheFile_;
+
+    //! Boolean denoting whether the coefficients were loaded from the cache file.
+    bool areCoefficientsLoadedFromCache_;
 };
 
 
@@ -148,9 +148,9 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
     NRLMSISE00Atmosphere( const tudat::input_output::solar_activity::SolarActivityDataMap solarActivityData,
                           const bool useIdealGasLaw = true )
     {
-        nrlmsise00InputFunction_ = std::bind( &tudat::aerodynamics::nrlmsiseInputFunction,
-                   std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4,
-                   solarActivityData, false, TUDAT_NAN );
+        solarActivityTable_ = std::make_shared< NRLMSISE00SolarActivityTable >( solarActivityData );
+        nrlmsise00InputFunction_ = std::bind( &NRLMSISE00SolarActivityTable::getNrlmsise00Input, solarActivityTable_,
+                   std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4 );
         solarActivityContainer_ = std::make_shared< input_output::solar_activity::SolarActivityContainer >(
                     solarActivityData );
 
@@ -176,9 +176,9 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
                          const GasComponentProperties gasProperties,
                          const bool useIdealGasLaw = true)
     {
-        nrlmsise00InputFunction_ = std::bind( &tudat::aerodynamics::nrlmsiseInputFunction,
-                   std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4,
-                   solarActivityData, false, TUDAT_NAN );
+        solarActivityTable_ = std::make_shared< NRLMSISE00SolarActivityTable >( solarActivityData );
+        nrlmsise00InputFunction_ = std::bind( &NRLMSISE00SolarActivityTable::getNrlmsise00Input, solarActivityTable_,
+                   std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4 );
         solarActivityContainer_ = std::make_shared< input_output::solar_activity::SolarActivityContainer >(
                     solarActivityData );
 
@@ -376,6 +376,23 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
         return weightedAverageCollisionDiameter_;
     }
 
+    //! Get local densities at a list of points.
+    /*!
+     * Returns the local density of the atmosphere in kg per meter^3 at a list of points. Only the density is computed
+     * (no other properties), and the time-dependent input of the model is re-used for consecutive points at the same
+     * time (if the model is created from solar activity data), making this function more efficient than repeated calls
+     * to getDensity. The stored properties of the last call to any of the other get functions are not modified.
+     * \param altitudes Altitudes at which density is to be computed [m].
+     * \param longitudes Longitudes at which density is to be computed [rad].
+     * \param latitudes Latitudes at which density is to be computed [rad].
+     * \param times Times at which density is to be computed (seconds since J2000).
+     * \return Atmospheric densities [kg/m^3] at the requested points.
+     */
+    std::vector< double > getDensities( const std::vector< double >& altitudes,
+                                        const std::vector< double >& longitudes,
+                                        const std::vector< double >& latitudes,
+                                        const std::vector< double >& times );
+
     //! Get the full model output
     /*!
      * Gets the output directly from the model. This will return a
@@ -400,6 +417,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
     void resetHashKey( )
     {
         hashKey_ = 0;
+        currentInputTime_ = TUDAT_NAN;
     }
 
     std::shared_ptr< input_output::solar_activity::SolarActivityContainer > getSolarActivityContainer( )
@@ -422,6 +440,17 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
         return nrlmsise00InputFunction_;
     }
 
+    //! Function to get the table of solar activity from which the input is computed
+    /*!
+     *  Function to get the table of solar activity from which the input is computed (nullptr if model is created from
+     *  a user-defined input function).
+     *  \return Table of solar activity from which the input is computed
+     */
+    std::shared_ptr< NRLMSISE00SolarActivityTable > getSolarActivityTable( )
+    {
+        return solarActivityTable_;
+    }
+
     nrlmsise_input getNRLMSISE00InputStruct( )
     {
         return input_;
@@ -590,9 +619,18 @@ private:
     void computeProperties( const double altitude, const double longitude,
                             const double latitude, const double time );
 
+    //! Set the time-dependent entries of the input structure from the current input data.
+    void setTimeDependentInputStructEntries( );
+
     //! Input data to NRLMSISE00 atmosphere model
     NRLMSISE00Input inputData_;
 
+    //! Table of solar activity from which input is computed (nullptr if user-defined input function is used).
+    std::shared_ptr< NRLMSISE00SolarActivityTable > solarActivityTable_;
+
+    //! Time at which the time-dependent entries of input_ were last computed from solarActivityTable_.
+    double currentInputTime_;
+
     std::shared_ptr< input_output::solar_activity::SolarActivityContainer > solarActivityContainer_;
 
     std::map< AtmosphericCompositionSpecies, int > speciesIndices =
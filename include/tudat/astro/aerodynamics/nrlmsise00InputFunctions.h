@@ -109,6 +109,124 @@ NRLMSISE00Input nrlmsiseInputFunction( const double altitude, const double longi
                                        const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityMap,
                                        const bool adjustSolarTime = false, const double localSolarTime = 0.0 );
 
+//! Solar activity of a single day, stored in the form in which it is used as NRLMSISE00 input
+struct NRLMSISE00DailySolarActivity
+{
+    //! Year of the solar activity data
+    int year;
+
+    //! Julian day (at 0h) of the first of January of the year
+    double julianDayOnFirstOfJanuary;
+
+    //! Daily F10.7 flux for previous day (adjusted or observed, depending on flux qualifier)
+    double f107;
+
+    //! 81 day average of F10.7 flux (adjusted or observed, depending on flux qualifier)
+    double f107a;
+
+    //! Daily magnetic index
+    double apDaily;
+
+    //! Magnetic index data vector: \sa ap_array
+    double apVector[ 7 ];
+};
+
+//! Table of solar activity, indexed by day, from which the NRLMSISE00 input is retrieved.
+/*!
+ *  Table of solar activity, indexed by day, from which the NRLMSISE00 input is retrieved. The table is created from a
+ *  SolarActivityDataMap, and stores the data for each day (from the first day in the map up to 30 days after the last
+ *  day in the map) in a contiguous vector, so that the data for a given time is retrieved by a single index computation,
+ *  instead of a map look-up. Days that are missing in the map are filled in the same manner as is done by the
+ *  nrlmsiseInputFunction function, so that the input retrieved from this table is identical to that produced by
+ *  nrlmsiseInputFunction.
+ */
+class NRLMSISE00SolarActivityTable
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param solarActivityMap Solar activity data, with the Julian day (at 0h) as key
+     */
+    NRLMSISE00SolarActivityTable(
+            const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityMap );
+
+    //! Function to retrieve the solar activity data for a given day
+    /*!
+     *  Function to retrieve the solar activity data for a given day. For days before the start of the table, the data of
+     *  the first day is returned, for days more than 30 days after the last entry of the solar activity data, an
+     *  exception is thrown.
+     *  \param julianDay Julian day (at 0h) for which solar activity is to be retrieved.
+     *  \return Solar activity data for requested day.
+     */
+    const NRLMSISE00DailySolarActivity& getDailySolarActivity( const double julianDay ) const;
+
+    //! Function to compute the NRLMSISE00 input from the tabulated solar activity
+    /*!
+     *  Function to compute the NRLMSISE00 input from the tabulated solar activity, producing results identical to those of
+     *  nrlmsiseInputFunction (with adjustSolarTime set to false).
+     *  \param altitude Altitude at which output is to be computed [m].
+     *  \param longitude Longitude at which output is to be computed [rad].
+     *  \param latitude Latitude at which output is to be computed [rad].
+     *  \param time Time at which output is to be computed (seconds since J2000).
+     *  \return NRLMSISE00 input at requested time and position
+     */
+    NRLMSISE00Input getNrlmsise00Input( const double altitude, const double longitude,
+                                        const double latitude, const double time ) const;
+
+    //! Function to retrieve the first Julian day (at 0h) in the table
+    /*!
+     *  Function to retrieve the first Julian day (at 0h) in the table
+     *  \return First Julian day (at 0h) in the table
+     */
+    double getFirstJulianDay( ) const
+    {
+        return firstJulianDay_;
+    }
+
+    //! Function to retrieve the number of days in the table
+    /*!
+     *  Function to retrieve the number of days in the table
+     *  \return Number of days in the table
+     */
+    int getNumberOfDays( ) const
+    {
+        return static_cast< int >( dailySolarActivity_.size( ) );
+    }
+
+private:
+
+    //! First Julian day (at 0h) in the table
+    double firstJulianDay_;
+
+    //! Solar activity for each day, starting at firstJulianDay_
+    std::vector< NRLMSISE00DailySolarActivity > dailySolarActivity_;
+};
+
+//! Function to compute the Julian day (at 0h) corresponding to a time
+/*!
+ *  Function to compute the Julian day (at 0h) corresponding to a time, as used for the retrieval of the NRLMSISE00
+ *  solar activity input.
+ *  \param time Time (seconds since J2000).
+ *  \return Julian day (at 0h) in which time is located
+ */
+double getNrlmsise00JulianDay( const double time );
+
+//! Function to set the time-dependent entries of the NRLMSISE00 input from the tabulated solar activity
+/*!
+ *  Function to set the time-dependent entries of the NRLMSISE00 input (year, day of the year, second of the day,
+ *  F10.7 and magnetic indices) from the tabulated solar activity. The local solar time, which also depends on the
+ *  longitude, is not set by this function.
+ *  \param solarActivityTable Table of solar activity
+ *  \param time Time at which input is to be computed (seconds since J2000).
+ *  \param nrlmsiseInputData NRLMSISE00 input of which the time-dependent entries are set (returned by reference)
+ */
+void setTimeDependentNrlmsise00Input(
+        const NRLMSISE00SolarActivityTable& solarActivityTable,
+        const double time,
+        NRLMSISE00Input& nrlmsiseInputData );
+
 }  // namespace aerodynamics
 }  // namespace tudat
 
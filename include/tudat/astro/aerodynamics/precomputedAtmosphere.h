@@ -0,0 +1,566 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PRECOMPUTED_ATMOSPHERE_H
+#define TUDAT_PRECOMPUTED_ATMOSPHERE_H
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/multi_array.hpp>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/aerodynamics/atmosphereModel.h"
+#include "tudat/math/interpolators/multiLinearInterpolator.h"
+
+namespace tudat
+{
+
+namespace aerodynamics
+{
+
+//! Version of the binary precomputed atmosphere file format
+static const uint32_t PRECOMPUTED_ATMOSPHERE_FILE_VERSION = 2;
+
+//! Header of binary precomputed atmosphere file.
+/*!
+ *  Header of binary precomputed atmosphere file. The header is followed directly by the numberOfAltitudes_ altitude nodes,
+ *  and subsequently by the table entries, stored as 4 doubles (log of density, log of pressure, temperature, speed of
+ *  sound) per node, with the indices in order of altitude, latitude, local solar time and time (row-major, time
+ *  index running fastest). The remaining members store the settings with which the table was generated, and a
+ *  fingerprint of the atmosphere model from which it was generated, which are used to check whether a file is
+ *  consistent with the requested settings and atmosphere model.
+ */
+struct PrecomputedAtmosphereFileHeader
+{
+    //! File identifier, must be equal to "TUDATPAT"
+    char fileIdentifier_[ 8 ];
+
+    //! Version of the file format
+    uint32_t fileVersion_;
+
+    //! Marker used to detect files written on a machine with different byte order
+    uint32_t byteOrderMarker_;
+
+    //! Number of altitude nodes
+    uint64_t numberOfAltitudes_;
+
+    //! Number of latitude nodes
+    uint64_t numberOfLatitudes_;
+
+    //! Number of local solar time nodes
+    uint64_t numberOfLocalSolarTimes_;
+
+    //! Number of time nodes
+    uint64_t numberOfTimes_;
+
+    //! Minimum altitude of the table
+    double minimumAltitude_;
+
+    //! Maximum altitude of the table
+    double maximumAltitude_;
+
+    //! Initial altitude step, before adaptive refinement
+    double initialAltitudeStep_;
+
+    //! Minimum altitude step, used during adaptive refinement
+    double minimumAltitudeStep_;
+
+    //! Tolerance on relative density interpolation error used during adaptive refinement of the altitude nodes
+    double densityTolerance_;
+
+    //! First time node of the table
+    double startTime_;
+
+    //! Constant step between subsequent time nodes of the table
+    double timeStep_;
+
+    //! Maximum relative density interpolation error at the check points, determined after generation of the table
+    double maximumSampledRelativeDensityError_;
+
+    //! Fingerprint of the atmosphere model from which the table was generated (see computeAtmosphereModelFingerprint)
+    uint64_t baseModelFingerprint_;
+};
+
+//! Settings for the grid on which an atmosphere model is precomputed.
+/*!
+ *  Settings for the grid on which an atmosphere model is precomputed, as used by the PrecomputedAtmosphere class. The
+ *  grid is defined in altitude, latitude, local solar time and time. The latitude, local solar time and time nodes are
+ *  equidistant. The altitude nodes are determined adaptively: starting from an equidistant grid, each altitude interval
+ *  is bisected until the relative error of the (log-linear) interpolation of the density at the interval midpoint is
+ *  below the tolerance, for a set of reference latitudes, local solar times and times.
+ */
+class PrecomputedAtmosphereGridSettings
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param minimumAltitude Minimum altitude of the table.
+     *  \param maximumAltitude Maximum altitude of the table.
+     *  \param startTime First time node of the table (seconds since J2000).
+     *  \param endTime Time up to which the table is generated (seconds since J2000); the final time node is at or after
+     *  this time.
+     *  \param timeStep Constant step between subsequent time nodes of the table.
+     *  \param initialAltitudeStep Altitude step of the grid before adaptive refinement.
+     *  \param densityTolerance Tolerance on relative density interpolation error in altitude, used for adaptive
+     *  refinement of the altitude nodes.
+     *  \param minimumAltitudeStep Minimum altitude step of the table (adaptive refinement is stopped when this value is
+     *  reached).
+     *  \param numberOfLatitudes Number of (equidistant) latitude nodes, from -90 to 90 degrees.
+     *  \param numberOfLocalSolarTimes Number of (equidistant) local solar time nodes, from 0 to 24 hours.
+     *  \param numberOfErrorCheckPoints Number of points at which the interpolation error is checked after generation
+     *  of the table (see PrecomputedAtmosphere::getMaximumSampledRelativeDensityError).
+     */
+    PrecomputedAtmosphereGridSettings(
+            const double minimumAltitude,
+            const double maximumAltitude,
+            const double startTime,
+            const double endTime,
+            const double timeStep,
+            const double initialAltitudeStep = 50.0E3,
+            const double densityTolerance = 1.0E-3,
+            const double minimumAltitudeStep = 250.0,
+            const unsigned int numberOfLatitudes = 19,
+            const unsigned int numberOfLocalSolarTimes = 25,
+            const unsigned int numberOfErrorCheckPoints = 1000 ):
+        minimumAltitude_( minimumAltitude ), maximumAltitude_( maximumAltitude ),
+        startTime_( startTime ), endTime_( endTime ), timeStep_( timeStep ),
+        initialAltitudeStep_( initialAltitudeStep ), densityTolerance_( densityTolerance ),
+        minimumAltitudeStep_( minimumAltitudeStep ),
+        numberOfLatitudes_( numberOfLatitudes ), numberOfLocalSolarTimes_( numberOfLocalSolarTimes ),
+        numberOfErrorCheckPoints_( numberOfErrorCheckPoints )
+    {
+        if( !( maximumAltitude_ > minimumAltitude_ ) || !( initialAltitudeStep_ > 0.0 ) ||
+                !( minimumAltitudeStep_ > 0.0 ) || !( densityTolerance_ > 0.0 ) )
+        {
+            throw std::runtime_error( "Error when creating precomputed atmosphere grid settings, altitude range, steps or "
+                                      "tolerance are invalid" );
+        }
+
+        if( !( endTime_ > startTime_ ) || !( timeStep_ > 0.0 ) )
+        {
+            throw std::runtime_error( "Error when creating precomputed atmosphere grid settings, time interval or step "
+                                      "size is invalid" );
+        }
+
+        if( numberOfLatitudes_ < 2 || numberOfLocalSolarTimes_ < 2 )
+        {
+            throw std::runtime_error( "Error when creating precomputed atmosphere grid settings, at least 2 latitude and "
+                                      "local solar time nodes are required" );
+        }
+    }
+
+    //! Function to compute the number of time nodes of the table
+    /*!
+     *  Function to compute the number of time nodes of the table, such that the final time node is at or after endTime_.
+     *  \return Number of time nodes of the table
+     */
+    unsigned int getNumberOfTimes( ) const
+    {
+        return static_cast< unsigned int >( std::ceil( ( endTime_ - startTime_ ) / timeStep_ ) ) + 1;
+    }
+
+    //! Minimum altitude of the table.
+    double minimumAltitude_;
+
+    //! Maximum altitude of the table.
+    double maximumAltitude_;
+
+    //! First time node of the table (seconds since J2000).
+    double startTime_;
+
+    //! Time up to which the table is generated (seconds since J2000).
+    double endTime_;
+
+    //! Constant step between subsequent time nodes of the table.
+    double timeStep_;
+
+    //! Altitude step of the grid before adaptive refinement.
+    double initialAltitudeStep_;
+
+    //! Tolerance on relative density interpolation error in altitude, used for adaptive refinement of the altitude nodes.
+    double densityTolerance_;
+
+    //! Minimum altitude step of the table.
+    double minimumAltitudeStep_;
+
+    //! Number of (equidistant) latitude nodes, from -90 to 90 degrees.
+    unsigned int numberOfLatitudes_;
+
+    //! Number of (equidistant) local solar time nodes, from 0 to 24 hours.
+    unsigned int numberOfLocalSolarTimes_;
+
+    //! Number of points at which the interpolation error is checked after generation of the table.
+    unsigned int numberOfErrorCheckPoints_;
+};
+
+//! Function to compute the local solar time from the longitude and time.
+/*!
+ *  Function to compute the local solar time from the longitude and time, using the same definition as the NRLMSISE00
+ *  input (second of the UT day plus longitude in hours), wrapped to the interval [0, 24) hours.
+ *  \param longitude Longitude [rad].
+ *  \param time Time (seconds since J2000).
+ *  \return Local solar time [hours].
+ */
+double computeLocalSolarTime( const double longitude, const double time );
+
+//! Function to compute the longitude at which a given local solar time is attained at a given time.
+/*!
+ *  Function to compute the longitude at which a given local solar time is attained at a given time (inverse of
+ *  computeLocalSolarTime), wrapped to the interval [-pi, pi).
+ *  \param localSolarTime Local solar time [hours].
+ *  \param time Time (seconds since J2000).
+ *  \return Longitude [rad].
+ */
+double computeLongitudeFromLocalSolarTime( const double localSolarTime, const double time );
+
+//! Function to compute the second of the (UT) day from a time in seconds since J2000.
+/*!
+ *  Function to compute the second of the (UT) day from a time in seconds since J2000 (which is at 12h), neglecting the
+ *  difference between the time scale of the input and UT.
+ *  \param time Time (seconds since J2000).
+ *  \return Second of the day [s].
+ */
+double computeSecondOfDay( const double time );
+
+//! Function to compute the equidistant latitude nodes of a precomputed atmosphere.
+/*!
+ *  Function to compute the equidistant latitude nodes of a precomputed atmosphere, from -90 to 90 degrees.
+ *  \param numberOfLatitudes Number of latitude nodes.
+ *  \return Latitude nodes [rad].
+ */
+std::vector< double > getPrecomputedAtmosphereLatitudes( const unsigned int numberOfLatitudes );
+
+//! Function to compute the equidistant local solar time nodes of a precomputed atmosphere.
+/*!
+ *  Function to compute the equidistant local solar time nodes of a precomputed atmosphere, from 0 to 24 hours.
+ *  \param numberOfLocalSolarTimes Number of local solar time nodes.
+ *  \return Local solar time nodes [hours].
+ */
+std::vector< double > getPrecomputedAtmosphereLocalSolarTimes( const unsigned int numberOfLocalSolarTimes );
+
+//! Atmosphere model that interpolates a table, precomputed from another atmosphere model.
+/*!
+ *  Atmosphere model that interpolates a table, precomputed from another atmosphere model (e.g. NRLMSISE00). The table
+ *  is defined on a 4-dimensional grid in altitude, latitude, local solar time and time (see
+ *  PrecomputedAtmosphereGridSettings), on which the logarithm of density and pressure, as well as temperature and speed
+ *  of sound, are stored, and which is interpolated multi-linearly. Using local solar time instead of longitude as an
+ *  independent variable makes the variation of the atmosphere w.r.t. time (at a fixed local solar time) slow. The table
+ *  can be written to/read from a binary file (see createPrecomputedAtmosphere), so that it need only be generated once
+ *  for a series of simulations.
+ */
+class PrecomputedAtmosphere : public AtmosphereModel
+{
+public:
+
+    //! Constructor, from precomputed table.
+    /*!
+     *  Constructor, from precomputed table.
+     *  \param altitudes Altitude nodes of the table.
+     *  \param numberOfLatitudes Number of (equidistant) latitude nodes, from -90 to 90 degrees.
+     *  \param numberOfLocalSolarTimes Number of (equidistant) local solar time nodes, from 0 to 24 hours.
+     *  \param times Time nodes of the table.
+     *  \param tabulatedData Table of log of density, log of pressure, temperature and speed of sound, with indices in
+     *  order of altitude, latitude, local solar time and time.
+     *  \param maximumSampledRelativeDensityError Maximum relative density interpolation error, as found at check points.
+     *  \param boundaryHandling Method for interpolation behavior when altitude or time are out of range.
+     */
+    PrecomputedAtmosphere(
+            const std::vector< double >& altitudes,
+            const unsigned int numberOfLatitudes,
+            const unsigned int numberOfLocalSolarTimes,
+            const std::vector< double >& times,
+            const boost::multi_array< Eigen::Vector4d, 4 >& tabulatedData,
+            const double maximumSampledRelativeDensityError = TUDAT_NAN,
+            const interpolators::BoundaryInterpolationType boundaryHandling = interpolators::throw_exception_at_boundary );
+
+    //! Default destructor.
+    ~PrecomputedAtmosphere( ){ }
+
+    //! Get local density.
+    /*!
+     *  Returns the local density of the atmosphere, interpolated from the table.
+     *  \param altitude Altitude at which density is to be computed [m].
+     *  \param longitude Longitude at which density is to be computed [rad].
+     *  \param latitude Latitude at which density is to be computed [rad].
+     *  \param time Time at which density is to be computed (seconds since J2000).
+     *  \return Atmospheric density [kg/m^3].
+     */
+    double getDensity( const double altitude, const double longitude,
+                       const double latitude, const double time )
+    {
+        computeProperties( altitude, longitude, latitude, time );
+        return std::exp( currentProperties_( 0 ) );
+    }
+
+    //! Get local pressure.
+    /*!
+     *  Returns the local pressure of the atmosphere, interpolated from the table.
+     *  \param altitude Altitude at which pressure is to be computed [m].
+     *  \param longitude Longitude at which pressure is to be computed [rad].
+     *  \param latitude Latitude at which pressure is to be computed [rad].
+     *  \param time Time at which pressure is to be computed (seconds since J2000).
+     *  \return Atmospheric pressure [N/m^2].
+     */
+    double getPressure( const double altitude, const double longitude,
+                        const double latitude, const double time )
+    {
+        computeProperties( altitude, longitude, latitude, time );
+        return std::exp( currentProperties_( 1 ) );
+    }
+
+    //! Get local temperature.
+    /*!
+     *  Returns the local temperature of the atmosphere, interpolated from the table.
+     *  \param altitude Altitude at which temperature is to be computed [m].
+     *  \param longitude Longitude at which temperature is to be computed [rad].
+     *  \param latitude Latitude at which temperature is to be computed [rad].
+     *  \param time Time at which temperature is to be computed (seconds since J2000).
+     *  \return Atmospheric temperature [K].
+     */
+    double getTemperature( const double altitude, const double longitude,
+                           const double latitude, const double time )
+    {
+        computeProperties( altitude, longitude, latitude, time );
+        return currentProperties_( 2 );
+    }
+
+    //! Get local speed of sound.
+    /*!
+     *  Returns the local speed of sound of the atmosphere, interpolated from the table.
+     *  \param altitude Altitude at which speed of sound is to be computed [m].
+     *  \param longitude Longitude at which speed of sound is to be computed [rad].
+     *  \param latitude Latitude at which speed of sound is to be computed [rad].
+     *  \param time Time at which speed of sound is to be computed (seconds since J2000).
+     *  \return Speed of sound [m/s].
+     */
+    double getSpeedOfSound( const double altitude, const double longitude,
+                            const double latitude, const double time )
+    {
+        computeProperties( altitude, longitude, latitude, time );
+        return currentProperties_( 3 );
+    }
+
+    //! Function to retrieve the maximum relative density interpolation error found at the check points
+    /*!
+     *  Function to retrieve the maximum relative density interpolation error found at the check points, as determined by
+     *  comparing the interpolated density with that of the original atmosphere model at the centers of a set of
+     *  (pseudo-randomly selected) grid cells, directly after the table was generated. Note that this is the largest
+     *  error that was encountered at these sample points, and not a guaranteed bound on the interpolation error: the
+     *  error elsewhere in the table may be larger.
+     *  \return Maximum relative density interpolation error at check points.
+     */
+    double getMaximumSampledRelativeDensityError( )
+    {
+        return maximumSampledRelativeDensityError_;
+    }
+
+    //! Function to retrieve the altitude nodes of the table
+    /*!
+     *  Function to retrieve the altitude nodes of the table
+     *  \return Altitude nodes of the table
+     */
+    std::vector< double > getAltitudes( )
+    {
+        return independentValues_.at( 0 );
+    }
+
+    //! Function to retrieve the time nodes of the table
+    /*!
+     *  Function to retrieve the time nodes of the table
+     *  \return Time nodes of the table
+     */
+    std::vector< double > getTimes( )
+    {
+        return independentValues_.at( 3 );
+    }
+
+    //! Function to set the maximum relative density interpolation error found at the check points
+    /*!
+     *  Function to set the maximum relative density interpolation error found at the check points, as determined by
+     *  computePrecomputedAtmosphere.
+     *  \param maximumSampledRelativeDensityError Maximum relative density interpolation error at check points.
+     */
+    void setMaximumSampledRelativeDensityError( const double maximumSampledRelativeDensityError )
+    {
+        maximumSampledRelativeDensityError_ = maximumSampledRelativeDensityError;
+    }
+
+    //! Function to retrieve the table of log of density, log of pressure, temperature and speed of sound
+    /*!
+     *  Function to retrieve the table of log of density, log of pressure, temperature and speed of sound
+     *  \return Table of log of density, log of pressure, temperature and speed of sound
+     */
+    const boost::multi_array< Eigen::Vector4d, 4 >& getTabulatedData( )
+    {
+        return interpolator_->getDependentValues( );
+    }
+
+    //! Function to write the table to a binary file
+    /*!
+     *  Function to write the table to a binary file, which can be read by readPrecomputedAtmosphereFromFile. The table is
+     *  first written to a temporary file, which is renamed to fileName once complete, so that an interrupted write does
+     *  not leave a partial file.
+     *  \param fileName Name of the file to which the table is to be written
+     *  \param gridSettings Settings with which the table was generated, stored in the file header
+     *  \param baseModelFingerprint Fingerprint of the atmosphere model from which the table was generated (see
+     *  computeAtmosphereModelFingerprint), stored in the file header
+     */
+    void writeToFile( const std::string& fileName,
+                      const PrecomputedAtmosphereGridSettings& gridSettings,
+                      const uint64_t baseModelFingerprint );
+
+private:
+
+    //! Function to interpolate the table at the given position and time, if these have changed since the last call.
+    /*!
+     *  Function to interpolate the table at the given position and time, if these have changed since the last call.
+     *  \param altitude Altitude at which properties are to be computed [m].
+     *  \param longitude Longitude at which properties are to be computed [rad].
+     *  \param latitude Latitude at which properties are to be computed [rad].
+     *  \param time Time at which properties are to be computed (seconds since J2000).
+     */
+    void computeProperties( const double altitude, const double longitude,
+                            const double latitude, const double time );
+
+    //! Independent variables of table (altitude, latitude, local solar time, time)
+    std::vector< std::vector< double > > independentValues_;
+
+    //! Interpolator for table
+    std::shared_ptr< interpolators::MultiLinearInterpolator< double, Eigen::Vector4d, 4 > > interpolator_;
+
+    //! Maximum relative density interpolation error at check points.
+    double maximumSampledRelativeDensityError_;
+
+    //! Pre-allocated vector of independent variables at which interpolator is evaluated
+    std::vector< double > currentIndependentVariables_;
+
+    //! Altitude, longitude, latitude and time at last call of computeProperties
+    Eigen::Vector4d currentInput_;
+
+    //! Interpolated log of density, log of pressure, temperature and speed of sound at last call of computeProperties
+    Eigen::Vector4d currentProperties_;
+};
+
+//! Function to compute the maximum (log-linear) density interpolation error at the midpoint of an altitude interval.
+/*!
+ *  Function to compute the maximum relative error of log-linear density interpolation at the midpoint of an altitude
+ *  interval, over a set of reference points.
+ *  \param lowerLogDensities Log of density at lower altitude, at each of the reference points.
+ *  \param upperLogDensities Log of density at upper altitude, at each of the reference points.
+ *  \param midpointLogDensities Log of density at midpoint altitude, at each of the reference points.
+ *  \return Maximum relative density interpolation error
+ */
+double computeMaximumAltitudeIntervalDensityError(
+        const std::vector< double >& lowerLogDensities,
+        const std::vector< double >& upperLogDensities,
+        const std::vector< double >& midpointLogDensities );
+
+//! Function to adaptively refine an altitude interval, until the density interpolation error is below the tolerance.
+/*!
+ *  Function to adaptively refine an altitude interval by (recursive) bisection, until the density interpolation error at
+ *  the midpoint of each sub-interval is below the tolerance, or the minimum altitude step is reached.
+ *  \param lowerAltitude Lower altitude of interval.
+ *  \param upperAltitude Upper altitude of interval.
+ *  \param lowerLogDensities Log of density at lower altitude, at each of the reference points.
+ *  \param upperLogDensities Log of density at upper altitude, at each of the reference points.
+ *  \param logDensityFunction Function returning the log of density at each of the reference points, at given altitude.
+ *  \param gridSettings Settings for the grid of the table.
+ *  \param refinedAltitudes Altitude nodes, to which the upper altitudes of all sub-intervals are appended (returned by
+ *  reference).
+ */
+void refineAltitudeInterval(
+        const double lowerAltitude,
+        const double upperAltitude,
+        const std::vector< double >& lowerLogDensities,
+        const std::vector< double >& upperLogDensities,
+        const std::function< std::vector< double >( const double ) >& logDensityFunction,
+        const PrecomputedAtmosphereGridSettings& gridSettings,
+        std::vector< double >& refinedAltitudes );
+
+//! Function to compute a table of atmospheric properties from an atmosphere model.
+/*!
+ *  Function to compute a table of atmospheric properties from an atmosphere model, on a grid in altitude, latitude,
+ *  local solar time and time, with adaptive altitude node spacing (see PrecomputedAtmosphereGridSettings). After
+ *  generation of the table, the density interpolation error is checked w.r.t. the atmosphere model.
+ *  \param atmosphereModel Atmosphere model from which the table is to be computed
+ *  \param gridSettings Settings for the grid on which the table is to be computed
+ *  \param boundaryHandling Method for interpolation behavior when altitude or time are out of range.
+ *  \return Atmosphere model interpolating the table
+ */
+std::shared_ptr< PrecomputedAtmosphere > computePrecomputedAtmosphere(
+        const std::shared_ptr< AtmosphereModel > atmosphereModel,
+        const PrecomputedAtmosphereGridSettings& gridSettings,
+        const interpolators::BoundaryInterpolationType boundaryHandling = interpolators::throw_exception_at_boundary );
+
+//! Function to compute a fingerprint of an atmosphere model, used to identify the model from which a table was generated
+/*!
+ *  Function to compute a fingerprint of an atmosphere model, used to check whether a precomputed atmosphere file was
+ *  generated from the same atmosphere model (including its input, such as space weather data). The fingerprint is a
+ *  (64-bit FNV-1a) hash of the type of the model, and of the density, pressure and temperature that it returns at a
+ *  fixed set of points (minimum, middle and maximum altitude, three latitudes, two longitudes, and the start, middle and
+ *  end time of the grid). Models that differ in any of these values are identified as different.
+ *  \param atmosphereModel Atmosphere model for which the fingerprint is to be computed
+ *  \param gridSettings Settings for the grid on which the table is to be computed, defining the points at which the
+ *  model is evaluated
+ *  \return Fingerprint of the atmosphere model
+ */
+uint64_t computeAtmosphereModelFingerprint(
+        const std::shared_ptr< AtmosphereModel > atmosphereModel,
+        const PrecomputedAtmosphereGridSettings& gridSettings );
+
+//! Function to read a precomputed atmosphere table from a binary file
+/*!
+ *  Function to read a precomputed atmosphere table from a binary file, written by PrecomputedAtmosphere::writeToFile.
+ *  \param fileName Name of the file from which the table is to be read
+ *  \param gridSettings Settings of the requested grid. If the settings stored in the file are not consistent with
+ *  these settings, a nullptr is returned.
+ *  \param baseModelFingerprint Fingerprint of the atmosphere model from which the table is to have been generated (see
+ *  computeAtmosphereModelFingerprint). If the fingerprint stored in the file is different, a nullptr is returned.
+ *  \param boundaryHandling Method for interpolation behavior when altitude or time are out of range.
+ *  \return Atmosphere model interpolating the table (nullptr if file does not exist, was written with a different
+ *  version of the file format, or is not consistent with gridSettings and baseModelFingerprint)
+ */
+std::shared_ptr< PrecomputedAtmosphere > readPrecomputedAtmosphereFromFile(
+        const std::string& fileName,
+        const PrecomputedAtmosphereGridSettings& gridSettings,
+        const uint64_t baseModelFingerprint,
+        const interpolators::BoundaryInterpolationType boundaryHandling = interpolators::throw_exception_at_boundary );
+
+//! Function to create a precomputed atmosphere, using a table stored on disk if available.
+/*!
+ *  Function to create a precomputed atmosphere. If cacheFileName is non-empty and refers to a table file generated with
+ *  the same grid settings, from an atmosphere model with the same fingerprint (see computeAtmosphereModelFingerprint),
+ *  the table is read from this file. Otherwise, the table is computed from the atmosphere model, and (if cacheFileName
+ *  is non-empty) written to the file, replacing any existing file.
+ *  \param atmosphereModel Atmosphere model from which the table is to be computed
+ *  \param gridSettings Settings for the grid on which the table is to be computed
+ *  \param cacheFileName Name of the file in which the table is cached (no caching if empty)
+ *  \param boundaryHandling Method for interpolation behavior when altitude or time are out of range.
+ *  \return Atmosphere model interpolating the table
+ */
+std::shared_ptr< PrecomputedAtmosphere > createPrecomputedAtmosphere(
+        const std::shared_ptr< AtmosphereModel > atmosphereModel,
+        const PrecomputedAtmosphereGridSettings& gridSettings,
+        const std::string& cacheFileName = "",
+        const interpolators::BoundaryInterpolationType boundaryHandling = interpolators::throw_exception_at_boundary );
+
+} // namespace aerodynamics
+
+} // namespace tudat
+
+#endif // TUDAT_PRECOMPUTED_ATMOSPHERE_H
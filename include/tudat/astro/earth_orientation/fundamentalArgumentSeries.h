@@ -0,0 +1,309 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_FUNDAMENTALARGUMENTSERIES_H
+#define TUDAT_FUNDAMENTALARGUMENTSERIES_H
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/basics/basicTypedefs.h"
+
+namespace tudat
+{
+
+namespace earth_orientation
+{
+
+//! Class to evaluate a series of periodic terms, with phases that are linear combinations of fundamental arguments
+/*!
+ *  Class to evaluate a series of periodic terms, with phases that are linear combinations of six fundamental arguments
+ *  (typically the Delaunay arguments and GMST), as used for short-period Earth orientation corrections. Each term j
+ *  contributes S_j * sin( phi_j ) + C_j * cos( phi_j ) to each of the NumberOfComponents outputs, with
+ *  phi_j = sum_k m_{jk} theta_k.
+ *
+ *  The terms are stored in structure-of-arrays layout (one contiguous array per fundamental argument multiplier). If all
+ *  multipliers are (small) integers, the sine and cosine of each phase are obtained from products of precomputed powers
+ *  of exp( i theta_k ), computed by angle-addition recurrences, so that only six sine and cosine evaluations are needed
+ *  per epoch, irrespective of the number of terms. Otherwise, the sine and cosine of each phase are evaluated directly.
+ *
+ *  The sines and cosines of the phases are stored in (mutable) member vectors, allocated once in the constructor, so an
+ *  object should not be evaluated concurrently from multiple threads.
+ */
+template< int NumberOfComponents >
+class FundamentalArgumentSeries
+{
+public:
+
+    //! Typedef for output of a single series evaluation
+    typedef Eigen::Matrix< double, NumberOfComponents, 1 > OutputVector;
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param argumentAmplitudes List of amplitude matrices, one term per row, with columns: sine and cosine amplitude of
+     *  first component, sine and cosine amplitude of second component, etc. Only the first 2 * NumberOfComponents columns
+     *  are used, any additional columns are ignored.
+     *  \param argumentMultipliers List of fundamental argument multiplier matrices (one term per row, six columns), with
+     *  same number of rows as the associated entry of argumentAmplitudes.
+     */
+    FundamentalArgumentSeries(
+            const std::vector< Eigen::MatrixXd >& argumentAmplitudes,
+            const std::vector< Eigen::MatrixXd >& argumentMultipliers )
+    {
+        if( argumentAmplitudes.size( ) != argumentMultipliers.size( ) )
+        {
+            throw std::runtime_error( "Error when creating fundamental argument series, input size is inconsistent" );
+        }
+
+        // Count terms, and check input consistency
+        int numberOfTerms = 0;
+        for( unsigned int i = 0; i < argumentAmplitudes.size( ); i++ )
+        {
+            if( argumentAmplitudes.at( i ).rows( ) != argumentMultipliers.at( i ).rows( ) ||
+                    argumentAmplitudes.at( i ).cols( ) < 2 * NumberOfComponents ||
+                    argumentMultipliers.at( i ).cols( ) != 6 )
+            {
+                throw std::runtime_error( "Error when creating fundamental argument series, input matrix size is inconsistent" );
+            }
+            numberOfTerms += argumentAmplitudes.at( i ).rows( );
+        }
+
+        // Merge all terms into single set of arrays
+        argumentMultipliers_.resize( numberOfTerms, 6 );
+        sineAmplitudes_.resize( NumberOfComponents, numberOfTerms );
+        cosineAmplitudes_.resize( NumberOfComponents, numberOfTerms );
+        int currentTerm = 0;
+        for( unsigned int i = 0; i < argumentAmplitudes.size( ); i++ )
+        {
+            const Eigen::MatrixXd usedAmplitudes = argumentAmplitudes.at( i ).leftCols( 2 * NumberOfComponents );
+            for( int j = 0; j < usedAmplitudes.rows( ); j++ )
+            {
+                argumentMultipliers_.row( currentTerm ) = argumentMultipliers.at( i ).row( j );
+                for( int k = 0; k < NumberOfComponents; k++ )
+                {
+                    sineAmplitudes_( k, currentTerm ) = usedAmplitudes( j, 2 * k );
+                    cosineAmplitudes_( k, currentTerm ) = usedAmplitudes( j, 2 * k + 1 );
+                }
+                currentTerm++;
+            }
+        }
+        cosinePhases_.resize( numberOfTerms );
+        sinePhases_.resize( numberOfTerms );
+
+        // Check if recurrence-based evaluation can be used
+        useRecurrences_ = true;
+        maximumMultiplier_ = 0;
+        for( int k = 0; k < 6; k++ )
+        {
+            bool isArgumentUsed = false;
+            for( int j = 0; j < numberOfTerms; j++ )
+            {
+                double currentMultiplier = argumentMultipliers_( j, k );
+                if( currentMultiplier != std::round( currentMultiplier ) ||
+                        std::fabs( currentMultiplier ) > maximumRecurrenceMultiplier_ )
+                {
+                    useRecurrences_ = false;
+                }
+                else if( currentMultiplier != 0.0 )
+                {
+                    isArgumentUsed = true;
+                    maximumMultiplier_ = std::max( maximumMultiplier_, static_cast< int >( std::fabs( currentMultiplier ) ) );
+                }
+            }
+
+            if( isArgumentUsed )
+            {
+                usedArguments_.push_back( k );
+            }
+        }
+
+        if( useRecurrences_ )
+        {
+            integerArgumentMultipliers_ = argumentMultipliers_.cast< int >( );
+            for( int k = 0; k < 6; k++ )
+            {
+                integerArgumentMultipliers_.col( k ).array( ) += maximumMultiplier_;
+            }
+        }
+    }
+
+    //! Function to evaluate the series at a single epoch
+    /*!
+     *  Function to evaluate the series at a single epoch
+     *  \param fundamentalArguments Values of fundamental arguments at which series is to be evaluated
+     *  \return Sum of all series terms
+     */
+    OutputVector evaluate( const Eigen::Vector6d& fundamentalArguments ) const
+    {
+        computePhases( fundamentalArguments );
+        return sumTerms( );
+    }
+
+    //! Function to evaluate the series at a set of epochs
+    /*!
+     *  Function to evaluate the series at a set of epochs
+     *  \param fundamentalArguments Values of fundamental arguments at which series is to be evaluated, one epoch per column
+     *  \return Sum of all series terms, one epoch per column
+     */
+    Eigen::Matrix< double, NumberOfComponents, Eigen::Dynamic > evaluate(
+            const Eigen::Matrix< double, 6, Eigen::Dynamic >& fundamentalArguments ) const
+    {
+        Eigen::Matrix< double, NumberOfComponents, Eigen::Dynamic > seriesValues(
+                    NumberOfComponents, fundamentalArguments.cols( ) );
+        for( int i = 0; i < fundamentalArguments.cols( ); i++ )
+        {
+            computePhases( fundamentalArguments.col( i ) );
+            seriesValues.col( i ) = sumTerms( );
+        }
+        return seriesValues;
+    }
+
+    //! Function to retrieve the number of terms in the series
+    int getNumberOfTerms( ) const
+    {
+        return static_cast< int >( argumentMultipliers_.rows( ) );
+    }
+
+    //! Function to retrieve whether the phases are computed from angle-addition recurrences
+    bool getUseRecurrences( ) const
+    {
+        return useRecurrences_;
+    }
+
+private:
+
+    //! Function to sum all terms, from the sines and cosines of their phases (summed term by term)
+    /*!
+     *  Function to sum all terms, from the sines and cosines of their phases (summed term by term), as set by the last
+     *  call to computePhases
+     *  \return Sum of all series terms
+     */
+    OutputVector sumTerms( ) const
+    {
+        OutputVector seriesValue = OutputVector::Zero( );
+        for( int j = 0; j < sinePhases_.rows( ); j++ )
+        {
+            seriesValue += sineAmplitudes_.col( j ) * sinePhases_( j ) + cosineAmplitudes_.col( j ) * cosinePhases_( j );
+        }
+        return seriesValue;
+    }
+
+    //! Function to compute the sine and cosine of the phases of all terms
+    /*!
+     *  Function to compute the sine and cosine of the phases of all terms, which are set in the cosinePhases_ and
+     *  sinePhases_ members
+     *  \param fundamentalArguments Values of fundamental arguments at which phases are to be computed
+     */
+    void computePhases( const Eigen::Vector6d& fundamentalArguments ) const
+    {
+        const int numberOfTerms = static_cast< int >( argumentMultipliers_.rows( ) );
+        if( useRecurrences_ )
+        {
+            // Compute cos( m theta_k ) and sin( m theta_k ) for m = -M..M by recurrence (fixed-size, on the stack)
+            Eigen::Matrix< double, maximumPowerTableRows_, 6 > argumentPowersCosine;
+            Eigen::Matrix< double, maximumPowerTableRows_, 6 > argumentPowersSine;
+            for( unsigned int k = 0; k < usedArguments_.size( ); k++ )
+            {
+                const int currentArgument = usedArguments_.at( k );
+                const double cosineArgument = std::cos( fundamentalArguments( currentArgument ) );
+                const double sineArgument = std::sin( fundamentalArguments( currentArgument ) );
+                argumentPowersCosine( maximumMultiplier_, currentArgument ) = 1.0;
+                argumentPowersSine( maximumMultiplier_, currentArgument ) = 0.0;
+                for( int m = 1; m <= maximumMultiplier_; m++ )
+                {
+                    const double previousCosine = argumentPowersCosine( maximumMultiplier_ + m - 1, currentArgument );
+                    const double previousSine = argumentPowersSine( maximumMultiplier_ + m - 1, currentArgument );
+                    argumentPowersCosine( maximumMultiplier_ + m, currentArgument ) =
+                            previousCosine * cosineArgument - previousSine * sineArgument;
+                    argumentPowersSine( maximumMultiplier_ + m, currentArgument ) =
+                            previousSine * cosineArgument + previousCosine * sineArgument;
+                    argumentPowersCosine( maximumMultiplier_ - m, currentArgument ) =
+                            argumentPowersCosine( maximumMultiplier_ + m, currentArgument );
+                    argumentPowersSine( maximumMultiplier_ - m, currentArgument ) =
+                            -argumentPowersSine( maximumMultiplier_ + m, currentArgument );
+                }
+            }
+
+            // Multiply exp( i m_{jk} theta_k ) for all used arguments, per argument over all terms
+            cosinePhases_.setOnes( );
+            sinePhases_.setZero( );
+            double* cosinePhaseData = cosinePhases_.data( );
+            double* sinePhaseData = sinePhases_.data( );
+            for( unsigned int k = 0; k < usedArguments_.size( ); k++ )
+            {
+                const int currentArgument = usedArguments_.at( k );
+                const int* multiplierIndices = integerArgumentMultipliers_.col( currentArgument ).data( );
+                const double* cosinePowers = argumentPowersCosine.col( currentArgument ).data( );
+                const double* sinePowers = argumentPowersSine.col( currentArgument ).data( );
+                for( int j = 0; j < numberOfTerms; j++ )
+                {
+                    const double cosineFactor = cosinePowers[ multiplierIndices[ j ] ];
+                    const double sineFactor = sinePowers[ multiplierIndices[ j ] ];
+                    const double newCosine = cosinePhaseData[ j ] * cosineFactor - sinePhaseData[ j ] * sineFactor;
+                    sinePhaseData[ j ] = sinePhaseData[ j ] * cosineFactor + cosinePhaseData[ j ] * sineFactor;
+                    cosinePhaseData[ j ] = newCosine;
+                }
+            }
+        }
+        else
+        {
+            cosinePhases_.noalias( ) = argumentMultipliers_ * fundamentalArguments;
+            for( int j = 0; j < numberOfTerms; j++ )
+            {
+                sinePhases_( j ) = std::sin( cosinePhases_( j ) );
+                cosinePhases_( j ) = std::cos( cosinePhases_( j ) );
+            }
+        }
+    }
+
+    //! Maximum absolute value of integer multiplier for which recurrences are used
+    static constexpr double maximumRecurrenceMultiplier_ = 16.0;
+
+    //! Number of rows of (stack-allocated) tables of cos( m theta_k ) and sin( m theta_k ), for m = -16..16
+    static constexpr int maximumPowerTableRows_ = 2 * static_cast< int >( maximumRecurrenceMultiplier_ ) + 1;
+
+    //! Fundamental argument multipliers (one term per row, stored column-major, so one contiguous array per argument)
+    Eigen::Matrix< double, Eigen::Dynamic, 6 > argumentMultipliers_;
+
+    //! Fundamental argument multipliers, offset by maximumMultiplier_, for use as index into argumentPowers tables
+    Eigen::Matrix< int, Eigen::Dynamic, 6 > integerArgumentMultipliers_;
+
+    //! Sine amplitudes (one term per column)
+    Eigen::Matrix< double, NumberOfComponents, Eigen::Dynamic > sineAmplitudes_;
+
+    //! Cosine amplitudes (one term per column)
+    Eigen::Matrix< double, NumberOfComponents, Eigen::Dynamic > cosineAmplitudes_;
+
+    //! Boolean denoting whether all multipliers are integers, so that recurrences are used to compute the phases
+    bool useRecurrences_;
+
+    //! Maximum absolute value of multiplier in series
+    int maximumMultiplier_;
+
+    //! Indices of fundamental arguments that have a non-zero multiplier for at least one term
+    std::vector< int > usedArguments_;
+
+    //! Cosines of the phases of all terms, as computed by last call to computePhases
+    mutable Eigen::VectorXd cosinePhases_;
+
+    //! Sines of the phases of all terms, as computed by last call to computePhases
+    mutable Eigen::VectorXd sinePhases_;
+};
+
+} // namespace earth_orientation
+
+} // namespace tudat
+
+#endif // TUDAT_FUNDAMENTALARGUMENTSERIES_H
@@ -26,6 +26,7 @@
 #include "tudat/astro/basic_astro/unitConversions.h"
 #include "tudat/astro/basic_astro/timeConversions.h"
 #include "tudat/astro/earth_orientation/readAmplitudeAndArgumentMultipliers.h"
+#include "tudat/astro/earth_orientation/fundamentalArgumentSeries.h"
 
 #include "tudat/interface/sofa/fundamentalArguments.h"
 #include "tudat/io/basicInputOutput.h"
@@ -38,6 +39,22 @@ namespace tudat
 namespace earth_orientation
 {
 
+//! Number of components of short period Earth orientation correction, as function of output type
+template< typename OutputType >
+struct ShortPeriodCorrectionSize;
+
+template< >
+struct ShortPeriodCorrectionSize< double >
+{
+    static const int value = 1;
+};
+
+template< >
+struct ShortPeriodCorrectionSize< Eigen::Vector2d >
+{
+    static const int value = 2;
+};
+
 //! Object to calculate the short period variations in Earth orientaion parameters
 /*!
  *  Object to calculate the short period  variations in Earth orientaion parameters, e.g. taking into account
@@ -75,14 +92,18 @@ public:
         }
 
         // Read data from files
+        std::vector< Eigen::MatrixXd > argumentAmplitudes;
+        std::vector< Eigen::MatrixXd > argumentMultipliers;
         std::pair< Eigen::MatrixXd, Eigen::MatrixXd > dataFromFile;
         for( unsigned int i = 0; i < amplitudesFiles.size( ); i++ )
         {
             dataFromFile = readAmplitudesAndFundamentalArgumentMultipliers(
                         amplitudesFiles.at( i ), argumentMultipliersFile.at( i ), minimumAmplitude );
-            argumentAmplitudes_.push_back( conversionFactor * dataFromFile.first );
-            argumentMultipliers_.push_back( dataFromFile.second );
+            argumentAmplitudes.push_back( conversionFactor * dataFromFile.first );
+            argumentMultipliers.push_back( dataFromFile.second );
         }
+        correctionSeries_ = std::make_shared< FundamentalArgumentSeries< ShortPeriodCorrectionSize< OutputType >::value > >(
+                    argumentAmplitudes, argumentMultipliers );
 
         if( shortTermInterpolatorSettings != nullptr )
         {
@@ -128,6 +149,42 @@ public:
         return sumCorrectionTerms( fundamentalArguments );
     }
 
+    //! Function to obtain short period corrections at a set of epochs.
+    /*!
+     *  Function to obtain short period corrections at a set of epochs. If no interpolator is used, the fundamental arguments
+     *  for all epochs are computed first, after which the correction series is evaluated for all epochs at once.
+     *  \param ephemerisTimes Times (TDB seconds since J2000) at which corretions are to be determined
+     *  \return Short period corrections, one entry per input time
+     */
+    std::vector< OutputType > getCorrectionsAtEpochs( const std::vector< double >& ephemerisTimes )
+    {
+        std::vector< OutputType > corrections;
+        corrections.reserve( ephemerisTimes.size( ) );
+        if( correctionInterpolator_ == nullptr )
+        {
+            Eigen::Matrix< double, 6, Eigen::Dynamic > fundamentalArguments( 6, ephemerisTimes.size( ) );
+            for( unsigned int i = 0; i < ephemerisTimes.size( ); i++ )
+            {
+                fundamentalArguments.col( i ) = argumentFunction_( ephemerisTimes.at( i ) );
+            }
+
+            Eigen::Matrix< double, ShortPeriodCorrectionSize< OutputType >::value, Eigen::Dynamic > correctionValues =
+                    correctionSeries_->evaluate( fundamentalArguments );
+            for( unsigned int i = 0; i < ephemerisTimes.size( ); i++ )
+            {
+                corrections.push_back( convertSeriesOutput( correctionValues.col( i ) ) );
+            }
+        }
+        else
+        {
+            for( unsigned int i = 0; i < ephemerisTimes.size( ); i++ )
+            {
+                corrections.push_back( correctionInterpolator_->interpolate( ephemerisTimes.at( i ) ) );
+            }
+        }
+        return corrections;
+    }
+
 private:
 
     //! Function to sum all the corrcetion terms.
@@ -136,13 +193,17 @@ private:
      * \param arguments Values of fundamental arguments
      * \return Total correction at current fundamental arguments
      */
-    OutputType sumCorrectionTerms( const Eigen::Vector6d& arguments );
+    OutputType sumCorrectionTerms( const Eigen::Vector6d& arguments )
+    {
+        return convertSeriesOutput( correctionSeries_->evaluate( arguments ) );
+    }
 
-    //! Amplitudes of libration-induced variations
-    std::vector< Eigen::MatrixXd > argumentAmplitudes_;
+    //! Function to convert output of correctionSeries_ for a single epoch to OutputType
+    OutputType convertSeriesOutput(
+            const Eigen::Matrix< double, ShortPeriodCorrectionSize< OutputType >::value, 1 >& seriesOutput );
 
-    //! Fundamental argument multipliers of libration-induced variations.
-    std::vector< Eigen::MatrixXd > argumentMultipliers_;
+    //! Series of correction terms (libration and/or ocean tide-induced variations)
+    std::shared_ptr< FundamentalArgumentSeries< ShortPeriodCorrectionSize< OutputType >::value > > correctionSeries_;
 
     //! Fundamental argument functions associated with multipliers.
     std::function< Eigen::Vector6d( const double ) > argumentFunction_;
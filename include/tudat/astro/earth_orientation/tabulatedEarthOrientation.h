@@ -0,0 +1,267 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_TABULATEDEARTHORIENTATION_H
+#define TUDAT_TABULATEDEARTHORIENTATION_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <Eigen/Core>
+
+#include "tudat/basics/basicTypedefs.h"
+#include "tudat/astro/basic_astro/timeConversions.h"
+#include "tudat/astro/earth_orientation/earthOrientationCalculator.h"
+
+namespace tudat
+{
+
+namespace earth_orientation
+{
+
+//! Version of the binary Earth orientation table file format written by this version of Tudat
+const uint32_t EARTH_ORIENTATION_TABLE_FILE_VERSION = 2;
+
+//! Number of quantities stored per epoch in an Earth orientation table: X, Y, s, x_p, y_p, UT1 minus input time.
+const uint32_t EARTH_ORIENTATION_TABLE_NUMBER_OF_COLUMNS = 6;
+
+//! Header of binary Earth orientation table file.
+/*!
+ *  Header of binary Earth orientation table file. The header is followed directly by the table entries, stored as
+ *  numberOfEpochs_ rows of numberOfColumns_ doubles (row-major), for equidistant epochs startTime_ + i * timeStep_.
+ */
+struct EarthOrientationTableHeader
+{
+    //! File identifier, must be equal to "TUDATEOT"
+    char fileIdentifier_[ 8 ];
+
+    //! Version of the file format
+    uint32_t fileVersion_;
+
+    //! Marker used to detect files written on a machine with different byte order
+    uint32_t byteOrderMarker_;
+
+    //! Time scale (as TimeScales enum) of the independent variable of the table
+    uint32_t timeScale_;
+
+    //! Precession-nutation theory (as IAUConventions enum) with which the table was generated
+    uint32_t precessionNutationTheory_;
+
+    //! Number of quantities stored per epoch
+    uint32_t numberOfColumns_;
+
+    //! Number of points used for Lagrange interpolation of the table
+    uint32_t numberOfInterpolationPoints_;
+
+    //! Number of epochs in the table
+    uint64_t numberOfEpochs_;
+
+    //! First epoch of the table (in seconds since J2000 in timeScale_)
+    double startTime_;
+
+    //! Constant time step between subsequent epochs of the table
+    double timeStep_;
+
+    //! Fingerprint of the daily EOP values (polar motion, nutation corrections, UT1-UTC) with which the table was generated
+    uint64_t eopDataFingerprint_;
+
+    //! Fingerprint of the short-period polar motion and UT1 corrections with which the table was generated
+    uint64_t shortPeriodCorrectionsFingerprint_;
+};
+
+//! Function to compute fingerprints of the EOP data and short-period corrections used by an Earth orientation calculator
+/*!
+ *  Function to compute fingerprints of the EOP data and short-period corrections used by an Earth orientation calculator,
+ *  used to check whether an Earth orientation table was generated with the same settings as a given calculator. The
+ *  fingerprints are (64-bit FNV-1a) hashes of the values of the daily EOP interpolators (polar motion, nutation corrections
+ *  and UT1-UTC, sampled at most daily) and of the short-period polar motion and UT1 corrections (sampled at 101 epochs),
+ *  evaluated at equidistant epochs over the given interval.
+ *  \param earthOrientationCalculator Object used to compute the Earth orientation
+ *  \param intervalStart Start of the interval over which the calculator is sampled
+ *  \param intervalEnd End of the interval over which the calculator is sampled
+ *  \return Fingerprint of the daily EOP values (first) and of the short-period corrections (second)
+ */
+std::pair< uint64_t, uint64_t > computeEarthOrientationTableFingerprints(
+        const std::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator,
+        const double intervalStart,
+        const double intervalEnd );
+
+//! Function to compute an Earth orientation table and write it to a binary file.
+/*!
+ *  Function to compute an Earth orientation table and write it to a binary file, which can subsequently be loaded (memory-mapped)
+ *  by the TabulatedEarthOrientationAngles class. For each epoch, the values of X, Y, s, x_p, y_p (see
+ *  EarthOrientationAnglesCalculator::getRotationAnglesFromItrsToGcrs) and UT1 minus the epoch are stored, including all
+ *  (sub-)diurnal corrections applied by the earthOrientationCalculator. Fingerprints of the EOP data and short-period
+ *  corrections of the earthOrientationCalculator (see computeEarthOrientationTableFingerprints) are stored in the header.
+ *  \param fileName Name of the file to which the table is to be written
+ *  \param earthOrientationCalculator Object used to compute the Earth orientation
+ *  \param intervalStart First epoch of the table
+ *  \param intervalEnd Epoch up to which the table is to be computed (last table epoch is at or beyond this epoch)
+ *  \param timeStep Time step between table epochs
+ *  \param timeScale Time scale in which table epochs (and input to the table at run time) are defined
+ *  \param numberOfInterpolationPoints Number of points to use for Lagrange interpolation of the table (must be even)
+ */
+void writeEarthOrientationTableToFile(
+        const std::string& fileName,
+        const std::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator,
+        const double intervalStart,
+        const double intervalEnd,
+        const double timeStep,
+        const basic_astrodynamics::TimeScales timeScale = basic_astrodynamics::tdb_scale,
+        const unsigned int numberOfInterpolationPoints = 8 );
+
+//! Class providing Earth orientation angles and UT1 from a precomputed, memory-mapped, table
+/*!
+ *  Class providing Earth orientation angles and UT1 from a precomputed table, as written by writeEarthOrientationTableToFile.
+ *  The file is memory-mapped (read-only), so that the table data is loaded on demand, and is shared between all processes
+ *  using the same file. Values are obtained by Lagrange interpolation on the equidistant table grid, with the interval
+ *  index computed directly from the input time. The class holds no mutable state, and may be used concurrently.
+ */
+class TabulatedEarthOrientationAngles
+{
+public:
+
+    //! Constructor, maps the table file into memory and checks its consistency.
+    /*!
+     *  Constructor, maps the table file into memory and checks its consistency.
+     *  \param fileName Name of the file containing the Earth orientation table
+     */
+    TabulatedEarthOrientationAngles( const std::string& fileName );
+
+    //! Calculate rotation angles from ITRS to GCRS at given time value.
+    /*!
+     *  Calculate rotation angles from ITRS to GCRS at given time value, by interpolating the table. Input time must be
+     *  in the time scale of the table.
+     *  \param timeValue Number of seconds since J2000 at which orientation is to be evaluated.
+     *  \return Rotation angles for ITRS<->GCRS transformation at given epoch. First pair entry is: X, Y, s, x_p, y_p. Second
+     *  defines UT1.
+     */
+    template< typename TimeType >
+    std::pair< Eigen::Vector5d, TimeType > getRotationAnglesFromItrsToGcrs( const TimeType timeValue ) const
+    {
+        Eigen::Vector6d interpolatedEntries = interpolateTableEntries( static_cast< double >( timeValue ) );
+        return std::make_pair( interpolatedEntries.segment< 5 >( 0 ), timeValue + interpolatedEntries( 5 ) );
+    }
+
+    //! Function to retrieve the first epoch at which the table can be evaluated
+    double getStartTime( ) const
+    {
+        return header_.startTime_;
+    }
+
+    //! Function to retrieve the last epoch at which the table can be evaluated
+    double getEndTime( ) const
+    {
+        return header_.startTime_ + static_cast< double >( header_.numberOfEpochs_ - 1 ) * header_.timeStep_;
+    }
+
+    //! Function to retrieve the time step between table epochs
+    double getTimeStep( ) const
+    {
+        return header_.timeStep_;
+    }
+
+    //! Function to retrieve the number of epochs in the table
+    uint64_t getNumberOfEpochs( ) const
+    {
+        return header_.numberOfEpochs_;
+    }
+
+    //! Function to retrieve the time scale of the independent variable of the table
+    basic_astrodynamics::TimeScales getTimeScale( ) const
+    {
+        return static_cast< basic_astrodynamics::TimeScales >( header_.timeScale_ );
+    }
+
+    //! Function to retrieve the precession-nutation theory with which the table was generated
+    basic_astrodynamics::IAUConventions getPrecessionNutationTheory( ) const
+    {
+        return static_cast< basic_astrodynamics::IAUConventions >( header_.precessionNutationTheory_ );
+    }
+
+    //! Function to retrieve the fingerprint of the daily EOP values with which the table was generated
+    uint64_t getEopDataFingerprint( ) const
+    {
+        return header_.eopDataFingerprint_;
+    }
+
+    //! Function to retrieve the fingerprint of the short-period corrections with which the table was generated
+    uint64_t getShortPeriodCorrectionsFingerprint( ) const
+    {
+        return header_.shortPeriodCorrectionsFingerprint_;
+    }
+
+    //! Function to retrieve the name of the file containing the table
+    std::string getFileName( ) const
+    {
+        return fileName_;
+    }
+
+private:
+
+    //! Function to interpolate all table entries (X, Y, s, x_p, y_p, UT1 minus time) at given time
+    Eigen::Vector6d interpolateTableEntries( const double time ) const;
+
+    //! Name of the file containing the table
+    std::string fileName_;
+
+    //! Memory-mapped file containing the table
+    boost::interprocess::file_mapping fileMapping_;
+
+    //! Mapped region of fileMapping_, covering the full file
+    boost::interprocess::mapped_region mappedRegion_;
+
+    //! Copy of header of the table file
+    EarthOrientationTableHeader header_;
+
+    //! Pointer to first table entry in mapped memory
+    const double* tableEntries_;
+
+    //! Inverse of time step between table epochs
+    double inverseTimeStep_;
+
+    //! Lagrange interpolation denominators for the (equidistant) interpolation nodes
+    std::vector< double > lagrangeWeightDenominators_;
+};
+
+//! Function to retrieve the Earth orientation table from a given file
+/*!
+ *  Function to retrieve the Earth orientation table from a given file. If the same file has already been loaded (and the
+ *  table object is still in use), the existing object is returned, so that the file is mapped only once per process.
+ *  \param fileName Name of the file containing the Earth orientation table
+ *  \return Earth orientation table loaded from the file
+ */
+std::shared_ptr< TabulatedEarthOrientationAngles > getTabulatedEarthOrientationAngles( const std::string& fileName );
+
+//! Function to compute the maximum difference between tabulated and directly computed Earth orientation
+/*!
+ *  Function to compute the maximum difference between tabulated and directly computed Earth orientation, at a set of test
+ *  epochs (typically in between table nodes).
+ *  \param tabulatedEarthOrientation Earth orientation table that is to be checked
+ *  \param earthOrientationCalculator Object used to directly compute the Earth orientation
+ *  \param testTimes Epochs (in the time scale of the table) at which the comparison is to be made
+ *  \return Maximum absolute differences for X, Y, s, x_p, y_p (in radians) and UT1 (in seconds)
+ */
+Eigen::Vector6d computeMaximumEarthOrientationTableErrors(
+        const std::shared_ptr< TabulatedEarthOrientationAngles > tabulatedEarthOrientation,
+        const std::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator,
+        const std::vector< double >& testTimes );
+
+} // namespace earth_orientation
+
+} // namespace tudat
+
+#endif // TUDAT_TABULATEDEARTHORIENTATION_H
@@ -397,6 +397,12 @@ public:
         return dailyUtcUt1CorrectionInterpolator_;
     }
 
+    //! Function to retrieve object calculating short period UT1 variations
+    std::shared_ptr< ShortPeriodEarthOrientationCorrectionCalculator< double > > getShortPeriodUt1CorrectionCalculator( )
+    {
+        return shortPeriodUt1CorrectionCalculator_;
+    }
+
 private:
 
     double getTDBminusTT( const double ttOrTdbSinceJ2000, const Eigen::Vector3d earthFixedPosition )
@@ -123,7 +123,8 @@ public:
 
 /*!
  * Occultation model with a single occulting body. This evaluates the standard shadow function. The occulting body
- * shape is approximated as sphere of its actual shape model's average radius.
+ * shape is approximated as sphere of its actual shape model's average radius. The full shadow function is only
+ * evaluated if the target is inside the penumbra cone of the occulting body (see isPointOutsidePenumbraCone()).
  */
 class SingleOccultingBodyOccultationModel : public OccultationModel
 {
@@ -158,7 +159,8 @@ private:
  * occulting body. For non-concurrent occultations, this class behaves as expected. Multiple concurrent occultations of
  * extended sources may result in overestimated occultation (i.e. underestimated received irradiance and thus radiation
  * pressure). Occultation of multiple point sources is always handled correctly. The occulting body shapes are
- * approximated as spheres of their actual shape models' average radius.
+ * approximated as spheres of their actual shape models' average radius. As for the single occulting body, the shadow
+ * function of an occulting body is only evaluated if the target is inside its penumbra cone.
  */
 class SimpleMultipleOccultingBodyOccultationModel : public OccultationModel
 {
@@ -208,6 +210,27 @@ bool evaluatePointToPointVisibilityWithOccultation(
         double occultingBodyRadius,
         const Eigen::Vector3d& targetPosition);
 
+/*!
+ * Evaluate whether a target is outside the penumbra cone of a spherical occulting body, illuminated by a spherical
+ * source. The penumbra cone is bounded by the lines that are tangent to both spheres and cross the axis between them.
+ * A target outside of this cone, or in front of the occulting body as seen from the source, sees the entire source
+ * (i.e. the shadow function is 1). This check only requires a few dot products, and is used to avoid evaluating the
+ * full shadow function for targets that are trivially illuminated.
+ *
+ * @param occultedSourcePosition Position of the occulted source in global coordinates
+ * @param occultedSourceRadius Radius of the occulted source
+ * @param occultingBodyPosition Position of the occulting body in global coordinates
+ * @param occultingBodyRadius Radius of the occulting body
+ * @param targetPosition Position of the target in global coordinates
+ * @return Whether the target is outside the penumbra cone
+ */
+bool isPointOutsidePenumbraCone(
+        const Eigen::Vector3d& occultedSourcePosition,
+        double occultedSourceRadius,
+        const Eigen::Vector3d& occultingBodyPosition,
+        double occultingBodyRadius,
+        const Eigen::Vector3d& targetPosition);
+
 } // electromagnetism
 } // tudat
 
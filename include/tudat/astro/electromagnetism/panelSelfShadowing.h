@@ -0,0 +1,242 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PANELSELFSHADOWING_H
+#define TUDAT_PANELSELFSHADOWING_H
+
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/system_models/vehicleExteriorPanels.h"
+
+
+namespace tudat
+{
+namespace electromagnetism
+{
+
+/*!
+ * Bounding volume hierarchy (BVH) of the panels of a vehicle, used to efficiently determine whether a ray is blocked by
+ * any of the panels. For the purpose of the intersection tests, each panel is represented by a flat disk with the
+ * centroid and surface normal of the panel (panels are shadowed and can shadow from both sides). A ray that passes
+ * exactly through the edge of a disk is not blocked.
+ *
+ * The hierarchy is a binary tree of axis-aligned bounding boxes, constructed by recursively splitting the panels at the
+ * median of their centroids along the axis of largest extent.
+ */
+class PanelBoundingVolumeHierarchy
+{
+public:
+
+    /*!
+     * Constructor.
+     *
+     * @param panelCentroids Centroids of the panels
+     * @param panelNormals Unit surface normals of the panels
+     * @param panelRadii Radii of the disks representing the panels
+     * @param maximumNumberOfPanelsPerLeaf Maximum number of panels in a leaf node of the hierarchy
+     */
+    PanelBoundingVolumeHierarchy(
+            const std::vector< Eigen::Vector3d >& panelCentroids,
+            const std::vector< Eigen::Vector3d >& panelNormals,
+            const std::vector< double >& panelRadii,
+            const unsigned int maximumNumberOfPanelsPerLeaf = 2 );
+
+    /*!
+     * Function to determine whether a ray intersects any of the panels (other than the panel from which it originates).
+     *
+     * @param rayOrigin Origin of the ray
+     * @param rayDirection Unit vector along the ray
+     * @param originPanelIndex Index of the panel from which the ray originates, which is excluded from the test
+     * (set to -1 to test all panels)
+     * @return True if the ray intersects any of the (other) panels at a positive distance from its origin
+     */
+    bool isRayBlocked(
+            const Eigen::Vector3d& rayOrigin,
+            const Eigen::Vector3d& rayDirection,
+            const int originPanelIndex = -1 ) const;
+
+    unsigned int getNumberOfNodes( ) const
+    {
+        return nodes_.size( );
+    }
+
+    unsigned int getNumberOfPanels( ) const
+    {
+        return panelCentroids_.size( );
+    }
+
+private:
+
+    //! Node of the hierarchy, containing either two child nodes or (for a leaf) a range of panels
+    struct Node
+    {
+        Eigen::Vector3d minimumBound_;
+        Eigen::Vector3d maximumBound_;
+        int firstChildIndex_;
+        int secondChildIndex_;
+        unsigned int firstPanelIndex_;
+        unsigned int numberOfPanels_;
+    };
+
+    int buildNode( const unsigned int firstPanelIndex, const unsigned int numberOfPanels );
+
+    bool doesRayIntersectBox(
+            const Node& node, const Eigen::Vector3d& rayOrigin, const Eigen::Vector3d& inverseRayDirection ) const;
+
+    bool doesRayIntersectPanel(
+            const unsigned int panelIndex, const Eigen::Vector3d& rayOrigin, const Eigen::Vector3d& rayDirection ) const;
+
+    std::vector< Eigen::Vector3d > panelCentroids_;
+
+    std::vector< Eigen::Vector3d > panelNormals_;
+
+    std::vector< double > panelRadii_;
+
+    // Axis-aligned bounding box of each (disk-shaped) panel
+    std::vector< Eigen::Vector3d > panelMinimumBounds_;
+    std::vector< Eigen::Vector3d > panelMaximumBounds_;
+
+    // Panel indices, ordered such that each leaf node refers to a contiguous range
+    std::vector< unsigned int > orderedPanelIndices_;
+
+    std::vector< Node > nodes_;
+
+    unsigned int maximumNumberOfPanelsPerLeaf_;
+
+    // Minimum distance along a ray for an intersection to count as blocking, to exclude intersections with coplanar
+    // neighbouring panels at the ray origin
+    double minimumIntersectionDistance_;
+};
+
+/*!
+ * Class to compute the illumination fractions of the panels of a vehicle, accounting for the (self-)shadowing of panels
+ * by other panels of the same vehicle (e.g. the bus shaded by an antenna dish). The geometry of the panels is taken to
+ * be fixed in the frame in which the panels are defined.
+ *
+ * The illumination fraction of a panel, for a given direction to the source, is computed by ray tracing: each panel is
+ * sampled by a grid of points, from which a ray is traced towards the source, and tested against all other panels
+ * using a PanelBoundingVolumeHierarchy. Since only the area of the panels is known (not their shape), each panel is
+ * represented by the disk inscribed in the square with the area of the panel. This disk lies within the edges of
+ * square and rectangular panels, such that the faces of a convex body (e.g. a box) do not shadow each other, at the
+ * expense of neglecting the shadows cast by the corners of the panels. Since this is too costly to perform at each function evaluation of a
+ * propagation, the illumination fractions are precomputed on a grid of source directions (azimuth and elevation in the
+ * panel frame) at construction, and bi-linearly interpolated during the propagation.
+ */
+class PanelSelfShadowingModel
+{
+public:
+
+    /*!
+     * Constructor, computes the illumination fraction table.
+     *
+     * @param panels Panels of the vehicle, all defined in the same (vehicle-fixed) frame. Each panel must have a
+     * defined position.
+     * @param numberOfAzimuthPoints Number of (equispaced) source azimuth angles in the illumination fraction table
+     * @param numberOfElevationPoints Number of (equispaced) source elevation angles, from -90 to 90 degrees
+     * (inclusive), in the illumination fraction table
+     * @param numberOfSamplesPerPanelSide Number of points per side of the square grid that is used to sample a panel
+     * when ray tracing (only the points inside the disk representing the panel are used)
+     * @param numberOfThreads Number of threads used to compute the illumination fraction table (0 to use all hardware
+     * threads)
+     */
+    PanelSelfShadowingModel(
+            const std::vector< std::shared_ptr< system_models::VehicleExteriorPanel > >& panels,
+            const unsigned int numberOfAzimuthPoints = 72,
+            const unsigned int numberOfElevationPoints = 37,
+            const unsigned int numberOfSamplesPerPanelSide = 8,
+            const unsigned int numberOfThreads = 1 );
+
+    /*!
+     * Function to compute the illumination fraction of a single panel directly by ray tracing (i.e. without using the
+     * illumination fraction table).
+     *
+     * @param panelIndex Index of the panel
+     * @param directionToSource Unit vector from the vehicle to the source, in the panel frame
+     * @return Fraction (between 0 and 1) of the panel area that is not shadowed by other panels
+     */
+    double computeIlluminationFraction(
+            const unsigned int panelIndex,
+            const Eigen::Vector3d& directionToSource ) const;
+
+    /*!
+     * Function to update the illumination fractions of all panels, by interpolating the illumination fraction table.
+     *
+     * @param directionToSource Unit vector from the vehicle to the source, in the panel frame
+     */
+    void updateIlluminationFractions( const Eigen::Vector3d& directionToSource );
+
+    double getCurrentIlluminationFraction( const unsigned int panelIndex ) const
+    {
+        return currentIlluminationFractions_( panelIndex );
+    }
+
+    const Eigen::VectorXd& getCurrentIlluminationFractions( ) const
+    {
+        return currentIlluminationFractions_;
+    }
+
+    //! Function to retrieve the illumination fraction table (row: panel; column: elevation index * number of azimuth
+    //! points + azimuth index)
+    const Eigen::MatrixXd& getIlluminationFractionTable( ) const
+    {
+        return illuminationFractionTable_;
+    }
+
+    unsigned int getNumberOfPanels( ) const
+    {
+        return panelNormals_.size( );
+    }
+
+    unsigned int getNumberOfAzimuthPoints( ) const
+    {
+        return numberOfAzimuthPoints_;
+    }
+
+    unsigned int getNumberOfElevationPoints( ) const
+    {
+        return numberOfElevationPoints_;
+    }
+
+    std::shared_ptr< PanelBoundingVolumeHierarchy > getBoundingVolumeHierarchy( ) const
+    {
+        return boundingVolumeHierarchy_;
+    }
+
+private:
+
+    Eigen::Vector3d getTableDirection( const unsigned int azimuthIndex, const unsigned int elevationIndex ) const;
+
+    std::vector< Eigen::Vector3d > panelNormals_;
+
+    // Points on each panel from which rays are traced
+    std::vector< std::vector< Eigen::Vector3d > > panelSamplePoints_;
+
+    std::shared_ptr< PanelBoundingVolumeHierarchy > boundingVolumeHierarchy_;
+
+    unsigned int numberOfAzimuthPoints_;
+
+    unsigned int numberOfElevationPoints_;
+
+    double azimuthStep_;
+
+    double elevationStep_;
+
+    Eigen::MatrixXd illuminationFractionTable_;
+
+    Eigen::VectorXd currentIlluminationFractions_;
+};
+
+} // namespace electromagnetism
+} // namespace tudat
+
+#endif // TUDAT_PANELSELFSHADOWING_H
@@ -21,9 +21,9 @@
 #include <Eigen/Core>
 
 #include "tudat/math/basic/mathematicalConstants.h"
+#include "tudat/astro/electromagnetism/panelSelfShadowing.h"
 #include "tudat/astro/electromagnetism/reflectionLaw.h"
 #include "tudat/astro/system_models/vehicleExteriorPanels.h"
-#include "tudat/astro/system_models/vehicleExteriorPanels.h"
 
 
 namespace tudat
@@ -353,11 +353,52 @@ public:
         return totalNumberOfPanels_;
     }
 
+    /*!
+     * Set model for the self-shadowing of the body-fixed panels. When set, the force on each body-fixed panel is scaled
+     * by its illumination fraction, as obtained from the self-shadowing model. Segment-fixed panels are not included in
+     * the self-shadowing model: they are not shadowed, and do not cast shadows.
+     *
+     * @param selfShadowingModel Self-shadowing model, defined for the body-fixed panels of this target (nullptr to
+     *      disable self-shadowing)
+     */
+    void setSelfShadowingModel( const std::shared_ptr< PanelSelfShadowingModel > selfShadowingModel )
+    {
+        if( selfShadowingModel != nullptr && selfShadowingModel->getNumberOfPanels( ) != bodyFixedPanels_.size( ) )
+        {
+            throw std::runtime_error( "Error when setting panel self-shadowing model, number of panels (" +
+                                      std::to_string( selfShadowingModel->getNumberOfPanels( ) ) +
+                                      ") is not equal to number of body-fixed panels (" +
+                                      std::to_string( bodyFixedPanels_.size( ) ) + ")." );
+        }
+        selfShadowingModel_ = selfShadowingModel;
+    }
+
+    std::shared_ptr< PanelSelfShadowingModel > getSelfShadowingModel( )
+    {
+        return selfShadowingModel_;
+    }
+
     void saveLocalComputations( const std::string sourceName, const bool saveCosines ) override ;
 
 private:
     void updateMembers_( double currentTime ) override;
 
+    // Update illumination fractions of body-fixed panels (if self-shadowing is used)
+    void updateIlluminationFractions( const Eigen::Vector3d& sourceToTargetDirectionLocalFrame )
+    {
+        if( selfShadowingModel_ != nullptr )
+        {
+            selfShadowingModel_->updateIlluminationFractions( -sourceToTargetDirectionLocalFrame );
+        }
+    }
+
+    // Get illumination fraction of panel, as computed by last call to updateIlluminationFractions
+    double getIlluminationFraction( const int panelIndex )
+    {
+        return ( selfShadowingModel_ != nullptr && panelIndex < static_cast< int >( bodyFixedPanels_.size( ) ) ) ?
+                    selfShadowingModel_->getCurrentIlluminationFraction( panelIndex ) : 1.0;
+    }
+
     void resetDerivedComputations( const std::string sourceName ) override
     {
         for( unsigned int i = 0; i < panelForces_.size( ); i++ )
@@ -397,6 +438,8 @@ private:
     std::map< std::string, std::vector< Eigen::Vector3d > > panelForcesPerSource_;
     std::map< std::string, std::vector< Eigen::Vector3d > > panelTorquesPerSource_;
 
+    std::shared_ptr< PanelSelfShadowingModel > selfShadowingModel_;
+
 };
 
 } // tudat
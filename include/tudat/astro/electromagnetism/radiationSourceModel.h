@@ -326,15 +326,36 @@ public:
 
     virtual std::vector< Eigen::Vector7d > getCurrentPanelGeomtry( ){ return std::vector< Eigen::Vector7d >( ); }
 
-
 protected:
+    /*!
+     * Update the panel properties that are stored as (structure-of-)arrays for the vectorized irradiance evaluation,
+     * from the current panels and their radiosity models. Must be called whenever the panels or their radiosity models
+     * are updated. If any of the radiosity models is not Lambertian, the irradiance is evaluated panel-by-panel.
+     */
+    void updatePanelArrays();
+
     std::shared_ptr<basic_astrodynamics::BodyShapeModel> sourceBodyShapeModel_;
     std::unique_ptr<SourcePanelRadiosityModelUpdater> sourcePanelRadiosityModelUpdater_;
 
 private:
+    IrradianceWithSourceList evaluateIrradianceAtPositionFromPanelArrays(const Eigen::Vector3d& targetPosition);
 
     // For dependent variable
     double visibleArea{TUDAT_NAN};
+
+    // Whether panel arrays are up to date, and all radiosity models are Lambertian
+    bool usePanelArrays_{false};
+
+    // Panel properties, stored per column/entry
+    Eigen::Matrix3Xd panelCenters_;
+    Eigen::Matrix3Xd panelSurfaceNormals_;
+    Eigen::VectorXd panelAreas_;
+    Eigen::VectorXd panelIrradianceFactors_;
+
+    // Buffers for irradiance evaluation
+    Eigen::Matrix3Xd currentTargetPositionsRelativeToPanels_;
+    Eigen::ArrayXd currentPanelNormalProjections_;
+    Eigen::ArrayXd currentPanelIrradiances_;
 };
 
 /*!
@@ -420,13 +441,17 @@ public:
      * @param sourceBodyShapeModel Shape model of this source
      * @param baseRadiosityModels Radiosity models that will be copied for each panel
      * @param numberOfPanelsPerRing Number of panels for each ring, excluding the central cap
+     * @param panelRegenerationTolerance Displacement of the target (relative to its distance from the source center)
+     *      since the last panel generation below which the existing panels are reused, instead of generating new panels
+     *      for the current target position. For a value of 0, panels are only reused for an identical target position.
      */
     explicit DynamicallyPaneledRadiationSourceModel(
             const std::shared_ptr<basic_astrodynamics::BodyShapeModel>& sourceBodyShapeModel,
             std::unique_ptr<SourcePanelRadiosityModelUpdater> sourcePanelRadiosityModelUpdater,
             const std::vector<std::unique_ptr<SourcePanelRadiosityModel>>& baseRadiosityModels,
             const std::vector<int>& numberOfPanelsPerRing,
-            const std::string& sourceName = "");
+            const std::string& sourceName = "",
+            const double panelRegenerationTolerance = 0.0);
 
     IrradianceWithSourceList evaluateIrradianceAtPosition(const Eigen::Vector3d& targetPosition) override;
 
@@ -442,6 +467,11 @@ public:
 
     std::vector< Eigen::Vector7d > getCurrentPanelGeomtry( ) override ;
 
+    double getPanelRegenerationTolerance() const
+    {
+        return panelRegenerationTolerance_;
+    }
+
 private:
     void updateMembers_(double currentTime) override;
 
@@ -450,6 +480,14 @@ private:
     const std::vector<int> numberOfPanelsPerRing_;
 
     std::vector<RadiationSourcePanel> panels_;
+
+    double panelRegenerationTolerance_;
+
+    // Target position for which panels were last generated
+    Eigen::Vector3d panelGenerationTargetPosition_{Eigen::Vector3d::Constant(TUDAT_NAN)};
+
+    // Time at which radiosity models of panels were last updated
+    double panelUpdateTime_{TUDAT_NAN};
 };
 
 class SourcePanelRadiosityModelUpdater
@@ -54,6 +54,24 @@ public:
             const Eigen::Vector3d& panelSurfaceNormal,
             const Eigen::Vector3d& targetPosition) const = 0;
 
+    /*!
+     * Evaluate the target-independent factor of the irradiance [W m²/m²] due to this panel, for radiosity models that
+     * emit or reflect in a Lambertian manner. For such models, the irradiance at a position r (relative to the panel
+     * center) in front of the panel is this factor times cos(θ)/|r|², with θ the angle between the panel surface
+     * normal and r. This allows the irradiances due to all panels of a source to be evaluated in a single vectorized
+     * operation, without calling evaluateIrradianceAtPosition for each panel.
+     *
+     * @param panelArea Area of the panel [m²]
+     * @param panelSurfaceNormal Surface normal of the panel
+     * @return Lambertian irradiance factor, or NaN if the radiosity model is not Lambertian
+     */
+    virtual double evaluateLambertianIrradianceFactor(
+            double panelArea,
+            const Eigen::Vector3d& panelSurfaceNormal) const
+    {
+        return TUDAT_NAN;
+    }
+
     /*!
      * Update class members.
      *
@@ -180,6 +198,10 @@ public:
             const Eigen::Vector3d& panelSurfaceNormal,
             const Eigen::Vector3d& targetPosition) const override;
 
+    double evaluateLambertianIrradianceFactor(
+            double panelArea,
+            const Eigen::Vector3d& panelSurfaceNormal) const override;
+
     std::unique_ptr<SourcePanelRadiosityModel> clone() const override
     {
         return std::make_unique<ConstantSourcePanelRadiosityModel>(*this);
@@ -219,6 +241,10 @@ public:
             const Eigen::Vector3d& panelSurfaceNormal,
             const Eigen::Vector3d& targetPosition) const override;
 
+    double evaluateLambertianIrradianceFactor(
+            double panelArea,
+            const Eigen::Vector3d& panelSurfaceNormal) const override;
+
     std::unique_ptr<SourcePanelRadiosityModel> clone() const override
     {
         return std::make_unique<CustomInherentSourcePanelRadiosityModel>(*this);
@@ -280,6 +306,10 @@ public:
             const Eigen::Vector3d& panelSurfaceNormal,
             const Eigen::Vector3d& targetPosition) const override;
 
+    double evaluateLambertianIrradianceFactor(
+            double panelArea,
+            const Eigen::Vector3d& panelSurfaceNormal) const override;
+
     std::unique_ptr<SourcePanelRadiosityModel> clone() const override
     {
         return std::make_unique<AlbedoSourcePanelRadiosityModel>(*this);
@@ -335,6 +365,10 @@ public:
             const Eigen::Vector3d& panelSurfaceNormal,
             const Eigen::Vector3d& targetPosition) const override;
 
+    double evaluateLambertianIrradianceFactor(
+            double panelArea,
+            const Eigen::Vector3d& panelSurfaceNormal) const override;
+
     std::unique_ptr<SourcePanelRadiosityModel> clone() const override
     {
         return std::make_unique<DelayedThermalSourcePanelRadiosityModel>(*this);
@@ -396,6 +430,10 @@ public:
             const Eigen::Vector3d& panelSurfaceNormal,
             const Eigen::Vector3d& targetPosition) const override;
 
+    double evaluateLambertianIrradianceFactor(
+            double panelArea,
+            const Eigen::Vector3d& panelSurfaceNormal) const override;
+
 
     std::unique_ptr<SourcePanelRadiosityModel> clone() const override
     {
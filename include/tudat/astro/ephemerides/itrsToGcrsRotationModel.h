@@ -20,6 +20,7 @@
 #include "tudat/math/interpolators/interpolator.h"
 #include "tudat/astro/ephemerides/rotationalEphemeris.h"
 #include "tudat/astro/earth_orientation/earthOrientationCalculator.h"
+#include "tudat/astro/earth_orientation/tabulatedEarthOrientation.h"
 
 
 
@@ -66,17 +67,37 @@ public:
      *  \param anglesCalculator Class performing calculation to obtain earth orientation angle.
      *  \param timeScale Time scale in which input to this class (in getRotationToBaseFrame, getDerivativeOfRotationToBaseFrame) is provided,
      *  needed for correct input to EarthOrientationAnglesCalculator::getRotationAnglesFromItrsToGcrs.
+     *  \param baseFrame Base frame of the rotation model (GCRS or J2000)
+     *  \param tabulatedAngles Precomputed table of Earth orientation angles, used instead of the anglesCalculator to
+     *  compute the rotation if provided (default none). Time scale of the table must be equal to inputTimeScale.
      */
     GcrsToItrsRotationModel( const std::shared_ptr< earth_orientation::EarthOrientationAnglesCalculator > anglesCalculator,
                              const basic_astrodynamics::TimeScales inputTimeScale  = basic_astrodynamics::tdb_scale,
-                             const std::string& baseFrame = "GCRS" ):
-        RotationalEphemeris( baseFrame, "ITRS" ), anglesCalculator_( anglesCalculator ), inputTimeScale_( inputTimeScale ),
-        frameBias_( Eigen::Matrix3d::Identity( ) )
+                             const std::string& baseFrame = "GCRS",
+                             const std::shared_ptr< earth_orientation::TabulatedEarthOrientationAngles > tabulatedAngles =
+            nullptr ):
+        RotationalEphemeris( baseFrame, "ITRS" ), anglesCalculator_( anglesCalculator ), tabulatedAngles_( tabulatedAngles ),
+        inputTimeScale_( inputTimeScale ), frameBias_( Eigen::Matrix3d::Identity( ) )
 
     {
-        functionToGetRotationAngles = std::bind(
-                    &earth_orientation::EarthOrientationAnglesCalculator::getRotationAnglesFromItrsToGcrs< double >,
-                    anglesCalculator, std::placeholders::_1, inputTimeScale );
+        if( tabulatedAngles_ == nullptr )
+        {
+            functionToGetRotationAngles = std::bind(
+                        &earth_orientation::EarthOrientationAnglesCalculator::getRotationAnglesFromItrsToGcrs< double >,
+                        anglesCalculator, std::placeholders::_1, inputTimeScale );
+        }
+        else
+        {
+            if( tabulatedAngles_->getTimeScale( ) != inputTimeScale )
+            {
+                throw std::runtime_error( "Error in GCRS<->ITRS model, time scale of Earth orientation table " +
+                                          tabulatedAngles_->getFileName( ) + " is inconsistent with input time scale" );
+            }
+            functionToGetRotationAngles = std::bind(
+                        &earth_orientation::TabulatedEarthOrientationAngles::getRotationAnglesFromItrsToGcrs< double >,
+                        tabulatedAngles_, std::placeholders::_1 );
+        }
+
         if( baseFrame == "J2000" )
         {
             frameBias_ = sofa_interface::getFrameBias(
@@ -97,8 +118,7 @@ public:
     Eigen::Quaterniond getRotationToBaseFrame( const double ephemerisTime )
     {
         return Eigen::Quaterniond( frameBias_ ) * earth_orientation::calculateRotationFromItrsToGcrs< double >(
-                    anglesCalculator_->getRotationAnglesFromItrsToGcrs< double >( ephemerisTime, inputTimeScale_ ),
-                    ephemerisTime );
+                    functionToGetRotationAngles( ephemerisTime ), ephemerisTime );
     }
 
     //! Function to calculate the rotation quaternion from ITRS to base frame
@@ -111,7 +131,9 @@ public:
     Eigen::Quaterniond getRotationToBaseFrameFromExtendedTime( const Time ephemerisTime )
     {
         return Eigen::Quaterniond( frameBias_ ) * earth_orientation::calculateRotationFromItrsToGcrs< Time >(
-                    anglesCalculator_->getRotationAnglesFromItrsToGcrs< Time >( ephemerisTime, inputTimeScale_ ),
+                    ( tabulatedAngles_ == nullptr ) ?
+                        anglesCalculator_->getRotationAnglesFromItrsToGcrs< Time >( ephemerisTime, inputTimeScale_ ) :
+                        tabulatedAngles_->getRotationAnglesFromItrsToGcrs< Time >( ephemerisTime ),
                     ephemerisTime );
     }
 
@@ -174,6 +196,16 @@ public:
         return anglesCalculator_;
     }
 
+    //! Function to retrieve precomputed table of Earth orientation angles (nullptr if angles are computed directly)
+    /*!
+     * Function to retrieve precomputed table of Earth orientation angles (nullptr if angles are computed directly)
+     * \return Precomputed table of Earth orientation angles
+     */
+    std::shared_ptr< earth_orientation::TabulatedEarthOrientationAngles > getTabulatedAngles( )
+    {
+        return tabulatedAngles_;
+    }
+
     //! Function to retrieve time scale in which the input time for class functions are interpreted
     /*!
      * Function to retrieve time scale in which the input time for class functions are interpreted
@@ -202,6 +234,9 @@ private:
      */
     std::shared_ptr< earth_orientation::EarthOrientationAnglesCalculator > anglesCalculator_;
 
+    //! Precomputed table of Earth orientation angles, used instead of anglesCalculator_ if not nullptr
+    std::shared_ptr< earth_orientation::TabulatedEarthOrientationAngles > tabulatedAngles_;
+
     //! Time scale in which the input time for class functions are interpreted
     basic_astrodynamics::TimeScales inputTimeScale_;
 
@@ -191,7 +191,9 @@ public:
     RotationalEphemeris( const std::string& baseFrameOrientation = "",
                          const std::string& targetFrameOrientation = "" )
         : baseFrameOrientation_( baseFrameOrientation ),
-          targetFrameOrientation_( targetFrameOrientation )
+          targetFrameOrientation_( targetFrameOrientation ),
+          useEpochCache_( false ), isEpochCacheValid_( false ), isCachedEpochExtended_( false ),
+          cachedEpoch_( TUDAT_NAN ), cachedExtendedEpoch_( 0 )
     { }
 
     //! Virtual destructor.
@@ -459,12 +461,61 @@ public:
     Eigen::Vector7d getRotationStateVector( const double time )
     {
         Eigen::Vector7d rotationalState;
-        rotationalState.segment( 0, 4 ) = linear_algebra::convertQuaternionToVectorFormat(
-                    getRotationToBaseFrame( time ) );
-        rotationalState.segment( 4, 3 ) = getRotationalVelocityVectorInTargetFrame( time );
+        if( useEpochCache_ )
+        {
+            updateEpochCache( time );
+            rotationalState.segment( 0, 4 ) = linear_algebra::convertQuaternionToVectorFormat(
+                        cachedRotationToTargetFrame_.inverse( ) );
+            rotationalState.segment( 4, 3 ) = cachedRotationToTargetFrame_ * cachedAngularVelocityVectorInBaseFrame_;
+        }
+        else
+        {
+            rotationalState.segment( 0, 4 ) = linear_algebra::convertQuaternionToVectorFormat(
+                        getRotationToBaseFrame( time ) );
+            rotationalState.segment( 4, 3 ) = getRotationalVelocityVectorInTargetFrame( time );
+        }
         return rotationalState;
     }
 
+    //! Function to set whether the rotational quantities are to be cached per epoch
+    /*!
+     * Function to set whether the rotational quantities are to be cached per epoch. If set to true, the first call to any of
+     * the templated functions (e.g. getRotationToBaseFrameTemplated), the full rotational state functions and
+     * getRotationStateVector at a given epoch computes the rotation, its time derivative and the angular velocity together
+     * (using getFullRotationalQuantitiesToTargetFrame), and subsequent calls at the same epoch retrieve these quantities from
+     * the cache. The cache is invalidated when a different epoch is requested, and should be cleared (see clearEpochCache)
+     * whenever a property of the model is modified. The cache must only be used for models that depend on time (and model
+     * parameters) only, and not for models that depend on the current state of a body. The cache is not synchronized, and
+     * may only be used when the model is evaluated from a single thread; the multi-threaded observation simulation and
+     * estimation functions revert to a single thread if it is enabled (see getThreadUnsafeEnvironmentModels).
+     * \param useEpochCache Boolean denoting whether the rotational quantities are to be cached per epoch
+     */
+    void setUseEpochCache( const bool useEpochCache )
+    {
+        useEpochCache_ = useEpochCache;
+        clearEpochCache( );
+    }
+
+    //! Function to retrieve whether the rotational quantities are cached per epoch
+    /*!
+     * Function to retrieve whether the rotational quantities are cached per epoch
+     * \return Boolean denoting whether the rotational quantities are cached per epoch
+     */
+    bool getUseEpochCache( )
+    {
+        return useEpochCache_;
+    }
+
+    //! Function to clear the per-epoch cache of rotational quantities
+    /*!
+     * Function to clear the per-epoch cache of rotational quantities, forcing the quantities to be recomputed at the next call.
+     * To be called whenever a property (e.g. an estimated parameter) of the rotation model is modified.
+     */
+    void clearEpochCache( )
+    {
+        isEpochCacheValid_ = false;
+    }
+
     //! Get base reference frame orientation.
     /*!
      * Function to retrieve the base reference frame orientation.
@@ -485,6 +536,20 @@ public:
     { }
 protected:
 
+    //! Function to update the per-epoch cache of rotational quantities to the given epoch (if not already at this epoch)
+    /*!
+     * Function to update the per-epoch cache of rotational quantities to the given epoch (if not already at this epoch)
+     * \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     */
+    void updateEpochCache( const double secondsSinceEpoch );
+
+    //! Function to update the per-epoch cache of rotational quantities to the given epoch (if not already at this epoch)
+    /*!
+     * Function to update the per-epoch cache of rotational quantities to the given epoch (if not already at this epoch)
+     * \param timeSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     */
+    void updateEpochCache( const Time& timeSinceEpoch );
+
     //! Base reference frame orientation.
     /*!
      * Base reference frame orientation.
@@ -497,6 +562,30 @@ protected:
      */
     const std::string targetFrameOrientation_;
 
+    //! Boolean denoting whether the rotational quantities are cached per epoch
+    bool useEpochCache_;
+
+    //! Boolean denoting whether the cached rotational quantities are valid for the cached epoch
+    bool isEpochCacheValid_;
+
+    //! Boolean denoting whether the cached rotational quantities were computed at cachedExtendedEpoch_ (or cachedEpoch_)
+    bool isCachedEpochExtended_;
+
+    //! Epoch at which cached rotational quantities were computed (if computed with double precision time)
+    double cachedEpoch_;
+
+    //! Epoch at which cached rotational quantities were computed (if computed with Time precision time)
+    Time cachedExtendedEpoch_;
+
+    //! Cached rotation to target frame from base frame
+    Eigen::Quaterniond cachedRotationToTargetFrame_;
+
+    //! Cached time derivative of rotation matrix to target frame from base frame
+    Eigen::Matrix3d cachedDerivativeOfRotationToTargetFrame_;
+
+    //! Cached angular velocity vector of target frame, expressed in base frame
+    Eigen::Vector3d cachedAngularVelocityVectorInBaseFrame_;
+
 };
 
 //! Function to transform a state from the target to base frame of a rotational ephemeris
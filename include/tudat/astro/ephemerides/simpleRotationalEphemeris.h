@@ -167,7 +167,11 @@ public:
      * Function to reset the rotation rate of the body.
      * \param rotationRate New rotation rate [rad/s].
      */
-    void resetRotationRate( const double rotationRate ) { rotationRate_ = rotationRate; }
+    void resetRotationRate( const double rotationRate )
+    {
+        rotationRate_ = rotationRate;
+        clearEpochCache( );
+    }
 
     //! Function to get vector of euler angles at initialSecondsSinceEpoch_
     /*!
@@ -80,6 +80,7 @@ public:
     void reset( const std::shared_ptr< interpolators::OneDimensionalInterpolator< TimeType, StateType > > interpolator )
     {
         interpolator_ = interpolator;
+        clearEpochCache( );
     }
 
     //! Function to retrieve the rotational state interpolator.
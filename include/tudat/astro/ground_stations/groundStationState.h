@@ -237,6 +237,16 @@ public:
     void setSiteId( const std::string& siteId ){ siteId_ = siteId; }
 
     std::string getSiteId( ){ return siteId_; }
+
+    //! Function to retrieve the model for the variations of the station position w.r.t. its nominal position
+    /*!
+     *  Function to retrieve the model for the variations of the station position w.r.t. its nominal position
+     * \return Model for the variations of the station position (nullptr if none)
+     */
+    std::shared_ptr< StationMotionModel > getStationMotionModel( )
+    {
+        return stationMotionModel_;
+    }
 protected:
 
 
@@ -467,6 +477,10 @@ public:
         return motion;
     }
 
+    std::vector< std::shared_ptr< StationMotionModel > > getModelList( )
+    {
+        return modelList_;
+    }
 
 protected:
 
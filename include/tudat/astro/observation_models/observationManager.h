@@ -18,6 +18,7 @@
 #include "tudat/astro/orbit_determination/observation_partials/observationPartial.h"
 #include "tudat/astro/propagators/stateTransitionMatrixInterface.h"
 #include "tudat/simulation/propagation_setup/dependentVariablesInterface.h"
+#include "tudat/math/basic/blockSparseDesignMatrix.h"
 
 namespace tudat
 {
@@ -103,6 +104,15 @@ public:
      */
     virtual std::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > getObservationSimulator( ) = 0;
 
+    //! Function (pure virtual) to retrieve the blocks of columns of the partials matrix that may be non-zero
+    /*!
+     * Function (pure virtual) to retrieve the blocks of columns of the partials matrix (as computed by
+     * computeObservationsWithPartials) that may be non-zero for a given set of link ends. All other columns are zero.
+     * \param linkEnds Set of link ends for which the non-zero blocks of columns are to be retrieved
+     * \return Blocks of columns (start index and size in the parameter vector) that may be non-zero
+     */
+    virtual std::vector< std::pair< int, int > > getPartialsColumnBlocks( const LinkEnds& linkEnds ) = 0;
+
 
 protected:
 
@@ -322,6 +332,32 @@ public:
         return observationPartials_.at( linkEnds );
     }
 
+    //! Function to retrieve the blocks of columns of the partials matrix that may be non-zero
+    /*!
+     * Function to retrieve the blocks of columns of the partials matrix that may be non-zero for a given set of link
+     * ends, as determined from the parameter indices of its observation partial objects. Partials w.r.t. the current
+     * state of a body are mapped to the estimated parameters using the combined state transition and sensitivity
+     * matrix, which may couple them to any parameter, so that all columns are returned if such a partial exists.
+     * \param linkEnds Set of link ends for which the non-zero blocks of columns are to be retrieved
+     * \return Blocks of columns (start index and size in the parameter vector) that may be non-zero
+     */
+    std::vector< std::pair< int, int > > getPartialsColumnBlocks( const LinkEnds& linkEnds )
+    {
+        std::vector< std::pair< int, int > > columnBlocks;
+        if( observationPartials_.count( linkEnds ) > 0 )
+        {
+            for( auto partialIterator : observationPartials_.at( linkEnds ) )
+            {
+                if( partialIterator.first.first < stateTransitionMatrixSize_ )
+                {
+                    return { std::make_pair( 0, stateTransitionMatrixInterface_->getFullParameterVectorSize( ) ) };
+                }
+                columnBlocks.push_back( partialIterator.first );
+            }
+        }
+        return linear_algebra::mergeColumnBlocks( columnBlocks );
+    }
+
 
 protected:
 
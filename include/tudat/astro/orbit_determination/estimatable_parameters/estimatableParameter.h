@@ -153,6 +153,16 @@ bool isParameterArcWiseInitialStateProperty( const EstimatebleParametersEnum par
 
 bool isParameterClockProperty( const EstimatebleParametersEnum parameterType );
 
+//! Function to determine whether the given parameter is defined separately for each of a set of arcs.
+/*!
+ * Function to determine whether the given parameter is defined separately for each of a set of arcs (e.g. arc-wise
+ * initial states, biases and empirical accelerations), so that each of its entries influences only the observations
+ * of a single arc.
+ * \param parameterType Parameter identifier.
+ * \return True if parameter is defined separately for each arc.
+ */
+bool isParameterArcWise( const EstimatebleParametersEnum parameterType );
+
 //! Typedef for full parameter identifier.
 typedef std::pair< EstimatebleParametersEnum, std::pair< std::string, std::string > > EstimatebleParameterIdentifier;
 
@@ -11,6 +11,7 @@
 #ifndef TUDAT_ESTIMATABLEPARAMETERSET_H
 #define TUDAT_ESTIMATABLEPARAMETERSET_H
 
+#include <algorithm>
 #include <iostream>
 #include <vector>
 #include <string>
@@ -558,6 +559,48 @@ public:
         return parameterIndices_;
     }
 
+    //! Function to retrieve the indices of all entries of arc-wise parameters in the estimated parameter vector
+    /*!
+     * Function to retrieve the indices of all entries of arc-wise parameters (see isParameterArcWise) in the estimated
+     * parameter vector, which are candidates for arc-wise elimination from the normal equations
+     * \return Indices (in ascending order) of all entries of arc-wise parameters
+     */
+    std::vector< int > getArcWiseParameterIndices( )
+    {
+        std::vector< std::pair< int, int > > arcWiseParameterIndices;
+        for( auto parameterIterator : initialMultiArcStateParameters_ )
+        {
+            arcWiseParameterIndices.push_back( std::make_pair( parameterIterator.first, parameterIterator.second->getParameterSize( ) ) );
+        }
+
+        for( auto parameterIterator : doubleParameters_ )
+        {
+            if( isParameterArcWise( parameterIterator.second->getParameterName( ).first ) )
+            {
+                arcWiseParameterIndices.push_back( std::make_pair( parameterIterator.first, parameterIterator.second->getParameterSize( ) ) );
+            }
+        }
+
+        for( auto parameterIterator : vectorParameters_ )
+        {
+            if( isParameterArcWise( parameterIterator.second->getParameterName( ).first ) )
+            {
+                arcWiseParameterIndices.push_back( std::make_pair( parameterIterator.first, parameterIterator.second->getParameterSize( ) ) );
+            }
+        }
+
+        std::vector< int > parameterEntryIndices;
+        for( unsigned int i = 0; i < arcWiseParameterIndices.size( ); i++ )
+        {
+            for( int j = 0; j < arcWiseParameterIndices.at( i ).second; j++ )
+            {
+                parameterEntryIndices.push_back( arcWiseParameterIndices.at( i ).first + j );
+            }
+        }
+        std::sort( parameterEntryIndices.begin( ), parameterEntryIndices.end( ) );
+        return parameterEntryIndices;
+    }
+
     //! Function to retrieve total multiplier and right-hand side for parameter estimation linear constraint
     /*!
      * Function to retrieve total multiplier and right-hand side for parameter estimation linear constraint
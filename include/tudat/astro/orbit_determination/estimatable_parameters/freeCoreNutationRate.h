@@ -68,6 +68,7 @@ public:
     void setParameterValue( const double parameterValue )
     {
         rotationModel_->getPlanetaryOrientationAngleCalculator()->resetFreeCoreNutationRate( parameterValue );
+        rotationModel_->clearEpochCache( );
     }
 
 
@@ -104,6 +104,7 @@ public:
 
         rotationModel_->getPlanetaryOrientationAngleCalculator()->resetRotationRateCorrections(
                     rotationRateCorrections);
+        rotationModel_->clearEpochCache( );
 
     }
 
@@ -137,6 +137,7 @@ public:
 
         // Reset y polar motion amplitude coefficients.
         rotationModel_->getPlanetaryOrientationAngleCalculator()->resetYpolarMotionCoefficients( yPolarMotionAmplitudeCoefficients);
+        rotationModel_->clearEpochCache( );
 
     }
 
@@ -20,6 +20,7 @@
 #include <Eigen/LU>
 
 #include "tudat/basics/timeType.h"
+#include "tudat/math/basic/blockSparseDesignMatrix.h"
 #include "tudat/astro/observation_models/linkTypeDefs.h"
 #include "tudat/astro/observation_models/observableTypes.h"
 #include "tudat/simulation/estimation_setup/observationCollection.h"
@@ -46,7 +47,11 @@ public:
         reintegrateEquationsOnFirstIteration_( true ),
         reintegrateVariationalEquations_( true ),
         saveDesignMatrix_( true ),
-        printOutput_( true )
+        printOutput_( true ),
+        numberOfThreads_( 1 ),
+        useNormalEquations_( false ),
+        useSquareRootInformationFilter_( false ),
+        saveBlockSparseDesignMatrix_( false )
     {
 //        weightsMatrixDiagonals_ = observationCollection->getConcatenatedWeights( );
 //        setConstantWeightsMatrix( 1.0 );
@@ -439,6 +444,113 @@ public:
         return considerParametersIncluded_;
     }
 
+    //! Function to return the number of threads used to compute the design matrix and residuals
+    /*!
+     * Function to return the number of threads used to compute the design matrix and residuals
+     * \return Number of threads used to compute the design matrix and residuals (0 to use all hardware threads)
+     */
+    unsigned int getNumberOfThreads( ) const
+    {
+        return numberOfThreads_;
+    }
+
+    //! Function to set the number of threads used to compute the design matrix and residuals
+    /*!
+     * Function to set the number of threads used to compute the design matrix and residuals. The observation sets are
+     * distributed over the threads, each of which uses its own observation managers. The result does not depend on the
+     * number of threads. By default, a single thread is used. The environment models (e.g. ephemerides and rotation
+     * models), as well as the state transition matrix and dependent variable interfaces, are shared by the threads and
+     * are evaluated without modifying them. If any of the environment models is not known to be safe for concurrent
+     * evaluation (e.g. ephemerides and rotation models evaluated directly from SPICE, see
+     * simulation_setup::getThreadUnsafeEnvironmentModels), a single thread is used.
+     * \param numberOfThreads Number of threads used to compute the design matrix and residuals (0 to use all hardware
+     * threads)
+     */
+    void setNumberOfThreads( const unsigned int numberOfThreads )
+    {
+        numberOfThreads_ = numberOfThreads;
+    }
+
+    //! Function to return whether the estimation is performed from the normal equations, without full design matrix
+    /*!
+     * Function to return whether the estimation is performed from the normal equations, without full design matrix
+     * \return Boolean denoting whether the estimation is performed from the normal equations
+     */
+    bool getUseNormalEquations( ) const
+    {
+        return useNormalEquations_;
+    }
+
+    //! Function to set whether the estimation is performed from the normal equations, without full design matrix
+    /*!
+     * Function to set whether the estimation is performed from the normal equations, without full design matrix. If
+     * true, the normal matrix H^T W H and right-hand side H^T W y are accumulated per observation set, and the full
+     * design matrix H is never stored, so that the memory use does not scale with the number of observations times
+     * the number of parameters. The (normalized) design matrices in the output are then empty, regardless of the
+     * setting of saveDesignMatrix, unless the block-sparse design matrix is saved (see setSaveBlockSparseDesignMatrix).
+     * The residuals and covariance are computed as in the default mode.
+     * \param useNormalEquations Boolean denoting whether the estimation is performed from the normal equations
+     */
+    void setUseNormalEquations( const bool useNormalEquations )
+    {
+        useNormalEquations_ = useNormalEquations;
+    }
+
+    //! Function to return whether the estimation is performed using a square-root information filter
+    /*!
+     * Function to return whether the estimation is performed using a square-root information filter
+     * \return Boolean denoting whether the estimation is performed using a square-root information filter
+     */
+    bool getUseSquareRootInformationFilter( ) const
+    {
+        return useSquareRootInformationFilter_;
+    }
+
+    //! Function to set whether the estimation is performed using a square-root information filter
+    /*!
+     * Function to set whether the estimation is performed using a square-root information filter (see
+     * linear_algebra::SquareRootInformationFilter). If true, the observation sets are added one by one to the
+     * upper-triangular square-root information matrix using Householder transformations, and the full design matrix
+     * is never stored (as for setUseNormalEquations). Since the normal equations are not formed, this is numerically
+     * more robust for ill-conditioned estimations. The (normalized) design matrices in the output are empty, regardless
+     * of the setting of saveDesignMatrix. The residuals and covariance are computed as in the default mode. If the
+     * estimation includes constraints, the constrained system is solved from the normal equations formed from the
+     * square-root information matrix. This setting takes precedence over setUseNormalEquations (and, for an estimation,
+     * over EstimationInput::setEliminateArcWiseParameters).
+     * \param useSquareRootInformationFilter Boolean denoting whether the estimation is performed using a square-root
+     * information filter
+     */
+    void setUseSquareRootInformationFilter( const bool useSquareRootInformationFilter )
+    {
+        useSquareRootInformationFilter_ = useSquareRootInformationFilter;
+    }
+
+    //! Function to return whether the block-sparse design matrix is saved when using the normal equations
+    /*!
+     * Function to return whether the block-sparse design matrix is saved when using the normal equations
+     * \return Boolean denoting whether the block-sparse design matrix is saved when using the normal equations
+     */
+    bool getSaveBlockSparseDesignMatrix( ) const
+    {
+        return saveBlockSparseDesignMatrix_;
+    }
+
+    //! Function to set whether the block-sparse design matrix is saved when using the normal equations
+    /*!
+     * Function to set whether the block-sparse design matrix is saved when using the normal equations (see
+     * setUseNormalEquations). If true, the non-zero blocks of the partials of each observation set are stored in a
+     * linear_algebra::BlockSparseDesignMatrix, of which the normalized columns of the estimated parameters are saved
+     * in the output (see CovarianceAnalysisOutput::getNormalizedBlockSparseDesignMatrix). Since partials w.r.t. station,
+     * link-end and arc-wise parameters are only non-zero for the associated observations, the memory use is typically
+     * much smaller than that of the full design matrix.
+     * \param saveBlockSparseDesignMatrix Boolean denoting whether the block-sparse design matrix is saved when using the
+     * normal equations
+     */
+    void setSaveBlockSparseDesignMatrix( const bool saveBlockSparseDesignMatrix )
+    {
+        saveBlockSparseDesignMatrix_ = saveBlockSparseDesignMatrix;
+    }
+
 
 
 protected:
@@ -470,6 +582,18 @@ protected:
 
     //! Boolean denoting whether consider parameters are included in the covariance analysis
     bool considerParametersIncluded_;
+
+    //! Number of threads used to compute the design matrix and residuals (0 to use all hardware threads)
+    unsigned int numberOfThreads_;
+
+    //! Boolean denoting whether the estimation is performed from the normal equations, without full design matrix
+    bool useNormalEquations_;
+
+    //! Boolean denoting whether the estimation is performed using a square-root information filter
+    bool useSquareRootInformationFilter_;
+
+    //! Boolean denoting whether the block-sparse design matrix is saved when using the normal equations
+    bool saveBlockSparseDesignMatrix_;
 };
 
 
@@ -580,7 +704,10 @@ public:
         convergenceChecker_( convergenceChecker ),
         considerParametersDeviations_( considerParametersDeviations ),
         conditionNumberWarningEachIteration_( true ),
-        applyFinalParameterCorrection_( applyFinalParameterCorrection )
+        applyFinalParameterCorrection_( applyFinalParameterCorrection ),
+        eliminateArcWiseParameters_( false ),
+        iterationToFreezePartials_( -1 ),
+        updateRatioToFreezePartials_( 0.0 )
 
     {
         if ( this->areConsiderParametersIncluded( ) )
@@ -676,6 +803,82 @@ public:
         return saveStateHistoryForEachIteration_;
     }
 
+    //! Function to return whether the arc-wise parameters are eliminated (per arc) when solving the normal equations
+    /*!
+     * Function to return whether the arc-wise parameters are eliminated (per arc) when solving the normal equations
+     * \return Boolean denoting whether the arc-wise parameters are eliminated when solving the normal equations
+     */
+    bool getEliminateArcWiseParameters( ) const
+    {
+        return eliminateArcWiseParameters_;
+    }
+
+    //! Function to set whether the arc-wise parameters are eliminated (per arc) when solving the normal equations
+    /*!
+     * Function to set whether the arc-wise parameters are eliminated (per arc) when solving the normal equations. If
+     * true, the arc-wise parameters (e.g. multi-arc initial states, arc-wise biases and empirical accelerations) are
+     * grouped into blocks that are uncoupled from one another (typically one per arc), each of which is eliminated
+     * using its Schur complement (in parallel, using the number of threads of this object), after which the reduced
+     * system for the global parameters is solved, and the arc-wise parameters are back-substituted. This is much
+     * faster than solving the full system for estimations with many arcs. The normal equations are formed from the
+     * design matrix if setUseNormalEquations is not set. If the estimation includes constraints, the full system is
+     * solved.
+     * \param eliminateArcWiseParameters Boolean denoting whether the arc-wise parameters are eliminated when solving the
+     * normal equations
+     */
+    void setEliminateArcWiseParameters( const bool eliminateArcWiseParameters )
+    {
+        eliminateArcWiseParameters_ = eliminateArcWiseParameters;
+    }
+
+    //! Function to set the settings for freezing the variational equations and observation partials during estimation
+    /*!
+     * Function to set the settings for freezing the variational equations and observation partials during estimation.
+     * Once frozen, the variational equations are no longer re-integrated, and the (normalized) observation partials of
+     * the last iteration in which they were computed are reused, so that only the equations of motion and the residuals
+     * are recomputed in each iteration. With the square-root information filter (see setUseSquareRootInformationFilter),
+     * the partials are recomputed from the frozen state transition and sensitivity matrices. The partials are frozen
+     * from the given iteration onwards, or from the iteration after the one in which the parameter update is small
+     * compared to the formal errors (whichever comes first). Since the partials typically change very little once the
+     * estimation is close to convergence, this reduces the computational cost of the later iterations, without
+     * significantly affecting the converged solution. When using normal equations (see setUseNormalEquations), the
+     * residuals in the frozen iterations are projected onto the partials using a (block-sparse) design matrix. With a
+     * fixed freezing iteration, this matrix is only formed in the iteration before the partials are frozen. If the
+     * update ratio criterion is used, it is formed (and stored for the duration of the iteration) in every iteration until
+     * the partials are frozen, requiring memory of the order of the number of observations times the number of
+     * parameters that each observation depends on.
+     * \param iterationToFreezePartials Index of the first iteration in which the partials are frozen (iteration 0 uses
+     * the initial parameter estimate); no freezing at a fixed iteration if smaller than 1
+     * \param updateRatioToFreezePartials Maximum value, over all estimated parameters, of the ratio of the parameter
+     * update to its formal error, below which the partials are frozen for all subsequent iterations; not used if equal
+     * to or smaller than 0
+     */
+    void setPartialsFreezingSettings( const int iterationToFreezePartials,
+                                      const double updateRatioToFreezePartials = 0.0 )
+    {
+        iterationToFreezePartials_ = iterationToFreezePartials;
+        updateRatioToFreezePartials_ = updateRatioToFreezePartials;
+    }
+
+    //! Function to return the index of the first iteration in which the partials are frozen (disabled if smaller than 1)
+    int getIterationToFreezePartials( ) const
+    {
+        return iterationToFreezePartials_;
+    }
+
+    //! Function to return the ratio of parameter update to formal error below which the partials are frozen (disabled
+    //! if equal to or smaller than 0)
+    double getUpdateRatioToFreezePartials( ) const
+    {
+        return updateRatioToFreezePartials_;
+    }
+
+    //! Function to return whether the variational equations and observation partials may be frozen during estimation
+    bool arePartialsFreezingSettingsDefined( ) const
+    {
+        return ( iterationToFreezePartials_ > 0 ) || ( updateRatioToFreezePartials_ > 0.0 );
+    }
+
     //! Boolean denoting whether the residuals and parameters from the each iteration are to be saved
     bool saveResidualsAndParametersFromEachIteration_;
 
@@ -691,6 +894,16 @@ public:
 
     bool applyFinalParameterCorrection_;
 
+    //! Boolean denoting whether the arc-wise parameters are eliminated (per arc) when solving the normal equations
+    bool eliminateArcWiseParameters_;
+
+    //! Index of the first iteration in which the variational equations and partials are frozen (disabled if smaller
+    //! than 1)
+    int iterationToFreezePartials_;
+
+    //! Ratio of parameter update to formal error below which the variational equations and partials are frozen
+    //! (disabled if equal to or smaller than 0)
+    double updateRatioToFreezePartials_;
 
 };
 
@@ -741,7 +954,7 @@ struct CovarianceAnalysisOutput
         exceptionDuringPropagation_( exceptionDuringPropagation )
     {
         considerParametersIncluded_ = false;
-        if ( designMatrixConsiderParameters.size( ) > 0 && considerNormalizationFactors.size( ) > 0 && considerCovarianceContribution.size( ) > 0 )
+        if ( considerNormalizationFactors.size( ) > 0 && considerCovarianceContribution.size( ) > 0 )
         {
             considerParametersIncluded_ = true;
         }
@@ -818,26 +1031,55 @@ struct CovarianceAnalysisOutput
      */
     Eigen::MatrixXd getUnnormalizedDesignMatrix( )
     {
+        Eigen::MatrixXd normalizedDesignMatrix = getNormalizedDesignMatrix( );
         Eigen::MatrixXd unnormalizedPartialDerivatives = Eigen::MatrixXd::Zero(
-                    normalizedDesignMatrix_.rows( ), normalizedDesignMatrix_.cols( ) );
+                    normalizedDesignMatrix.rows( ), normalizedDesignMatrix.cols( ) );
 
         for( int i = 0; i < designMatrixTransformationDiagonal_.rows( ); i++ )
         {
-            unnormalizedPartialDerivatives.block( 0, i, normalizedDesignMatrix_.rows( ), 1 ) =
-                    normalizedDesignMatrix_.block( 0, i, normalizedDesignMatrix_.rows( ), 1 ) *
+            unnormalizedPartialDerivatives.block( 0, i, normalizedDesignMatrix.rows( ), 1 ) =
+                    normalizedDesignMatrix.block( 0, i, normalizedDesignMatrix.rows( ), 1 ) *
                     designMatrixTransformationDiagonal_( i );
         }
         return unnormalizedPartialDerivatives;
     }
 
+    //! Function to retrieve the matrix of normalized partial derivatives
+    /*!
+     * Function to retrieve the matrix of normalized partial derivatives. If only the block-sparse design matrix is
+     * stored, it is converted to a dense matrix.
+     * \return Matrix of normalized partial derivatives
+     */
     Eigen::MatrixXd getNormalizedDesignMatrix( )
     {
+        if( normalizedDesignMatrix_.size( ) == 0 && normalizedBlockSparseDesignMatrix_ != nullptr )
+        {
+            return normalizedBlockSparseDesignMatrix_->getDenseMatrix( );
+        }
         return normalizedDesignMatrix_;
     }
 
+    //! Function to retrieve the block-sparse matrix of normalized partial derivatives
+    /*!
+     * Function to retrieve the block-sparse matrix of normalized partial derivatives, which is only set for an estimation
+     * from the normal equations (see CovarianceAnalysisInput::setSaveBlockSparseDesignMatrix)
+     * \return Block-sparse matrix of normalized partial derivatives (nullptr if not set)
+     */
+    std::shared_ptr< linear_algebra::BlockSparseDesignMatrix > getNormalizedBlockSparseDesignMatrix( )
+    {
+        return normalizedBlockSparseDesignMatrix_;
+    }
+
+    //! Function to set the block-sparse matrix of normalized partial derivatives
+    void setNormalizedBlockSparseDesignMatrix(
+            const std::shared_ptr< linear_algebra::BlockSparseDesignMatrix > normalizedBlockSparseDesignMatrix )
+    {
+        normalizedBlockSparseDesignMatrix_ = normalizedBlockSparseDesignMatrix;
+    }
+
     Eigen::MatrixXd getNormalizedWeightedDesignMatrix( )
     {
-        Eigen::MatrixXd weightedNormalizedDesignMatrix = normalizedDesignMatrix_;
+        Eigen::MatrixXd weightedNormalizedDesignMatrix = getNormalizedDesignMatrix( );
         scaleDesignMatrixWithWeights( weightedNormalizedDesignMatrix, weightsMatrixDiagonal_ );
         return weightedNormalizedDesignMatrix;
     }
@@ -912,6 +1154,10 @@ struct CovarianceAnalysisOutput
     //! Matrix of observation partials (normalixed) used in estimation (may be empty if so requested)
     Eigen::MatrixXd normalizedDesignMatrix_;
 
+    //! Block-sparse matrix of observation partials (normalized) used in estimation from normal equations (nullptr if
+    //! not saved)
+    std::shared_ptr< linear_algebra::BlockSparseDesignMatrix > normalizedBlockSparseDesignMatrix_;
+
     //! Diagonal of weights matrix used in the estimation
     Eigen::VectorXd weightsMatrixDiagonal_;
 
@@ -1000,7 +1246,7 @@ struct EstimationOutput: public CovarianceAnalysisOutput< ObservationScalarType,
         residualHistory_( residualHistory ),
         parameterHistory_( parameterHistory ),
         exceptionDuringInversion_( exceptionDuringInversion ),
-        numberOfParameters_( normalizedDesignMatrix.cols( ) )
+        numberOfParameters_( inverseNormalizedCovarianceMatrix.rows( ) )
     { }
 
 
@@ -32,7 +32,9 @@ namespace propagators
 //! Base class for interface object of interpolation of numerically propagated state transition and sensitivity matrices.
 /*!
  *  Base class for interface object of interpolation of numerically propagated state transition and sensitivity matrices.
- *  Derived classes implement the case of single-arc/multi-arc/combined dynamics.
+ *  Derived classes implement the case of single-arc/multi-arc/combined dynamics. The functions retrieving the matrices
+ *  do not store intermediate results in the object, so that they may be called concurrently, as is done when computing
+ *  the observation partials on multiple threads.
  */
 class CombinedStateTransitionAndSensitivityMatrixInterface
 {
@@ -144,9 +146,6 @@ public:
         stateTransitionMatrixInterpolator_( stateTransitionMatrixInterpolator ),
         sensitivityMatrixInterpolator_( sensitivityMatrixInterpolator )
     {
-        combinedStateTransitionMatrix_ = Eigen::MatrixXd::Zero(
-                        stateTransitionMatrixSize_, stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
-
         // Re-order state partial addition indices to match ephemeris update order (inverted in variational equations object)
         statePartialAdditionIndices_.clear( );
         for ( int i = statePartialAdditionIndices.size( ) - 1; i >= 0 ; i-- )
@@ -237,9 +236,6 @@ public:
 
 private:
 
-    //! Predefined matrix to use as return value when calling getCombinedStateTransitionAndSensitivityMatrix.
-    Eigen::MatrixXd combinedStateTransitionMatrix_;
-
     //! Interpolator returning the state transition matrix as a function of time.
     std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
     stateTransitionMatrixInterpolator_;
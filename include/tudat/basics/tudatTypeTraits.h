@@ -91,6 +91,12 @@ struct is_state_scalar_and_time_type {
 template <typename TimeType>
 struct scalar_type;
 
+template <>
+struct scalar_type< float >
+{
+    using value_type = float;
+};
+
 template <>
 struct scalar_type< double >
 {
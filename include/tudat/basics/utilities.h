@@ -11,6 +11,7 @@
 #ifndef TUDAT_UTILITIES_H
 #define TUDAT_UTILITIES_H
 
+#include <cstdint>
 #include <unordered_map>
 #include <map>
 #include <vector>
@@ -1093,6 +1094,52 @@ bool compareStlVectors( const std::vector<T>& v1, const std::vector<T>& v2)
     std::sort(v2Sort.begin(), v2Sort.end());
     return v1Sort == v2Sort;
 }
+
+//! Function to determine the number of threads to use for a parallel computation
+/*!
+ *  Function to determine the number of threads to use for a parallel computation, limited to the number of
+ *  (independent) iterations of the computation.
+ *  \param requestedNumberOfThreads Requested number of threads; if 0, the number of concurrent threads supported by
+ *  the hardware is used
+ *  \param numberOfIterations Number of independent iterations of the computation
+ *  \return Number of threads to use (at least 1)
+ */
+unsigned int getNumberOfThreadsToUse( const unsigned int requestedNumberOfThreads,
+                                      const unsigned int numberOfIterations );
+
+//! Function to evaluate the iterations of a loop in parallel
+/*!
+ *  Function to evaluate the iterations of a loop in parallel, by dividing the iterations 0...(numberOfIterations-1)
+ *  into contiguous blocks of (nearly) equal size, which are each evaluated on a separate thread. The iterations must be
+ *  independent: the loopFunction may only modify data that is exclusive to the iteration. Since each iteration is
+ *  evaluated in the same manner irrespective of the number of threads, the results do not depend on the number of
+ *  threads. An exception thrown in any of the iterations is rethrown on the calling thread, after all threads have
+ *  finished. If a thread cannot be started, the threads that were already started are joined, after which the exception
+ *  is rethrown.
+ *  \param numberOfIterations Number of iterations of the loop
+ *  \param loopFunction Function evaluating a single iteration, with the iteration index as input
+ *  \param numberOfThreads Number of threads to use (see getNumberOfThreadsToUse); if 1, the loop is evaluated on the
+ *  calling thread
+ */
+void parallelFor( const unsigned int numberOfIterations,
+                  const std::function< void( const unsigned int ) >& loopFunction,
+                  const unsigned int numberOfThreads );
+
+//! Initial value (offset basis) of a 64-bit FNV-1a hash
+const uint64_t FNV1A_HASH_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+
+//! Function to update a 64-bit FNV-1a hash with a block of data
+/*!
+ *  Function to update a 64-bit FNV-1a hash with a block of data, used to identify the input from which cached data
+ *  (e.g. precomputed aerodynamic coefficients or atmosphere tables) was generated. The hash of a sequence of blocks is
+ *  computed by starting from FNV1A_HASH_OFFSET_BASIS, and updating it with each of the blocks in turn.
+ *  \param hash Current value of the hash
+ *  \param data Pointer to the data with which the hash is to be updated
+ *  \param numberOfBytes Number of bytes of data with which the hash is to be updated
+ *  \return Updated value of the hash
+ */
+uint64_t updateFnv1aHash( uint64_t hash, const void* data, const std::size_t numberOfBytes );
+
 } // namespace utilities
 
 } // namespace tudat
@@ -56,7 +56,8 @@ inline void from_json( const nlohmann::json& jsonObject, InterpolatorTypes& oneD
 static std::map< AvailableLookupScheme, std::string > lookupSchemeTypes =
 {
     { huntingAlgorithm, "huntingAlgorithm" },
-    { binarySearch, "binarySearch" }
+    { binarySearch, "binarySearch" },
+    { equidistantLookup, "equidistantLookup" }
 };
 
 //! `AvailableLookupScheme`s not supported by `json_interface`.
@@ -13,6 +13,7 @@
 
 #include "basic/basicFunction.h"
 #include "basic/basicMathematicsFunctions.h"
+#include "basic/blockSparseDesignMatrix.h"
 #include "basic/convergenceException.h"
 #include "basic/coordinateConversions.h"
 #include "basic/function.h"
@@ -26,5 +27,6 @@
 #include "basic/rotationAboutArbitraryAxis.h"
 #include "basic/rotationRepresentations.h"
 #include "basic/sphericalHarmonics.h"
+#include "basic/squareRootInformationFilter.h"
 
 #endif // TUDAT_BASIC_H
@@ -0,0 +1,218 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_BLOCKSPARSEDESIGNMATRIX_H
+#define TUDAT_BLOCKSPARSEDESIGNMATRIX_H
+
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace linear_algebra
+{
+
+//! Function to merge a list of (possibly overlapping or adjacent) blocks of columns
+/*!
+ * Function to merge a list of (possibly overlapping or adjacent) blocks of columns into a sorted list of disjoint,
+ * non-adjacent blocks. Blocks of size 0 are removed.
+ * \param columnBlocks List of blocks of columns, each defined by its start index and size
+ * \return Sorted list of merged blocks of columns, each defined by its start index and size
+ */
+std::vector< std::pair< int, int > > mergeColumnBlocks(
+        const std::vector< std::pair< int, int > >& columnBlocks );
+
+//! Function to determine the blocks of columns of a matrix that contain non-zero entries
+/*!
+ * Function to determine the blocks of columns of a matrix that contain non-zero entries, from a list of candidate
+ * blocks outside of which all entries are known to be zero (for instance from the parameter indices of the observation
+ * partials). Each candidate block is reduced to the range(s) of consecutive columns that contain at least one non-zero
+ * entry.
+ * \param matrix Matrix for which the non-zero blocks of columns are to be determined
+ * \param candidateColumnBlocks Blocks of columns (start index and size) that may contain non-zero entries
+ * \return Sorted list of disjoint blocks of columns (start index and size) that contain non-zero entries
+ */
+std::vector< std::pair< int, int > > getNonZeroColumnBlocks(
+        const Eigen::MatrixXd& matrix,
+        const std::vector< std::pair< int, int > >& candidateColumnBlocks );
+
+//! Function to add a block of observations with block-sparse partials to the normal equations
+/*!
+ * Function to add a block of observations to the normal equations, as addObservationsToNormalEquations, for partials
+ * that are only non-zero in a given set of blocks of columns. Only the products of the non-zero blocks of columns are
+ * computed, so that the cost scales with the square of the number of non-zero columns, instead of the total number of
+ * columns.
+ * \param designMatrixBlock Matrix containing partial derivatives of the block of observations (rows) w.r.t. all
+ * estimated parameters (columns)
+ * \param columnBlocks Disjoint blocks of columns (start index and size) outside of which designMatrixBlock is zero
+ * \param observationResidualsBlock Difference between measured and simulated observations of the block
+ * \param diagonalOfWeightMatrixBlock Diagonal of observation weights matrix of the block
+ * \param normalMatrix Normal matrix to which H^T W H of the block is added (returned by reference)
+ * \param normalRightHandSide Right-hand side of the normal equations to which H^T W y of the block is added (returned by
+ * reference)
+ */
+void addObservationsToNormalEquations(
+        const Eigen::MatrixXd& designMatrixBlock,
+        const std::vector< std::pair< int, int > >& columnBlocks,
+        const Eigen::VectorXd& observationResidualsBlock,
+        const Eigen::VectorXd& diagonalOfWeightMatrixBlock,
+        Eigen::MatrixXd& normalMatrix,
+        Eigen::VectorXd& normalRightHandSide );
+
+//! Design matrix stored as a set of dense sub-blocks
+/*!
+ * Design matrix (matrix of partial derivatives of observations w.r.t. parameters) in which only the non-zero sub-blocks
+ * are stored. The matrix is divided into blocks of rows (typically one per set of observations), and for each block of
+ * rows only the entries in a list of blocks of columns are stored (e.g. the partials w.r.t. the parameters of the
+ * ground stations, arcs and link ends involved in the observations). All other entries are zero. Products with the
+ * matrix, and the normal equations, are computed from the stored sub-blocks only.
+ */
+class BlockSparseDesignMatrix
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor, creating a matrix with all entries equal to zero
+     * \param numberOfRows Number of rows of the matrix (observations)
+     * \param numberOfColumns Number of columns of the matrix (parameters)
+     */
+    BlockSparseDesignMatrix( const int numberOfRows = 0, const int numberOfColumns = 0 );
+
+    //! Function to add a block of rows to the matrix
+    /*!
+     * Function to add a block of rows to the matrix, of which only the entries in the given blocks of columns are
+     * stored. The rows must not overlap with the rows of any of the blocks that were added previously.
+     * \param firstRow Index of the first row of the block in the matrix
+     * \param rowBlock Entries of the block of rows, for all columns of the matrix
+     * \param columnBlocks Blocks of columns (start index and size) of the entries that are stored; if empty, the blocks
+     * containing non-zero entries are determined from the entries of rowBlock
+     */
+    void addRowBlock(
+            const int firstRow,
+            const Eigen::MatrixXd& rowBlock,
+            const std::vector< std::pair< int, int > >& columnBlocks = std::vector< std::pair< int, int > >( ) );
+
+    //! Function to add all blocks of rows of another matrix (of the same size) to this matrix
+    /*!
+     * Function to add all blocks of rows of another matrix (of the same size) to this matrix, e.g. to combine matrices
+     * that were filled on different threads. The blocks of rows are stored in order of their first row, so that the
+     * result does not depend on the order in which the blocks were added.
+     * \param otherMatrix Matrix of which the blocks of rows are to be added to this matrix
+     */
+    void addRowBlocks( const BlockSparseDesignMatrix& otherMatrix );
+
+    //! Function to multiply the columns of the matrix by a set of factors
+    /*!
+     * Function to multiply the columns of the matrix by a set of factors (e.g. the inverse of the normalization terms
+     * of the parameters)
+     * \param scalingFactors Factor by which each column of the matrix is multiplied
+     */
+    void scaleColumns( const Eigen::VectorXd& scalingFactors );
+
+    //! Function to create a matrix consisting of a subset of the columns of this matrix
+    /*!
+     * Function to create a matrix consisting of a subset of the columns of this matrix (e.g. the columns of the
+     * estimated parameters in the full parameter vector)
+     * \param columnIndices Indices of the columns of this matrix that form the columns of the new matrix (in order)
+     * \return Matrix consisting of the selected columns
+     */
+    BlockSparseDesignMatrix getColumnSubset( const std::vector< int >& columnIndices ) const;
+
+    //! Function to compute the product H x of the matrix with a vector
+    Eigen::VectorXd multiply( const Eigen::VectorXd& vector ) const;
+
+    //! Function to compute the product H^T y of the transpose of the matrix with a vector
+    Eigen::VectorXd multiplyTranspose( const Eigen::VectorXd& vector ) const;
+
+    //! Function to compute the normal equations of the matrix
+    /*!
+     * Function to compute the normal matrix H^T W H and its right-hand side H^T W y, using only the products of the
+     * stored sub-blocks of each block of rows
+     * \param observationResiduals Residuals y of the observations
+     * \param diagonalOfWeightMatrix Diagonal of the weights matrix W of the observations
+     * \param normalMatrix Normal matrix H^T W H (returned by reference)
+     * \param normalRightHandSide Right-hand side of the normal equations H^T W y (returned by reference)
+     */
+    void computeNormalEquations(
+            const Eigen::VectorXd& observationResiduals,
+            const Eigen::VectorXd& diagonalOfWeightMatrix,
+            Eigen::MatrixXd& normalMatrix,
+            Eigen::VectorXd& normalRightHandSide ) const;
+
+    //! Function to create the equivalent dense matrix
+    Eigen::MatrixXd getDenseMatrix( ) const;
+
+    //! Function to retrieve the number of rows of the matrix
+    int getNumberOfRows( ) const
+    {
+        return numberOfRows_;
+    }
+
+    //! Function to retrieve the number of columns of the matrix
+    int getNumberOfColumns( ) const
+    {
+        return numberOfColumns_;
+    }
+
+    //! Function to retrieve the number of blocks of rows that have been added to the matrix
+    int getNumberOfRowBlocks( ) const
+    {
+        return static_cast< int >( rowBlockStartAndSize_.size( ) );
+    }
+
+    //! Function to retrieve the start index and size of each block of rows
+    const std::vector< std::pair< int, int > >& getRowBlockStartAndSize( ) const
+    {
+        return rowBlockStartAndSize_;
+    }
+
+    //! Function to retrieve the blocks of columns (start index and size) that are stored for each block of rows
+    const std::vector< std::vector< std::pair< int, int > > >& getColumnBlocks( ) const
+    {
+        return columnBlocks_;
+    }
+
+    //! Function to retrieve the number of matrix entries that are stored
+    long long getNumberOfStoredEntries( ) const;
+
+protected:
+
+    //! Function to insert a block of rows with its (already extracted) sub-blocks, sorted by first row
+    void insertRowBlock(
+            const std::pair< int, int >& rowStartAndSize,
+            const std::vector< std::pair< int, int > >& columnBlocks,
+            const std::vector< Eigen::MatrixXd >& subBlocks );
+
+    //! Number of rows of the matrix
+    int numberOfRows_;
+
+    //! Number of columns of the matrix
+    int numberOfColumns_;
+
+    //! Start index and size of each block of rows (sorted by start index)
+    std::vector< std::pair< int, int > > rowBlockStartAndSize_;
+
+    //! Blocks of columns (start index and size) that are stored, for each block of rows
+    std::vector< std::vector< std::pair< int, int > > > columnBlocks_;
+
+    //! Stored entries, for each block of rows and each of its blocks of columns
+    std::vector< std::vector< Eigen::MatrixXd > > subBlocks_;
+};
+
+} // namespace linear_algebra
+
+} // namespace tudat
+
+#endif // TUDAT_BLOCKSPARSEDESIGNMATRIX_H
@@ -16,6 +16,7 @@
 #define TUDAT_LEASTSQUARESESTIMATION_H
 
 #include <map>
+#include <vector>
 
 #include <Eigen/Core>
 #include <Eigen/SVD>
@@ -104,6 +105,20 @@ Eigen::MatrixXd calculateInverseOfUpdatedCovarianceMatrix(
         const Eigen::VectorXd& diagonalOfWeightMatrix,
         const double limitConditionNumberForWarning = 1.0E8 );
 
+//! Function to add linear constraints to the inverse covariance matrix, using Lagrange multipliers
+/*!
+ * Function to add linear constraints to the inverse covariance matrix, using Lagrange multipliers. The matrix is
+ * extended with the constraint multipliers, to size (parameters + constraints) x (parameters + constraints).
+ * \param inverseOfCovarianceMatrix Inverse covariance matrix to which the constraints are to be added (modified by
+ * this function)
+ * \param constraintMultiplier Multiplier for estimated parameter that defines linear constraint
+ * \param constraintRightHandside Right-hand side estimation linear constraint
+ */
+void addConstraintsToInverseCovarianceMatrix(
+        Eigen::MatrixXd& inverseOfCovarianceMatrix,
+        const Eigen::MatrixXd& constraintMultiplier,
+        const Eigen::VectorXd& constraintRightHandside );
+
 Eigen::MatrixXd calculateConsiderParametersCovarianceContribution(
         const Eigen::MatrixXd& normalisedCovarianceMatrix,
         const Eigen::MatrixXd& designMatrix,
@@ -173,6 +188,99 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromD
         const Eigen::VectorXd& observationResiduals,
         const double limitConditionNumberForWarning = 1.0E8 );
 
+//! Function to add the contribution of a block of observations to the normal equations
+/*!
+ * Function to add the contribution of a block of observations to the normal equations, i.e. to add H^T W H to the
+ * normal matrix and H^T W y to its right-hand side, with H, W and y the partials, weights and residuals of the block.
+ * By adding all observations block by block, the full design matrix need not be stored.
+ * \param designMatrixBlock Matrix containing partial derivatives of the block of observations (rows) w.r.t. estimated
+ * parameters (columns)
+ * \param observationResidualsBlock Difference between measured and simulated observations of the block
+ * \param diagonalOfWeightMatrixBlock Diagonal of observation weights matrix of the block
+ * \param normalMatrix Normal matrix, to which the contribution of the block is added (modified by this function)
+ * \param normalRightHandSide Right-hand side of normal equations, to which the contribution of the block is added
+ * (modified by this function)
+ */
+void addObservationsToNormalEquations(
+        const Eigen::MatrixXd& designMatrixBlock,
+        const Eigen::VectorXd& observationResidualsBlock,
+        const Eigen::VectorXd& diagonalOfWeightMatrixBlock,
+        Eigen::MatrixXd& normalMatrix,
+        Eigen::VectorXd& normalRightHandSide );
+
+//! Function to partition a subset of the parameters into blocks that are mutually uncoupled in a symmetric matrix
+/*!
+ * Function to partition a subset of the parameters into blocks that are mutually uncoupled in a symmetric matrix (e.g.
+ * the inverse covariance matrix), such that the matrix entries between parameters in different blocks are all zero.
+ * Typically used to find the arc-wise parameters of each arc in a multi-arc estimation, which couple only to
+ * parameters of their own arc and to the global parameters.
+ * \param symmetricMatrix Symmetric matrix from which the coupling between the parameters is determined
+ * \param candidateParameterIndices Indices of the parameters that are to be partitioned into blocks
+ * \return List of blocks of parameter indices (each in ascending order), ordered by their first index
+ */
+std::vector< std::vector< int > > getDecoupledParameterBlocks(
+        const Eigen::MatrixXd& symmetricMatrix,
+        const std::vector< int >& candidateParameterIndices );
+
+//! Function to solve a symmetric positive definite system of equations by elimination of mutually uncoupled blocks of
+//! parameters
+/*!
+ * Function to solve a symmetric positive definite system of equations A*x = b by elimination of mutually uncoupled
+ * blocks of (local) parameters. For a matrix with a block-arrow structure, in which the local parameter blocks couple
+ * only to themselves and to the global parameters (all parameters not in any of the blocks), each local block is
+ * eliminated (in parallel) using its Schur complement, after which the (small) reduced system for the global
+ * parameters is solved, and the local parameters are obtained by back-substitution. The computational cost is linear
+ * in the number of blocks, instead of cubic in the total number of parameters.
+ * \param matrixToInvert Symmetric positive definite matrix A
+ * \param rightHandSideVector Vector b on the righthandside of the matrix equation that is to be solved
+ * \param localParameterBlocks Blocks of local parameters, which must be mutually uncoupled in matrixToInvert (see
+ * getDecoupledParameterBlocks)
+ * \param solution Solution x of matrix equation A*x=b (returned by reference)
+ * \param limitConditionNumberForWarning Maximum value of the (estimated) condition number of the reduced system that is
+ * allowed (warning printed when exceeded)
+ * \param numberOfThreads Number of threads used to eliminate the local blocks (0 to use all hardware threads)
+ * \return True if the system was solved, false if any of the local blocks, or the reduced system, is not positive
+ * definite (in which case the solution is not set)
+ */
+bool solveSystemOfEquationsWithSchurComplement(
+        const Eigen::MatrixXd& matrixToInvert,
+        const Eigen::VectorXd& rightHandSideVector,
+        const std::vector< std::vector< int > >& localParameterBlocks,
+        Eigen::VectorXd& solution,
+        const double limitConditionNumberForWarning = 1.0E8,
+        const unsigned int numberOfThreads = 1 );
+
+//! Function to perform an iteration of least squares estimation from the normal equations, a priori information and
+//! constraints
+/*!
+ * Function to perform an iteration of least squares estimation from the normal equations (H^T W H and H^T W y), a
+ * priori information and constraints. The result is equal to that of performLeastSquaresAdjustmentFromDesignMatrix
+ * for the same observations, but does not require the design matrix. Without constraints, the system is solved using
+ * an LDLT decomposition (with the SVD used as fallback if the matrix is not positive definite); with constraints the
+ * SVD is used. If local parameters are provided (and no constraints are used), the mutually uncoupled blocks of local
+ * parameters (e.g. the arc-wise parameters of each arc in a multi-arc estimation) are eliminated using
+ * solveSystemOfEquationsWithSchurComplement.
+ * \param normalMatrix Normal matrix H^T W H
+ * \param normalRightHandSide Right-hand side of normal equations H^T W y
+ * \param inverseOfAPrioriCovarianceMatrix Inverse of a priori covariance matrix
+ * \param limitConditionNumberForWarning Maximum value of the condition number of the covariance matrix that is allowed
+ * (warning printed when exceeded; condition number estimated from LDLT decomposition if it is used)
+ * \param constraintMultiplier Multiplier for estimated parameter that defines linear constraint
+ * \param constraintRightHandside Right-hand side estimation linear constraint
+ * \param localParameterIndices Indices of parameters that are candidates for elimination as local parameters (empty to
+ * solve the full system)
+ * \param numberOfThreads Number of threads used to eliminate the local parameter blocks (0 to use all hardware threads)
+ * \return Pair containing: (first: parameter adjustment, second: inverse covariance)
+ */
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromNormalEquations(
+        const Eigen::MatrixXd& normalMatrix,
+        const Eigen::VectorXd& normalRightHandSide,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const double limitConditionNumberForWarning = 1.0E8,
+        const Eigen::MatrixXd& constraintMultiplier = Eigen::MatrixXd( 0, 0 ),
+        const Eigen::VectorXd& constraintRightHandside = Eigen::VectorXd( 0 ),
+        const std::vector< int >& localParameterIndices = std::vector< int >( ),
+        const unsigned int numberOfThreads = 1 );
 
 Eigen::VectorXd evaluatePolynomial(
     const Eigen::VectorXd& independentValues,
@@ -0,0 +1,209 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References:
+ *      Bierman, G.J., Factorization Methods for Discrete Sequential Estimation, Academic Press, 1977.
+ */
+
+#ifndef TUDAT_SQUAREROOTINFORMATIONFILTER_H
+#define TUDAT_SQUAREROOTINFORMATIONFILTER_H
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace linear_algebra
+{
+
+//! Square-root information filter (SRIF), for sequential least squares estimation
+/*!
+ * Square-root information filter (SRIF), for sequential least squares estimation. The information of all observations
+ * that have been processed is stored in the upper-triangular square-root information matrix R and the vector z, such
+ * that R^T R is equal to the inverse covariance (information) matrix H^T W H (plus the a priori information), and R^T z
+ * is equal to H^T W y. Blocks of observations are added by a Householder QR decomposition of the matrix formed by
+ * stacking the current [R z] on top of the weighted [H y] of the new observations. Since the normal equations are never
+ * formed, the condition number of the problem that is solved is the square root of that of the normal equations. The
+ * observations can be added in any number of blocks, so that the estimate can be updated incrementally when new
+ * observations become available, and process noise can be added between blocks (Bierman, 1977).
+ */
+class SquareRootInformationFilter
+{
+public:
+
+    //! Constructor, without a priori information
+    /*!
+     * Constructor, without a priori information
+     * \param numberOfParameters Number of estimated parameters
+     */
+    SquareRootInformationFilter( const int numberOfParameters );
+
+    //! Constructor, with a priori information
+    /*!
+     * Constructor, with a priori information (with a priori parameter deviation equal to zero)
+     * \param inverseOfAPrioriCovarianceMatrix Inverse of a priori covariance matrix (must be positive semi-definite)
+     */
+    SquareRootInformationFilter( const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix );
+
+    //! Constructor, from existing square-root information
+    /*!
+     * Constructor, from existing square-root information
+     * \param squareRootInformationMatrix Square-root information matrix (triangularized if it is not upper-triangular)
+     * \param squareRootInformationVector Square-root information vector
+     * \param residualSumOfSquares Least squares cost function of the information
+     */
+    SquareRootInformationFilter(
+            const Eigen::MatrixXd& squareRootInformationMatrix,
+            const Eigen::VectorXd& squareRootInformationVector,
+            const double residualSumOfSquares = 0.0 );
+
+    //! Function to add a block of observations to the filter
+    /*!
+     * Function to add a block of observations to the filter, by triangularizing the current square-root information
+     * matrix, stacked on top of the weighted observation partials.
+     * \param designMatrixBlock Matrix containing partial derivatives of the block of observations (rows) w.r.t. estimated
+     * parameters (columns)
+     * \param observationResidualsBlock Difference between measured and simulated observations of the block
+     * \param diagonalOfWeightMatrixBlock Diagonal of observation weights matrix of the block
+     */
+    void addObservations(
+            const Eigen::MatrixXd& designMatrixBlock,
+            const Eigen::VectorXd& observationResidualsBlock,
+            const Eigen::VectorXd& diagonalOfWeightMatrixBlock );
+
+    //! Function to add the information of another square-root information filter to this filter
+    /*!
+     * Function to add the information of another square-root information filter (for the same parameters) to this
+     * filter, e.g. to combine the information of observations that were processed in parallel.
+     * \param squareRootInformationMatrix Square-root information matrix that is to be added (need not be triangular)
+     * \param squareRootInformationVector Square-root information vector that is to be added
+     * \param residualSumOfSquares Least squares cost function of the information that is to be added
+     */
+    void addSquareRootInformation(
+            const Eigen::MatrixXd& squareRootInformationMatrix,
+            const Eigen::VectorXd& squareRootInformationVector,
+            const double residualSumOfSquares = 0.0 );
+
+    //! Function to add the information of another square-root information filter to this filter
+    /*!
+     * Function to add the information of another square-root information filter (for the same parameters) to this
+     * filter, e.g. to combine the information of observations that were processed in parallel.
+     * \param otherFilter Filter of which the information is to be added
+     */
+    void addSquareRootInformation( const SquareRootInformationFilter& otherFilter )
+    {
+        addSquareRootInformation( otherFilter.squareRootInformationMatrix_, otherFilter.squareRootInformationVector_,
+                                  otherFilter.residualSumOfSquares_ );
+    }
+
+    //! Function to add a priori information to the filter
+    /*!
+     * Function to add a priori information (with a priori parameter deviation equal to zero) to the filter. The square
+     * root of the information matrix is computed from its eigenvalue decomposition, so that it may be singular.
+     * \param inverseOfAPrioriCovarianceMatrix Inverse of a priori covariance matrix (must be positive semi-definite)
+     */
+    void addAprioriInformation( const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix );
+
+    //! Function to add process noise to the estimated parameters
+    /*!
+     * Function to add process noise to the estimated parameters, to be called between two blocks of observations. The
+     * parameters after the noise is added are x' = x + G w, with G the noise mapping matrix, and w zero-mean noise with
+     * covariance Q. The noise is eliminated from the information equations by a Householder QR decomposition of the
+     * augmented matrix [ R_w 0 0; -R G R z ], with R_w^T R_w = Q^-1 (Bierman, 1977).
+     * \param noiseMappingMatrix Matrix G mapping the noise to the estimated parameters
+     * \param processNoiseCovariance Covariance Q of the noise (must be positive definite)
+     */
+    void addProcessNoise(
+            const Eigen::MatrixXd& noiseMappingMatrix,
+            const Eigen::MatrixXd& processNoiseCovariance );
+
+    //! Function to rescale the estimated parameters
+    /*!
+     * Function to rescale the estimated parameters, such that the filter estimates x_i * s_i instead of x_i (for
+     * instance to estimate parameters normalized by the magnitude of their partials). The columns of the
+     * square-root information matrix are divided by the scaling factors.
+     * \param scalingFactors Factors s_i by which the parameters are multiplied
+     */
+    void scaleParameters( const Eigen::VectorXd& scalingFactors );
+
+    //! Function to compute the current parameter estimate
+    /*!
+     * Function to compute the current parameter estimate, by back-substitution of R x = z.
+     * \param limitConditionNumberForWarning Maximum value of the condition number of the information matrix that is
+     * allowed (warning printed when exceeded; condition number estimated from the diagonal of R)
+     * \return Current parameter estimate
+     */
+    Eigen::VectorXd getParameterEstimate( const double limitConditionNumberForWarning = 1.0E8 ) const;
+
+    //! Function to compute the information (inverse covariance) matrix R^T R
+    Eigen::MatrixXd getInformationMatrix( ) const
+    {
+        return squareRootInformationMatrix_.transpose( ) * squareRootInformationMatrix_;
+    }
+
+    //! Function to compute the covariance matrix R^-1 R^-T
+    Eigen::MatrixXd getCovarianceMatrix( ) const;
+
+    //! Function to retrieve the upper-triangular square-root information matrix R
+    const Eigen::MatrixXd& getSquareRootInformationMatrix( ) const
+    {
+        return squareRootInformationMatrix_;
+    }
+
+    //! Function to retrieve the square-root information vector z
+    const Eigen::VectorXd& getSquareRootInformationVector( ) const
+    {
+        return squareRootInformationVector_;
+    }
+
+    //! Function to retrieve the least squares cost function (weighted sum of squares of the post-fit residuals,
+    //! including those of the a priori information) at the current parameter estimate
+    double getResidualSumOfSquares( ) const
+    {
+        return residualSumOfSquares_;
+    }
+
+    int getNumberOfParameters( ) const
+    {
+        return numberOfParameters_;
+    }
+
+protected:
+
+    //! Function to triangularize an augmented matrix [A b], and set its upper part as the new [R z]
+    /*!
+     * Function to triangularize an augmented matrix [A b] using a Householder QR decomposition, after which the upper
+     * n rows of the triangularized matrix (with n the number of parameters) are set as the new [R z], and the square of
+     * the remaining entry in the last column is added to the least squares cost function.
+     * \param augmentedMatrix Augmented matrix that is to be triangularized, of which the last numberOfParameters_ + 1
+     * columns are [A b]
+     * \param numberOfLeadingColumns Number of columns preceding [A b] (e.g. process noise) that are eliminated first
+     */
+    void triangularizeAugmentedMatrix(
+            const Eigen::MatrixXd& augmentedMatrix,
+            const int numberOfLeadingColumns = 0 );
+
+    //! Number of estimated parameters
+    int numberOfParameters_;
+
+    //! Upper-triangular square-root information matrix R
+    Eigen::MatrixXd squareRootInformationMatrix_;
+
+    //! Square-root information vector z
+    Eigen::VectorXd squareRootInformationVector_;
+
+    //! Least squares cost function at the current parameter estimate
+    double residualSumOfSquares_;
+};
+
+} // namespace linear_algebra
+
+} // namespace tudat
+
+#endif // TUDAT_SQUAREROOTINFORMATIONFILTER_H
@@ -521,20 +521,30 @@ createOneDimensionalInterpolator(
                                   "handling methods have been defined." );
     }
 
+    // Use equidistant lookup scheme if grid allows it
+    std::vector< IndependentVariableType > independentValues;
+    independentValues.reserve( dataToInterpolate.size( ) );
+    for( const auto& dataIterator : dataToInterpolate )
+    {
+        independentValues.push_back( dataIterator.first );
+    }
+    AvailableLookupScheme selectedLookupScheme = selectLookupSchemeForGrid(
+                independentValues, interpolatorSettings->getSelectedLookupScheme( ) );
+
     // Check type of interpolator.
     switch( interpolatorSettings->getInterpolatorType( ) )
     {
     case linear_interpolator:
         createdInterpolator = std::make_shared< LinearInterpolator
                 < IndependentVariableType, DependentVariableType > >(
-                    dataToInterpolate, interpolatorSettings->getSelectedLookupScheme( ),
+                    dataToInterpolate, selectedLookupScheme,
                     interpolatorSettings->getBoundaryHandling( ).at( 0 ), defaultExtrapolationValue );
         break;
     case cubic_spline_interpolator:
     {
             createdInterpolator = std::make_shared< CubicSplineInterpolator
                     < IndependentVariableType, DependentVariableType > >(
-                        dataToInterpolate, interpolatorSettings->getSelectedLookupScheme( ),
+                        dataToInterpolate, selectedLookupScheme,
                         interpolatorSettings->getBoundaryHandling( ).at( 0 ) );
         break;
     }
@@ -548,7 +558,7 @@ createOneDimensionalInterpolator(
                 createdInterpolator = std::make_shared< LagrangeInterpolator
                         < IndependentVariableType, DependentVariableType > >(
                             dataToInterpolate, lagrangeInterpolatorSettings->getInterpolatorOrder( ),
-                            interpolatorSettings->getSelectedLookupScheme( ),
+                            selectedLookupScheme,
                             lagrangeInterpolatorSettings->getLagrangeBoundaryHandling( ),
                             interpolatorSettings->getBoundaryHandling( ).at( 0 ), defaultExtrapolationValue );
 
@@ -570,14 +580,14 @@ createOneDimensionalInterpolator(
         createdInterpolator = std::make_shared< HermiteCubicSplineInterpolator
                 < IndependentVariableType, DependentVariableType > >(
                     dataToInterpolate, firstDerivativeOfDependentVariables,
-                    interpolatorSettings->getSelectedLookupScheme( ),
+                    selectedLookupScheme,
                     interpolatorSettings->getBoundaryHandling( ).at( 0 ), defaultExtrapolationValue );
         break;
     }
     case piecewise_constant_interpolator:
         createdInterpolator = std::make_shared< PiecewiseConstantInterpolator
                 < IndependentVariableType, DependentVariableType > >(
-                    dataToInterpolate, interpolatorSettings->getSelectedLookupScheme( ),
+                    dataToInterpolate, selectedLookupScheme,
                     interpolatorSettings->getBoundaryHandling( ).at( 0 ), defaultExtrapolationValue );
         break;
     default:
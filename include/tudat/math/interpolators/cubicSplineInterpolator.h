@@ -298,20 +298,124 @@ public:
 
         // Determine the lower entry in the table corresponding to the target independent variable
         // value.
-        unsigned int lowerEntry_ = lookUpScheme_->findNearestLowerNeighbour( targetIndependentVariableValue );
+        return interpolateInInterval(
+                    targetIndependentVariableValue, lookUpScheme_->findNearestLowerNeighbour( targetIndependentVariableValue ) );
+    }
+
+    //! Function interpolates dependent variable value at given independent variable value, using a caller-owned cursor.
+    /*!
+     *  Function interpolates dependent variable value at given independent variable value, using a caller-owned
+     *  cursor for the interval look-up (see OneDimensionalInterpolator). This function does not modify the interpolator.
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation
+     *      is to take place.
+     *  \param lookUpCursor Cursor storing the state of the sequence of interval look-ups.
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolate( const IndependentVariableType targetIndependentVariableValue,
+                                       LookUpCursor& lookUpCursor ) const
+    {
+        // Check whether boundary handling needs to be applied, if independent variable is beyond its defined range.
+        DependentVariableType interpolatedValue;
+        bool useValue = false;
+        this->checkBoundaryCase( interpolatedValue, useValue, targetIndependentVariableValue );
+        if( useValue )
+        {
+            return interpolatedValue;
+        }
+
+        // Determine the lower entry in the table corresponding to the target independent variable
+        // value.
+        return interpolateInInterval(
+                    targetIndependentVariableValue, lookUpScheme_->findNearestLowerNeighbour( targetIndependentVariableValue, lookUpCursor ) );
+    }
+
+    //! Function to compute the first derivative of the spline at given independent variable value.
+    /*!
+     *  Function to compute the first derivative of the spline at given independent variable value, using a caller-owned
+     *  cursor for the interval look-up. No boundary handling is applied (i.e. the spline is extrapolated outside its
+     *  domain). This function does not modify the interpolator.
+     *  \param targetIndependentVariableValue Value of independent variable at which derivative is to be computed.
+     *  \param lookUpCursor Cursor storing the state of the sequence of interval look-ups.
+     *  \return First derivative of spline w.r.t. independent variable.
+     */
+    DependentVariableType interpolateFirstDerivative( const IndependentVariableType targetIndependentVariableValue,
+                                                      LookUpCursor& lookUpCursor ) const
+    {
+        unsigned int lowerEntry = lookUpScheme_->findNearestLowerNeighbour( targetIndependentVariableValue, lookUpCursor );
+        if ( lowerEntry == independentValues_.size( ) - 1 )
+        {
+            lowerEntry -= 1;
+        }
+
+        // Calculate derivatives of coefficients A,B,C,D (see interpolateInInterval)
+        ScalarType intervalSize = static_cast< ScalarType >(
+                    independentValues_[ lowerEntry + 1 ] - independentValues_[ lowerEntry ] );
+        ScalarType coefficientA = ( independentValues_[ lowerEntry + 1 ] - targetIndependentVariableValue ) / intervalSize;
+        ScalarType coefficientB = mathematical_constants::getFloatingInteger< ScalarType >( 1.0 ) - coefficientA;
+        ScalarType coefficientCDerivative =
+                -( mathematical_constants::getFloatingInteger< ScalarType >( 3.0 ) * coefficientA * coefficientA -
+                   mathematical_constants::getFloatingInteger< ScalarType >( 1.0 ) ) /
+                mathematical_constants::getFloatingInteger< ScalarType >( 6.0 ) * intervalSize;
+        ScalarType coefficientDDerivative =
+                ( mathematical_constants::getFloatingInteger< ScalarType >( 3.0 ) * coefficientB * coefficientB -
+                  mathematical_constants::getFloatingInteger< ScalarType >( 1.0 ) ) /
+                mathematical_constants::getFloatingInteger< ScalarType >( 6.0 ) * intervalSize;
+
+        return ( dependentValues_[ lowerEntry + 1 ] - dependentValues_[ lowerEntry ] ) /
+                intervalSize +
+                coefficientCDerivative * secondDerivativeOfCurve_[ lowerEntry ] +
+                coefficientDDerivative * secondDerivativeOfCurve_[ lowerEntry + 1 ];
+    }
+
+    InterpolatorTypes getInterpolatorType( ){ return cubic_spline_interpolator; }
 
-        // If lowerEntry_ is the last element of independentValues_, execute extrapolation with
+protected:
+
+    //! Function to perform interpolation at a set of sorted independent variable values.
+    /*!
+     *  Function to perform interpolation at a set of independent variable values, sorted in ascending order, in a single
+     *  sweep through the independent variable grid (see OneDimensionalInterpolator::interpolateSortedBatchInSweep).
+     *  \param independentVariableValues Pointer to first of the (sorted) independent variable values at which the value
+     *      of the dependent variable is to be determined.
+     *  \param numberOfValues Number of independent variable values.
+     *  \param interpolatedValues Pointer to first entry of buffer to which interpolated values are written.
+     */
+    void interpolateSortedBatch( const IndependentVariableType* independentVariableValues,
+                                 const int numberOfValues,
+                                 DependentVariableType* interpolatedValues ) const
+    {
+        this->interpolateSortedBatchInSweep(
+                    independentVariableValues, numberOfValues, interpolatedValues,
+                    [ this ]( const IndependentVariableType independentVariableValue, const int lowerEntry )
+        {
+            return interpolateInInterval( independentVariableValue, lowerEntry );
+        } );
+    }
+
+    //! Function interpolates dependent variable value in the interval with given lower index.
+    /*!
+     *  Function interpolates dependent variable value in the interval with given lower index (as found by the look-up
+     *  scheme).
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation
+     *      is to take place.
+     *  \param lowerEntry Index of nearest lower neighbour of targetIndependentVariableValue in independentValues_.
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolateInInterval( const IndependentVariableType targetIndependentVariableValue,
+                                                 unsigned int lowerEntry ) const
+    {
+        // If lowerEntry is the last element of independentValues_, execute extrapolation with
         // the last and second to last elements of independentValues_.
-        if ( lowerEntry_ == independentValues_.size( ) - 1 )
+        if ( lowerEntry == independentValues_.size( ) - 1 )
         {
-            lowerEntry_ -= 1;
+            lowerEntry -= 1;
         }
 
         // Get independent variable values bounding interval in which requested value lies.
         IndependentVariableType lowerValue, upperValue;
         ScalarType squareDifference;
-        lowerValue = independentValues_[ lowerEntry_ ];
-        upperValue = independentValues_[ lowerEntry_ + 1 ];
+        lowerValue = independentValues_[ lowerEntry ];
+        upperValue = independentValues_[ lowerEntry + 1 ];
 
         // Calculate coefficients A,B,C,D (see Numerical (Press W.H., et al., 2002))
         squareDifference = static_cast< ScalarType >( upperValue - lowerValue ) *
@@ -325,16 +429,12 @@ public:
                 mathematical_constants::getFloatingInteger< ScalarType >( 6.0 ) * squareDifference;
 
         // The interpolated dependent variable value.
-        return coefficientA_ * dependentValues_[ lowerEntry_ ] +
-                coefficientB_ * dependentValues_[ lowerEntry_ + 1 ] +
-                coefficientC_ * secondDerivativeOfCurve_[ lowerEntry_ ] +
-                coefficientD_ * secondDerivativeOfCurve_[ lowerEntry_ + 1 ];
+        return coefficientA_ * dependentValues_[ lowerEntry ] +
+                coefficientB_ * dependentValues_[ lowerEntry + 1 ] +
+                coefficientC_ * secondDerivativeOfCurve_[ lowerEntry ] +
+                coefficientD_ * secondDerivativeOfCurve_[ lowerEntry + 1 ];
     }
 
-    InterpolatorTypes getInterpolatorType( ){ return cubic_spline_interpolator; }
-
-protected:
-
 private:
 
     //! Calculates the second derivatives of the curve.
@@ -171,25 +171,34 @@ public:
         }
 
         // Determine the lower entry in the table corresponding to the target independent variable value.
-        unsigned int lowerEntry_ = lookUpScheme_->findNearestLowerNeighbour( targetIndependentVariableValue );
+        return interpolateInInterval(
+                    targetIndependentVariableValue, lookUpScheme_->findNearestLowerNeighbour( targetIndependentVariableValue ) );
+    }
 
-        // If lowerEntry_ is the last element of independentValues_, execute extrapolation with
-        // the last and second to last elements of independentValues_.
-        if ( lowerEntry_ == independentValues_.size( ) - 1 )
+    //! Function interpolates dependent variable value at given independent variable value, using a caller-owned cursor.
+    /*!
+     *  Function interpolates dependent variable value at given independent variable value, using a caller-owned
+     *  cursor for the interval look-up (see OneDimensionalInterpolator). This function does not modify the interpolator.
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation
+     *      is to take place.
+     *  \param lookUpCursor Cursor storing the state of the sequence of interval look-ups.
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolate( const IndependentVariableType targetIndependentVariableValue,
+                                       LookUpCursor& lookUpCursor ) const
+    {
+        // Check whether boundary handling needs to be applied, if independent variable is beyond its defined range.
+        DependentVariableType targetValue;
+        bool useValue = false;
+        this->checkBoundaryCase( targetValue, useValue, targetIndependentVariableValue );
+        if( useValue )
         {
-            lowerEntry_ -= 1;
+            return targetValue;
         }
 
-        // Compute Hermite spline
-        ScalarType factor = static_cast< ScalarType >( targetIndependentVariableValue - independentValues_[ lowerEntry_ ] ) /
-                static_cast< ScalarType >( independentValues_[ lowerEntry_ + 1 ] - independentValues_[ lowerEntry_ ] );
-        targetValue =
-                coefficients_[ 0 ][ lowerEntry_ ] * factor * factor * factor +
-                coefficients_[ 1 ][ lowerEntry_ ] * factor * factor +
-                coefficients_[ 2 ][ lowerEntry_ ] * factor +
-                coefficients_[ 3 ][ lowerEntry_ ] ;
-
-        return targetValue;
+        // Determine the lower entry in the table corresponding to the target independent variable value.
+        return interpolateInInterval(
+                    targetIndependentVariableValue, lookUpScheme_->findNearestLowerNeighbour( targetIndependentVariableValue, lookUpCursor ) );
     }
 
     InterpolatorTypes getInterpolatorType( ){ return hermite_spline_interpolator; }
@@ -201,6 +210,60 @@ public:
     }
 protected:
 
+    //! Function to perform interpolation at a set of sorted independent variable values.
+    /*!
+     *  Function to perform interpolation at a set of independent variable values, sorted in ascending order, in a single
+     *  sweep through the independent variable grid (see OneDimensionalInterpolator::interpolateSortedBatchInSweep).
+     *  \param independentVariableValues Pointer to first of the (sorted) independent variable values at which the value
+     *      of the dependent variable is to be determined.
+     *  \param numberOfValues Number of independent variable values.
+     *  \param interpolatedValues Pointer to first entry of buffer to which interpolated values are written.
+     */
+    void interpolateSortedBatch( const IndependentVariableType* independentVariableValues,
+                                 const int numberOfValues,
+                                 DependentVariableType* interpolatedValues ) const
+    {
+        this->interpolateSortedBatchInSweep(
+                    independentVariableValues, numberOfValues, interpolatedValues,
+                    [ this ]( const IndependentVariableType independentVariableValue, const int lowerEntry )
+        {
+            return interpolateInInterval( independentVariableValue, lowerEntry );
+        } );
+    }
+
+    //! Function interpolates dependent variable value in the interval with given lower index.
+    /*!
+     *  Function interpolates dependent variable value in the interval with given lower index (as found by the look-up
+     *  scheme).
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation
+     *      is to take place.
+     *  \param lowerEntry Index of nearest lower neighbour of targetIndependentVariableValue in independentValues_.
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolateInInterval( const IndependentVariableType targetIndependentVariableValue,
+                                                 unsigned int lowerEntry ) const
+    {
+        DependentVariableType targetValue;
+
+        // If lowerEntry is the last element of independentValues_, execute extrapolation with
+        // the last and second to last elements of independentValues_.
+        if ( lowerEntry == independentValues_.size( ) - 1 )
+        {
+            lowerEntry -= 1;
+        }
+
+        // Compute Hermite spline
+        ScalarType factor = static_cast< ScalarType >( targetIndependentVariableValue - independentValues_[ lowerEntry ] ) /
+                static_cast< ScalarType >( independentValues_[ lowerEntry + 1 ] - independentValues_[ lowerEntry ] );
+        targetValue =
+                coefficients_[ 0 ][ lowerEntry ] * factor * factor * factor +
+                coefficients_[ 1 ][ lowerEntry ] * factor * factor +
+                coefficients_[ 2 ][ lowerEntry ] * factor +
+                coefficients_[ 3 ][ lowerEntry ] ;
+
+        return targetValue;
+    }
+
     //! Compute coefficients of the splines
     void computeCoefficients( )
     {
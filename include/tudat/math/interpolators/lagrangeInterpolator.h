@@ -46,10 +46,12 @@ enum LagrangeInterpolatorBoundaryHandling
 /*!
  *  Class to perform Lagrange polynomial interpolation from a set of independent and
  *  dependent values, as well as the order of the interpolation. Note that this class is optimized
- *  for many function calls to interpolate, since the denominators for
- *  the interpolations are pre-computed for all interpolation intervals.
- *  See e.g. http://mathworld.wolfram.com/LagrangeInterpolatingPolynomial.html for
- *  mathematical details.
+ *  for many function calls to interpolate: the polynomial is evaluated in barycentric form, with the
+ *  barycentric weights pre-computed for all interpolation intervals (or, for an equidistant grid, a single
+ *  set of weights in closed form). The first derivative of the interpolating polynomial can be computed
+ *  simultaneously with its value, at little extra cost.
+ *  See e.g. http://mathworld.wolfram.com/LagrangeInterpolatingPolynomial.html and Berrut and Trefethen (2004),
+ *  Barycentric Lagrange Interpolation, SIAM Review 46(3), for mathematical details.
  */
 template< typename IndependentVariableType, typename DependentVariableType,
           typename ScalarType = typename scalar_type< IndependentVariableType >::value_type >
@@ -136,13 +138,10 @@ public:
         // Create lookup scheme from independent variable values.
         this->makeLookupScheme( selectedLookupScheme );
 
-        // Calculate denominators for each interval, to prevent recalculations dueint each
+        // Calculate barycentric weights for each interval, to prevent recalculations during each
         // interpolation call.
-        initializeDenominators( );
+        initializeBarycentricWeights( );
         initializeBoundaryInterpolators( selectedLookupScheme );
-
-        // Pre-allocate cache vector for computational efficiency.
-        independentVariableDifferenceCache.resize( 2 * offsetEntries_ + 2 );
     }
 
     //! Constructor from map of independent/dependent data.
@@ -217,12 +216,10 @@ public:
         // Create lookup scheme from independent variable data points.
         this->makeLookupScheme( selectedLookupScheme );
 
-        // Calculate denominators for each interval, to prevent recalculations dueint each
-        //interpolation call.
-        initializeDenominators( );
+        // Calculate barycentric weights for each interval, to prevent recalculations during each
+        // interpolation call.
+        initializeBarycentricWeights( );
         initializeBoundaryInterpolators( selectedLookupScheme );
-
-        independentVariableDifferenceCache.resize( 2 * offsetEntries_ + 2 );
     }
 
     //! Destructor.
@@ -256,8 +253,159 @@ public:
 
         // Determine the lower entry in the table corresponding to the target independent variable
         // value.
-        int lowerEntry = lookUpScheme_->findNearestLowerNeighbour(
-                    targetIndependentVariableValue );
+        return interpolateInInterval(
+                    targetIndependentVariableValue, lookUpScheme_->findNearestLowerNeighbour(
+                        targetIndependentVariableValue ) );
+    }
+
+    //! Function interpolates dependent variable value at given independent variable value, using a caller-owned cursor.
+    /*!
+     *  Function interpolates dependent variable value at given independent variable value, using a caller-owned
+     *  cursor for the interval look-up (see OneDimensionalInterpolator). This function does not modify the interpolator.
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation
+     *      is to take place.
+     *  \param lookUpCursor Cursor storing the state of the sequence of interval look-ups.
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolate( const IndependentVariableType targetIndependentVariableValue,
+                                       LookUpCursor& lookUpCursor ) const
+    {
+        // Check whether boundary handling needs to be applied, if independent variable is beyond its defined range.
+        DependentVariableType interpolatedValue = zeroEntry_;
+        bool useValue = false;
+        this->checkBoundaryCase( interpolatedValue, useValue, targetIndependentVariableValue );
+        if( useValue )
+        {
+            return interpolatedValue;
+        }
+
+        // Determine the lower entry in the table corresponding to the target independent variable
+        // value.
+        return interpolateInInterval(
+                    targetIndependentVariableValue, lookUpScheme_->findNearestLowerNeighbour(
+                        targetIndependentVariableValue, lookUpCursor ) );
+    }
+
+    //! Function interpolates dependent variable value and its first derivative at given independent variable value.
+    /*!
+     *  Function interpolates dependent variable value and its first derivative w.r.t. the independent variable at
+     *  given independent variable value, using a single interval look-up (e.g. to obtain a velocity from a tabulated
+     *  position). Near the edges of the domain, the derivative of the boundary interpolator is used (if cubic spline
+     *  boundary interpolation is used). If the boundary handling of the interpolator replaces the interpolated value
+     *  outside of the domain (e.g. use_boundary_value), the derivative is set to zero (or NaN for use_nan_value).
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation
+     *      is to take place.
+     *  \param firstDerivative Interpolated first derivative of dependent variable (returned by reference).
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolateWithFirstDerivative( const IndependentVariableType targetIndependentVariableValue,
+                                                          DependentVariableType& firstDerivative )
+    {
+        DependentVariableType interpolatedValue = zeroEntry_;
+        if( checkBoundaryCaseWithFirstDerivative( interpolatedValue, firstDerivative, targetIndependentVariableValue ) )
+        {
+            return interpolatedValue;
+        }
+
+        interpolateInIntervalWithFirstDerivative(
+                    targetIndependentVariableValue, lookUpScheme_->findNearestLowerNeighbour(
+                        targetIndependentVariableValue ), interpolatedValue, firstDerivative );
+        return interpolatedValue;
+    }
+
+    //! Function interpolates dependent variable value and its first derivative, using a caller-owned cursor.
+    /*!
+     *  Function interpolates dependent variable value and its first derivative w.r.t. the independent variable at
+     *  given independent variable value (see other overload), using a caller-owned cursor for the interval look-up.
+     *  This function does not modify the interpolator.
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation
+     *      is to take place.
+     *  \param firstDerivative Interpolated first derivative of dependent variable (returned by reference).
+     *  \param lookUpCursor Cursor storing the state of the sequence of interval look-ups.
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolateWithFirstDerivative( const IndependentVariableType targetIndependentVariableValue,
+                                                          DependentVariableType& firstDerivative,
+                                                          LookUpCursor& lookUpCursor ) const
+    {
+        DependentVariableType interpolatedValue = zeroEntry_;
+        if( checkBoundaryCaseWithFirstDerivative( interpolatedValue, firstDerivative, targetIndependentVariableValue ) )
+        {
+            return interpolatedValue;
+        }
+
+        interpolateInIntervalWithFirstDerivative(
+                    targetIndependentVariableValue, lookUpScheme_->findNearestLowerNeighbour(
+                        targetIndependentVariableValue, lookUpCursor ), interpolatedValue, firstDerivative );
+        return interpolatedValue;
+    }
+
+    //! Function to retrieve whether the single set of closed-form barycentric weights for an equidistant grid is used.
+    /*!
+     *  Function to retrieve whether the single set of closed-form barycentric weights for an equidistant grid is used.
+     *  \return True if independent variable grid is equidistant, and closed-form weights are used.
+     */
+    bool getIsGridEquidistant( )
+    {
+        return isGridEquidistant_;
+    }
+
+    //! Function to retrieve the number of stages of interpolator
+    /*!
+     *  Function to retrieve the number of stages of interpolator
+     *  \return Number of stages of interpolator
+     */
+    int getNumberOfStages( )
+    {
+        return numberOfStages_;
+    }
+
+    InterpolatorTypes getInterpolatorType( ){ return lagrange_interpolator; }
+
+    LagrangeInterpolatorBoundaryHandling getLagrangeBoundaryHandling( )
+    {
+        return lagrangeBoundaryHandling_;
+    }
+
+
+protected:
+
+private:
+
+    //! Function to perform interpolation at a set of sorted independent variable values.
+    /*!
+     *  Function to perform interpolation at a set of independent variable values, sorted in ascending order, in a single
+     *  sweep through the independent variable grid (see OneDimensionalInterpolator::interpolateSortedBatchInSweep).
+     *  \param independentVariableValues Pointer to first of the (sorted) independent variable values at which the value
+     *      of the dependent variable is to be determined.
+     *  \param numberOfValues Number of independent variable values.
+     *  \param interpolatedValues Pointer to first entry of buffer to which interpolated values are written.
+     */
+    void interpolateSortedBatch( const IndependentVariableType* independentVariableValues,
+                                 const int numberOfValues,
+                                 DependentVariableType* interpolatedValues ) const
+    {
+        this->interpolateSortedBatchInSweep(
+                    independentVariableValues, numberOfValues, interpolatedValues,
+                    [ this ]( const IndependentVariableType independentVariableValue, const int lowerEntry )
+        {
+            return interpolateInInterval( independentVariableValue, lowerEntry );
+        } );
+    }
+
+    //! Function interpolates dependent variable value in the interval with given lower index.
+    /*!
+     *  Function interpolates dependent variable value in the interval with given lower index (as found by the look-up
+     *  scheme).
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation
+     *      is to take place.
+     *  \param lowerEntry Index of nearest lower neighbour of targetIndependentVariableValue in independentValues_.
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolateInInterval( const IndependentVariableType targetIndependentVariableValue,
+                                                 const int lowerEntry ) const
+    {
+        DependentVariableType interpolatedValue = zeroEntry_;
 
         // Check if requested interval is inside region in which centered lagrange interpolation
         // can be used.
@@ -271,10 +419,6 @@ public:
         }
         else
         {
-            // Initialize repeated numerator to 1
-            ScalarType repeatedNumerator =
-                    mathematical_constants::getFloatingInteger< ScalarType >( 1 );
-
             // Check if requested independent variable is equal to data point
             if( independentValues_[ lowerEntry ] == targetIndependentVariableValue )
             {
@@ -290,28 +434,17 @@ public:
             }
             else
             {
-                // Set up repeated numerator and cache of independent variable values from which
-                // interpolant is created.
-                int j = 0;
-                for( int i = 0; i <= 2 * offsetEntries_ + 1; i++ )
-                {
-                    j = i + lowerEntry - offsetEntries_;
-                    independentVariableDifferenceCache[ i ] =
-                            static_cast< ScalarType >(
-                                targetIndependentVariableValue - independentValues_[ j ] );
-
-                    repeatedNumerator *= independentVariableDifferenceCache[ i ];
-
-                }
-
-                // Evaluate interpolating polynomial at requested data point.
+                // Evaluate interpolating polynomial at requested data point, using barycentric formula.
+                const int stencilStart = lowerEntry - offsetEntries_;
+                const ScalarType* weights = getBarycentricWeights( lowerEntry );
+                ScalarType weightSum = computeBarycentricWeightSum(
+                            targetIndependentVariableValue, stencilStart, weights );
                 for( int i = 0; i < numberOfStages_; i++ )
                 {
-                    j = i + lowerEntry - offsetEntries_;
-                    interpolatedValue += dependentValues_[ j ]  *
-                            ( repeatedNumerator /
-                              ( independentVariableDifferenceCache[ i ] *
-                                denominators[ lowerEntry ][ j - lowerEntry + offsetEntries_ ] ) );
+                    interpolatedValue += dependentValues_[ i + stencilStart ] *
+                            ( weights[ i ] / ( static_cast< ScalarType >(
+                                                   targetIndependentVariableValue - independentValues_[ i + stencilStart ] ) *
+                                               weightSum ) );
                 }
             }
         }
@@ -319,41 +452,175 @@ public:
         return interpolatedValue;
     }
 
-    //! Function to retrieve the number of stages of interpolator
+    //! Function interpolates dependent variable value and its first derivative in the interval with given lower index.
     /*!
-     *  Function to retrieve the number of stages of interpolator
-     *  \return Number of stages of interpolator
+     *  Function interpolates dependent variable value and its first derivative w.r.t. the independent variable, in the
+     *  interval with given lower index (as found by the look-up scheme).
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation
+     *      is to take place.
+     *  \param lowerEntry Index of nearest lower neighbour of targetIndependentVariableValue in independentValues_.
+     *  \param interpolatedValue Interpolated value of dependent variable (returned by reference).
+     *  \param firstDerivative Interpolated first derivative of dependent variable (returned by reference).
      */
-    int getNumberOfStages( )
+    void interpolateInIntervalWithFirstDerivative( const IndependentVariableType targetIndependentVariableValue,
+                                                   const int lowerEntry,
+                                                   DependentVariableType& interpolatedValue,
+                                                   DependentVariableType& firstDerivative ) const
     {
-        return numberOfStages_;
-    }
+        interpolatedValue = zeroEntry_;
+        firstDerivative = zeroEntry_;
 
-    InterpolatorTypes getInterpolatorType( ){ return lagrange_interpolator; }
+        // Check if requested interval is inside region in which centered lagrange interpolation
+        // can be used.
+        if( lowerEntry < offsetEntries_ || lowerEntry >= numberOfIndependentValues_ - offsetEntries_ - 1 )
+        {
+            const bool isAtStart = ( lowerEntry < offsetEntries_ );
+            interpolatedValue = performLagrangeBoundaryInterpolation(
+                        isAtStart ? beginInterpolator_ : endInterpolator_, targetIndependentVariableValue );
+            if( lagrangeBoundaryHandling_ == lagrange_cubic_spline_boundary_interpolation ||
+                    lagrangeBoundaryHandling_ == lagrange_cubic_spline_boundary_interpolation_with_warning )
+            {
+                LookUpCursor boundaryLookUpCursor;
+                firstDerivative = ( isAtStart ? beginInterpolator_ : endInterpolator_ )->interpolateFirstDerivative(
+                            targetIndependentVariableValue, boundaryLookUpCursor );
+            }
+            else
+            {
+                firstDerivative = IdentityElement::getNanIdentity< DependentVariableType >( zeroEntry_ );
+            }
+            return;
+        }
 
-    LagrangeInterpolatorBoundaryHandling getLagrangeBoundaryHandling( )
-    {
-        return lagrangeBoundaryHandling_;
+        const int stencilStart = lowerEntry - offsetEntries_;
+        const ScalarType* weights = getBarycentricWeights( lowerEntry );
+
+        // Check if requested independent variable is equal to data point
+        int nodeIndex = -1;
+        for( int i = offsetEntries_ - 1; i <= offsetEntries_ + 1; i++ )
+        {
+            if( independentValues_[ i + stencilStart ] == targetIndependentVariableValue )
+            {
+                nodeIndex = i;
+            }
+        }
+
+        if( nodeIndex >= 0 )
+        {
+            // Evaluate value and derivative at node (see Berrut and Trefethen, 2004, Eq. 9.4)
+            interpolatedValue = dependentValues_[ nodeIndex + stencilStart ];
+            for( int i = 0; i < numberOfStages_; i++ )
+            {
+                if( i != nodeIndex )
+                {
+                    firstDerivative += ( dependentValues_[ i + stencilStart ] - interpolatedValue ) *
+                            ( weights[ i ] / ( weights[ nodeIndex ] * static_cast< ScalarType >(
+                                                   independentValues_[ nodeIndex + stencilStart ] -
+                                               independentValues_[ i + stencilStart ] ) ) );
+                }
+            }
+        }
+        else
+        {
+            // Evaluate interpolating polynomial and its derivative, using barycentric formula.
+            ScalarType weightSum = computeBarycentricWeightSum(
+                        targetIndependentVariableValue, stencilStart, weights );
+            ScalarType currentDifference;
+            for( int i = 0; i < numberOfStages_; i++ )
+            {
+                currentDifference = static_cast< ScalarType >(
+                            targetIndependentVariableValue - independentValues_[ i + stencilStart ] );
+                interpolatedValue += dependentValues_[ i + stencilStart ] *
+                        ( weights[ i ] / ( currentDifference * weightSum ) );
+            }
+            for( int i = 0; i < numberOfStages_; i++ )
+            {
+                currentDifference = static_cast< ScalarType >(
+                            targetIndependentVariableValue - independentValues_[ i + stencilStart ] );
+                firstDerivative += ( interpolatedValue - dependentValues_[ i + stencilStart ] ) *
+                        ( weights[ i ] / ( currentDifference * currentDifference * weightSum ) );
+            }
+        }
     }
 
+    //! Function to apply boundary handling of interpolator (outside of domain) to value and first derivative.
+    /*!
+     *  Function to apply boundary handling of interpolator (outside of domain) to value and first derivative (see
+     *  OneDimensionalInterpolator::checkBoundaryCase).
+     *  \param interpolatedValue Value of dependent variable at boundary (returned by reference, if applicable).
+     *  \param firstDerivative First derivative of dependent variable at boundary (returned by reference, if applicable).
+     *  \param targetIndependentVariableValue Value of independent variable to be checked for boundary handling.
+     *  \return True if the boundary value is to be used, instead of interpolating.
+     */
+    bool checkBoundaryCaseWithFirstDerivative( DependentVariableType& interpolatedValue,
+                                               DependentVariableType& firstDerivative,
+                                               const IndependentVariableType targetIndependentVariableValue ) const
+    {
+        bool useValue = false;
+        this->checkBoundaryCase( interpolatedValue, useValue, targetIndependentVariableValue );
+        if( useValue )
+        {
+            if( this->boundaryHandling_ == use_nan_value || this->boundaryHandling_ == use_nan_value_with_warning )
+            {
+                firstDerivative = IdentityElement::getNanIdentity< DependentVariableType >( zeroEntry_ );
+            }
+            else
+            {
+                firstDerivative = zeroEntry_;
+            }
+        }
+        return useValue;
+    }
 
-protected:
+    //! Function to retrieve the barycentric weights for the interpolating polynomial of given interval.
+    /*!
+     *  Function to retrieve the barycentric weights for the interpolating polynomial of given interval.
+     *  \param lowerEntry Index of nearest lower neighbour of interval in independentValues_.
+     *  \return Pointer to first of the numberOfStages_ barycentric weights of the interval.
+     */
+    const ScalarType* getBarycentricWeights( const int lowerEntry ) const
+    {
+        return isGridEquidistant_ ? barycentricWeights_.data( ) :
+                                    barycentricWeights_.data( ) + lowerEntry * numberOfStages_;
+    }
 
-private:
+    //! Function to compute the denominator of the barycentric interpolation formula.
+    /*!
+     *  Function to compute the denominator of the barycentric interpolation formula, i.e. the sum of w_i / ( x - x_i ).
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation
+     *      is to take place (may not be equal to one of the nodes).
+     *  \param stencilStart Index of first node of interpolating polynomial in independentValues_.
+     *  \param weights Barycentric weights of interpolating polynomial.
+     *  \return Denominator of barycentric interpolation formula.
+     */
+    ScalarType computeBarycentricWeightSum( const IndependentVariableType targetIndependentVariableValue,
+                                            const int stencilStart,
+                                            const ScalarType* weights ) const
+    {
+        ScalarType weightSum = mathematical_constants::getFloatingInteger< ScalarType >( 0 );
+        for( int i = 0; i < numberOfStages_; i++ )
+        {
+            weightSum += weights[ i ] / static_cast< ScalarType >(
+                        targetIndependentVariableValue - independentValues_[ i + stencilStart ] );
+        }
+        return weightSum;
+    }
 
     DependentVariableType performLagrangeBoundaryInterpolation(
-        const std::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > > boundaryInterpolator,
-        const IndependentVariableType& targetIndependentVariableValue )
+        const std::shared_ptr< CubicSplineInterpolator< IndependentVariableType, DependentVariableType, ScalarType > >&
+        boundaryInterpolator,
+        const IndependentVariableType& targetIndependentVariableValue ) const
     {
+        // Use local cursor for (small) boundary interpolator, so that this object is not modified
+        LookUpCursor boundaryLookUpCursor;
         DependentVariableType interpolatedValue;
         switch( lagrangeBoundaryHandling_ )
         {
         case lagrange_cubic_spline_boundary_interpolation_with_warning:
             std::cerr<<"Warning, calling Lagrange interpolator near boundary (at "<<targetIndependentVariableValue<<" ), using cubic-spline interpolation"<<std::endl;
-            interpolatedValue = boundaryInterpolator->interpolate( targetIndependentVariableValue );
+            interpolatedValue = boundaryInterpolator->interpolate( targetIndependentVariableValue, boundaryLookUpCursor );
             break;
         case lagrange_cubic_spline_boundary_interpolation:
-            interpolatedValue = boundaryInterpolator->interpolate( targetIndependentVariableValue );
+            interpolatedValue = boundaryInterpolator->interpolate( targetIndependentVariableValue, boundaryLookUpCursor );
             break;
         case lagrange_boundary_nan_interpolation_with_warning:
             std::cerr<<"Warning, calling Lagrange interpolator near boundary (at "<<targetIndependentVariableValue<<" ), returning NaN"<<std::endl;
@@ -373,13 +640,17 @@ private:
         return interpolatedValue;
     }
 
-    //! Function called at initialization which pre-computes the denominators of the
+    //! Function called at initialization which pre-computes the barycentric weights of the
     //! interpolants at each interval.
     /*!
-     *  Function called at initialization which pre-computes the denominators of the interpolants
-     *  at each interval, i.e. each interval between two subsequent independent variable values.
+     *  Function called at initialization which pre-computes the barycentric weights of the interpolants
+     *  at each interval, i.e. each interval between two subsequent independent variable values. The weight of node j
+     *  is the inverse of the product of ( x_j - x_k ) over all other nodes k of the interpolant. Since any common factor
+     *  of the weights cancels in the barycentric formula, the node differences are normalized by the width of the
+     *  interpolant (to prevent over- and underflow). For an equidistant grid, the weights are the same for all intervals,
+     *  and are given in closed form by ( -1 )^j ( n - 1 choose j ), so that only a single set of weights is stored.
      */
-    void initializeDenominators( )
+    void initializeBarycentricWeights( )
     {
         // Check validity of requested number of stages"
         if( numberOfStages_ % 2 != 0 )
@@ -396,30 +667,49 @@ private:
         // Determine offset from boundary of interpolation interval where interpolant is valid.
         offsetEntries_ = numberOfStages_ / 2 - 1;
 
-        // Iterate over all intervals and calculate denominators
-        int currentIterationStart;
-        denominators.resize( numberOfIndependentValues_ );
-        for( int i = offsetEntries_; i < numberOfIndependentValues_ - offsetEntries_ - 1 ; i++ )
-        {
-            // Determine start index in independent variables for current polynomial
-            currentIterationStart = i - offsetEntries_;
-
-            denominators[ i ].resize( 2 * offsetEntries_ + 2 );
+        // Check if grid is equidistant (to within rounding errors)
+        isGridEquidistant_ = ( findEquidistantGridSegments( independentValues_, 1, 1.0E-12 ).size( ) == 2 );
 
-            // Calculate all denominators for single interval.
+        if( isGridEquidistant_ )
+        {
+            barycentricWeights_.resize( numberOfStages_ );
+            ScalarType binomialCoefficient = mathematical_constants::getFloatingInteger< ScalarType >( 1 );
             for( int j = 0; j < numberOfStages_; j++ )
             {
-                denominators[ i ][ j ] =
-                        mathematical_constants::getFloatingInteger< ScalarType >( 1 );
-
-                for( int k = 0; k < numberOfStages_; k++ )
+                barycentricWeights_[ j ] = ( j % 2 == 0 ) ? binomialCoefficient : -binomialCoefficient;
+                binomialCoefficient = binomialCoefficient *
+                        static_cast< ScalarType >( numberOfStages_ - 1 - j ) / static_cast< ScalarType >( j + 1 );
+            }
+        }
+        else
+        {
+            // Iterate over all intervals and calculate weights
+            int currentIterationStart;
+            ScalarType currentStencilWidth, currentProduct;
+            barycentricWeights_.resize( numberOfIndependentValues_ * numberOfStages_ );
+            for( int i = offsetEntries_; i < numberOfIndependentValues_ - offsetEntries_ - 1 ; i++ )
+            {
+                // Determine start index in independent variables for current polynomial
+                currentIterationStart = i - offsetEntries_;
+                currentStencilWidth = static_cast< ScalarType >(
+                            independentValues_[ currentIterationStart + numberOfStages_ - 1 ] -
+                        independentValues_[ currentIterationStart ] );
+
+                // Calculate all weights for single interval.
+                for( int j = 0; j < numberOfStages_; j++ )
                 {
-                    if( k != j )
+                    currentProduct = mathematical_constants::getFloatingInteger< ScalarType >( 1 );
+                    for( int k = 0; k < numberOfStages_; k++ )
                     {
-                        denominators[ i ][ j ] *= static_cast< ScalarType >(
-                                    independentValues_[ j + currentIterationStart ] -
-                                independentValues_[ k + currentIterationStart ] );
+                        if( k != j )
+                        {
+                            currentProduct *= static_cast< ScalarType >(
+                                        independentValues_[ j + currentIterationStart ] -
+                                    independentValues_[ k + currentIterationStart ] ) / currentStencilWidth;
+                        }
                     }
+                    barycentricWeights_[ i * numberOfStages_ + j ] =
+                            mathematical_constants::getFloatingInteger< ScalarType >( 1 ) / currentProduct;
                 }
             }
         }
@@ -477,8 +767,15 @@ private:
         }
     }
 
-    //! Pre-computed denominators to be used in interpolation
-    std::vector< std::vector< ScalarType > > denominators;
+    //! Pre-computed barycentric weights to be used in interpolation
+    /*!
+     *  Pre-computed barycentric weights to be used in interpolation, stored contiguously per interval (numberOfStages_
+     *  entries, starting at index lowerEntry * numberOfStages_), or a single set of weights if isGridEquidistant_ is true.
+     */
+    std::vector< ScalarType > barycentricWeights_;
+
+    //! Boolean denoting whether the independent variable grid is equidistant, so that a single set of weights is used
+    bool isGridEquidistant_;
 
     //! Zero entry for dependent variables
     /*!
@@ -501,15 +798,13 @@ private:
      */
     int offsetEntries_;
 
-    std::vector< ScalarType > independentVariableDifferenceCache;
-
     //! Interpolator to be used at beginning of domain.
-    std::shared_ptr< OneDimensionalInterpolator
-    < IndependentVariableType, DependentVariableType > > beginInterpolator_;
+    std::shared_ptr< CubicSplineInterpolator
+    < IndependentVariableType, DependentVariableType, ScalarType > > beginInterpolator_;
 
     //! Interpolator to be used at end of domain.
-    std::shared_ptr< OneDimensionalInterpolator
-    < IndependentVariableType, DependentVariableType > > endInterpolator_;
+    std::shared_ptr< CubicSplineInterpolator
+    < IndependentVariableType, DependentVariableType, ScalarType > > endInterpolator_;
 
     //! Size of (in)dependent variable vector
     int numberOfIndependentValues_;
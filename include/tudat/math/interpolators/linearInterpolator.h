@@ -228,7 +228,74 @@ public:
         }
 
         // Lookup nearest lower index.
-        unsigned int newNearestLowerIndex = lookUpScheme_->findNearestLowerNeighbour( independentVariableValue );
+        return interpolateInInterval(
+                    independentVariableValue, lookUpScheme_->findNearestLowerNeighbour( independentVariableValue ) );
+    }
+
+    //! Function interpolates dependent variable value at given independent variable value, using a caller-owned cursor.
+    /*!
+     *  Function interpolates dependent variable value at given independent variable value, using a caller-owned
+     *  cursor for the interval look-up (see OneDimensionalInterpolator). This function does not modify the interpolator.
+     *  \param independentVariableValue Value of independent variable at which interpolation
+     *      is to take place.
+     *  \param lookUpCursor Cursor storing the state of the sequence of interval look-ups.
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolate( const IndependentVariableType independentVariableValue,
+                                       LookUpCursor& lookUpCursor ) const
+    {
+        // Check whether boundary handling needs to be applied, if independent variable is beyond its defined range.
+        DependentVariableType interpolatedValue;
+        bool useValue = false;
+        this->checkBoundaryCase( interpolatedValue, useValue, independentVariableValue );
+        if( useValue )
+        {
+            return interpolatedValue;
+        }
+
+        // Lookup nearest lower index.
+        return interpolateInInterval(
+                    independentVariableValue, lookUpScheme_->findNearestLowerNeighbour( independentVariableValue, lookUpCursor ) );
+    }
+
+    InterpolatorTypes getInterpolatorType( ){ return linear_interpolator; }
+
+protected:
+
+    //! Function to perform interpolation at a set of sorted independent variable values.
+    /*!
+     *  Function to perform interpolation at a set of independent variable values, sorted in ascending order, in a single
+     *  sweep through the independent variable grid (see OneDimensionalInterpolator::interpolateSortedBatchInSweep).
+     *  \param independentVariableValues Pointer to first of the (sorted) independent variable values at which the value
+     *      of the dependent variable is to be determined.
+     *  \param numberOfValues Number of independent variable values.
+     *  \param interpolatedValues Pointer to first entry of buffer to which interpolated values are written.
+     */
+    void interpolateSortedBatch( const IndependentVariableType* independentVariableValues,
+                                 const int numberOfValues,
+                                 DependentVariableType* interpolatedValues ) const
+    {
+        this->interpolateSortedBatchInSweep(
+                    independentVariableValues, numberOfValues, interpolatedValues,
+                    [ this ]( const IndependentVariableType independentVariableValue, const int lowerEntry )
+        {
+            return interpolateInInterval( independentVariableValue, lowerEntry );
+        } );
+    }
+
+    //! Function interpolates dependent variable value in the interval with given lower index.
+    /*!
+     *  Function interpolates dependent variable value in the interval with given lower index (as found by the look-up
+     *  scheme).
+     *  \param independentVariableValue Value of independent variable at which interpolation
+     *      is to take place.
+     *  \param newNearestLowerIndex Index of nearest lower neighbour of independentVariableValue in independentValues_.
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolateInInterval( const IndependentVariableType independentVariableValue,
+                                                 unsigned int newNearestLowerIndex ) const
+    {
+        DependentVariableType interpolatedValue;
 
         // If newNearestLowerIndex is the last element of independentValues_, execute extrapolation with
         // the last and second to last elements of independentValues_.
@@ -248,8 +315,6 @@ public:
         return interpolatedValue;
     }
 
-    InterpolatorTypes getInterpolatorType( ){ return linear_interpolator; }
-
 };
 
 
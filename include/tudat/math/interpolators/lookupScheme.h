@@ -12,6 +12,9 @@
 #ifndef TUDAT_LOOK_UP_SCHEME_H
 #define TUDAT_LOOK_UP_SCHEME_H
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <vector>
 #include <iostream>
 #include <memory>
@@ -31,7 +34,87 @@ enum AvailableLookupScheme
 {
     undefinedScheme,
     huntingAlgorithm,
-    binarySearch
+    binarySearch,
+    equidistantLookup
+};
+
+//! Function to determine the segments of a grid in which the grid is equidistant
+/*!
+ *  Function to determine the segments of a (strictly increasing) grid in which the grid is equidistant. A grid point is
+ *  considered to be part of the current segment if its deviation from the equidistant grid defined by the first two points of
+ *  the segment is less than a given fraction of the step size. This function is used to determine whether an
+ *  EquidistantLookupScheme may be used for the grid.
+ *  \param independentVariableValues Grid that is to be checked
+ *  \param maximumNumberOfSegments Maximum number of segments in which the grid may be equidistant
+ *  \param relativeTolerance Maximum deviation of grid point from equidistant grid, as a fraction of the step size
+ *  \return Indices of the grid points at which the equidistant segments start (with last entry equal to the index of the
+ *  final grid point). Empty if the grid is not strictly increasing, or consists of more than maximumNumberOfSegments
+ *  equidistant segments.
+ */
+template< typename IndependentVariableType >
+std::vector< int > findEquidistantGridSegments(
+        const std::vector< IndependentVariableType >& independentVariableValues,
+        const int maximumNumberOfSegments = 16,
+        const double relativeTolerance = 1.0E-8 )
+{
+    std::vector< int > segmentStartIndices;
+    const int numberOfValues = static_cast< int >( independentVariableValues.size( ) );
+    if( numberOfValues < 2 )
+    {
+        return segmentStartIndices;
+    }
+
+    int currentSegmentStart = 0;
+    double currentStepSize = static_cast< double >( independentVariableValues.at( 1 ) - independentVariableValues.at( 0 ) );
+    segmentStartIndices.push_back( 0 );
+    for( int i = 1; i < numberOfValues; i++ )
+    {
+        double currentStep = static_cast< double >( independentVariableValues.at( i ) - independentVariableValues.at( i - 1 ) );
+        if( !( currentStep > 0.0 ) )
+        {
+            return std::vector< int >( );
+        }
+
+        // Start new segment if grid point deviates from equidistant grid in current segment
+        double deviationFromGrid = static_cast< double >(
+                    independentVariableValues.at( i ) - independentVariableValues.at( currentSegmentStart ) ) -
+                static_cast< double >( i - currentSegmentStart ) * currentStepSize;
+        if( std::fabs( deviationFromGrid ) > relativeTolerance * currentStepSize )
+        {
+            currentSegmentStart = i - 1;
+            currentStepSize = currentStep;
+            segmentStartIndices.push_back( currentSegmentStart );
+            if( static_cast< int >( segmentStartIndices.size( ) ) > maximumNumberOfSegments )
+            {
+                return std::vector< int >( );
+            }
+        }
+    }
+    segmentStartIndices.push_back( numberOfValues - 1 );
+
+    return segmentStartIndices;
+}
+
+//! Object storing the state of a sequence of look-ups, owned by the caller of the look-up
+/*!
+ * Object storing the state of a sequence of look-ups (the index found in the previous look-up), owned by the caller of the
+ * look-up, instead of by the look-up scheme. It is used by the const look-up and interpolation functions, so that a
+ * single look-up scheme/interpolator can be used concurrently by multiple callers (e.g. threads), each with its own
+ * cursor, while retaining the speed-up of the hunting algorithm for each caller.
+ */
+struct LookUpCursor
+{
+    //! Constructor, initializes the cursor to the state before any look-up is done
+    LookUpCursor( ): previousNearestLowerIndex_( -1 ){ }
+
+    //! Function to reset the cursor to the state before any look-up is done
+    void reset( )
+    {
+        previousNearestLowerIndex_ = -1;
+    }
+
+    //! Nearest lower index found in previous look-up (-1 if no look-up has been done)
+    int previousNearestLowerIndex_;
 };
 
 //! Look-up scheme class for nearest left neighbour search.
@@ -70,6 +153,48 @@ public:
      */
     virtual int findNearestLowerNeighbour( const IndependentVariableType valueToLookup ) = 0;
 
+    //! Find nearest left neighbour, using a caller-owned cursor.
+    /*!
+     * Function finds nearest left neighbour of given value in independentVariableValues_, using (and updating) the state of
+     * the look-up stored in a caller-owned cursor, instead of in this object. This function does not modify this object,
+     * and may be called concurrently (with different cursors). By default, the hunting algorithm is used, starting
+     * from the index found in the previous look-up with the same cursor (binary search for the first look-up).
+     * \param valueToLookup Value of which nearest neighbour is to be determined.
+     * \param lookUpCursor Cursor storing the state of the sequence of look-ups (modified by this function).
+     * \return Index of entry in independentVariableValues_ vector which is nearest lower neighbour
+     * to valueToLookup.
+     */
+    virtual int findNearestLowerNeighbour( const IndependentVariableType valueToLookup,
+                                           LookUpCursor& lookUpCursor ) const
+    {
+        int newNearestLowerIndex = 0;
+
+        // If this is first look-up with cursor, use binary search.
+        if ( lookUpCursor.previousNearestLowerIndex_ < 0 )
+        {
+            newNearestLowerIndex = basic_mathematics::computeNearestLeftNeighborUsingBinarySearch
+                    < IndependentVariableType >( independentVariableValues_, valueToLookup );
+        }
+        // If requested value is in same interval, return same value as previous time.
+        else if ( basic_mathematics::isIndependentVariableInInterval< IndependentVariableType >
+                  ( lookUpCursor.previousNearestLowerIndex_, valueToLookup, independentVariableValues_ ) )
+        {
+            newNearestLowerIndex = lookUpCursor.previousNearestLowerIndex_;
+        }
+        // Otherwise, perform hunting algorithm.
+        else
+        {
+            newNearestLowerIndex =
+                    basic_mathematics::findNearestLeftNeighbourUsingHuntingAlgorithm< IndependentVariableType >
+                    ( valueToLookup, lookUpCursor.previousNearestLowerIndex_, independentVariableValues_ );
+        }
+
+        // Set calculated value for use in next call.
+        lookUpCursor.previousNearestLowerIndex_ = newNearestLowerIndex;
+
+        return newNearestLowerIndex;
+    }
+
     IndependentVariableType getMinimumValue( )
     {
         return independentVariableValues_.at( 0 );
@@ -103,6 +228,7 @@ class HuntingAlgorithmLookupScheme: public LookUpScheme< IndependentVariableType
 public:
 
     using LookUpScheme< IndependentVariableType >::independentVariableValues_;
+    using LookUpScheme< IndependentVariableType >::findNearestLowerNeighbour;
 
     //! Constructor, used to set data vector.
     /*!
@@ -112,9 +238,7 @@ public:
      */
     HuntingAlgorithmLookupScheme( const std::vector< IndependentVariableType >&
                                   independentVariableValues )
-        : LookUpScheme< IndependentVariableType >( independentVariableValues ),
-          isFirstLookupDone( 0 ),
-          previousNearestLowerIndex_( 0 )
+        : LookUpScheme< IndependentVariableType >( independentVariableValues )
     { }
 
     //! Default destructor
@@ -126,64 +250,31 @@ public:
     //! Find nearest left neighbour.
     /*!
      * Function finds nearest left neighbour of given value in ndependentVariableValues_. If this
-     * is first call of function, a binary search is used.
+     * is first call of function, a binary search is used. The result of the previous call is stored in this object, and
+     * used as starting point of the hunting algorithm. Since the resulting index does not depend on the starting point,
+     * this function may be called concurrently (with the starting point taken from any of the preceding calls), although
+     * the const overload with a cursor argument is preferred for concurrent use.
      * \param valueToLookup Value of which nearest neighbour is to be determined.
      * \return Index of entry in independentVariableValues_ vector which is nearest lower neighbour
      * to valueToLookup.
      */
     int findNearestLowerNeighbour( const IndependentVariableType valueToLookup )
     {
-        // Initialize return value.
-        int newNearestLowerIndex = 0;
-
-        // If this is first call of function, use binary search.
-        if ( !isFirstLookupDone )
-        {
-            newNearestLowerIndex = basic_mathematics::computeNearestLeftNeighborUsingBinarySearch
-                    < IndependentVariableType >( independentVariableValues_, valueToLookup );
-            isFirstLookupDone = 1;
-        }
-
-        else
-        {
-            // If requested value is in same interval, return same value as previous time.
-            if ( basic_mathematics::isIndependentVariableInInterval< IndependentVariableType >
-                 ( previousNearestLowerIndex_, valueToLookup, independentVariableValues_ ) )
-            {
-                newNearestLowerIndex = previousNearestLowerIndex_;
-
-            }
-
-            // Otherwise, perform hunting algorithm.
-            else
-            {
-                newNearestLowerIndex =
-                        basic_mathematics::findNearestLeftNeighbourUsingHuntingAlgorithm<
-                        IndependentVariableType >
-                        (  valueToLookup, previousNearestLowerIndex_, independentVariableValues_ );
-
-            }
-        }
-
-        // Set calculated value for use in next call.
-        previousNearestLowerIndex_ = newNearestLowerIndex;
-
+        LookUpCursor lookUpCursor;
+        lookUpCursor.previousNearestLowerIndex_ = previousNearestLowerIndex_.load( std::memory_order_relaxed );
+        int newNearestLowerIndex = findNearestLowerNeighbour( valueToLookup, lookUpCursor );
+        previousNearestLowerIndex_.store( newNearestLowerIndex, std::memory_order_relaxed );
         return newNearestLowerIndex;
     }
 
 private:
 
-    //! Boolean to denote whether a lookup has been done.
-    /*!
-     * Boolean to denote whether a lookup has been done.
-     */
-    bool isFirstLookupDone;
-
-    //! Nearest left index during previous call.
+    //! Nearest left index found during previous call (-1 if no call has been made).
     /*!
-     * Nearest left index during previous call
+     * Nearest left index found during previous call (-1 if no call has been made), stored as atomic variable so that
+     * concurrent calls do not constitute a data race.
      */
-    int previousNearestLowerIndex_;
+    std::atomic< int > previousNearestLowerIndex_{ -1 };
 };
 
 //! Look-up scheme class for nearest left neighbour search using binary search algorithm.
@@ -228,8 +319,187 @@ public:
                 < IndependentVariableType >( independentVariableValues_, valueToLookup );
     }
 
+    //! Find nearest left neighbour (cursor is not used by this scheme).
+    /*!
+     * Function finds nearest left neighbour of given value in independentVariableValues_. The cursor is not used or modified.
+     * \param valueToLookup Value of which nearest neaighbour is to be determined.
+     * \param lookUpCursor Cursor storing the state of the sequence of look-ups (not used).
+     * \return Index of entry in independentVariableValues_ vector which is nearest lower neighbour
+     * to valueToLookup.
+     */
+    int findNearestLowerNeighbour( const IndependentVariableType valueToLookup,
+                                   LookUpCursor& lookUpCursor ) const
+    {
+        return basic_mathematics::computeNearestLeftNeighborUsingBinarySearch
+                < IndependentVariableType >( independentVariableValues_, valueToLookup );
+    }
+
 };
 
+//! Look-up scheme class for nearest left neighbour search in (piecewise) equidistant grid.
+/*!
+ * Look-up scheme class for nearest left neighbour search in equidistant grid, or in a grid consisting of a limited number of
+ * equidistant segments (see findEquidistantGridSegments). The interval index is computed directly from the value that is
+ * to be looked up (with a single-step correction for rounding errors), so that the look-up is done in constant time. The
+ * results are identical to those of the binary search and hunting algorithm look-up schemes. The class holds no state
+ * that is modified by a look-up.
+ * \tparam IndependentVariableType Type of entries of vector in which lookup is to be performed.
+ */
+template< typename IndependentVariableType >
+class EquidistantLookupScheme: public LookUpScheme< IndependentVariableType >
+{
+public:
+
+    using LookUpScheme< IndependentVariableType >::independentVariableValues_;
+
+    //! Constructor, used to set data vector.
+    /*!
+     * Constructor, used to set data vector, and compute the step sizes of the equidistant segments of the grid.
+     * \param independentVariableValues vector of independent variable values in which to perform
+     * lookup procedure.
+     */
+    EquidistantLookupScheme(
+            const std::vector< IndependentVariableType >& independentVariableValues )
+        : LookUpScheme< IndependentVariableType >( independentVariableValues )
+    {
+        segmentStartIndices_ = findEquidistantGridSegments( independentVariableValues_ );
+        if( segmentStartIndices_.size( ) == 0 )
+        {
+            throw std::runtime_error(
+                        "Error when creating equidistant lookup scheme, grid is not (piecewise) equidistant" );
+        }
+
+        numberOfSegments_ = static_cast< int >( segmentStartIndices_.size( ) ) - 1;
+        for( int i = 0; i < numberOfSegments_; i++ )
+        {
+            segmentStartValues_.push_back( independentVariableValues_.at( segmentStartIndices_.at( i ) ) );
+            inverseStepSizes_.push_back(
+                        static_cast< double >( segmentStartIndices_.at( i + 1 ) - segmentStartIndices_.at( i ) ) /
+                        static_cast< double >( independentVariableValues_.at( segmentStartIndices_.at( i + 1 ) ) -
+                                               segmentStartValues_.at( i ) ) );
+        }
+    }
+
+    //! Default destructor
+    /*!
+     *  Default destructor
+     */
+    ~EquidistantLookupScheme( ){ }
+
+    //! Find nearest left neighbour.
+    /*!
+     * Function finds nearest left neighbour of given value in independentVariableValues_.
+     * \param valueToLookup Value of which nearest neaighbour is to be determined.
+     * \return Index of entry in independentVariableValues_ vector which is nearest lower neighbour
+     * to valueToLookup.
+     */
+    int findNearestLowerNeighbour( const IndependentVariableType valueToLookup )
+    {
+        return findNearestLowerNeighbourInGrid( valueToLookup );
+    }
+
+    //! Find nearest left neighbour (cursor is not used by this scheme).
+    /*!
+     * Function finds nearest left neighbour of given value in independentVariableValues_. The cursor is not used or modified.
+     * \param valueToLookup Value of which nearest neaighbour is to be determined.
+     * \param lookUpCursor Cursor storing the state of the sequence of look-ups (not used).
+     * \return Index of entry in independentVariableValues_ vector which is nearest lower neighbour
+     * to valueToLookup.
+     */
+    int findNearestLowerNeighbour( const IndependentVariableType valueToLookup,
+                                   LookUpCursor& lookUpCursor ) const
+    {
+        return findNearestLowerNeighbourInGrid( valueToLookup );
+    }
+
+    //! Function to retrieve the number of equidistant segments of the grid
+    /*!
+     * Function to retrieve the number of equidistant segments of the grid
+     * \return Number of equidistant segments of the grid
+     */
+    int getNumberOfSegments( )
+    {
+        return numberOfSegments_;
+    }
+
+private:
+
+    //! Find nearest left neighbour, by computing index from distance to start of equidistant segment
+    int findNearestLowerNeighbourInGrid( const IndependentVariableType valueToLookup ) const
+    {
+        const int lastIndex = segmentStartIndices_[ numberOfSegments_ ];
+        if( !( valueToLookup > independentVariableValues_[ 0 ] ) )
+        {
+            return 0;
+        }
+        else if( valueToLookup >= independentVariableValues_[ lastIndex ] )
+        {
+            return lastIndex;
+        }
+
+        // Find equidistant segment (typically only one) in which value is located
+        int currentSegment = 0;
+        while( currentSegment < numberOfSegments_ - 1 && valueToLookup >= segmentStartValues_[ currentSegment + 1 ] )
+        {
+            currentSegment++;
+        }
+
+        // Compute index from distance to segment start, limited to segment
+        int lowerIndex = segmentStartIndices_[ currentSegment ] + static_cast< int >(
+                    static_cast< double >( valueToLookup - segmentStartValues_[ currentSegment ] ) *
+                    inverseStepSizes_[ currentSegment ] );
+        lowerIndex = std::min( std::max( lowerIndex, segmentStartIndices_[ currentSegment ] ),
+                               segmentStartIndices_[ currentSegment + 1 ] - 1 );
+
+        // Correct for rounding errors and deviations from equidistant grid
+        if( valueToLookup < independentVariableValues_[ lowerIndex ] )
+        {
+            lowerIndex--;
+        }
+        else if( valueToLookup >= independentVariableValues_[ lowerIndex + 1 ] )
+        {
+            lowerIndex++;
+        }
+        return lowerIndex;
+    }
+
+    //! Indices of grid points at which the equidistant segments start (with final entry the index of the last grid point)
+    std::vector< int > segmentStartIndices_;
+
+    //! Grid values at which the equidistant segments start
+    std::vector< IndependentVariableType > segmentStartValues_;
+
+    //! Inverse of step sizes in equidistant segments
+    std::vector< double > inverseStepSizes_;
+
+    //! Number of equidistant segments
+    int numberOfSegments_;
+
+};
+
+//! Function to select the look-up scheme for a grid, using an equidistant look-up scheme if the grid allows it
+/*!
+ * Function to select the look-up scheme for a grid. If the binary search or hunting algorithm scheme is requested, and the
+ * grid is (piecewise) equidistant (see findEquidistantGridSegments), the (faster, and stateless) equidistant look-up scheme
+ * is selected instead, which produces identical results. Otherwise, the requested scheme is returned.
+ * \param independentVariableValues Grid in which the look-up is to be performed
+ * \param requestedLookupScheme Requested look-up scheme
+ * \return Look-up scheme that is to be used
+ */
+template< typename IndependentVariableType >
+AvailableLookupScheme selectLookupSchemeForGrid(
+        const std::vector< IndependentVariableType >& independentVariableValues,
+        const AvailableLookupScheme requestedLookupScheme )
+{
+    AvailableLookupScheme selectedLookupScheme = requestedLookupScheme;
+    if( ( requestedLookupScheme == huntingAlgorithm || requestedLookupScheme == binarySearch ) &&
+            findEquidistantGridSegments( independentVariableValues ).size( ) > 0 )
+    {
+        selectedLookupScheme = equidistantLookup;
+    }
+    return selectedLookupScheme;
+}
+
 //! Typedef for shared-pointer to LookUpScheme object with double-type entries.
 typedef std::shared_ptr< LookUpScheme< double > > LookUpSchemeDoublePointer;
 
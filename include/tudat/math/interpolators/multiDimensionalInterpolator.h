@@ -165,7 +165,7 @@ public:
      *  Function to return the ector with dependent variables used by the interpolator.
      *  \return Dependent variables used by the interpolator.
      */
-    boost::multi_array< DependentVariableType, static_cast< size_t >( NumberOfDimensions ) > getDependentValues( )
+    const boost::multi_array< DependentVariableType, static_cast< size_t >( NumberOfDimensions ) >& getDependentValues( )
     {
         return dependentData_;
     }
@@ -342,6 +342,17 @@ protected:
             }
             break;
         }
+        case equidistantLookup:
+        {
+            for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
+            {
+                // Create equidistant scheme, which computes the interval directly from the independent variable.
+                lookUpSchemes_[ i ] = std::shared_ptr< LookUpScheme< IndependentVariableType > >
+                        ( new EquidistantLookupScheme< IndependentVariableType >(
+                              independentValues_[ i ] ) );
+            }
+            break;
+        }
         default:
             throw std::runtime_error( "Error: lookup scheme not found when making scheme for N-D interpolator." );
         }
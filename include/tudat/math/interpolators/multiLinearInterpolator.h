@@ -30,6 +30,7 @@
 #ifndef TUDAT_MULTI_LINEAR_INTERPOLATOR_H
 #define TUDAT_MULTI_LINEAR_INTERPOLATOR_H
 
+#include <algorithm>
 #include <vector>
 
 #include <boost/array.hpp>
@@ -47,11 +48,70 @@ namespace tudat
 namespace interpolators
 {
 
+//! Struct to evaluate a multi-linear interpolation step over the corners of a grid cell, unrolled at compile time.
+/*!
+ *  Struct to evaluate a multi-linear interpolation step over the corners of a grid cell. The evaluate function for
+ *  CurrentDimension calls the function for CurrentDimension + 1 for the lower and upper corner in CurrentDimension, and
+ *  scales the results with the interpolation fractions. Since the recursion is resolved at compile time (terminating at
+ *  the specialization for CurrentDimension = NumberOfDimensions), the 2^NumberOfDimensions corner evaluations are
+ *  unrolled by the compiler, while the order of operations is identical to that of a runtime recursion over the dimensions.
+ *  	param IndependentVariableType Type for independent variables.
+ *  	param DependentVariableType Type for dependent variable.
+ *  	param NumberOfDimensions Number of independent variables.
+ *  	param CurrentDimension Dimension in which this interpolation step is to be performed.
+ */
+template< typename IndependentVariableType, typename DependentVariableType,
+          unsigned int NumberOfDimensions, unsigned int CurrentDimension >
+struct MultiLinearCornerEvaluation
+{
+    //! Function to evaluate the interpolation step in the current dimension.
+    /*!
+     *  Function to evaluate the interpolation step in the current dimension.
+     *  \param cellData Pointer to dependent variable value at lower corner of current (sub-)cell, in contiguous storage.
+     *  \param strides Strides (in number of entries) of contiguous dependent variable storage, per dimension.
+     *  \param lowerFractions Interpolation fractions for lower corners, per dimension.
+     *  \param upperFractions Interpolation fractions for upper corners, per dimension.
+     *  \return Interpolated value in dimensions CurrentDimension and higher.
+     */
+    static DependentVariableType evaluate(
+            const DependentVariableType* cellData,
+            const boost::array< long, NumberOfDimensions >& strides,
+            const boost::array< IndependentVariableType, NumberOfDimensions >& lowerFractions,
+            const boost::array< IndependentVariableType, NumberOfDimensions >& upperFractions )
+    {
+        return upperFractions[ CurrentDimension ] *
+                MultiLinearCornerEvaluation< IndependentVariableType, DependentVariableType,
+                NumberOfDimensions, CurrentDimension + 1 >::evaluate(
+                    cellData + strides[ CurrentDimension ], strides, lowerFractions, upperFractions ) +
+                lowerFractions[ CurrentDimension ] *
+                MultiLinearCornerEvaluation< IndependentVariableType, DependentVariableType,
+                NumberOfDimensions, CurrentDimension + 1 >::evaluate(
+                    cellData, strides, lowerFractions, upperFractions );
+    }
+};
+
+//! Struct to terminate the compile-time recursion of MultiLinearCornerEvaluation, returning the value at a grid corner.
+template< typename IndependentVariableType, typename DependentVariableType, unsigned int NumberOfDimensions >
+struct MultiLinearCornerEvaluation< IndependentVariableType, DependentVariableType, NumberOfDimensions, NumberOfDimensions >
+{
+    //! Function to return the dependent variable value at a grid corner.
+    static DependentVariableType evaluate(
+            const DependentVariableType* cellData,
+            const boost::array< long, NumberOfDimensions >&,
+            const boost::array< IndependentVariableType, NumberOfDimensions >&,
+            const boost::array< IndependentVariableType, NumberOfDimensions >& )
+    {
+        return *cellData;
+    }
+};
+
 //! Class for performing multi-linear interpolation for arbitrary number of independent variables.
 /*!
  * Class for performing multi-linear interpolation for arbitrary number of independent variables.
- * Interpolation is calculated recursively over all dimensions of independent variables. Note
- * that the types (i.e. double, float) of all independent variables must be the same.
+ * Interpolation is calculated recursively over all dimensions of independent variables, with the recursion
+ * unrolled at compile time (see MultiLinearCornerEvaluation), directly on the contiguous storage of the dependent
+ * variables, using strides computed at construction. Note that the types (i.e. double, float) of all independent
+ * variables must be the same.
  * \tparam IndependentVariableType Type for independent variables.
  * \tparam DependentVariableType Type for dependent variable.
  * \tparam NumberOfDimensions Number of independent variables.
@@ -100,10 +160,9 @@ public:
     {
         // Save (in)dependent variables
         independentValues_ = independentValues;
-        dependentData_.resize( reinterpret_cast< boost::array< size_t,
-                               boost::multi_array< DependentVariableType,
-                               static_cast< size_t >( NumberOfDimensions ) >::dimensionality > const& >(
-                                   *dependentData.shape( ) ) ); // resize dependent data container
+        boost::array< size_t, NumberOfDimensions > dependentDataShape;
+        std::copy( dependentData.shape( ), dependentData.shape( ) + NumberOfDimensions, dependentDataShape.begin( ) );
+        dependentData_.resize( dependentDataShape ); // resize dependent data container
         dependentData_ = dependentData;
 
         // Check consistency of template arguments and input variables.
@@ -126,6 +185,15 @@ public:
 
         // Create lookup scheme from independent variable data points.
         this->makeLookupSchemes( selectedLookupScheme );
+
+        // Retrieve strides of (contiguous) dependent variable storage, and offset of first entry w.r.t. storage origin
+        dependentDataFirstEntryOffset_ = 0;
+        for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
+        {
+            dependentDataStrides_[ i ] = static_cast< long >( dependentData_.strides( )[ i ] );
+            dependentDataFirstEntryOffset_ +=
+                    static_cast< long >( dependentData_.index_bases( )[ i ] ) * dependentDataStrides_[ i ];
+        }
     }
 
     //! Constructor taking independent and dependent variable data.
@@ -180,50 +248,53 @@ public:
                                       std::to_string( NumberOfDimensions ) );
         }
 
-        // Create local copy of current independent variables
-        std::vector< IndependentVariableType > localIndependentValuesToInterpolate = independentValuesToInterpolate;
+        // Create local copy of current independent variables (modified by boundary handling)
+        boost::array< IndependentVariableType, NumberOfDimensions > localIndependentValuesToInterpolate;
+        std::copy( independentValuesToInterpolate.begin( ), independentValuesToInterpolate.end( ),
+                   localIndependentValuesToInterpolate.begin( ) );
 
         // Check that independent variables are in range
         bool useValue = false;
         DependentVariableType currentDependentVariable;
         for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
         {
-            this->checkBoundaryCase( i, useValue, localIndependentValuesToInterpolate.at( i ), currentDependentVariable );
+            this->checkBoundaryCase( i, useValue, localIndependentValuesToInterpolate[ i ], currentDependentVariable );
             if ( useValue )
             {
                 return currentDependentVariable;
             }
         }
 
-        // Determine the nearest lower neighbours.
-        std::vector< unsigned int > nearestLowerIndices;
-        nearestLowerIndices.resize( NumberOfDimensions );
+        // Determine the nearest lower neighbours, interpolation fractions, and lower corner of grid cell.
+        unsigned int nearestLowerIndex;
+        long cellOffset = 0;
+        boost::array< IndependentVariableType, NumberOfDimensions > lowerFractions, upperFractions;
         for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
         {
-            nearestLowerIndices[ i ] = lookUpSchemes_[ i ]->findNearestLowerNeighbour(
+            nearestLowerIndex = lookUpSchemes_[ i ]->findNearestLowerNeighbour(
                         localIndependentValuesToInterpolate[ i ] );
 
             // If newNearestLowerIndex is the last element of independentValues_, execute extrapolation with
             // the last and second to last elements of independentValues_.
-            if ( nearestLowerIndices[ i ] == independentValues_[ i ].size( ) - 1 )
+            if ( nearestLowerIndex == independentValues_[ i ].size( ) - 1 )
             {
-                nearestLowerIndices[ i ] -= 1;
+                nearestLowerIndex -= 1;
             }
 
-        }
+            // Calculate fractions of data points above and below independent
+            // variable value to be added to interpolated value.
+            upperFractions[ i ] = ( localIndependentValuesToInterpolate[ i ] - independentValues_[ i ][ nearestLowerIndex ] ) /
+                    ( independentValues_[ i ][ nearestLowerIndex + 1 ] - independentValues_[ i ][ nearestLowerIndex ] );
+            lowerFractions[ i ] = -( localIndependentValuesToInterpolate[ i ] - independentValues_[ i ][ nearestLowerIndex + 1 ] ) /
+                    ( independentValues_[ i ][ nearestLowerIndex + 1 ] - independentValues_[ i ][ nearestLowerIndex ] );
 
-        // Initialize function evaluation indices to -1 for debugging purposes.
-        boost::array< unsigned int, NumberOfDimensions > interpolationIndices;
-        for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
-        {
-            interpolationIndices[ i ] = -1;
+            cellOffset += static_cast< long >( nearestLowerIndex ) * dependentDataStrides_[ i ];
         }
 
-        // Call first step of interpolation, this function calls itself at subsequent independent
-        // variable dimensions to evaluate and properly scale dependent variable table values at
-        // all 2^n grid edges.
-        return performRecursiveInterpolationStep( 0, localIndependentValuesToInterpolate,
-                                                  interpolationIndices, nearestLowerIndices );
+        // Evaluate and scale dependent variable table values at all 2^n grid edges.
+        return MultiLinearCornerEvaluation< IndependentVariableType, DependentVariableType, NumberOfDimensions, 0 >::
+                evaluate( dependentData_.origin( ) + dependentDataFirstEntryOffset_ + cellOffset,
+                          dependentDataStrides_, lowerFractions, upperFractions );
     }
 
 private:
@@ -266,86 +337,29 @@ private:
 
             break;
 
+        case equidistantLookup:
+
+            for( unsigned int i = 0; i < NumberOfDimensions; i++ )
+            {
+                // Create equidistant scheme, which computes the interval directly from the independent variable.
+                lookUpSchemes_[ i ] = std::shared_ptr< LookUpScheme< IndependentVariableType > >
+                        ( new EquidistantLookupScheme< IndependentVariableType >(
+                              independentValues_[ i ] ) );
+            }
+
+            break;
+
         default:
 
             throw std::runtime_error( "Warning: lookup scheme not found when making scheme for 1-D interpolator" );
         }
     }
 
-    //! Perform the step in a single dimension of the interpolation process.
-    /*!
-     * Function calculates single dimension of the interpolation process. Function calls itself if
-     * final dimension not yet reached. Calling this function with currentDimension = 0 will result
-     * in 2^{NumberOfDimensions} number of calls to the function at currentDimension =
-     * NumberOfDimensions -1. As such, the complete series of calls, starting at currentDimension =
-     * 0, retrieves the dependent variable values at all edges of the grid hyper-rectangle and
-     * properly scales them.
-     * \param currentDimension Dimension in which this interpolation step is to be performed.
-     * \param independentValuesToInterpolate Vector of values of independent variables at which
-     *          interpolation is to be performed.
-     * \param currentArrayIndices Array of indices modified at index = currentDimension at each
-     *          call of function. Variable is passed to dependentData in highest step to return
-     *          data for interpolation.
-     * \param nearestLowerIndices Indices in subvectors of independentValues_ vector. That is, the
-     *  n-th entry of nearestLowerIndices represent the nearest lower neighbour in the n-th
-     *  interpolation dimension of the independent variable vectors.
-     * \return Interpolated value in a single dimension
-     */
-    DependentVariableType performRecursiveInterpolationStep(
-            const unsigned int currentDimension,
-            const std::vector< IndependentVariableType >& independentValuesToInterpolate,
-            boost::array< unsigned int, NumberOfDimensions > currentArrayIndices,
-            const std::vector< unsigned int >& nearestLowerIndices )
-    {
-        IndependentVariableType upperFraction, lowerFraction;
-        DependentVariableType upperContribution, lowerContribution;
-
-        // Calculate fractions of data points above and below independent
-        // variable value to be added to interpolated value.
-        upperFraction = ( independentValuesToInterpolate[ currentDimension ] -
-                          independentValues_[ currentDimension ]
-                          [ nearestLowerIndices[ currentDimension ] ] ) /
-                ( independentValues_[ currentDimension ]
-                  [ nearestLowerIndices[ currentDimension ] + 1 ] -
-                independentValues_[ currentDimension ]
-                [ nearestLowerIndices[ currentDimension ] ] );
-        lowerFraction = -( independentValuesToInterpolate[ currentDimension ] -
-                           independentValues_[ currentDimension ]
-                           [ nearestLowerIndices[ currentDimension ] + 1 ] ) /
-                ( independentValues_[ currentDimension ]
-                  [ nearestLowerIndices[ currentDimension ] + 1 ] -
-                independentValues_[ currentDimension ]
-                [ nearestLowerIndices[ currentDimension ] ] );
-
-        // If at top dimension, call dependent variable data.
-        if ( currentDimension == NumberOfDimensions - 1 )
-        {
-            currentArrayIndices[ NumberOfDimensions - 1 ] = nearestLowerIndices[ currentDimension ];
-            lowerContribution = dependentData_( currentArrayIndices );
-            currentArrayIndices[ NumberOfDimensions - 1 ] = nearestLowerIndices[ currentDimension ]
-                    + 1;
-            upperContribution = dependentData_( currentArrayIndices );
-        }
-
-        // If at lower dimension, update currentArrayIndices and call function with
-        // currentDimension++.
-        else
-        {
-            currentArrayIndices[ currentDimension ] = nearestLowerIndices[ currentDimension ];
-            lowerContribution = performRecursiveInterpolationStep(
-                        currentDimension + 1, independentValuesToInterpolate,
-                        currentArrayIndices, nearestLowerIndices );
-            currentArrayIndices[ currentDimension ] = nearestLowerIndices[ currentDimension ] + 1;
-            upperContribution = performRecursiveInterpolationStep(
-                        currentDimension + 1, independentValuesToInterpolate,
-                        currentArrayIndices, nearestLowerIndices );
-        }
+    //! Strides (in number of entries) of the contiguous storage of dependentData_, per dimension.
+    boost::array< long, NumberOfDimensions > dependentDataStrides_;
 
-        // Return interpolated value.
-        DependentVariableType returnValue = upperFraction * upperContribution +
-                lowerFraction * lowerContribution;
-        return returnValue;
-    }
+    //! Offset (in number of entries) of the first entry of dependentData_ (at its index bases) w.r.t. its storage origin.
+    long dependentDataFirstEntryOffset_;
 };
 
 //extern template class MultiLinearInterpolator< double, Eigen::Vector6d, 1 >;
@@ -12,6 +12,9 @@
 #ifndef TUDAT_ONE_DIMENSIONAL_INTERPOLATOR_H
 #define TUDAT_ONE_DIMENSIONAL_INTERPOLATOR_H
 
+#include <algorithm>
+#include <mutex>
+#include <numeric>
 #include <vector>
 #include <iostream>
 
@@ -125,6 +128,94 @@ public:
     virtual DependentVariableType
     interpolate( const IndependentVariableType independentVariableValue ) = 0;
 
+    //! Function to perform interpolation, using a caller-owned look-up cursor.
+    /*!
+     *  This function performs the interpolation, using (and updating) the state of the interval look-up stored in a
+     *  caller-owned cursor, instead of the state stored in the look-up scheme of this object. The function does not modify
+     *  this object, so that a single interpolator may be used concurrently by multiple callers (e.g. threads), provided that
+     *  each caller uses its own cursor. Results are identical to those of the interpolate function without cursor.
+     *
+     *  The default implementation, used by derived classes that do not override this function, does not use the cursor,
+     *  but calls the interpolate function without cursor (which performs its own look-up). These calls are serialized
+     *  by a mutex, so that the default implementation may also be used concurrently by multiple callers.
+     *  \param independentVariableValue Independent variable value at which the value of the
+     *      dependent variable is to be determined.
+     *  \param lookUpCursor Cursor storing the state of the sequence of interval look-ups (modified by this function).
+     *  \return Interpolated value of dependent variable.
+     */
+    virtual DependentVariableType
+    interpolate( const IndependentVariableType independentVariableValue, LookUpCursor& lookUpCursor ) const
+    {
+        static std::mutex interpolationMutex;
+        std::lock_guard< std::mutex > interpolationLock( interpolationMutex );
+        return const_cast< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >* >( this )->
+                interpolate( independentVariableValue );
+    }
+
+    //! Function to perform interpolation at a set of independent variable values.
+    /*!
+     *  This function performs the interpolation at a set of independent variable values, and writes the results into a
+     *  preallocated buffer. The results are identical to those of calling the single-value interpolate function for each
+     *  entry. If the input values are sorted in ascending order, the interval look-up is performed as a single sweep
+     *  through the independent variable grid. If they are not, the values are sorted (by index) first, and the results
+     *  are written back in the order of the input. The function does not modify this object.
+     *  \param independentVariableValues Pointer to first of the independent variable values at which the value of the
+     *      dependent variable is to be determined.
+     *  \param numberOfValues Number of independent variable values.
+     *  \param interpolatedValues Pointer to first entry of buffer (of size numberOfValues) to which interpolated values of
+     *      dependent variable are written.
+     */
+    void interpolateBatch( const IndependentVariableType* independentVariableValues,
+                           const int numberOfValues,
+                           DependentVariableType* interpolatedValues ) const
+    {
+        if( std::is_sorted( independentVariableValues, independentVariableValues + numberOfValues ) )
+        {
+            interpolateSortedBatch( independentVariableValues, numberOfValues, interpolatedValues );
+        }
+        else
+        {
+            // Determine order in which input is sorted
+            std::vector< int > sortedOrder( numberOfValues );
+            std::iota( sortedOrder.begin( ), sortedOrder.end( ), 0 );
+            std::stable_sort( sortedOrder.begin( ), sortedOrder.end( ),
+                              [ & ]( const int firstIndex, const int secondIndex )
+            {
+                return independentVariableValues[ firstIndex ] < independentVariableValues[ secondIndex ];
+            } );
+
+            // Interpolate at sorted values, and write back results in input order
+            std::vector< IndependentVariableType > sortedIndependentVariableValues( numberOfValues );
+            for( int i = 0; i < numberOfValues; i++ )
+            {
+                sortedIndependentVariableValues[ i ] = independentVariableValues[ sortedOrder[ i ] ];
+            }
+            std::vector< DependentVariableType > sortedInterpolatedValues( numberOfValues );
+            interpolateSortedBatch( sortedIndependentVariableValues.data( ), numberOfValues,
+                                    sortedInterpolatedValues.data( ) );
+            for( int i = 0; i < numberOfValues; i++ )
+            {
+                interpolatedValues[ sortedOrder[ i ] ] = sortedInterpolatedValues[ i ];
+            }
+        }
+    }
+
+    //! Function to perform interpolation at a set of independent variable values.
+    /*!
+     *  This function performs the interpolation at a set of independent variable values (see pointer-based overload).
+     *  \param independentVariableValues Independent variable values at which the value of the dependent variable is to be
+     *      determined.
+     *  \param interpolatedValues Interpolated values of dependent variable (returned by reference, resized by this function
+     *      if needed).
+     */
+    void interpolateBatch( const std::vector< IndependentVariableType >& independentVariableValues,
+                           std::vector< DependentVariableType >& interpolatedValues ) const
+    {
+        interpolatedValues.resize( independentVariableValues.size( ) );
+        interpolateBatch( independentVariableValues.data( ), static_cast< int >( independentVariableValues.size( ) ),
+                          interpolatedValues.data( ) );
+    }
+
     //! Function to perform interpolation, with non-const input argument.
     /*!
      *  This function performs the interpolation, with non-const input argument. Function calls the interpolate function and is
@@ -211,7 +302,7 @@ protected:
      *  \param targetIndependentVariable Value of independent variable (i.e., the one that is to be checked for boundary handling).
      *  \return Condition with respect to boundary.
      */
-    int checkInterpolationBoundary( const IndependentVariableType& targetIndependentVariable )
+    int checkInterpolationBoundary( const IndependentVariableType& targetIndependentVariable ) const
     {
         int isAtBoundary = 0;
         if ( targetIndependentVariable < independentValues_.front( ) )
@@ -236,7 +327,7 @@ protected:
      */
     void checkBoundaryCase(
             DependentVariableType& dependentVariable, bool& useValue,
-            const IndependentVariableType& targetIndependentVariable )
+            const IndependentVariableType& targetIndependentVariable ) const
     {
         // If extrapolation outside domain is not allowed
         if ( boundaryHandling_ != extrapolate_at_boundary )
@@ -362,6 +453,74 @@ protected:
         }
     }
 
+    //! Function to perform interpolation at a set of sorted independent variable values.
+    /*!
+     *  Function to perform interpolation at a set of independent variable values, sorted in ascending order. This default
+     *  implementation calls the single-value interpolate function with a local look-up cursor. Derived classes may
+     *  override this function (typically using interpolateSortedBatchInSweep) to prevent a virtual function call per value.
+     *  \param independentVariableValues Pointer to first of the (sorted) independent variable values at which the value
+     *      of the dependent variable is to be determined.
+     *  \param numberOfValues Number of independent variable values.
+     *  \param interpolatedValues Pointer to first entry of buffer to which interpolated values are written.
+     */
+    virtual void interpolateSortedBatch( const IndependentVariableType* independentVariableValues,
+                                         const int numberOfValues,
+                                         DependentVariableType* interpolatedValues ) const
+    {
+        LookUpCursor lookUpCursor;
+        for( int i = 0; i < numberOfValues; i++ )
+        {
+            interpolatedValues[ i ] = interpolate( independentVariableValues[ i ], lookUpCursor );
+        }
+    }
+
+    //! Function to perform interpolation at a set of sorted independent variable values, in a single sweep through the grid.
+    /*!
+     *  Function to perform interpolation at a set of independent variable values, sorted in ascending order. The interval
+     *  of the first value is determined by the look-up scheme, after which the interval is found by stepping forward
+     *  through the independent variable grid, which gives the same interval as the look-up scheme. Boundary handling is
+     *  applied in the same manner as for the single-value interpolate function.
+     *  \param independentVariableValues Pointer to first of the (sorted) independent variable values at which the value
+     *      of the dependent variable is to be determined.
+     *  \param numberOfValues Number of independent variable values.
+     *  \param interpolatedValues Pointer to first entry of buffer to which interpolated values are written.
+     *  \param interpolateInInterval Function (typically a lambda calling a non-virtual member function of the derived
+     *      class) that interpolates at a given independent variable value, in interval with given lower index.
+     */
+    template< typename IntervalInterpolationFunction >
+    void interpolateSortedBatchInSweep( const IndependentVariableType* independentVariableValues,
+                                        const int numberOfValues,
+                                        DependentVariableType* interpolatedValues,
+                                        const IntervalInterpolationFunction& interpolateInInterval ) const
+    {
+        if( numberOfValues <= 0 )
+        {
+            return;
+        }
+
+        const int numberOfIndependentValues = static_cast< int >( independentValues_.size( ) );
+        LookUpCursor lookUpCursor;
+        int lowerEntry = lookUpScheme_->findNearestLowerNeighbour( independentVariableValues[ 0 ], lookUpCursor );
+
+        bool useValue;
+        for( int i = 0; i < numberOfValues; i++ )
+        {
+            // Check whether boundary handling needs to be applied
+            useValue = false;
+            checkBoundaryCase( interpolatedValues[ i ], useValue, independentVariableValues[ i ] );
+            if( !useValue )
+            {
+                // Step forward to interval containing current value
+                while( lowerEntry < numberOfIndependentValues - 1 &&
+                       !( independentVariableValues[ i ] < independentValues_[ lowerEntry + 1 ] ) )
+                {
+                    lowerEntry++;
+                }
+                interpolatedValues[ i ] = interpolateInInterval( independentVariableValues[ i ], lowerEntry );
+            }
+        }
+    }
+
     //! Make look-up scheme that is to be used.
     /*!
      * This function creates the look-up scheme that is to be used in determining the interval of
@@ -391,6 +550,13 @@ protected:
                       ( independentValues_ );
             break;
         }
+        case equidistantLookup:
+        {
+            // Create equidistant scheme, which computes the interval directly from the independent variable.
+            lookUpScheme_ = std::make_shared< EquidistantLookupScheme< IndependentVariableType > >
+                      ( independentValues_ );
+            break;
+        }
         default:
             throw std::runtime_error( "Warning: lookup scheme not found when making scheme for 1-D interpolator" );
         }
@@ -161,6 +161,46 @@ public:
         return dependentValues_.at( lowerEntry );
     }
 
+    //! Function interpolates dependent variable value at given independent variable value, using a caller-owned cursor.
+    /*!
+     *  Function interpolates dependent variable value at given independent variable value using piecewise constant algorithm,
+     *  using a caller-owned cursor for the interval look-up (see OneDimensionalInterpolator). This function does not modify
+     *  the interpolator.
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation is to take place.
+     *  \param lookUpCursor Cursor storing the state of the sequence of interval look-ups.
+     *  \return Interpolated value of dependent variable.
+     */
+    DependentVariableType interpolate( const IndependentVariableType targetIndependentVariableValue,
+                                       LookUpCursor& lookUpCursor ) const
+    {
+        // Check whether boundary handling needs to be applied, if independent variable is beyond its defined range.
+        DependentVariableType interpolatedValue;
+        bool useValue = false;
+        this->checkBoundaryCase( interpolatedValue, useValue, targetIndependentVariableValue );
+        if( useValue )
+        {
+            return interpolatedValue;
+        }
+
+        // Determine the lower entry in the table corresponding to the target independent variable value.
+        int lowerEntry;
+        if( targetIndependentVariableValue <= independentValues_.at( 0 ) )
+        {
+            lowerEntry = 0;
+        }
+        else if( targetIndependentVariableValue >= independentValues_.at( independentValues_.size( ) - 1 ) )
+        {
+            lowerEntry = independentValues_.size( ) - 1;
+        }
+        else
+        {
+            lowerEntry = lookUpScheme_->findNearestLowerNeighbour( targetIndependentVariableValue, lookUpCursor );
+        }
+
+        // Return interpolated value
+        return dependentValues_.at( lowerEntry );
+    }
+
     //! Function to reset the values of dependent variables used by interpolator
     /*!
      *  Function to reset the values of dependent variables used by interpolator
@@ -0,0 +1,154 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_SINGLEPRECISIONLAGRANGEINTERPOLATOR_H
+#define TUDAT_SINGLEPRECISIONLAGRANGEINTERPOLATOR_H
+
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/math/interpolators/lagrangeInterpolator.h"
+
+namespace tudat
+{
+
+namespace interpolators
+{
+
+//! Class to perform Lagrange polynomial interpolation of matrices, with data points stored in single precision
+/*!
+ *  Class to perform Lagrange polynomial interpolation of (double precision) matrices, for which the data points are
+ *  stored in single precision, halving the memory required to store the data points w.r.t. a
+ *  LagrangeInterpolator< double, Eigen::MatrixXd >. The independent variables are stored in double precision, so that
+ *  long time series can be interpolated without loss of precision in the look-up. The relative precision of the
+ *  interpolated values is limited to that of single precision floating point numbers (approximately 1E-7). The data
+ *  points are not stored in the (double precision) dependentValues_ member of the base class, so that
+ *  getDependentValues returns an empty vector.
+ */
+class SinglePrecisionLagrangeInterpolator : public OneDimensionalInterpolator< double, Eigen::MatrixXd >
+{
+public:
+
+    using OneDimensionalInterpolator< double, Eigen::MatrixXd >::independentValues_;
+    using OneDimensionalInterpolator< double, Eigen::MatrixXd >::lookUpScheme_;
+    using Interpolator< double, Eigen::MatrixXd >::interpolate;
+
+    //! Constructor from vectors of independent/dependent data.
+    /*!
+     *  Constructor from vectors of independent/dependent data, with input as for LagrangeInterpolator. The dependent
+     *  variables are converted to single precision.
+     *  \param independentVariables Vector of values of independent variables that are used, must be
+     *      sorted in ascending order.
+     *  \param dependentVariables Vector of values of dependent variables that are used.
+     *  \param numberOfStages Number of data points that are used to calculate the interpolating
+     *      polynomial (must be even).
+     *  \param selectedLookupScheme Identifier of lookupscheme from enum.
+     *  \param lagrangeBoundaryHandling Method for interpolation near the edges of the domain
+     *  \param boundaryHandling Boundary handling method, in case the independent variable is outside the
+     *      specified range.
+     */
+    SinglePrecisionLagrangeInterpolator(
+            const std::vector< double >& independentVariables,
+            const std::vector< Eigen::MatrixXd >& dependentVariables,
+            const int numberOfStages,
+            const AvailableLookupScheme selectedLookupScheme = huntingAlgorithm,
+            const LagrangeInterpolatorBoundaryHandling lagrangeBoundaryHandling = lagrange_cubic_spline_boundary_interpolation,
+            const BoundaryInterpolationType boundaryHandling = extrapolate_at_boundary ):
+        OneDimensionalInterpolator< double, Eigen::MatrixXd >( boundaryHandling )
+    {
+        std::vector< Eigen::MatrixXf > singlePrecisionDependentVariables;
+        singlePrecisionDependentVariables.reserve( dependentVariables.size( ) );
+        for( unsigned int i = 0; i < dependentVariables.size( ); i++ )
+        {
+            singlePrecisionDependentVariables.push_back( dependentVariables.at( i ).cast< float >( ) );
+        }
+
+        singlePrecisionInterpolator_ = std::make_shared< LagrangeInterpolator< double, Eigen::MatrixXf, float > >(
+                    independentVariables, singlePrecisionDependentVariables, numberOfStages, selectedLookupScheme,
+                    lagrangeBoundaryHandling, boundaryHandling );
+
+        independentValues_ = independentVariables;
+        lookUpScheme_ = singlePrecisionInterpolator_->getLookUpScheme( );
+    }
+
+    //! Destructor
+    ~SinglePrecisionLagrangeInterpolator( ){ }
+
+    //! Function interpolates dependent variable value at given independent variable value.
+    /*!
+     *  Function interpolates dependent variable value at given independent variable value.
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation
+     *      is to take place.
+     *  \return Interpolated value of dependent variable (in double precision).
+     */
+    Eigen::MatrixXd interpolate( const double targetIndependentVariableValue )
+    {
+        return singlePrecisionInterpolator_->interpolate( targetIndependentVariableValue ).cast< double >( );
+    }
+
+    //! Function interpolates dependent variable value at given independent variable value, using a caller-owned cursor.
+    /*!
+     *  Function interpolates dependent variable value at given independent variable value, using a caller-owned
+     *  cursor for the interval look-up (see OneDimensionalInterpolator). This function does not modify the interpolator.
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation
+     *      is to take place.
+     *  \param lookUpCursor Cursor storing the state of the sequence of interval look-ups.
+     *  \return Interpolated value of dependent variable (in double precision).
+     */
+    Eigen::MatrixXd interpolate( const double targetIndependentVariableValue,
+                                 LookUpCursor& lookUpCursor ) const
+    {
+        return singlePrecisionInterpolator_->interpolate( targetIndependentVariableValue, lookUpCursor ).cast< double >( );
+    }
+
+    //! Function to retrieve the interpolator that operates on the single precision data points
+    std::shared_ptr< LagrangeInterpolator< double, Eigen::MatrixXf, float > > getSinglePrecisionInterpolator( )
+    {
+        return singlePrecisionInterpolator_;
+    }
+
+    InterpolatorTypes getInterpolatorType( ){ return lagrange_interpolator; }
+
+private:
+
+    //! Function to perform interpolation at a set of sorted independent variable values.
+    /*!
+     *  Function to perform interpolation at a set of independent variable values, sorted in ascending order, in a single
+     *  sweep through the independent variable grid of the single precision interpolator.
+     *  \param independentVariableValues Pointer to first of the (sorted) independent variable values at which the value
+     *      of the dependent variable is to be determined.
+     *  \param numberOfValues Number of independent variable values.
+     *  \param interpolatedValues Pointer to first entry of buffer to which interpolated values are written.
+     */
+    void interpolateSortedBatch( const double* independentVariableValues,
+                                 const int numberOfValues,
+                                 Eigen::MatrixXd* interpolatedValues ) const
+    {
+        std::vector< Eigen::MatrixXf > singlePrecisionInterpolatedValues( numberOfValues );
+        singlePrecisionInterpolator_->interpolateBatch(
+                    independentVariableValues, numberOfValues, singlePrecisionInterpolatedValues.data( ) );
+        for( int i = 0; i < numberOfValues; i++ )
+        {
+            interpolatedValues[ i ] = singlePrecisionInterpolatedValues[ i ].cast< double >( );
+        }
+    }
+
+    //! Interpolator that operates on the single precision data points
+    std::shared_ptr< LagrangeInterpolator< double, Eigen::MatrixXf, float > > singlePrecisionInterpolator_;
+};
+
+} // namespace interpolators
+
+} // namespace tudat
+
+#endif // TUDAT_SINGLEPRECISIONLAGRANGEINTERPOLATOR_H
@@ -692,26 +692,36 @@ public:
 
     //    extern template void setStateFromEphemeris< double, double >( const double& time );
 
-    //! Templated function to get the current state of the body from its ephemeris and
-    //! global-to-ephemeris-frame function.
+    //! Templated function to get the state of the body from its ephemeris and global-to-ephemeris-frame function.
     /*!
-     * Templated function to get the current state of the body from its ephemeris and
-     * global-to-ephemeris-frame function.  It calls the setStateFromEphemeris state, resetting the currentState_ /
-     * currentLongState_ variables, and returning the state with the requested precision
+     * Templated function to get the state of the body from its ephemeris and global-to-ephemeris-frame function, returning
+     * the state with the requested precision. Unlike setStateFromEphemeris, this function does not modify the body (the
+     * currentState_/currentLongState_ variables are not reset), so that it may be called concurrently from multiple
+     * threads, provided that the ephemeris models that are used can be evaluated concurrently. If the body is the global
+     * frame origin, a zero state is returned.
      * \param time Time at which to evaluate states.
      * \return State at requested time
      */
     template<typename StateScalarType = double, typename TimeType = double>
     Eigen::Matrix<StateScalarType, 6, 1> getStateInBaseFrameFromEphemeris(const TimeType time)
     {
-        setStateFromEphemeris<StateScalarType, TimeType>(time);
-        if (sizeof(StateScalarType) == 8)
+        if( bodyEphemeris_ == nullptr )
+        {
+            throw std::runtime_error( "Error when requesting state from ephemeris of body " + bodyName_ + ", body has no ephemeris" );
+        }
+
+        if (bodyIsGlobalFrameOrigin_ == 0)
+        {
+            return bodyEphemeris_->getTemplatedStateFromEphemeris<StateScalarType, TimeType>(time) +
+                    ephemerisFrameToBaseFrame_->getBaseFrameState<TimeType, StateScalarType>(time);
+        }
+        else if (bodyIsGlobalFrameOrigin_ == 1)
         {
-            return currentState_.template cast<StateScalarType>();
+            return Eigen::Matrix<StateScalarType, 6, 1>::Zero( );
         }
         else
         {
-            return currentLongState_.template cast<StateScalarType>();
+            throw std::runtime_error("Error when setting body state, global origin not yet defined.");
         }
     }
 
@@ -721,13 +731,13 @@ public:
         return getStateInBaseFrameFromEphemeris< StateScalarType, TimeType >( time ).segment( 0, 3 );
     }
 
-    //! Templated function to get the current berycentric state of the body from its ephemeris andcglobal-to-ephemeris-frame
+    //! Templated function to get the barycentric state of the body from its ephemeris and global-to-ephemeris-frame
     //! function.
     /*!
-     * Templated function to get the current berycentric state of the body from its ephemeris andcglobal-to-ephemeris-frame
-     * function. It calls the setStateFromEphemeris state, resetting the currentBarycentricState_ /
-     * currentBarycentricLongState_ variables, and returning the state with the requested precision. This function can ONLY be
-     * called if this body is the global frame origin, otherwise an exception is thrown
+     * Templated function to get the barycentric state of the body from its ephemeris and global-to-ephemeris-frame
+     * function, returning the state with the requested precision. As getStateInBaseFrameFromEphemeris, this function does
+     * not modify the body. This function can ONLY be called if this body is the global frame origin, otherwise an
+     * exception is thrown
      * \param time Time at which to evaluate states.
      * \return Barycentric State at requested time
      */
@@ -736,14 +746,12 @@ public:
         if (bodyIsGlobalFrameOrigin_ != 1) {
             throw std::runtime_error("Error, calling global frame origin barycentric state on body that is not global frame origin");
         }
-
-        setStateFromEphemeris<StateScalarType, TimeType>(time);
-
-        if (sizeof(StateScalarType) == 8) {
-            return currentBarycentricState_.template cast<StateScalarType>();
-        } else {
-            return currentBarycentricLongState_.template cast<StateScalarType>();
+        if( bodyEphemeris_ == nullptr )
+        {
+            throw std::runtime_error( "Error when requesting state from ephemeris of body " + bodyName_ + ", body has no ephemeris" );
         }
+
+        return ephemerisFrameToBaseFrame_->getBaseFrameState<TimeType, StateScalarType>(time);
     }
 
     //! Get current rotational state.
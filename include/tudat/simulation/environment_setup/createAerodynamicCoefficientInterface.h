@@ -1469,36 +1469,43 @@ createTabulatedCoefficientAerodynamicCoefficientInterface(
                                   "inconsistent variable name vector dimensioning" );
     }
 
-    // Create interpolators for coefficients.
-    std::shared_ptr< MultiDimensionalInterpolator < double, Eigen::Vector3d, NumberOfDimensions > > forceInterpolator;
-    std::shared_ptr< MultiDimensionalInterpolator< double, Eigen::Vector3d, NumberOfDimensions > > momentInterpolator;
+    // Concatenate force and moment coefficients, so that they are interpolated in a single pass
+    for( unsigned int i = 0; i < NumberOfDimensions; i++ )
+    {
+        if( forceCoefficients.shape( )[ i ] != momentCoefficients.shape( )[ i ] )
+        {
+            throw std::runtime_error( "Error when creating tabulated aerodynamic coefficient interface, "
+                                      "inconsistent force and moment coefficient dimensioning" );
+        }
+    }
+    boost::array< size_t, NumberOfDimensions > coefficientsShape;
+    std::copy( forceCoefficients.shape( ), forceCoefficients.shape( ) + NumberOfDimensions, coefficientsShape.begin( ) );
+    boost::multi_array< Eigen::Vector6d, static_cast< size_t >( NumberOfDimensions ) > coefficients( coefficientsShape );
+    for( unsigned int i = 0; i < forceCoefficients.num_elements( ); i++ )
+    {
+        coefficients.data( )[ i ] << forceCoefficients.data( )[ i ], momentCoefficients.data( )[ i ];
+    }
+
+    // Create interpolator for coefficients.
+    std::shared_ptr< MultiDimensionalInterpolator< double, Eigen::Vector6d, NumberOfDimensions > > coefficientInterpolator;
     if ( interpolatorSettings == nullptr )
     {
-        forceInterpolator = createMultiDimensionalInterpolator< double, Eigen::Vector3d, NumberOfDimensions >(
-                    independentVariables, forceCoefficients,
-                    std::make_shared< InterpolatorSettings >( multi_linear_interpolator, huntingAlgorithm, false,
-                                                              std::vector< BoundaryInterpolationType >( NumberOfDimensions,
-                                                                                                        use_boundary_value ) ) );
-        momentInterpolator = createMultiDimensionalInterpolator< double, Eigen::Vector3d, NumberOfDimensions >(
-                    independentVariables, momentCoefficients,
+        coefficientInterpolator = createMultiDimensionalInterpolator< double, Eigen::Vector6d, NumberOfDimensions >(
+                    independentVariables, coefficients,
                     std::make_shared< InterpolatorSettings >( multi_linear_interpolator, huntingAlgorithm, false,
                                                               std::vector< BoundaryInterpolationType >( NumberOfDimensions,
                                                                                                         use_boundary_value ) ) );
     }
     else
     {
-        forceInterpolator = createMultiDimensionalInterpolator< double, Eigen::Vector3d, NumberOfDimensions >(
-                    independentVariables, forceCoefficients, interpolatorSettings );
-        momentInterpolator = createMultiDimensionalInterpolator< double, Eigen::Vector3d, NumberOfDimensions >(
-                    independentVariables, momentCoefficients, interpolatorSettings );
+        coefficientInterpolator = createMultiDimensionalInterpolator< double, Eigen::Vector6d, NumberOfDimensions >(
+                    independentVariables, coefficients, interpolatorSettings );
     }
 
     // Create aerodynamic coefficient interface.
     return std::make_shared< aerodynamics::CustomAerodynamicCoefficientInterface >(
-                std::bind( &MultiDimensionalInterpolator< double, Eigen::Vector3d, NumberOfDimensions >::interpolate,
-                           forceInterpolator, std::placeholders::_1 ),
-                std::bind( &MultiDimensionalInterpolator< double, Eigen::Vector3d, NumberOfDimensions >::interpolate,
-                           momentInterpolator, std::placeholders::_1 ),
+                std::bind( &MultiDimensionalInterpolator< double, Eigen::Vector6d, NumberOfDimensions >::interpolate,
+                           coefficientInterpolator, std::placeholders::_1 ),
                 referenceLength, referenceArea, momentReferencePoint,
                 independentVariableNames,
                 forceCoefficientsFrame, momentCoefficientsFrame );
@@ -20,6 +20,7 @@
 #include "tudat/astro/aerodynamics/atmosphereModel.h"
 #include "tudat/astro/aerodynamics/exponentialAtmosphere.h"
 #include "tudat/astro/aerodynamics/customConstantTemperatureAtmosphere.h"
+#include "tudat/astro/aerodynamics/precomputedAtmosphere.h"
 #include "tudat/astro/basic_astro/physicalConstants.h"
 #include "tudat/math/interpolators/interpolator.h"
 #include "tudat/basics/identityElements.h"
@@ -172,7 +173,8 @@ enum AtmosphereTypes
     custom_constant_temperature_atmosphere,
     tabulated_atmosphere,
     nrlmsise00,
-    scaled_atmosphere
+    scaled_atmosphere,
+    precomputed_atmosphere
 };
 
 //  Class for providing settings for atmosphere model.
@@ -883,6 +885,67 @@ protected:
     bool isScalingAbsolute_;
 };
 
+//  AtmosphereSettings for defining an atmosphere interpolated from a table precomputed from another atmosphere model.
+class PrecomputedAtmosphereSettings: public AtmosphereSettings
+{
+public:
+
+    //  Constructor.
+    /*
+     *  Constructor.
+     *  \param baseSettings Settings for the atmosphere model from which the table is computed.
+     *  \param gridSettings Settings for the grid on which the table is computed.
+     *  \param cacheFile File in which the table is cached (no caching if empty), see
+     *  aerodynamics::createPrecomputedAtmosphere.
+     *  \param boundaryHandling Method for interpolation behavior when altitude or time are out of range.
+     */
+    PrecomputedAtmosphereSettings(
+            const std::shared_ptr< AtmosphereSettings > baseSettings,
+            const aerodynamics::PrecomputedAtmosphereGridSettings& gridSettings,
+            const std::string& cacheFile = "",
+            const interpolators::BoundaryInterpolationType boundaryHandling = interpolators::throw_exception_at_boundary ):
+        AtmosphereSettings( precomputed_atmosphere ),
+        baseSettings_( baseSettings ), gridSettings_( gridSettings ), cacheFile_( cacheFile ),
+        boundaryHandling_( boundaryHandling ){ }
+
+    //  Function to return settings for the atmosphere model from which the table is computed.
+    std::shared_ptr< AtmosphereSettings > getBaseSettings( )
+    {
+        return baseSettings_;
+    }
+
+    //  Function to return settings for the grid on which the table is computed.
+    aerodynamics::PrecomputedAtmosphereGridSettings getGridSettings( )
+    {
+        return gridSettings_;
+    }
+
+    //  Function to return file in which the table is cached.
+    std::string getCacheFile( )
+    {
+        return cacheFile_;
+    }
+
+    //  Function to return method for interpolation behavior when altitude or time are out of range.
+    interpolators::BoundaryInterpolationType getBoundaryHandling( )
+    {
+        return boundaryHandling_;
+    }
+
+protected:
+
+    //  Settings for the atmosphere model from which the table is computed.
+    std::shared_ptr< AtmosphereSettings > baseSettings_;
+
+    //  Settings for the grid on which the table is computed.
+    aerodynamics::PrecomputedAtmosphereGridSettings gridSettings_;
+
+    //  File in which the table is cached (no caching if empty).
+    std::string cacheFile_;
+
+    //  Method for interpolation behavior when altitude or time are out of range.
+    interpolators::BoundaryInterpolationType boundaryHandling_;
+};
 
 //! @get_docstring(exponentialAtmosphereSettings,2)
 inline std::shared_ptr< AtmosphereSettings > exponentialAtmosphereSettings(
@@ -979,6 +1042,15 @@ inline std::shared_ptr< AtmosphereSettings > scaledAtmosphereSettings(
     return std::make_shared< ScaledAtmosphereSettings >( baseSettings, scaling, isScalingAbsolute );
 }
 
+inline std::shared_ptr< AtmosphereSettings > precomputedAtmosphereSettings(
+        const std::shared_ptr< AtmosphereSettings > baseSettings,
+        const aerodynamics::PrecomputedAtmosphereGridSettings& gridSettings,
+        const std::string& cacheFile = "",
+        const interpolators::BoundaryInterpolationType boundaryHandling = interpolators::throw_exception_at_boundary )
+{
+    return std::make_shared< PrecomputedAtmosphereSettings >( baseSettings, gridSettings, cacheFile, boundaryHandling );
+}
+
 inline std::shared_ptr< AtmosphereSettings > tabulatedAtmosphereSettings(
         const std::string& atmosphereTableFile,
         const std::vector< AtmosphereDependentVariables >& dependentVariablesNames = { density_dependent_atmosphere,
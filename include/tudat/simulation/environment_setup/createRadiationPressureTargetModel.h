@@ -126,6 +126,74 @@ private:
 
     double coefficient_;
 };
+
+/*!
+ * Settings for the self-shadowing of the body-fixed panels of a paneled radiation pressure target model.
+ *
+ * @see PanelSelfShadowingModel
+ */
+class PanelSelfShadowingSettings
+{
+public:
+    /*!
+     * Constructor.
+     *
+     * @param numberOfAzimuthPoints Number of source azimuth angles in the illumination fraction table
+     * @param numberOfElevationPoints Number of source elevation angles in the illumination fraction table
+     * @param numberOfSamplesPerPanelSide Number of ray-tracing sample points per side of each panel
+     * @param numberOfThreads Number of threads used to compute the illumination fraction table (0 for all hardware
+     *      threads)
+     */
+    PanelSelfShadowingSettings(
+            const unsigned int numberOfAzimuthPoints = 72,
+            const unsigned int numberOfElevationPoints = 37,
+            const unsigned int numberOfSamplesPerPanelSide = 8,
+            const unsigned int numberOfThreads = 1 ):
+        numberOfAzimuthPoints_( numberOfAzimuthPoints ),
+        numberOfElevationPoints_( numberOfElevationPoints ),
+        numberOfSamplesPerPanelSide_( numberOfSamplesPerPanelSide ),
+        numberOfThreads_( numberOfThreads ){ }
+
+    unsigned int numberOfAzimuthPoints_;
+
+    unsigned int numberOfElevationPoints_;
+
+    unsigned int numberOfSamplesPerPanelSide_;
+
+    unsigned int numberOfThreads_;
+};
+
+/*!
+ * Settings for a paneled radiation pressure target model, with self-shadowing of the body-fixed panels. The panels
+ * themselves are retrieved from the vehicle systems of the body.
+ *
+ * @see PaneledRadiationPressureTargetModel
+ */
+class PaneledRadiationPressureTargetModelSettings : public RadiationPressureTargetModelSettings
+{
+public:
+    /*!
+     * Constructor.
+     *
+     * @param selfShadowingSettings Settings for the self-shadowing of the body-fixed panels
+     * @param sourceToTargetOccultingBodies Map (source name -> list of occulting body names) of bodies
+     *      to occult sources as seen from this target
+     */
+    explicit PaneledRadiationPressureTargetModelSettings(
+            const std::shared_ptr< PanelSelfShadowingSettings > selfShadowingSettings,
+            const std::map<std::string, std::vector<std::string>>& sourceToTargetOccultingBodies = {}) :
+            RadiationPressureTargetModelSettings(
+                    RadiationPressureTargetModelType::paneled_target, sourceToTargetOccultingBodies),
+            selfShadowingSettings_( selfShadowingSettings ) {}
+
+    std::shared_ptr< PanelSelfShadowingSettings > getSelfShadowingSettings( ) const
+    {
+        return selfShadowingSettings_;
+    }
+
+private:
+    std::shared_ptr< PanelSelfShadowingSettings > selfShadowingSettings_;
+};
 //
 ///*!
 // * Settings for a paneled radiation pressure target model.
@@ -419,6 +487,26 @@ inline std::shared_ptr<RadiationPressureTargetModelSettings>
         occultingBodiesMap);
 }
 
+/*!
+ * Create settings for a paneled radiation pressure target model, in which the self-shadowing of the body-fixed
+ * panels is accounted for. All sources are occulted by the same set of bodies.
+ *
+ * @param selfShadowingSettings Settings for the self-shadowing of the body-fixed panels
+ * @param sourceToTargetOccultingBodies Names of bodies to occult the source as seen from this target
+ * @return Shared pointer to settings for a paneled radiation pressure target model
+ */
+inline std::shared_ptr<RadiationPressureTargetModelSettings>
+        paneledRadiationPressureTargetModelWithSelfShadowingSettings(
+            const std::shared_ptr< PanelSelfShadowingSettings > selfShadowingSettings =
+                std::make_shared< PanelSelfShadowingSettings >( ),
+            const std::vector<std::string>& sourceToTargetOccultingBodies = {})
+{
+    const std::map<std::string, std::vector<std::string>> occultingBodiesMap {{"", sourceToTargetOccultingBodies}};
+    return std::make_shared<PaneledRadiationPressureTargetModelSettings>(
+        selfShadowingSettings,
+        occultingBodiesMap);
+}
+
 RadiationPressureTargetModelType getTargetModelType( const std::shared_ptr<electromagnetism::RadiationPressureTargetModel> targetModel );
 
 /*!
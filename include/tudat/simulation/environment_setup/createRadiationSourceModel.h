@@ -452,15 +452,18 @@ public:
      * @param panelRadiosityModelSettings Vector of settings for radiosity model of all panels
      * @param numberOfPanelsPerRing Number of panels for each ring, excluding the central cap
      * @param originalSourceToSourceOccultingBodies Names of bodies to occult original sources as seen from this source
+     * @param panelRegenerationTolerance Relative displacement of the target below which panels are not regenerated
      */
     explicit ExtendedRadiationSourceModelSettings(
             const std::vector<std::shared_ptr<PanelRadiosityModelSettings>>& panelRadiosityModelSettings,
             const std::vector<int>& numberOfPanelsPerRing,
-            const std::map<std::string, std::vector<std::string>>& originalSourceToSourceOccultingBodies) :
+            const std::map<std::string, std::vector<std::string>>& originalSourceToSourceOccultingBodies,
+            const double panelRegenerationTolerance = 0.0) :
             RadiationSourceModelSettings(RadiationSourceModelType::extended_source),
             panelRadiosityModelSettings_(panelRadiosityModelSettings),
             numberOfPanelsPerRing_(numberOfPanelsPerRing),
-            originalSourceToSourceOccultingBodies_(originalSourceToSourceOccultingBodies) {}
+            originalSourceToSourceOccultingBodies_(originalSourceToSourceOccultingBodies),
+            panelRegenerationTolerance_(panelRegenerationTolerance) {}
 
     const std::vector<int>& getNumberOfPanelsPerRing() const
     {
@@ -477,6 +480,11 @@ public:
         return originalSourceToSourceOccultingBodies_;
     }
 
+    double getPanelRegenerationTolerance() const
+    {
+        return panelRegenerationTolerance_;
+    }
+
 private:
     std::vector<std::shared_ptr<PanelRadiosityModelSettings>> panelRadiosityModelSettings_;
     const std::vector<int> numberOfPanelsPerRing_;
@@ -484,6 +492,7 @@ private:
     // If the same occulting bodies are to be used for all original sources, there will be a single entry
     // with an emptry string as key
     std::map<std::string, std::vector<std::string>> originalSourceToSourceOccultingBodies_;
+    double panelRegenerationTolerance_;
 };
 
 /*!
@@ -636,16 +645,20 @@ inline std::shared_ptr<PanelRadiosityModelSettings>
  * @param numberOfPanelsPerRing Number of panels for each ring, excluding the central cap
  * @param originalSourceToSourceOccultingBodies Map (original source name -> list of occulting body names) of bodies
  *      to occult original sources as seen from this source
+ * @param panelRegenerationTolerance Displacement of the target (relative to its distance from the source center) since
+ *      the last panel generation below which panels are reused instead of regenerated
  * @return Shared pointer to settings for an extended radiation source model
  */
 inline std::shared_ptr<RadiationSourceModelSettings>
         extendedRadiationSourceModelSettingsWithOccultationMap(
                 std::vector<std::shared_ptr<PanelRadiosityModelSettings>> panelRadiosityModels,
                 const std::vector<int>& numberOfPanelsPerRing,
-                const std::map<std::string, std::vector<std::string>>& originalSourceToSourceOccultingBodies)
+                const std::map<std::string, std::vector<std::string>>& originalSourceToSourceOccultingBodies,
+                const double panelRegenerationTolerance = 0.0)
 {
     return std::make_shared< ExtendedRadiationSourceModelSettings >(
-            panelRadiosityModels, numberOfPanelsPerRing, originalSourceToSourceOccultingBodies);
+            panelRadiosityModels, numberOfPanelsPerRing, originalSourceToSourceOccultingBodies,
+            panelRegenerationTolerance);
 }
 
 /*!
@@ -654,17 +667,21 @@ inline std::shared_ptr<RadiationSourceModelSettings>
  * @param panelRadiosityModels List of settings for radiosity models of all panels
  * @param numberOfPanelsPerRing Number of panels for each ring, excluding the central cap
  * @param originalSourceToSourceOccultingBodies Names of bodies to occult original sources as seen from this source
+ * @param panelRegenerationTolerance Displacement of the target (relative to its distance from the source center) since
+ *      the last panel generation below which panels are reused instead of regenerated
  * @return Shared pointer to settings for an extended radiation source model
  */
 inline std::shared_ptr<RadiationSourceModelSettings>
         extendedRadiationSourceModelSettings(
                 std::vector<std::shared_ptr<PanelRadiosityModelSettings>> panelRadiosityModels,
                 const std::vector<int>& numberOfPanelsPerRing,
-                const std::vector<std::string>& originalSourceToSourceOccultingBodies = {})
+                const std::vector<std::string>& originalSourceToSourceOccultingBodies = {},
+                const double panelRegenerationTolerance = 0.0)
 {
     const std::map<std::string, std::vector<std::string>> occultingBodiesMap {{"", originalSourceToSourceOccultingBodies}};
     return extendedRadiationSourceModelSettingsWithOccultationMap(
-            std::move(panelRadiosityModels), numberOfPanelsPerRing, occultingBodiesMap);
+            std::move(panelRadiosityModels), numberOfPanelsPerRing, occultingBodiesMap,
+            panelRegenerationTolerance);
 }
 
 /*!
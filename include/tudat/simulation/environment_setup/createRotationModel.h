@@ -80,7 +80,7 @@ public:
                            const std::string& originalFrame,
                            const std::string& targetFrame ):
         rotationType_( rotationType ), originalFrame_( originalFrame ),
-        targetFrame_( targetFrame ){ }
+        targetFrame_( targetFrame ), useEpochCache_( false ){ }
 
     //Destructor.
     virtual ~RotationModelSettings( ){ }
@@ -121,6 +121,28 @@ public:
         originalFrame_ = originalFrame;
     }
 
+    //Function to retrieve whether the rotational quantities of the rotation model are to be cached per epoch
+    /*
+     *  Function to retrieve whether the rotational quantities of the rotation model are to be cached per epoch
+     *  \return Boolean denoting whether the rotational quantities are to be cached per epoch
+     */
+
+    bool getUseEpochCache( ){ return useEpochCache_; }
+
+    //Function to set whether the rotational quantities of the rotation model are to be cached per epoch
+    /*
+     *  Function to set whether the rotational quantities of the rotation model are to be cached per epoch (see
+     *  RotationalEphemeris::setUseEpochCache). Recommended for rotation models that are expensive to evaluate (e.g. GCRS<->ITRS
+     *  and planetary rotation models), and are used by several environment/acceleration models. Only supported for simple,
+     *  SPICE, GCRS<->ITRS, planetary and tabulated rotation models; creating any other (state-dependent or custom) rotation
+     *  model with this setting results in an exception. The cache is not thread-safe: a cached rotation model must only be
+     *  evaluated from a single thread. The multi-threaded observation simulation and estimation functions therefore use a
+     *  single thread if a cached rotation model is present in the environment.
+     *  \param useEpochCache Boolean denoting whether the rotational quantities are to be cached per epoch
+     */
+
+    void setUseEpochCache( const bool useEpochCache ){ useEpochCache_ = useEpochCache; }
+
 protected:
 
     //Type of rotation model that is to be created.
@@ -132,6 +154,9 @@ protected:
     //Base frame of rotation model.
     std::string targetFrame_;
 
+    //Boolean denoting whether the rotational quantities of the rotation model are to be cached per epoch
+    bool useEpochCache_;
+
 };
 
 class SpiceRotationModelSettings: public RotationModelSettings
@@ -398,6 +423,30 @@ public:
         shortTermInterpolatorSettings_ = shortTermInterpolatorSettings;
     }
 
+    //Function to retrieve the name of the precomputed Earth orientation table file (empty if not used)
+    /*
+     * Function to retrieve the name of the precomputed Earth orientation table file (empty if not used)
+     * \return Name of the precomputed Earth orientation table file
+     */
+    std::string getEarthOrientationTableFile( )
+    {
+        return earthOrientationTableFile_;
+    }
+
+    //Function to set the name of a precomputed Earth orientation table file
+    /*
+     * Function to set the name of a precomputed Earth orientation table file (see
+     * earth_orientation::writeEarthOrientationTableToFile), from which the Earth orientation angles and UT1 are interpolated,
+     * instead of computing them directly. Table must be generated with the same settings as this object: the
+     * precession-nutation theory, EOP data and short-period corrections are checked against the table header when the
+     * rotation model is created.
+     * \param earthOrientationTableFile Name of the precomputed Earth orientation table file
+     */
+    void setEarthOrientationTableFile( const std::string& earthOrientationTableFile )
+    {
+        earthOrientationTableFile_ = earthOrientationTableFile;
+    }
+
 private:
 
     //Time scale in which input to the rotation model class is provided
@@ -423,6 +472,9 @@ private:
     std::shared_ptr< interpolators::InterpolatorGenerationSettings< double > > tdbToTtInterpolatorSettings_;
 
     std::shared_ptr< interpolators::InterpolatorGenerationSettings< double > > shortTermInterpolatorSettings_;
+
+    //Name of the precomputed Earth orientation table file (empty if not used)
+    std::string earthOrientationTableFile_;
 };
 //#endif
 
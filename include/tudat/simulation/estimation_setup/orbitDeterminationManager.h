@@ -12,17 +12,22 @@
 #define TUDAT_ORBITDETERMINATIONMANAGER_H
 
 #include <algorithm>
+#include <tuple>
 
 
 
+#include "tudat/basics/utilities.h"
 #include "tudat/io/basicInputOutput.h"
+#include "tudat/math/basic/blockSparseDesignMatrix.h"
 #include "tudat/math/basic/leastSquaresEstimation.h"
+#include "tudat/math/basic/squareRootInformationFilter.h"
 #include "tudat/astro/observation_models/observationManager.h"
 #include "tudat/astro/orbit_determination/podInputOutputTypes.h"
 #include "tudat/astro/orbit_determination/estimatable_parameters/initialTranslationalState.h"
 #include "tudat/simulation/estimation_setup/variationalEquationsSolver.h"
 #include "tudat/simulation/estimation_setup/createObservationManager.h"
 #include "tudat/simulation/estimation_setup/createNumericalSimulator.h"
+#include "tudat/simulation/estimation_setup/simulateObservations.h"
 #include "tudat/simulation/propagation_setup/dependentVariablesInterface.h"
 
 namespace tudat
@@ -31,13 +36,19 @@ namespace tudat
 namespace simulation_setup
 {
 
+//! Function to check whether the residuals of an observable type are checked for (2 pi) discontinuities
+inline bool areObservationResidualDiscontinuitiesChecked( const observation_models::ObservableType observableType )
+{
+    return ( observableType == observation_models::angular_position || observableType == observation_models::euler_angle_313_observable || observableType == observation_models::relative_angular_position );
+}
+
 template< typename ObservationScalarType >
 void checkObservationResidualDiscontinuities(
         Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >& residuals,
         const std::pair< int, int > observableStartAndSize,
         const observation_models::ObservableType observableType )
 {
-    if( observableType == observation_models::angular_position || observableType == observation_models::euler_angle_313_observable || observableType == observation_models::relative_angular_position )
+    if( areObservationResidualDiscontinuitiesChecked( observableType ) )
     {
         Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > residualsBlock = residuals.block( observableStartAndSize.first, 0, observableStartAndSize.second, 1 );
         for( int i = 1; i < residualsBlock.rows( ); i++ )
@@ -115,23 +126,69 @@ void calculateResiduals(
 }
 
 
-//! Function to calculate the observation partials matrix and residuals
+//! Function to retrieve all non-empty observation sets from an observation collection
+/*!
+ *  Function to retrieve all non-empty observation sets from an observation collection, in the order in which they are
+ *  stored in the concatenated observations
+ *  \param observationsCollection Observable values and associated time tags, per observable type and set of link ends.
+ *  \return List of observation sets, each with its observable type, link ends and start index and size in the
+ *  concatenated observations
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+std::vector< std::tuple< observation_models::ObservableType, observation_models::LinkEnds,
+    std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >,
+    std::pair< int, int > > > getNonEmptyObservationSets(
+    const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationsCollection )
+{
+    std::vector< std::tuple< observation_models::ObservableType, observation_models::LinkEnds,
+        std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >,
+        std::pair< int, int > > > observationSets;
+    for( auto observableIt : observationsCollection->getObservationsSets( ) )
+    {
+        observation_models::ObservableType currentObservableType = observableIt.first;
+        for( auto linkEndIt : observableIt.second )
+        {
+            observation_models::LinkEnds currentLinkEnds = linkEndIt.first;
+            for( unsigned int i = 0; i < linkEndIt.second.size( ); i++ )
+            {
+                std::pair< int, int > observationIndices = observationsCollection->getObservationSetStartAndSize( ).at(
+                    currentObservableType ).at( currentLinkEnds ).at( i );
+                if( observationIndices.second > 0 )
+                {
+                    observationSets.push_back(
+                        std::make_tuple( currentObservableType, currentLinkEnds, linkEndIt.second.at( i ), observationIndices ) );
+                }
+            }
+        }
+    }
+    return observationSets;
+}
+
+//! Function to calculate the observation partials matrix and residuals, distributing the observation sets over threads
 /*!
  *  This function calculates the observation partials matrix and residuals, based on the state transition matrix,
  *  sensitivity matrix and body states resulting from the previous numerical integration iteration.
- *  Partials and observations are calculated by the observationManagers_.
- *  \param observationsAndTimes Observable values and associated time tags, per observable type and set of link ends.
- *  \param parameterVectorSize Length of the vector of estimated parameters
+ *  Partials and observations are calculated by the observation managers. Each observation set is computed on a single
+ *  thread, using the observation managers of that thread, and written to its own block of the design matrix and
+ *  residuals. The check for residual discontinuities is performed afterwards, on the calling thread, so that the
+ *  results are identical for any number of threads.
+ *  \param observationsCollection Observable values and associated time tags, per observable type and set of link ends.
+ *  \param threadObservationManagers Observation managers for each thread (one thread per entry), which must compute
+ *  the same observables and partials. The environment they use must be safe to evaluate concurrently if more than one
+ *  thread is used.
+ *  \param totalNumberParameters Length of the vector of estimated parameters
  *  \param totalObservationSize Total number of observations in observationsAndTimes map.
- *  \param residualsAndPartials Pair of residuals of computed w.r.t. input observable values and partials of
- *  observables w.r.t. parameter vector (return by reference).
+ *  \param designMatrix Partials of observables w.r.t. parameter vector (return by reference).
+ *  \param residuals Residuals of computed w.r.t. input observable values (return by reference).
+ *  \param calculateResiduals Boolean denoting whether the residuals are to be computed
+ *  \param calculatePartials Boolean denoting whether the design matrix is to be computed
  */
 template< typename ObservationScalarType = double, typename TimeType = double,
     typename std::enable_if< is_state_scalar_and_time_type< ObservationScalarType, TimeType >::value, int >::type = 0 >
 void calculateDesignMatrixAndResiduals(
     std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationsCollection,
-    const std::map< observation_models::ObservableType,
-        std::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > >& observationManagers,
+    const std::vector< std::map< observation_models::ObservableType,
+        std::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > > >& threadObservationManagers,
     const int totalNumberParameters,
     const int totalObservationSize,
     Eigen::MatrixXd& designMatrix,
@@ -144,6 +201,11 @@ void calculateDesignMatrixAndResiduals(
         throw std::runtime_error( "Error when computing observation partials; number of parameters is 0 or smaller: " + std::to_string( totalNumberParameters ) );
     }
 
+    if( threadObservationManagers.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when computing observation partials; no observation managers provided" );
+    }
+
     // Initialize return data.
     if( calculatePartials )
     {
@@ -158,66 +220,439 @@ void calculateDesignMatrixAndResiduals(
     typename observation_models::ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets
         sortedObservations = observationsCollection->getObservationsSets( );
 
-    // Iterate over all observable types in observationsAndTimes
-    for( auto observableIt : sortedObservations )
+    // Retrieve all non-empty observation sets, with their start index and size in the concatenated observations
+    std::vector< std::tuple< observation_models::ObservableType, observation_models::LinkEnds,
+        std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >,
+        std::pair< int, int > > > observationSetsToCompute = getNonEmptyObservationSets( observationsCollection );
+
+    // Compute observations and partials, distributing the observation sets over the threads
+    unsigned int numberOfThreads = threadObservationManagers.size( );
+    utilities::parallelFor( numberOfThreads, [ & ]( const unsigned int threadIndex )
     {
-        observation_models::ObservableType currentObservableType = observableIt.first;
+        for( unsigned int i = threadIndex; i < observationSetsToCompute.size( ); i += numberOfThreads )
+        {
+            observation_models::ObservableType currentObservableType = std::get< 0 >( observationSetsToCompute.at( i ) );
+            const observation_models::LinkEnds& currentLinkEnds = std::get< 1 >( observationSetsToCompute.at( i ) );
+            std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > currentObservations =
+                std::get< 2 >( observationSetsToCompute.at( i ) );
+            std::pair< int, int > observationIndices = std::get< 3 >( observationSetsToCompute.at( i ) );
+
+            // Compute estimated observations and partials from current parameter estimate.
+            Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > observationsVector;
+            Eigen::MatrixXd partialsMatrix;
+            threadObservationManagers.at( threadIndex ).at( currentObservableType )->
+                    computeObservationsWithPartials(
+                    currentObservations->getObservationTimes( ),
+                    currentLinkEnds,
+                    currentObservations->getReferenceLinkEnd( ),
+                    currentObservations->getAncilliarySettings( ),
+                    observationsVector,
+                    partialsMatrix,
+                    calculateResiduals,
+                    calculatePartials );
 
-        // Iterate over all link ends for current observable type in observationsAndTimes
-        for( auto linkEndIt : observableIt.second )
+            // Set current observation partials in matrix of all partials
+            if( calculatePartials )
+            {
+                designMatrix.block( observationIndices.first, 0, observationIndices.second,
+                                    totalNumberParameters ) = partialsMatrix;
+            }
+
+            // Compute residuals for current link ends and observable type.
+            if( calculateResiduals )
+            {
+                residuals.block( observationIndices.first, 0, observationIndices.second, 1 ) =
+                    currentObservations->getObservationsVector( ) - observationsVector;
+            }
+        }
+    }, numberOfThreads );
+
+    if( calculateResiduals )
+    {
+        for( auto observableIt : sortedObservations )
         {
-            observation_models::LinkEnds currentLinkEnds = linkEndIt.first;
-            for( unsigned int i = 0; i < linkEndIt.second.size( ); i++ )
+            std::pair< int, int > observableStartAndSize = observationsCollection->getObservationTypeStartAndSize( ).at( observableIt.first );
+            checkObservationResidualDiscontinuities< ObservationScalarType >( residuals, observableStartAndSize, observableIt.first );
+        }
+    }
+}
+
+//! Function to calculate the observation partials matrix and residuals
+/*!
+ *  This function calculates the observation partials matrix and residuals, based on the state transition matrix,
+ *  sensitivity matrix and body states resulting from the previous numerical integration iteration.
+ *  Partials and observations are calculated by the observationManagers_.
+ *  \param observationsAndTimes Observable values and associated time tags, per observable type and set of link ends.
+ *  \param parameterVectorSize Length of the vector of estimated parameters
+ *  \param totalObservationSize Total number of observations in observationsAndTimes map.
+ *  \param residualsAndPartials Pair of residuals of computed w.r.t. input observable values and partials of
+ *  observables w.r.t. parameter vector (return by reference).
+ */
+template< typename ObservationScalarType = double, typename TimeType = double,
+    typename std::enable_if< is_state_scalar_and_time_type< ObservationScalarType, TimeType >::value, int >::type = 0 >
+void calculateDesignMatrixAndResiduals(
+    std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationsCollection,
+    const std::map< observation_models::ObservableType,
+        std::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > >& observationManagers,
+    const int totalNumberParameters,
+    const int totalObservationSize,
+    Eigen::MatrixXd& designMatrix,
+    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >& residuals,
+    const bool calculateResiduals = true,
+    const bool calculatePartials = true )
+{
+    calculateDesignMatrixAndResiduals< ObservationScalarType, TimeType >(
+        observationsCollection,
+        std::vector< std::map< observation_models::ObservableType,
+            std::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > > >(
+            { observationManagers } ),
+        totalNumberParameters, totalObservationSize, designMatrix, residuals, calculateResiduals, calculatePartials );
+}
+
+//! Function to calculate the normal equations and residuals, without storing the full observation partials matrix
+/*!
+ *  This function calculates the normal matrix H^T W H and its right-hand side H^T W y, with H the observation partials
+ *  matrix, W the (diagonal) weights matrix and y the residuals, as well as the residuals themselves. The observation
+ *  sets are distributed over the threads in the same manner as in calculateDesignMatrixAndResiduals, but the partials
+ *  of each set are only used to update the normal equations of its thread, after which they are discarded. The memory
+ *  use is therefore independent of the number of observations (apart from the residuals). The normal equations of
+ *  the threads are summed in a fixed order, so that the results only depend (at round-off level) on the number of
+ *  threads.
+ *
+ *  The partials of each observation set are typically only non-zero for a small subset of the parameters (e.g. the
+ *  parameters of the ground stations, link ends and arcs involved). The blocks of columns that may be non-zero are
+ *  retrieved from the parameter indices of the observation partials (see
+ *  ObservationManagerBase::getPartialsColumnBlocks), and reduced to those that are actually non-zero, after which only
+ *  the products of these blocks are added to the normal equations. If requested, the non-zero blocks are also stored
+ *  in a block-sparse design matrix.
+ *
+ *  To allow the columns of the partials to be normalized in the same manner as normalizeDesignMatrix, the value with
+ *  the largest absolute value in each column of the partials matrix is returned as well.
+ *  \param observationsCollection Observable values and associated time tags, per observable type and set of link ends.
+ *  \param threadObservationManagers Observation managers for each thread (one thread per entry)
+ *  \param totalNumberParameters Length of the vector of estimated parameters
+ *  \param totalObservationSize Total number of observations in observationsAndTimes map.
+ *  \param weightsMatrixDiagonals Diagonal of the weights matrix of all observations
+ *  \param normalMatrix Normal matrix H^T W H (return by reference).
+ *  \param normalRightHandSide Right-hand side of normal equations H^T W y (return by reference).
+ *  \param partialsColumnExtrema Entry of each column of H with the largest absolute value, or 0 if the column is
+ *  zero (return by reference).
+ *  \param residuals Residuals of computed w.r.t. input observable values (return by reference).
+ *  \param designMatrix Block-sparse design matrix that is reset to contain the non-zero blocks of the partials (if not
+ *  nullptr).
+ */
+template< typename ObservationScalarType = double, typename TimeType = double,
+    typename std::enable_if< is_state_scalar_and_time_type< ObservationScalarType, TimeType >::value, int >::type = 0 >
+void calculateNormalEquationsAndResiduals(
+    std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationsCollection,
+    const std::vector< std::map< observation_models::ObservableType,
+        std::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > > >& threadObservationManagers,
+    const int totalNumberParameters,
+    const int totalObservationSize,
+    const Eigen::VectorXd& weightsMatrixDiagonals,
+    Eigen::MatrixXd& normalMatrix,
+    Eigen::VectorXd& normalRightHandSide,
+    Eigen::VectorXd& partialsColumnExtrema,
+    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >& residuals,
+    const std::shared_ptr< linear_algebra::BlockSparseDesignMatrix > designMatrix = nullptr )
+{
+    if( totalNumberParameters <= 0 )
+    {
+        throw std::runtime_error( "Error when computing normal equations; number of parameters is 0 or smaller: " + std::to_string( totalNumberParameters ) );
+    }
+
+    if( threadObservationManagers.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when computing normal equations; no observation managers provided" );
+    }
+
+    if( weightsMatrixDiagonals.rows( ) != totalObservationSize )
+    {
+        throw std::runtime_error( "Error when computing normal equations; size of weights diagonal is not compatible with number of observations" );
+    }
+
+    residuals = Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >::Zero( totalObservationSize, 1 );
+
+    std::vector< std::tuple< observation_models::ObservableType, observation_models::LinkEnds,
+        std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >,
+        std::pair< int, int > > > observationSetsToCompute = getNonEmptyObservationSets( observationsCollection );
+
+    // Accumulate normal equations, and extrema of partials, separately for each thread
+    unsigned int numberOfThreads = threadObservationManagers.size( );
+    std::vector< Eigen::MatrixXd > threadNormalMatrices(
+        numberOfThreads, Eigen::MatrixXd::Zero( totalNumberParameters, totalNumberParameters ) );
+    std::vector< Eigen::VectorXd > threadNormalRightHandSides(
+        numberOfThreads, Eigen::VectorXd::Zero( totalNumberParameters ) );
+    std::vector< Eigen::VectorXd > threadColumnMinima( numberOfThreads, Eigen::VectorXd::Zero( totalNumberParameters ) );
+    std::vector< Eigen::VectorXd > threadColumnMaxima( numberOfThreads, Eigen::VectorXd::Zero( totalNumberParameters ) );
+    std::vector< linear_algebra::BlockSparseDesignMatrix > threadDesignMatrices(
+        ( designMatrix != nullptr ) ? numberOfThreads : 0,
+        linear_algebra::BlockSparseDesignMatrix( totalObservationSize, totalNumberParameters ) );
+    utilities::parallelFor( numberOfThreads, [ & ]( const unsigned int threadIndex )
+    {
+        for( unsigned int i = threadIndex; i < observationSetsToCompute.size( ); i += numberOfThreads )
+        {
+            observation_models::ObservableType currentObservableType = std::get< 0 >( observationSetsToCompute.at( i ) );
+            const observation_models::LinkEnds& currentLinkEnds = std::get< 1 >( observationSetsToCompute.at( i ) );
+            std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > currentObservations =
+                std::get< 2 >( observationSetsToCompute.at( i ) );
+            std::pair< int, int > observationIndices = std::get< 3 >( observationSetsToCompute.at( i ) );
+
+            Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > observationsVector;
+            Eigen::MatrixXd partialsMatrix;
+            threadObservationManagers.at( threadIndex ).at( currentObservableType )->
+                    computeObservationsWithPartials(
+                    currentObservations->getObservationTimes( ),
+                    currentLinkEnds,
+                    currentObservations->getReferenceLinkEnd( ),
+                    currentObservations->getAncilliarySettings( ),
+                    observationsVector,
+                    partialsMatrix,
+                    true, true );
+
+            residuals.block( observationIndices.first, 0, observationIndices.second, 1 ) =
+                currentObservations->getObservationsVector( ) - observationsVector;
+
+            // Retrieve blocks of columns of the partials that are non-zero, and add only these to the normal equations
+            std::vector< std::pair< int, int > > columnBlocks = linear_algebra::getNonZeroColumnBlocks(
+                partialsMatrix, threadObservationManagers.at( threadIndex ).at( currentObservableType )->
+                    getPartialsColumnBlocks( currentLinkEnds ) );
+            linear_algebra::addObservationsToNormalEquations(
+                partialsMatrix, columnBlocks,
+                residuals.segment( observationIndices.first, observationIndices.second ).template cast< double >( ),
+                weightsMatrixDiagonals.segment( observationIndices.first, observationIndices.second ),
+                threadNormalMatrices.at( threadIndex ), threadNormalRightHandSides.at( threadIndex ) );
+            for( unsigned int j = 0; j < columnBlocks.size( ); j++ )
             {
-                std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > currentObservations = linkEndIt.second.at( i );
-                std::pair< int, int > observationIndices = observationsCollection->getObservationSetStartAndSize( ).at(
-                    currentObservableType ).at( currentLinkEnds ).at( i );
+                threadColumnMinima.at( threadIndex ).segment( columnBlocks.at( j ).first, columnBlocks.at( j ).second ) =
+                    threadColumnMinima.at( threadIndex ).segment( columnBlocks.at( j ).first, columnBlocks.at( j ).second ).cwiseMin(
+                        partialsMatrix.middleCols( columnBlocks.at( j ).first, columnBlocks.at( j ).second ).colwise( ).minCoeff( ).transpose( ) );
+                threadColumnMaxima.at( threadIndex ).segment( columnBlocks.at( j ).first, columnBlocks.at( j ).second ) =
+                    threadColumnMaxima.at( threadIndex ).segment( columnBlocks.at( j ).first, columnBlocks.at( j ).second ).cwiseMax(
+                        partialsMatrix.middleCols( columnBlocks.at( j ).first, columnBlocks.at( j ).second ).colwise( ).maxCoeff( ).transpose( ) );
+            }
 
-//                std::cout<<"Current size "<<currentObservations->getObservationTimes( ).size( )<<
-//                " "<<currentObservations->getObservations( ).size( )<<" "<<observationIndices.first<<" "<<observationIndices.second<<std::endl;
-                if( observationIndices.second > 0 )
-                {
-                    // Compute estimated ranges and range partials from current parameter estimate.
-                    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > observationsVector;
-                    Eigen::MatrixXd partialsMatrix;
-                    observationManagers.at( currentObservableType )->
-                            computeObservationsWithPartials(
-                            currentObservations->getObservationTimes( ),
-                            currentLinkEnds,
-                            currentObservations->getReferenceLinkEnd( ),
-                            currentObservations->getAncilliarySettings( ),
-                            observationsVector,
-                            partialsMatrix,
-                            calculateResiduals,
-                            calculatePartials );
-
-                    if( calculatePartials )
-                    {
-//                        std::cout<<designMatrix.rows( )<<" "<<designMatrix.cols( )<<std::endl;
-//                        std::cout<<observationIndices.first<<" "<<0<<" "<<observationIndices.second<<" "<<totalNumberParameters<<std::endl;
-//                        std::cout<<partialsMatrix.rows( )<<" "<<partialsMatrix.cols( )<<std::endl<<std::endl;
+            if( designMatrix != nullptr && columnBlocks.size( ) > 0 )
+            {
+                threadDesignMatrices.at( threadIndex ).addRowBlock( observationIndices.first, partialsMatrix, columnBlocks );
+            }
+        }
+    }, numberOfThreads );
 
-                        // Set current observation partials in matrix of all partials
-                        designMatrix.block( observationIndices.first, 0, observationIndices.second,
-                                            totalNumberParameters ) = partialsMatrix;
-                    }
+    if( designMatrix != nullptr )
+    {
+        *designMatrix = linear_algebra::BlockSparseDesignMatrix( totalObservationSize, totalNumberParameters );
+        for( unsigned int i = 0; i < numberOfThreads; i++ )
+        {
+            designMatrix->addRowBlocks( threadDesignMatrices.at( i ) );
+        }
+    }
 
-                    // Compute residuals for current link ends and observable type.
-                    if( calculateResiduals )
-                    {
-                        Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > residualsVector =
-                                currentObservations->getObservationsVector( ) - observationsVector;
-                        residuals.block( observationIndices.first, 0, observationIndices.second, 1 ) = ( residualsVector );
-                    }
-                }
+    normalMatrix = threadNormalMatrices.at( 0 );
+    normalRightHandSide = threadNormalRightHandSides.at( 0 );
+    Eigen::VectorXd columnMinima = threadColumnMinima.at( 0 );
+    Eigen::VectorXd columnMaxima = threadColumnMaxima.at( 0 );
+    for( unsigned int i = 1; i < numberOfThreads; i++ )
+    {
+        normalMatrix += threadNormalMatrices.at( i );
+        normalRightHandSide += threadNormalRightHandSides.at( i );
+        columnMinima = columnMinima.cwiseMin( threadColumnMinima.at( i ) );
+        columnMaxima = columnMaxima.cwiseMax( threadColumnMaxima.at( i ) );
+    }
+
+    partialsColumnExtrema = Eigen::VectorXd( totalNumberParameters );
+    for( int i = 0; i < totalNumberParameters; i++ )
+    {
+        partialsColumnExtrema( i ) = ( std::fabs( columnMinima( i ) ) > columnMaxima( i ) ) ? columnMinima( i ) : columnMaxima( i );
+    }
+
+    // Check residual discontinuities. For the (rare) residuals that are modified by this check, the partials of
+    // their observation set are recomputed, to correct the right-hand side of the normal equations
+    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > uncorrectedResiduals = residuals;
+    for( auto observableIt : observationsCollection->getObservationsSets( ) )
+    {
+        std::pair< int, int > observableStartAndSize = observationsCollection->getObservationTypeStartAndSize( ).at( observableIt.first );
+        checkObservationResidualDiscontinuities< ObservationScalarType >( residuals, observableStartAndSize, observableIt.first );
+    }
+
+    if( residuals != uncorrectedResiduals )
+    {
+        for( unsigned int i = 0; i < observationSetsToCompute.size( ); i++ )
+        {
+            std::pair< int, int > observationIndices = std::get< 3 >( observationSetsToCompute.at( i ) );
+            Eigen::VectorXd residualCorrections =
+                ( residuals.segment( observationIndices.first, observationIndices.second ) -
+                  uncorrectedResiduals.segment( observationIndices.first, observationIndices.second ) ).template cast< double >( );
+            if( !residualCorrections.isZero( 0.0 ) )
+            {
+                std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > currentObservations =
+                    std::get< 2 >( observationSetsToCompute.at( i ) );
+                Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > observationsVector;
+                Eigen::MatrixXd partialsMatrix;
+                threadObservationManagers.at( 0 ).at( std::get< 0 >( observationSetsToCompute.at( i ) ) )->
+                        computeObservationsWithPartials(
+                        currentObservations->getObservationTimes( ),
+                        std::get< 1 >( observationSetsToCompute.at( i ) ),
+                        currentObservations->getReferenceLinkEnd( ),
+                        currentObservations->getAncilliarySettings( ),
+                        observationsVector,
+                        partialsMatrix,
+                        false, true );
+                normalRightHandSide += partialsMatrix.transpose( ) * weightsMatrixDiagonals.segment(
+                    observationIndices.first, observationIndices.second ).cwiseProduct( residualCorrections );
+            }
+        }
+    }
+}
+
+//! Function to calculate the square-root information of the observations and the residuals, without storing the full
+//! observation partials matrix
+/*!
+ *  This function calculates the square-root information matrix R and vector z (see
+ *  linear_algebra::SquareRootInformationFilter) of all observations, such that R^T R = H^T W H and R^T z = H^T W y,
+ *  with H the observation partials matrix, W the (diagonal) weights matrix and y the residuals, as well as the residuals
+ *  themselves. The observation sets are distributed over the threads in the same manner as in
+ *  calculateNormalEquationsAndResiduals, and each thread adds its observation sets to its own filter, after which the
+ *  filters of the threads are combined in a fixed order. Since the residuals of observable types for which
+ *  checkObservationResidualDiscontinuities is used may be modified after they are computed, the partials of these
+ *  observation sets are stored until the check has been performed, and are only then added to the filters.
+ *
+ *  To allow the columns of the partials to be normalized in the same manner as normalizeDesignMatrix, the value with
+ *  the largest absolute value in each column of the partials matrix is returned as well.
+ *  \param observationsCollection Observable values and associated time tags, per observable type and set of link ends.
+ *  \param threadObservationManagers Observation managers for each thread (one thread per entry)
+ *  \param totalNumberParameters Length of the vector of estimated parameters
+ *  \param totalObservationSize Total number of observations in observationsAndTimes map.
+ *  \param weightsMatrixDiagonals Diagonal of the weights matrix of all observations
+ *  \param squareRootInformationFilter Filter containing the (unnormalized) square-root information of all observations
+ *  (return by reference).
+ *  \param partialsColumnExtrema Entry of each column of H with the largest absolute value, or 0 if the column is
+ *  zero (return by reference).
+ *  \param residuals Residuals of computed w.r.t. input observable values (return by reference).
+ */
+template< typename ObservationScalarType = double, typename TimeType = double,
+    typename std::enable_if< is_state_scalar_and_time_type< ObservationScalarType, TimeType >::value, int >::type = 0 >
+void calculateSquareRootInformationAndResiduals(
+    std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > observationsCollection,
+    const std::vector< std::map< observation_models::ObservableType,
+        std::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > > >& threadObservationManagers,
+    const int totalNumberParameters,
+    const int totalObservationSize,
+    const Eigen::VectorXd& weightsMatrixDiagonals,
+    std::shared_ptr< linear_algebra::SquareRootInformationFilter >& squareRootInformationFilter,
+    Eigen::VectorXd& partialsColumnExtrema,
+    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >& residuals )
+{
+    if( totalNumberParameters <= 0 )
+    {
+        throw std::runtime_error( "Error when computing square-root information; number of parameters is 0 or smaller: " + std::to_string( totalNumberParameters ) );
+    }
+
+    if( threadObservationManagers.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when computing square-root information; no observation managers provided" );
+    }
+
+    if( weightsMatrixDiagonals.rows( ) != totalObservationSize )
+    {
+        throw std::runtime_error( "Error when computing square-root information; size of weights diagonal is not compatible with number of observations" );
+    }
+
+    residuals = Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >::Zero( totalObservationSize, 1 );
+
+    std::vector< std::tuple< observation_models::ObservableType, observation_models::LinkEnds,
+        std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >,
+        std::pair< int, int > > > observationSetsToCompute = getNonEmptyObservationSets( observationsCollection );
+
+    // Add observation sets to filter of each thread, storing the partials of sets of which the residuals are to be checked
+    unsigned int numberOfThreads = threadObservationManagers.size( );
+    std::vector< linear_algebra::SquareRootInformationFilter > threadFilters(
+        numberOfThreads, linear_algebra::SquareRootInformationFilter( totalNumberParameters ) );
+    std::vector< Eigen::VectorXd > threadColumnMinima( numberOfThreads, Eigen::VectorXd::Zero( totalNumberParameters ) );
+    std::vector< Eigen::VectorXd > threadColumnMaxima( numberOfThreads, Eigen::VectorXd::Zero( totalNumberParameters ) );
+    std::vector< Eigen::MatrixXd > partialsToAddAfterCheck( observationSetsToCompute.size( ) );
+    utilities::parallelFor( numberOfThreads, [ & ]( const unsigned int threadIndex )
+    {
+        for( unsigned int i = threadIndex; i < observationSetsToCompute.size( ); i += numberOfThreads )
+        {
+            observation_models::ObservableType currentObservableType = std::get< 0 >( observationSetsToCompute.at( i ) );
+            const observation_models::LinkEnds& currentLinkEnds = std::get< 1 >( observationSetsToCompute.at( i ) );
+            std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > currentObservations =
+                std::get< 2 >( observationSetsToCompute.at( i ) );
+            std::pair< int, int > observationIndices = std::get< 3 >( observationSetsToCompute.at( i ) );
+
+            Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > observationsVector;
+            Eigen::MatrixXd partialsMatrix;
+            threadObservationManagers.at( threadIndex ).at( currentObservableType )->
+                    computeObservationsWithPartials(
+                    currentObservations->getObservationTimes( ),
+                    currentLinkEnds,
+                    currentObservations->getReferenceLinkEnd( ),
+                    currentObservations->getAncilliarySettings( ),
+                    observationsVector,
+                    partialsMatrix,
+                    true, true );
+
+            residuals.block( observationIndices.first, 0, observationIndices.second, 1 ) =
+                currentObservations->getObservationsVector( ) - observationsVector;
+
+            threadColumnMinima.at( threadIndex ) = threadColumnMinima.at( threadIndex ).cwiseMin(
+                partialsMatrix.colwise( ).minCoeff( ).transpose( ) );
+            threadColumnMaxima.at( threadIndex ) = threadColumnMaxima.at( threadIndex ).cwiseMax(
+                partialsMatrix.colwise( ).maxCoeff( ).transpose( ) );
+
+            if( areObservationResidualDiscontinuitiesChecked( currentObservableType ) )
+            {
+                partialsToAddAfterCheck.at( i ) = std::move( partialsMatrix );
+            }
+            else
+            {
+                threadFilters.at( threadIndex ).addObservations(
+                    partialsMatrix,
+                    residuals.segment( observationIndices.first, observationIndices.second ).template cast< double >( ),
+                    weightsMatrixDiagonals.segment( observationIndices.first, observationIndices.second ) );
             }
         }
+    }, numberOfThreads );
 
-        if( calculateResiduals )
+    // Check residual discontinuities, and add the observation sets with checked residuals to the filters
+    for( auto observableIt : observationsCollection->getObservationsSets( ) )
+    {
+        std::pair< int, int > observableStartAndSize = observationsCollection->getObservationTypeStartAndSize( ).at( observableIt.first );
+        checkObservationResidualDiscontinuities< ObservationScalarType >( residuals, observableStartAndSize, observableIt.first );
+    }
+
+    utilities::parallelFor( numberOfThreads, [ & ]( const unsigned int threadIndex )
+    {
+        for( unsigned int i = threadIndex; i < observationSetsToCompute.size( ); i += numberOfThreads )
         {
-            std::pair< int, int > observableStartAndSize = observationsCollection->getObservationTypeStartAndSize( ).at( currentObservableType );
-            checkObservationResidualDiscontinuities< ObservationScalarType >( residuals, observableStartAndSize, currentObservableType );
+            if( areObservationResidualDiscontinuitiesChecked( std::get< 0 >( observationSetsToCompute.at( i ) ) ) )
+            {
+                std::pair< int, int > observationIndices = std::get< 3 >( observationSetsToCompute.at( i ) );
+                threadFilters.at( threadIndex ).addObservations(
+                    partialsToAddAfterCheck.at( i ),
+                    residuals.segment( observationIndices.first, observationIndices.second ).template cast< double >( ),
+                    weightsMatrixDiagonals.segment( observationIndices.first, observationIndices.second ) );
+                partialsToAddAfterCheck.at( i ) = Eigen::MatrixXd( );
+            }
         }
+    }, numberOfThreads );
+
+    // Combine filters and extrema of threads
+    squareRootInformationFilter = std::make_shared< linear_algebra::SquareRootInformationFilter >( threadFilters.at( 0 ) );
+    Eigen::VectorXd columnMinima = threadColumnMinima.at( 0 );
+    Eigen::VectorXd columnMaxima = threadColumnMaxima.at( 0 );
+    for( unsigned int i = 1; i < numberOfThreads; i++ )
+    {
+        squareRootInformationFilter->addSquareRootInformation( threadFilters.at( i ) );
+        columnMinima = columnMinima.cwiseMin( threadColumnMinima.at( i ) );
+        columnMaxima = columnMaxima.cwiseMax( threadColumnMaxima.at( i ) );
+    }
+
+    partialsColumnExtrema = Eigen::VectorXd( totalNumberParameters );
+    for( int i = 0; i < totalNumberParameters; i++ )
+    {
+        partialsColumnExtrema( i ) = ( std::fabs( columnMinima( i ) ) > columnMaxima( i ) ) ? columnMinima( i ) : columnMaxima( i );
     }
 }
 
@@ -327,7 +762,8 @@ public:
             const std::vector< std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > > integratorSettings,
             const std::shared_ptr< propagators::PropagatorSettings< ObservationScalarType > > propagatorSettings,
             const bool propagateOnCreation = true ):
-        parametersToEstimate_( parametersToEstimate )
+        parametersToEstimate_( parametersToEstimate ),
+        bodies_( bodies )
     {
 
         std::vector< std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > > processedIntegratorSettings =
@@ -627,9 +1063,19 @@ public:
             fullParameterEstimate.segment( numberEstimatedParameters_, numberConsiderParameters_ ) = considerParametersValues_;
         }
 
-        // Compute design matrices (estimated and consider), and residuals (empty for covariance analysis)
+        // Compute covariance from normal equations, if the design matrix is not to be stored
         bool exceptionDuringPropagation = false;
         std::shared_ptr< propagators::SimulationResults< ObservationScalarType, TimeType > > simulationResults;
+        if( estimationInput->getUseSquareRootInformationFilter( ) )
+        {
+            return computeCovarianceFromSquareRootInformation( estimationInput, fullParameterEstimate );
+        }
+        else if( estimationInput->getUseNormalEquations( ) )
+        {
+            return computeCovarianceFromNormalEquations( estimationInput, fullParameterEstimate );
+        }
+
+        // Compute design matrices (estimated and consider), and residuals (empty for covariance analysis)
         std::pair< std::pair< Eigen::MatrixXd, Eigen::MatrixXd >, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > designMatricesAndResiduals =
                 performPreEstimationSteps( estimationInput, fullParameterEstimate, false, 0, exceptionDuringPropagation, simulationResults );
         Eigen::MatrixXd designMatrixEstimatedParameters = designMatricesAndResiduals.first.first;
@@ -697,6 +1143,118 @@ public:
         return estimationOutput;
     }
 
+    //! Function to compute the consider parameter contribution to the (normalized) covariance from the normal equations
+    /*!
+     * Function to compute the consider parameter contribution to the (normalized) covariance from the normal equations,
+     * equivalent to linear_algebra::calculateConsiderParametersCovarianceContribution
+     * \param normalizedCovarianceMatrix Normalized covariance matrix of estimated parameters
+     * \param considerNormalMatrix Normalized product H^T W H_c of partials w.r.t. estimated and consider parameters
+     * \param normalizedConsiderCovariance Normalized covariance of consider parameters
+     * \return Contribution of consider parameters to normalized covariance matrix
+     */
+    Eigen::MatrixXd calculateConsiderParametersCovarianceContributionFromNormalEquations(
+            const Eigen::MatrixXd& normalizedCovarianceMatrix,
+            const Eigen::MatrixXd& considerNormalMatrix,
+            const Eigen::MatrixXd& normalizedConsiderCovariance )
+    {
+        Eigen::MatrixXd covarianceTimesConsiderNormalMatrix = normalizedCovarianceMatrix * considerNormalMatrix;
+        return covarianceTimesConsiderNormalMatrix * normalizedConsiderCovariance * covarianceTimesConsiderNormalMatrix.transpose( );
+    }
+
+    //! Function to perform a covariance analysis from the normal equations, without storing the design matrix
+    std::shared_ptr< CovarianceAnalysisOutput< ObservationScalarType, TimeType > > computeCovarianceFromNormalEquations(
+            const std::shared_ptr< CovarianceAnalysisInput< ObservationScalarType, TimeType > > estimationInput,
+            ParameterVectorType& fullParameterEstimate )
+    {
+        bool exceptionDuringPropagation = false;
+        std::shared_ptr< propagators::SimulationResults< ObservationScalarType, TimeType > > simulationResults;
+        Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > residuals;
+        Eigen::MatrixXd normalMatrix, considerNormalMatrix;
+        Eigen::VectorXd normalRightHandSide, normalizationTerms, considerNormalizationTerms;
+        std::shared_ptr< linear_algebra::BlockSparseDesignMatrix > normalizedDesignMatrix;
+        performPreEstimationStepsFromNormalEquations(
+                    estimationInput, fullParameterEstimate, 0, exceptionDuringPropagation, simulationResults,
+                    normalMatrix, normalRightHandSide, considerNormalMatrix, normalizationTerms, considerNormalizationTerms,
+                    residuals, normalizedDesignMatrix );
+
+        // Retrieve constraints
+        Eigen::MatrixXd constraintStateMultiplier;
+        Eigen::VectorXd constraintRightHandSide;
+        parametersToEstimate_->getConstraints( constraintStateMultiplier, constraintRightHandSide );
+
+        // Compute inverse of updated covariance
+        Eigen::MatrixXd inverseNormalizedCovariance = normalizeAprioriCovariance(
+                estimationInput->getInverseOfAprioriCovariance( numberEstimatedParameters_ ), normalizationTerms ) + normalMatrix;
+        linear_algebra::addConstraintsToInverseCovarianceMatrix(
+                    inverseNormalizedCovariance, constraintStateMultiplier, constraintRightHandSide );
+
+        // Compute contribution consider parameters
+        Eigen::MatrixXd covarianceContributionConsiderParameters = Eigen::MatrixXd::Zero( 0, 0 );
+        if ( considerParametersIncluded_ )
+        {
+            covarianceContributionConsiderParameters = calculateConsiderParametersCovarianceContributionFromNormalEquations(
+                        inverseNormalizedCovariance.inverse( ), considerNormalMatrix,
+                        normalizeCovariance( estimationInput->getConsiderCovariance( ), considerNormalizationTerms ) );
+        }
+        else
+        {
+            considerNormalizationTerms = Eigen::VectorXd::Zero( 0 );
+        }
+
+        std::shared_ptr< CovarianceAnalysisOutput< ObservationScalarType, TimeType > > covarianceOutput =
+                std::make_shared< CovarianceAnalysisOutput< ObservationScalarType, TimeType > >(
+                    Eigen::MatrixXd::Zero( 0, 0 ), estimationInput->getWeightsMatrixDiagonals( ), normalizationTerms,
+                    inverseNormalizedCovariance, Eigen::MatrixXd::Zero( 0, 0 ), considerNormalizationTerms,
+                    covarianceContributionConsiderParameters, exceptionDuringPropagation );
+        covarianceOutput->setNormalizedBlockSparseDesignMatrix( normalizedDesignMatrix );
+        return covarianceOutput;
+    }
+
+    //! Function to perform a covariance analysis from the square-root information, without storing the design matrix
+    std::shared_ptr< CovarianceAnalysisOutput< ObservationScalarType, TimeType > > computeCovarianceFromSquareRootInformation(
+            const std::shared_ptr< CovarianceAnalysisInput< ObservationScalarType, TimeType > > estimationInput,
+            ParameterVectorType& fullParameterEstimate )
+    {
+        bool exceptionDuringPropagation = false;
+        std::shared_ptr< propagators::SimulationResults< ObservationScalarType, TimeType > > simulationResults;
+        Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > residuals;
+        std::shared_ptr< linear_algebra::SquareRootInformationFilter > squareRootInformationFilter;
+        Eigen::VectorXd normalizationTerms, considerNormalizationTerms;
+        performPreEstimationStepsWithSquareRootInformationFilter(
+                    estimationInput, fullParameterEstimate, 0, exceptionDuringPropagation, simulationResults,
+                    squareRootInformationFilter, normalizationTerms, considerNormalizationTerms, residuals );
+
+        // Retrieve constraints
+        Eigen::MatrixXd constraintStateMultiplier;
+        Eigen::VectorXd constraintRightHandSide;
+        parametersToEstimate_->getConstraints( constraintStateMultiplier, constraintRightHandSide );
+
+        // Compute inverse of updated covariance
+        Eigen::MatrixXd estimatedSquareRootInformationMatrix = squareRootInformationFilter->getSquareRootInformationMatrix( ).block(
+                    0, 0, numberEstimatedParameters_, numberEstimatedParameters_ );
+        Eigen::MatrixXd inverseNormalizedCovariance =
+                estimatedSquareRootInformationMatrix.transpose( ) * estimatedSquareRootInformationMatrix;
+        linear_algebra::addConstraintsToInverseCovarianceMatrix(
+                    inverseNormalizedCovariance, constraintStateMultiplier, constraintRightHandSide );
+
+        // Compute contribution consider parameters
+        Eigen::MatrixXd covarianceContributionConsiderParameters = Eigen::MatrixXd::Zero( 0, 0 );
+        if ( considerParametersIncluded_ )
+        {
+            Eigen::MatrixXd considerNormalMatrix = estimatedSquareRootInformationMatrix.transpose( ) *
+                    squareRootInformationFilter->getSquareRootInformationMatrix( ).block(
+                        0, numberEstimatedParameters_, numberEstimatedParameters_, numberConsiderParameters_ );
+            covarianceContributionConsiderParameters = calculateConsiderParametersCovarianceContributionFromNormalEquations(
+                        inverseNormalizedCovariance.inverse( ), considerNormalMatrix,
+                        normalizeCovariance( estimationInput->getConsiderCovariance( ), considerNormalizationTerms ) );
+        }
+
+        return std::make_shared< CovarianceAnalysisOutput< ObservationScalarType, TimeType > >(
+                    Eigen::MatrixXd::Zero( 0, 0 ), estimationInput->getWeightsMatrixDiagonals( ), normalizationTerms,
+                    inverseNormalizedCovariance, Eigen::MatrixXd::Zero( 0, 0 ), considerNormalizationTerms,
+                    covarianceContributionConsiderParameters, exceptionDuringPropagation );
+    }
+
     //! Function to perform parameter estimation from measurement data.
     /*!
      *  Function to perform parameter estimation, including orbit determination, i.e. body initial states, from measurement data.
@@ -722,14 +1280,23 @@ public:
                 std::to_string( estimationInput->getWeightsMatrixDiagonals( ).rows( ) ) + ") is not compatible with number of observations (" +
                 std::to_string( totalNumberOfObservations ) + ")" );
         }
+        // Check whether the estimation is to be performed from the normal equations or square-root information, without
+        // storing the design matrix
+        bool useSquareRootInformationFilter = estimationInput->getUseSquareRootInformationFilter( );
+        bool useNormalEquations = estimationInput->getUseNormalEquations( ) && !useSquareRootInformationFilter;
+        bool useDesignMatrix = !( useNormalEquations || useSquareRootInformationFilter );
+        int designMatrixRows = useDesignMatrix ? totalNumberOfObservations : 0;
+
         // Declare variables to be returned (i.e. results from best iteration)
         double bestResidual = TUDAT_NAN;
         ParameterVectorType bestParameterEstimate = ParameterVectorType::Constant( numberEstimatedParameters_, TUDAT_NAN );
         Eigen::VectorXd bestTransformationData = Eigen::VectorXd::Constant( numberEstimatedParameters_, TUDAT_NAN );
         Eigen::VectorXd bestResiduals = Eigen::VectorXd::Constant( totalNumberOfObservations, TUDAT_NAN );
-        Eigen::MatrixXd bestDesignMatrixEstimatedParameters = Eigen::MatrixXd::Constant( totalNumberOfObservations, totalNumberParameters_, TUDAT_NAN );
+        Eigen::MatrixXd bestDesignMatrixEstimatedParameters = Eigen::MatrixXd::Constant(
+                    designMatrixRows, useDesignMatrix ? totalNumberParameters_ : 0, TUDAT_NAN );
         Eigen::VectorXd bestWeightsMatrixDiagonal = Eigen::VectorXd::Constant( totalNumberOfObservations, TUDAT_NAN );
         Eigen::MatrixXd bestInverseNormalizedCovarianceMatrix = Eigen::MatrixXd::Constant( numberEstimatedParameters_, numberEstimatedParameters_, TUDAT_NAN );
+        std::shared_ptr< linear_algebra::BlockSparseDesignMatrix > bestBlockSparseDesignMatrix;
 
 
         Eigen::VectorXd bestConsiderTransformationData;
@@ -737,7 +1304,7 @@ public:
         if ( considerParametersIncluded_ )
         {
             bestConsiderTransformationData = Eigen::VectorXd::Constant( numberConsiderParameters_, TUDAT_NAN );
-            bestDesignMatrixConsiderParameters = Eigen::MatrixXd::Constant( totalNumberOfObservations, numberConsiderParameters_, TUDAT_NAN );
+            bestDesignMatrixConsiderParameters = Eigen::MatrixXd::Constant( designMatrixRows, useDesignMatrix ? numberConsiderParameters_ : 0, TUDAT_NAN );
             bestConsiderCovarianceContribution = Eigen::MatrixXd::Constant( numberEstimatedParameters_, numberEstimatedParameters_, TUDAT_NAN );
         }
         else
@@ -763,6 +1330,14 @@ public:
 
         bool exceptionDuringPropagation = false, exceptionDuringInversion = false;
 
+        // Declare variables to store the (normalized) partials once they are frozen
+        bool freezePartials = estimationInput->arePartialsFreezingSettingsDefined( );
+        bool arePartialsFrozen = false;
+        Eigen::MatrixXd frozenDesignMatrixEstimatedParameters, frozenDesignMatrixConsiderParameters;
+        Eigen::MatrixXd frozenNormalMatrix, frozenConsiderNormalMatrix;
+        Eigen::VectorXd frozenNormalizationTerms, frozenNormalizationTermsConsider;
+        std::shared_ptr< linear_algebra::BlockSparseDesignMatrix > frozenBlockSparseDesignMatrix;
+
         // Iterate until convergence (at least once)
         int bestIteration = -1;
         int numberOfIterations = 0;
@@ -775,20 +1350,77 @@ public:
                 newFullParameterEstimate.segment( numberEstimatedParameters_, numberConsiderParameters_ ) = considerParametersValues_;
             }
 
-            // Compute design matrices (for estimated and consider parameters) and residuals.
+            // Compute design matrices (for estimated and consider parameters) and residuals, or the normal equations or
+            // square-root information if the design matrix is not to be stored.
             std::shared_ptr< propagators::SimulationResults< ObservationScalarType, TimeType > > simulationResults;
-            std::pair< std::pair< Eigen::MatrixXd, Eigen::MatrixXd >, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > designMatricesAndResiduals =
-                    performPreEstimationSteps( estimationInput, newFullParameterEstimate, true, numberOfIterations, exceptionDuringPropagation, simulationResults );
-            Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > residuals = designMatricesAndResiduals.second;
-            Eigen::MatrixXd designMatrixEstimatedParameters = designMatricesAndResiduals.first.first;
-            Eigen::MatrixXd designMatrixConsiderParameters;
-            if ( considerParametersIncluded_ )
+            Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > residuals;
+            Eigen::MatrixXd designMatrixEstimatedParameters, designMatrixConsiderParameters;
+            Eigen::MatrixXd normalMatrix, considerNormalMatrix;
+            Eigen::VectorXd normalRightHandSide;
+            Eigen::VectorXd normalizationTerms, normalizationTermsConsider;
+            std::shared_ptr< linear_algebra::SquareRootInformationFilter > squareRootInformationFilter;
+            std::shared_ptr< linear_algebra::BlockSparseDesignMatrix > blockSparseDesignMatrix;
+            if( useSquareRootInformationFilter )
             {
-                designMatrixConsiderParameters = designMatricesAndResiduals.first.second;
+                // With frozen partials, the square-root information is recomputed from the frozen variational equations
+                performPreEstimationStepsWithSquareRootInformationFilter(
+                            estimationInput, newFullParameterEstimate, numberOfIterations, exceptionDuringPropagation, simulationResults,
+                            squareRootInformationFilter, normalizationTerms, normalizationTermsConsider, residuals,
+                            !arePartialsFrozen );
+            }
+            else if( arePartialsFrozen )
+            {
+                residuals = performPreEstimationStepsWithFrozenPartials(
+                            estimationInput, newFullParameterEstimate, numberOfIterations, exceptionDuringPropagation, simulationResults );
+                normalizationTerms = frozenNormalizationTerms;
+                normalizationTermsConsider = frozenNormalizationTermsConsider;
+                if( useNormalEquations )
+                {
+                    normalMatrix = frozenNormalMatrix;
+                    considerNormalMatrix = frozenConsiderNormalMatrix;
+                    normalRightHandSide = frozenBlockSparseDesignMatrix->multiplyTranspose(
+                                estimationInput->getWeightsMatrixDiagonals( ).cwiseProduct( residuals.template cast< double >( ) ) );
+                    blockSparseDesignMatrix = frozenBlockSparseDesignMatrix;
+                }
+                else
+                {
+                    designMatrixEstimatedParameters = frozenDesignMatrixEstimatedParameters;
+                    designMatrixConsiderParameters = frozenDesignMatrixConsiderParameters;
+                }
+            }
+            else if( useNormalEquations )
+            {
+                // The (block-sparse) design matrix is only needed if the partials may be frozen after this iteration
+                bool storeDesignMatrixForFreezing =
+                        freezePartials && ( ( estimationInput->getUpdateRatioToFreezePartials( ) > 0.0 ) ||
+                                            ( ( estimationInput->getIterationToFreezePartials( ) > 0 ) &&
+                                              ( numberOfIterations + 1 >= estimationInput->getIterationToFreezePartials( ) ) ) );
+                performPreEstimationStepsFromNormalEquations(
+                            estimationInput, newFullParameterEstimate, numberOfIterations, exceptionDuringPropagation, simulationResults,
+                            normalMatrix, normalRightHandSide, considerNormalMatrix, normalizationTerms, normalizationTermsConsider,
+                            residuals, blockSparseDesignMatrix, storeDesignMatrixForFreezing );
             }
             else
             {
-                designMatrixConsiderParameters = Eigen::MatrixXd::Zero( 0, 0 );
+                std::pair< std::pair< Eigen::MatrixXd, Eigen::MatrixXd >, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > designMatricesAndResiduals =
+                        performPreEstimationSteps( estimationInput, newFullParameterEstimate, true, numberOfIterations, exceptionDuringPropagation, simulationResults );
+                residuals = designMatricesAndResiduals.second;
+                designMatrixEstimatedParameters = designMatricesAndResiduals.first.first;
+                if ( considerParametersIncluded_ )
+                {
+                    designMatrixConsiderParameters = designMatricesAndResiduals.first.second;
+                }
+                else
+                {
+                    designMatrixConsiderParameters = Eigen::MatrixXd::Zero( 0, 0 );
+                }
+
+                // Normalise estimated parameters partials
+                normalizationTerms = normalizeDesignMatrix( designMatrixEstimatedParameters );
+                if ( considerParametersIncluded_ )
+                {
+                    normalizationTermsConsider = normalizeDesignMatrix( designMatrixConsiderParameters );
+                }
             }
 
             // Set simulation results
@@ -797,17 +1429,15 @@ public:
                 simulationResultsPerIteration.push_back( simulationResults );
             }
 
-            // Normalise estimated parameters partials and inverse apriori covariance
-            Eigen::VectorXd normalizationTerms = normalizeDesignMatrix( designMatrixEstimatedParameters );
+            // Normalise inverse apriori covariance
             Eigen::MatrixXd normalizedInverseAprioriCovarianceMatrix = normalizeAprioriCovariance(
                     estimationInput->getInverseOfAprioriCovariance( numberEstimatedParameters_ ), normalizationTerms );
 
-            // Normalise partials w.r.t. consider parameters, consider covariance and parameters deviations
-            Eigen::VectorXd normalizationTermsConsider, normalizedConsiderParametersDeviation;
+            // Normalise consider covariance and parameters deviations
+            Eigen::VectorXd normalizedConsiderParametersDeviation;
             Eigen::MatrixXd normalizedConsiderCovariance;
             if ( considerParametersIncluded_ )
             {
-                normalizationTermsConsider = normalizeDesignMatrix( designMatrixConsiderParameters );
                 normalizedConsiderCovariance = normalizeCovariance( estimationInput->getConsiderCovariance( ), normalizationTermsConsider );
                 normalizedConsiderParametersDeviation = estimationInput->considerParametersDeviations_.cwiseProduct( normalizationTermsConsider );
             }
@@ -833,10 +1463,44 @@ public:
                     conditionNumberCheck = TUDAT_NAN;
                 }
                 // Perform LSQ inversion
-                leastSquaresOutput = std::move( linear_algebra::performLeastSquaresAdjustmentFromDesignMatrix(
-                        designMatrixEstimatedParameters, residuals.template cast< double >( ), estimationInput->getWeightsMatrixDiagonals( ),
-                        normalizedInverseAprioriCovarianceMatrix, conditionNumberCheck, constraintStateMultiplier, constraintRightHandSide,
-                        designMatrixConsiderParameters, normalizedConsiderParametersDeviation ) );
+                if( useSquareRootInformationFilter )
+                {
+                    leastSquaresOutput = std::move( performLeastSquaresAdjustmentFromSquareRootInformation(
+                            squareRootInformationFilter, normalizedConsiderParametersDeviation, conditionNumberCheck,
+                            constraintStateMultiplier, constraintRightHandSide, considerNormalMatrix ) );
+                }
+                else if( useNormalEquations || estimationInput->getEliminateArcWiseParameters( ) )
+                {
+                    if( !useNormalEquations )
+                    {
+                        Eigen::MatrixXd weightedDesignMatrix = linear_algebra::multiplyDesignMatrixByDiagonalWeightMatrix(
+                                    designMatrixEstimatedParameters, estimationInput->getWeightsMatrixDiagonals( ) );
+                        normalMatrix = designMatrixEstimatedParameters.transpose( ) * weightedDesignMatrix;
+                        normalRightHandSide = weightedDesignMatrix.transpose( ) * residuals.template cast< double >( );
+                        if( considerParametersIncluded_ )
+                        {
+                            considerNormalMatrix = weightedDesignMatrix.transpose( ) * designMatrixConsiderParameters;
+                        }
+                    }
+
+                    if( considerParametersIncluded_ )
+                    {
+                        normalRightHandSide += considerNormalMatrix * normalizedConsiderParametersDeviation;
+                    }
+                    leastSquaresOutput = std::move( linear_algebra::performLeastSquaresAdjustmentFromNormalEquations(
+                            normalMatrix, normalRightHandSide, normalizedInverseAprioriCovarianceMatrix, conditionNumberCheck,
+                            constraintStateMultiplier, constraintRightHandSide,
+                            estimationInput->getEliminateArcWiseParameters( ) ?
+                                parametersToEstimate_->getArcWiseParameterIndices( ) : std::vector< int >( ),
+                            estimationInput->getNumberOfThreads( ) ) );
+                }
+                else
+                {
+                    leastSquaresOutput = std::move( linear_algebra::performLeastSquaresAdjustmentFromDesignMatrix(
+                            designMatrixEstimatedParameters, residuals.template cast< double >( ), estimationInput->getWeightsMatrixDiagonals( ),
+                            normalizedInverseAprioriCovarianceMatrix, conditionNumberCheck, constraintStateMultiplier, constraintRightHandSide,
+                            designMatrixConsiderParameters, normalizedConsiderParametersDeviation ) );
+                }
 
                 if( constraintStateMultiplier.rows( ) > 0 )
                 {
@@ -854,9 +1518,54 @@ public:
             ParameterVectorType parameterAddition =
                     ( leastSquaresOutput.first.cwiseQuotient( normalizationTerms.segment( 0, numberEstimatedParameters_ ) ) ).template cast< ObservationScalarType >( );
 
+            // Check whether the partials are to be frozen from the next iteration onwards (if so, store current partials)
+            if( freezePartials && !arePartialsFrozen )
+            {
+                bool freezePartialsOnNextIteration =
+                        ( estimationInput->getIterationToFreezePartials( ) > 0 ) &&
+                        ( numberOfIterations + 1 >= estimationInput->getIterationToFreezePartials( ) );
+                if( !freezePartialsOnNextIteration && estimationInput->getUpdateRatioToFreezePartials( ) > 0.0 )
+                {
+                    // Compare (normalized) parameter update to (normalized) formal errors
+                    Eigen::VectorXd normalizedFormalErrors =
+                            ( leastSquaresOutput.second ).inverse( ).diagonal( ).cwiseAbs( ).cwiseSqrt( );
+                    freezePartialsOnNextIteration =
+                            ( leastSquaresOutput.first.cwiseAbs( ).cwiseQuotient( normalizedFormalErrors ).maxCoeff( ) <
+                              estimationInput->getUpdateRatioToFreezePartials( ) );
+                }
+
+                if( freezePartialsOnNextIteration )
+                {
+                    arePartialsFrozen = true;
+                    frozenNormalizationTerms = normalizationTerms;
+                    frozenNormalizationTermsConsider = normalizationTermsConsider;
+                    if( useNormalEquations )
+                    {
+                        frozenNormalMatrix = normalMatrix;
+                        frozenConsiderNormalMatrix = considerNormalMatrix;
+                        frozenBlockSparseDesignMatrix = blockSparseDesignMatrix;
+                    }
+                    else if( useDesignMatrix )
+                    {
+                        frozenDesignMatrixEstimatedParameters = designMatrixEstimatedParameters;
+                        frozenDesignMatrixConsiderParameters = designMatrixConsiderParameters;
+                    }
+
+                    if( estimationInput->getPrintOutput( ) )
+                    {
+                        std::cout << "Freezing variational equations and partials from iteration " << numberOfIterations + 1 << std::endl;
+                    }
+                }
+            }
+
             // Compute contribution consider parameters
             Eigen::MatrixXd covarianceContributionConsiderParameters;
-            if ( considerParametersIncluded_ )
+            if ( considerParametersIncluded_ && !useDesignMatrix )
+            {
+                covarianceContributionConsiderParameters = calculateConsiderParametersCovarianceContributionFromNormalEquations(
+                        ( leastSquaresOutput.second ).inverse( ), considerNormalMatrix, normalizedConsiderCovariance );
+            }
+            else if ( considerParametersIncluded_ )
             {
                 covarianceContributionConsiderParameters = linear_algebra::calculateConsiderParametersCovarianceContribution(
                         ( leastSquaresOutput.second ).inverse( ), designMatrixEstimatedParameters, estimationInput->getWeightsMatrixDiagonals( ),
@@ -892,7 +1601,7 @@ public:
                 bestParameterEstimate = oldParameterEstimate;
                 bestResiduals = std::move( residuals.template cast< double >( ) );
                 estimationInput->getObservationCollection( )->setResiduals( residuals );
-                if( estimationInput->getSaveDesignMatrix( ) )
+                if( estimationInput->getSaveDesignMatrix( ) && useDesignMatrix )
                 {
                     bestDesignMatrixEstimatedParameters = std::move( designMatrixEstimatedParameters );
                     if ( considerParametersIncluded_ )
@@ -900,6 +1609,10 @@ public:
                         bestDesignMatrixConsiderParameters = std::move( designMatrixConsiderParameters );
                     }
                 }
+                if( estimationInput->getSaveBlockSparseDesignMatrix( ) )
+                {
+                    bestBlockSparseDesignMatrix = blockSparseDesignMatrix;
+                }
                 bestWeightsMatrixDiagonal = std::move( estimationInput->getWeightsMatrixDiagonals( ) );
                 bestTransformationData = std::move( normalizationTerms );
                 bestInverseNormalizedCovarianceMatrix = std::move( leastSquaresOutput.second );
@@ -961,6 +1674,7 @@ public:
                     bestTransformationData, bestInverseNormalizedCovarianceMatrix, bestResidual, bestIteration,
                     residualHistory, parameterHistory, bestDesignMatrixConsiderParameters, bestConsiderTransformationData,
                     bestConsiderCovarianceContribution, exceptionDuringInversion, exceptionDuringPropagation );
+        estimationOutput->setNormalizedBlockSparseDesignMatrix( bestBlockSparseDesignMatrix );
 
         if( estimationInput->getSaveStateHistoryForEachIteration( ) )
         {
@@ -1204,9 +1918,11 @@ protected:
 
 
         // Iterate over all observables and create observation managers.
+        observationSettingsList_ = observationSettingsList;
         observationManagers_ = createObservationManagersBase(
             observationSettingsList, bodies, fullParameters_,
             stateTransitionAndSensitivityMatrixInterface_, dependentVariablesInterface_ );
+        threadObservationManagers_ = { observationManagers_ };
 
         // Set current parameter estimate from body initial states and parameter set.
         currentParameterEstimate_ = parametersToEstimate_->template getFullParameterValues< ObservationScalarType >( );
@@ -1297,12 +2013,374 @@ protected:
         // Get number of observations
         int totalNumberOfObservations = estimationInput->getObservationCollection( )->getTotalObservableSize( );
 
+        updateParameterEstimateForIteration(
+                    estimationInput, newParameterEstimate, numberOfIterations, exceptionDuringPropagation, simulationResults );
+
+        // Calculate residuals and observation matrix for current parameter estimate.
+        Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > residuals;
+        Eigen::MatrixXd designMatrix;
+        calculateDesignMatrixAndResiduals< ObservationScalarType, TimeType >(
+                estimationInput->getObservationCollection( ),
+                getThreadObservationManagers( utilities::getNumberOfThreadsToUse(
+                    estimationInput->getNumberOfThreads( ), totalNumberOfObservations ) ),
+                totalNumberParameters_, totalNumberOfObservations, designMatrix, residuals, calculateResiduals, true );
+
+        // Divide partials matrix between estimated and consider parameters
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > designMatrices = separateEstimatedAndConsiderDesignMatrices( designMatrix, totalNumberOfObservations );
+
+        return std::make_pair( designMatrices, residuals );
+    }
+
+    //! Function to compute only the residuals for the current iteration, for use with frozen partials
+    /*!
+     *  Function to compute only the residuals for the current iteration, for use when the observation partials of a
+     *  previous iteration are reused (see EstimationInput::setPartialsFreezingSettings). Only the equations of motion
+     *  are re-integrated, the variational equations are not.
+     *  \param estimationInput Object containing all measurement data and associated settings
+     *  \param newParameterEstimate Full parameter vector (estimated and consider parameters) for current iteration
+     *  \param numberOfIterations Number of the current iteration
+     *  \param exceptionDuringPropagation Boolean set to true if an exception occured during propagation (return by
+     *  reference)
+     *  \param simulationResults Results of the propagation of the current iteration (return by reference)
+     *  \return Residuals of the current iteration
+     */
+    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > performPreEstimationStepsWithFrozenPartials(
+            std::shared_ptr< CovarianceAnalysisInput< ObservationScalarType, TimeType > > estimationInput,
+            ParameterVectorType& newParameterEstimate,
+            const int numberOfIterations,
+            bool& exceptionDuringPropagation,
+            std::shared_ptr< propagators::SimulationResults< ObservationScalarType, TimeType > >& simulationResults )
+    {
+        // Get number of observations
+        int totalNumberOfObservations = estimationInput->getObservationCollection( )->getTotalObservableSize( );
+
+        updateParameterEstimateForIteration(
+                    estimationInput, newParameterEstimate, numberOfIterations, exceptionDuringPropagation, simulationResults,
+                    false );
+
+        // Calculate residuals for current parameter estimate.
+        Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > residuals;
+        Eigen::MatrixXd designMatrix;
+        calculateDesignMatrixAndResiduals< ObservationScalarType, TimeType >(
+                estimationInput->getObservationCollection( ),
+                getThreadObservationManagers( utilities::getNumberOfThreadsToUse(
+                    estimationInput->getNumberOfThreads( ), totalNumberOfObservations ) ),
+                totalNumberParameters_, totalNumberOfObservations, designMatrix, residuals, true, false );
+
+        return residuals;
+    }
+
+    //! Function to compute the normalized normal equations and residuals for the current iteration
+    /*!
+     *  Function to compute the normalized normal equations and residuals for the current iteration, as an alternative to
+     *  performPreEstimationSteps that does not store the full design matrix. The normal equations are normalized such
+     *  that they are identical to those obtained from the design matrix normalized by normalizeDesignMatrix.
+     *  \param estimationInput Object containing all measurement data and associated settings
+     *  \param newParameterEstimate Full parameter vector (estimated and consider parameters) for current iteration
+     *  \param numberOfIterations Number of the current iteration
+     *  \param exceptionDuringPropagation Boolean set to true if an exception occured during propagation (return by
+     *  reference)
+     *  \param simulationResults Results of the propagation of the current iteration (return by reference)
+     *  \param normalMatrix Normalized normal matrix for the estimated parameters (return by reference)
+     *  \param normalRightHandSide Normalized right-hand side of the normal equations for the estimated parameters
+     *  (return by reference)
+     *  \param considerNormalMatrix Normalized product H^T W H_c of partials w.r.t. estimated and consider parameters
+     *  (return by reference; empty if no consider parameters are used)
+     *  \param normalizationTerms Normalization terms of the estimated parameters (return by reference)
+     *  \param considerNormalizationTerms Normalization terms of the consider parameters (return by reference; empty if
+     *  no consider parameters are used)
+     *  \param residuals Residuals of the current iteration (return by reference)
+     *  \param normalizedDesignMatrix Normalized block-sparse design matrix of the estimated parameters (return by
+     *  reference; only set if CovarianceAnalysisInput::getSaveBlockSparseDesignMatrix or computeBlockSparseDesignMatrix
+     *  is true, nullptr otherwise)
+     *  \param computeBlockSparseDesignMatrix Boolean denoting whether the block-sparse design matrix is to be computed,
+     *  regardless of CovarianceAnalysisInput::getSaveBlockSparseDesignMatrix (e.g. to reuse it when the partials are
+     *  frozen)
+     */
+    void performPreEstimationStepsFromNormalEquations(
+            std::shared_ptr< CovarianceAnalysisInput< ObservationScalarType, TimeType > > estimationInput,
+            ParameterVectorType& newParameterEstimate,
+            const int numberOfIterations,
+            bool& exceptionDuringPropagation,
+            std::shared_ptr< propagators::SimulationResults< ObservationScalarType, TimeType > >& simulationResults,
+            Eigen::MatrixXd& normalMatrix,
+            Eigen::VectorXd& normalRightHandSide,
+            Eigen::MatrixXd& considerNormalMatrix,
+            Eigen::VectorXd& normalizationTerms,
+            Eigen::VectorXd& considerNormalizationTerms,
+            Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >& residuals,
+            std::shared_ptr< linear_algebra::BlockSparseDesignMatrix >& normalizedDesignMatrix,
+            const bool computeBlockSparseDesignMatrix = false )
+    {
+        // Get number of observations
+        int totalNumberOfObservations = estimationInput->getObservationCollection( )->getTotalObservableSize( );
+
+        updateParameterEstimateForIteration(
+                    estimationInput, newParameterEstimate, numberOfIterations, exceptionDuringPropagation, simulationResults );
+
+        // Calculate residuals and normal equations, w.r.t. full parameter vector, for current parameter estimate.
+        Eigen::MatrixXd fullNormalMatrix;
+        Eigen::VectorXd fullNormalRightHandSide;
+        Eigen::VectorXd fullNormalizationTerms;
+        std::shared_ptr< linear_algebra::BlockSparseDesignMatrix > fullDesignMatrix;
+        if( estimationInput->getSaveBlockSparseDesignMatrix( ) || computeBlockSparseDesignMatrix )
+        {
+            fullDesignMatrix = std::make_shared< linear_algebra::BlockSparseDesignMatrix >( );
+        }
+        calculateNormalEquationsAndResiduals< ObservationScalarType, TimeType >(
+                estimationInput->getObservationCollection( ),
+                getThreadObservationManagers( utilities::getNumberOfThreadsToUse(
+                    estimationInput->getNumberOfThreads( ), totalNumberOfObservations ) ),
+                totalNumberParameters_, totalNumberOfObservations, estimationInput->getWeightsMatrixDiagonals( ),
+                fullNormalMatrix, fullNormalRightHandSide, fullNormalizationTerms, residuals, fullDesignMatrix );
+        for( int i = 0; i < totalNumberParameters_; i++ )
+        {
+            if( fullNormalizationTerms( i ) == 0.0 )
+            {
+                fullNormalizationTerms( i ) = 1.0;
+            }
+        }
+
+        // Retrieve indices of estimated and consider parameters in full parameter vector
+        std::vector< int > estimatedParameterIndices = getIndicesInFullParameterVector( indicesAndSizeEstimatedParameters_ );
+        std::vector< int > considerParameterIndices = getIndicesInFullParameterVector( indicesAndSizeConsiderParameters_ );
+
+        // Normalize and separate normal equations
+        normalizationTerms = Eigen::VectorXd( numberEstimatedParameters_ );
+        normalRightHandSide = Eigen::VectorXd( numberEstimatedParameters_ );
+        for( int i = 0; i < numberEstimatedParameters_; i++ )
+        {
+            normalizationTerms( i ) = fullNormalizationTerms( estimatedParameterIndices.at( i ) );
+            normalRightHandSide( i ) = fullNormalRightHandSide( estimatedParameterIndices.at( i ) ) / normalizationTerms( i );
+        }
+
+        considerNormalizationTerms = Eigen::VectorXd( considerParameterIndices.size( ) );
+        for( unsigned int i = 0; i < considerParameterIndices.size( ); i++ )
+        {
+            considerNormalizationTerms( i ) = fullNormalizationTerms( considerParameterIndices.at( i ) );
+        }
+
+        normalMatrix = Eigen::MatrixXd( numberEstimatedParameters_, numberEstimatedParameters_ );
+        considerNormalMatrix = Eigen::MatrixXd( numberEstimatedParameters_, considerParameterIndices.size( ) );
+        for( int i = 0; i < numberEstimatedParameters_; i++ )
+        {
+            for( int j = 0; j < numberEstimatedParameters_; j++ )
+            {
+                normalMatrix( i, j ) = fullNormalMatrix( estimatedParameterIndices.at( i ), estimatedParameterIndices.at( j ) ) /
+                        ( normalizationTerms( i ) * normalizationTerms( j ) );
+            }
+            for( unsigned int j = 0; j < considerParameterIndices.size( ); j++ )
+            {
+                considerNormalMatrix( i, j ) = fullNormalMatrix( estimatedParameterIndices.at( i ), considerParameterIndices.at( j ) ) /
+                        ( normalizationTerms( i ) * considerNormalizationTerms( j ) );
+            }
+        }
+
+        // Normalize block-sparse design matrix, and retrieve columns of estimated parameters
+        normalizedDesignMatrix = nullptr;
+        if( fullDesignMatrix != nullptr )
+        {
+            fullDesignMatrix->scaleColumns( fullNormalizationTerms.cwiseInverse( ) );
+            normalizedDesignMatrix = std::make_shared< linear_algebra::BlockSparseDesignMatrix >(
+                        fullDesignMatrix->getColumnSubset( estimatedParameterIndices ) );
+        }
+    }
+
+    //! Function to compute the normalized square-root information and residuals for the current iteration
+    /*!
+     *  Function to compute the normalized square-root information and residuals for the current iteration, as an
+     *  alternative to performPreEstimationSteps that does not store the full design matrix. The parameters of the
+     *  returned filter are the estimated parameters, followed by the consider parameters, normalized such that the
+     *  information is identical to that obtained from the design matrix normalized by normalizeDesignMatrix. The
+     *  (normalized) a priori information of the estimated parameters is included in the filter.
+     *  \param estimationInput Object containing all measurement data and associated settings
+     *  \param newParameterEstimate Full parameter vector (estimated and consider parameters) for current iteration
+     *  \param numberOfIterations Number of the current iteration
+     *  \param exceptionDuringPropagation Boolean set to true if an exception occured during propagation (return by
+     *  reference)
+     *  \param simulationResults Results of the propagation of the current iteration (return by reference)
+     *  \param squareRootInformationFilter Filter containing the normalized square-root information of the estimated and
+     *  consider parameters (return by reference)
+     *  \param normalizationTerms Normalization terms of the estimated parameters (return by reference)
+     *  \param considerNormalizationTerms Normalization terms of the consider parameters (return by reference; empty if
+     *  no consider parameters are used)
+     *  \param residuals Residuals of the current iteration (return by reference)
+     *  \param reintegrateVariationalEquations Boolean denoting whether the variational equations may be re-integrated
+     *  (if false, the partials are computed from the current state transition and sensitivity matrices)
+     */
+    void performPreEstimationStepsWithSquareRootInformationFilter(
+            std::shared_ptr< CovarianceAnalysisInput< ObservationScalarType, TimeType > > estimationInput,
+            ParameterVectorType& newParameterEstimate,
+            const int numberOfIterations,
+            bool& exceptionDuringPropagation,
+            std::shared_ptr< propagators::SimulationResults< ObservationScalarType, TimeType > >& simulationResults,
+            std::shared_ptr< linear_algebra::SquareRootInformationFilter >& squareRootInformationFilter,
+            Eigen::VectorXd& normalizationTerms,
+            Eigen::VectorXd& considerNormalizationTerms,
+            Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >& residuals,
+            const bool reintegrateVariationalEquations = true )
+    {
+        // Get number of observations
+        int totalNumberOfObservations = estimationInput->getObservationCollection( )->getTotalObservableSize( );
+
+        updateParameterEstimateForIteration(
+                    estimationInput, newParameterEstimate, numberOfIterations, exceptionDuringPropagation, simulationResults,
+                    reintegrateVariationalEquations );
+
+        // Calculate residuals and square-root information, w.r.t. full parameter vector, for current parameter estimate.
+        std::shared_ptr< linear_algebra::SquareRootInformationFilter > fullParameterFilter;
+        Eigen::VectorXd fullNormalizationTerms;
+        calculateSquareRootInformationAndResiduals< ObservationScalarType, TimeType >(
+                estimationInput->getObservationCollection( ),
+                getThreadObservationManagers( utilities::getNumberOfThreadsToUse(
+                    estimationInput->getNumberOfThreads( ), totalNumberOfObservations ) ),
+                totalNumberParameters_, totalNumberOfObservations, estimationInput->getWeightsMatrixDiagonals( ),
+                fullParameterFilter, fullNormalizationTerms, residuals );
+        for( int i = 0; i < totalNumberParameters_; i++ )
+        {
+            if( fullNormalizationTerms( i ) == 0.0 )
+            {
+                fullNormalizationTerms( i ) = 1.0;
+            }
+        }
+
+        // Order parameters as estimated parameters followed by consider parameters
+        std::vector< int > orderedParameterIndices = getIndicesInFullParameterVector( indicesAndSizeEstimatedParameters_ );
+        std::vector< int > considerParameterIndices = getIndicesInFullParameterVector( indicesAndSizeConsiderParameters_ );
+        orderedParameterIndices.insert( orderedParameterIndices.end( ), considerParameterIndices.begin( ), considerParameterIndices.end( ) );
+
+        // Normalize and reorder columns of square-root information matrix
+        Eigen::MatrixXd normalizedSquareRootInformationMatrix = Eigen::MatrixXd( totalNumberParameters_, totalNumberParameters_ );
+        Eigen::VectorXd orderedNormalizationTerms = Eigen::VectorXd( totalNumberParameters_ );
+        for( int i = 0; i < totalNumberParameters_; i++ )
+        {
+            orderedNormalizationTerms( i ) = fullNormalizationTerms( orderedParameterIndices.at( i ) );
+            normalizedSquareRootInformationMatrix.col( i ) =
+                    fullParameterFilter->getSquareRootInformationMatrix( ).col( orderedParameterIndices.at( i ) ) /
+                    orderedNormalizationTerms( i );
+        }
+        normalizationTerms = orderedNormalizationTerms.segment( 0, numberEstimatedParameters_ );
+        considerNormalizationTerms = orderedNormalizationTerms.segment(
+                    numberEstimatedParameters_, totalNumberParameters_ - numberEstimatedParameters_ );
+
+        // Create filter with normalized a priori information, and add (re-triangularized) information of observations
+        Eigen::MatrixXd normalizedInverseAprioriCovarianceMatrix = Eigen::MatrixXd::Zero( totalNumberParameters_, totalNumberParameters_ );
+        normalizedInverseAprioriCovarianceMatrix.block( 0, 0, numberEstimatedParameters_, numberEstimatedParameters_ ) =
+                normalizeAprioriCovariance( estimationInput->getInverseOfAprioriCovariance( numberEstimatedParameters_ ), normalizationTerms );
+        squareRootInformationFilter = std::make_shared< linear_algebra::SquareRootInformationFilter >(
+                    normalizedInverseAprioriCovarianceMatrix );
+        squareRootInformationFilter->addSquareRootInformation(
+                    normalizedSquareRootInformationMatrix, fullParameterFilter->getSquareRootInformationVector( ),
+                    fullParameterFilter->getResidualSumOfSquares( ) );
+    }
+
+    //! Function to perform an iteration of least squares estimation from the normalized square-root information
+    /*!
+     *  Function to perform an iteration of least squares estimation from the normalized square-root information, as
+     *  computed by performPreEstimationStepsWithSquareRootInformationFilter. The information equations of the estimated
+     *  parameters, R_ee x = z_e + R_ec dc (with dc the deviation of the consider parameters), are solved by
+     *  back-substitution. With constraints, the constrained normal equations formed from R_ee and z_e are solved.
+     *  \param squareRootInformationFilter Filter containing the normalized square-root information of the estimated and
+     *  consider parameters
+     *  \param normalizedConsiderParametersDeviation Normalized deviation of consider parameters
+     *  \param limitConditionNumberForWarning Maximum value of the condition number of the covariance matrix that is
+     *  allowed (warning printed when exceeded)
+     *  \param constraintStateMultiplier Multiplier for estimated parameter that defines linear constraint
+     *  \param constraintRightHandSide Right-hand side estimation linear constraint
+     *  \param considerNormalMatrix Normalized product H^T W H_c of partials w.r.t. estimated and consider parameters
+     *  (return by reference; empty if no consider parameters are used)
+     *  \return Pair containing: (first: parameter adjustment, second: inverse covariance)
+     */
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromSquareRootInformation(
+            const std::shared_ptr< linear_algebra::SquareRootInformationFilter > squareRootInformationFilter,
+            const Eigen::VectorXd& normalizedConsiderParametersDeviation,
+            const double limitConditionNumberForWarning,
+            const Eigen::MatrixXd& constraintStateMultiplier,
+            const Eigen::VectorXd& constraintRightHandSide,
+            Eigen::MatrixXd& considerNormalMatrix )
+    {
+        // Retrieve square-root information of estimated parameters, and their coupling to the consider parameters
+        int numberOfConsiderParameters = totalNumberParameters_ - numberEstimatedParameters_;
+        Eigen::MatrixXd estimatedSquareRootInformationMatrix = squareRootInformationFilter->getSquareRootInformationMatrix( ).block(
+                    0, 0, numberEstimatedParameters_, numberEstimatedParameters_ );
+        Eigen::VectorXd estimatedSquareRootInformationVector = squareRootInformationFilter->getSquareRootInformationVector( ).segment(
+                    0, numberEstimatedParameters_ );
+        if( numberOfConsiderParameters > 0 )
+        {
+            Eigen::MatrixXd considerSquareRootInformationMatrix = squareRootInformationFilter->getSquareRootInformationMatrix( ).block(
+                        0, numberEstimatedParameters_, numberEstimatedParameters_, numberOfConsiderParameters );
+            considerNormalMatrix = estimatedSquareRootInformationMatrix.transpose( ) * considerSquareRootInformationMatrix;
+            estimatedSquareRootInformationVector += considerSquareRootInformationMatrix * normalizedConsiderParametersDeviation;
+        }
+        else
+        {
+            considerNormalMatrix = Eigen::MatrixXd::Zero( 0, 0 );
+        }
+
+        Eigen::MatrixXd inverseNormalizedCovariance =
+                estimatedSquareRootInformationMatrix.transpose( ) * estimatedSquareRootInformationMatrix;
+        if( constraintStateMultiplier.rows( ) > 0 )
+        {
+            return linear_algebra::performLeastSquaresAdjustmentFromNormalEquations(
+                        inverseNormalizedCovariance,
+                        estimatedSquareRootInformationMatrix.transpose( ) * estimatedSquareRootInformationVector,
+                        Eigen::MatrixXd::Zero( numberEstimatedParameters_, numberEstimatedParameters_ ),
+                        limitConditionNumberForWarning, constraintStateMultiplier, constraintRightHandSide );
+        }
+
+        linear_algebra::SquareRootInformationFilter estimatedParameterFilter(
+                    estimatedSquareRootInformationMatrix, estimatedSquareRootInformationVector );
+        return std::make_pair( estimatedParameterFilter.getParameterEstimate( limitConditionNumberForWarning ), inverseNormalizedCovariance );
+    }
+
+    //! Function to retrieve the indices in the full parameter vector of a set of parameters
+    std::vector< int > getIndicesInFullParameterVector(
+            const std::vector< std::pair< std::pair< int, int >, int > >& indicesAndSizeParameters )
+    {
+        std::vector< int > indicesInFullParameterVector;
+        for( unsigned int i = 0; i < indicesAndSizeParameters.size( ); i++ )
+        {
+            for( int j = 0; j < indicesAndSizeParameters.at( i ).second; j++ )
+            {
+                int currentIndex = indicesAndSizeParameters.at( i ).first.first + j;
+                if( static_cast< int >( indicesInFullParameterVector.size( ) ) <= currentIndex )
+                {
+                    indicesInFullParameterVector.resize( currentIndex + 1 );
+                }
+                indicesInFullParameterVector.at( currentIndex ) = indicesAndSizeParameters.at( i ).first.second + j;
+            }
+        }
+        return indicesInFullParameterVector;
+    }
+
+    //! Function to reset the parameters and re-propagate the dynamics (if required) at the start of an iteration
+    /*!
+     *  Function to reset the parameters and re-propagate the dynamics (if required) at the start of an iteration
+     *  \param estimationInput Object containing all measurement data and associated settings
+     *  \param newParameterEstimate Full parameter vector (estimated and consider parameters) for current iteration
+     *  \param numberOfIterations Number of the current iteration
+     *  \param exceptionDuringPropagation Boolean set to true if an exception occured during propagation (return by
+     *  reference)
+     *  \param simulationResults Results of the propagation of the current iteration (return by reference)
+     *  \param reintegrateVariationalEquations Boolean denoting whether the variational equations may be re-integrated
+     *  (if false, only the equations of motion are re-integrated, and the current state transition and sensitivity
+     *  matrices are retained)
+     */
+    void updateParameterEstimateForIteration(
+            std::shared_ptr< CovarianceAnalysisInput< ObservationScalarType, TimeType > > estimationInput,
+            ParameterVectorType& newParameterEstimate,
+            const int numberOfIterations,
+            bool& exceptionDuringPropagation,
+            std::shared_ptr< propagators::SimulationResults< ObservationScalarType, TimeType > >& simulationResults,
+            const bool reintegrateVariationalEquations = true )
+    {
         // Re-integrate equations of motion and variational equations with new parameter estimate.
         try
         {
             if( ( numberOfIterations > 0 ) || ( estimationInput->getReintegrateEquationsOnFirstIteration( ) ) )
             {
-                resetParameterEstimate( newParameterEstimate, estimationInput->getReintegrateVariationalEquations( ) );
+                resetParameterEstimate( newParameterEstimate,
+                                        reintegrateVariationalEquations && estimationInput->getReintegrateVariationalEquations( ) );
             }
 
             if( std::dynamic_pointer_cast< EstimationInput< ObservationScalarType, TimeType > >( estimationInput ) != nullptr )
@@ -1322,27 +2400,37 @@ protected:
 
         if( estimationInput->getPrintOutput( ) )
         {
-            std::cout << "Calculating residuals and partials " << totalNumberOfObservations << std::endl;
+            std::cout << ( reintegrateVariationalEquations ? "Calculating residuals and partials " : "Calculating residuals " ) <<
+                         estimationInput->getObservationCollection( )->getTotalObservableSize( ) << std::endl;
         }
+    }
 
-        // Calculate residuals and observation matrix for current parameter estimate.
-        Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > residuals;
-        Eigen::MatrixXd designMatrix;
-        if ( calculateResiduals )
-        {
-            calculateDesignMatrixAndResiduals< ObservationScalarType, TimeType >(
-                    estimationInput->getObservationCollection( ), observationManagers_, totalNumberParameters_, totalNumberOfObservations, designMatrix, residuals, true );
-        }
-        else
+    //! Function to retrieve the observation managers to use on each thread when computing the design matrix
+    /*!
+     *  Function to retrieve the observation managers to use on each thread when computing the design matrix and
+     *  residuals. The first thread uses the observationManagers_; for the other threads, observation managers are
+     *  created from the observation model settings when first needed, and retained for subsequent iterations. If the
+     *  environment contains models that are not known to be safe for concurrent evaluation (see
+     *  getThreadUnsafeEnvironmentModels), only the observation managers for a single thread are returned.
+     *  \param requestedNumberOfThreads Number of threads for which the observation managers are to be retrieved
+     *  \return Observation managers for each thread
+     */
+    std::vector< std::map< observation_models::ObservableType,
+    std::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > > > getThreadObservationManagers(
+            const unsigned int requestedNumberOfThreads )
+    {
+        unsigned int numberOfThreads = simulation_setup::getNumberOfThreadsForEnvironmentEvaluation(
+                    bodies_, requestedNumberOfThreads );
+        while( threadObservationManagers_.size( ) < numberOfThreads )
         {
-            calculateDesignMatrix< ObservationScalarType, TimeType >(
-                    estimationInput->getObservationCollection( ), observationManagers_, totalNumberParameters_, totalNumberOfObservations, designMatrix );
+            threadObservationManagers_.push_back(
+                        createObservationManagersBase(
+                            observationSettingsList_, bodies_, fullParameters_,
+                            stateTransitionAndSensitivityMatrixInterface_, dependentVariablesInterface_ ) );
         }
-
-        // Divide partials matrix between estimated and consider parameters
-        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > designMatrices = separateEstimatedAndConsiderDesignMatrices( designMatrix, totalNumberOfObservations );
-
-        return std::make_pair( designMatrices, residuals );
+        return std::vector< std::map< observation_models::ObservableType,
+                std::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > > >(
+                    threadObservationManagers_.begin( ), threadObservationManagers_.begin( ) + numberOfThreads );
     }
 
     std::pair< Eigen::MatrixXd, Eigen::MatrixXd > separateEstimatedAndConsiderDesignMatrices(
@@ -1378,6 +2466,14 @@ protected:
     std::map< observation_models::ObservableType,
     std::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > > observationManagers_;
 
+    //! List of objects that compute the values/partials of the observables, for each thread used to compute the design
+    //! matrix (first entry equal to observationManagers_)
+    std::vector< std::map< observation_models::ObservableType,
+    std::shared_ptr< observation_models::ObservationManagerBase< ObservationScalarType, TimeType > > > > threadObservationManagers_;
+
+    //! Settings for the observation models, used to create the observation managers for additional threads
+    std::vector< std::shared_ptr< observation_models::ObservationModelSettings > > observationSettingsList_;
+
     //! Container object for all parameters that are to be estimated
     std::shared_ptr< estimatable_parameters::EstimatableParameterSet< ObservationScalarType > > parametersToEstimate_;
 
@@ -69,6 +69,48 @@ void addNoiseAndDependentVariableToObservation(
 }
 
 
+//! Function to check the viability of a computed observable, and add noise and dependent variables if it is viable
+/*!
+ *  Function to check the viability of a computed observable, and add noise and dependent variables if it is viable
+ *  \param calculatedObservation Computed (noise-free) observable
+ *  \param observationTime Time at which observable is computed
+ *  \param vectorOfStates Link end states, as computed with the observable
+ *  \param vectorOfTimes Link end times, as computed with the observable
+ *  \param observableType Type of observable
+ *  \param linkViabilityCalculators List of observation viability calculators, which are used to reject simulated
+ *  observation if they dont fulfill a given (set of) conditions, e.g. minimum elevation angle (default none).
+ *  \return Observation (with noise, if viable), viability of observation, and dependent variables
+ */
+template< int ObservationSize = 1, typename ObservationScalarType = double, typename TimeType = double >
+std::tuple< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >, bool, Eigen::VectorXd > checkAndFinalizeSimulatedObservation(
+        Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > calculatedObservation,
+        const TimeType& observationTime,
+        const std::vector< Eigen::Vector6d >& vectorOfStates,
+        const std::vector< double >& vectorOfTimes,
+        const observation_models::ObservableType observableType,
+        const std::vector< std::shared_ptr< observation_models::ObservationViabilityCalculator > > linkViabilityCalculators =
+        std::vector< std::shared_ptr< observation_models::ObservationViabilityCalculator > >( ),
+        const std::function< Eigen::VectorXd( const double ) > noiseFunction = nullptr,
+        const std::shared_ptr< ObservationDependentVariableCalculator > dependentVariableCalculator = nullptr,
+        const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > ancilliarySettings = nullptr )
+{
+    Eigen::VectorXd dependentVariables = Eigen::VectorXd::Zero( 0 );
+
+    // Check if observation is feasible
+    bool observationFeasible = isObservationViable( vectorOfStates, vectorOfTimes, linkViabilityCalculators );
+
+    if( observationFeasible )
+    {
+        addNoiseAndDependentVariableToObservation< ObservationSize , ObservationScalarType, TimeType >(
+                    calculatedObservation, observationTime, dependentVariables,
+                    vectorOfStates, vectorOfTimes, ancilliarySettings, observableType,
+                    noiseFunction, dependentVariableCalculator );
+    }
+
+    // Return simulated observable and viability
+    return std::make_tuple( calculatedObservation, observationFeasible, dependentVariables );
+}
+
 //! Function to simulate an observable, checking whether it is viable according to settings passed to this function
 /*!
  *  Function to simulate an observable, checking whether it is viable according to settings passed to this function
@@ -97,22 +139,11 @@ std::tuple< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >, bool, Eig
     Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > calculatedObservation =
             observationModel->computeObservationsWithLinkEndData(
                 observationTime, referenceLinkEnd, vectorOfTimes, vectorOfStates, ancilliarySettings );
-    Eigen::VectorXd dependentVariables = Eigen::VectorXd::Zero( 0 );
 
-    // Check if observation is feasible
-    bool observationFeasible = isObservationViable( vectorOfStates, vectorOfTimes, linkViabilityCalculators );
-
-    if( observationFeasible )
-    {
-        addNoiseAndDependentVariableToObservation< ObservationSize , ObservationScalarType, TimeType >(
-                    calculatedObservation, observationTime, dependentVariables,
-                    vectorOfStates, vectorOfTimes, ancilliarySettings, observationModel->getObservableType( ),
-                    noiseFunction, dependentVariableCalculator );
-    }
-
-
-    // Return simulated observable and viability
-    return std::make_tuple( calculatedObservation, observationFeasible, dependentVariables );
+    return checkAndFinalizeSimulatedObservation< ObservationSize, ObservationScalarType, TimeType >(
+                calculatedObservation, observationTime, vectorOfStates, vectorOfTimes,
+                observationModel->getObservableType( ), linkViabilityCalculators, noiseFunction,
+                dependentVariableCalculator, ancilliarySettings );
 }
 
 //! Function to simulate observables, checking whether they are viable according to settings passed to this function
@@ -199,25 +230,31 @@ simulateObservationsWithCheckAndLinkEndIdOutput(
                 dependentVariableCalculator, ancilliarySettings );
 }
 
+//! Computed observable, with associated link end states and times
+template< typename ObservationScalarType = double, int ObservationSize = 1 >
+using SingleObservationLinkEndData = std::tuple<
+Eigen::Matrix< ObservationScalarType, ObservationSize, 1 >, std::vector< Eigen::Vector6d >, std::vector< double > >;
+
+//! Function to compute the arcs of observations (without noise and additional viability checks) defined by per-arc settings
+/*!
+ *  Function to compute the arcs of observations (without noise and additional viability checks) defined by per-arc settings
+ *  \param observationsToSimulate Settings defining the observation arcs
+ *  \param observationModel Observation model that is to be used to compute observations
+ *  \param arcDefiningViabilityCalculators Viability calculators for the arc-defining constraint
+ *  \return List of observation arcs (map of observation time to observable with link end data)
+ */
 template< typename ObservationScalarType = double, typename TimeType = double,
           int ObservationSize = 1 >
-std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >
-simulatePerArcSingleObservationSet(
+std::vector< std::map< TimeType, SingleObservationLinkEndData< ObservationScalarType, ObservationSize > > >
+computePerArcObservationArcs(
         const std::shared_ptr< PerArcObservationSimulationSettings< TimeType > > observationsToSimulate,
         const std::shared_ptr< observation_models::ObservationModel< ObservationSize, ObservationScalarType, TimeType > > observationModel,
-        const SystemOfBodies& bodies )
+        const std::vector< std::shared_ptr< observation_models::ObservationViabilityCalculator > >& arcDefiningViabilityCalculators )
 {
     using namespace observation_models;
 
-    // Create viability settings for arc-defining constraint
-    std::vector< std::shared_ptr< observation_models::ObservationViabilityCalculator > > arcDefiningViabilityCalculators =
-            observation_models::createObservationViabilityCalculators(
-                bodies,
-                observationsToSimulate->getLinkEnds( ).linkEnds_,
-                observationsToSimulate->getObservableType( ), { observationsToSimulate->arcDefiningConstraint_ } );
-
     // Define list of arc data
-    typedef std::tuple< Eigen::Matrix< ObservationScalarType, ObservationSize, 1 >, std::vector< Eigen::Vector6d >, std::vector< double > > SingleObservationData;
+    typedef SingleObservationLinkEndData< ObservationScalarType, ObservationSize > SingleObservationData;
     typedef std::map< TimeType, SingleObservationData > SingleArcObservationData;
     std::vector< SingleArcObservationData > simulatedObservations;
 
@@ -291,6 +328,40 @@ simulatePerArcSingleObservationSet(
         }
     }
 
+    return simulatedObservations;
+}
+
+//! Function to create a single observation set from computed observation arcs, defined by per-arc settings
+/*!
+ *  Function to create a single observation set from observation arcs computed by computePerArcObservationArcs, checking
+ *  the additional viability settings, and adding noise and dependent variables.
+ *  \param observationsToSimulate Settings defining the observation arcs
+ *  \param simulatedObservations Computed observation arcs
+ *  \param bodies System of bodies
+ *  \return Simulated observation set
+ */
+template< typename ObservationScalarType = double, typename TimeType = double,
+          int ObservationSize = 1 >
+std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >
+createPerArcSingleObservationSet(
+        const std::shared_ptr< PerArcObservationSimulationSettings< TimeType > > observationsToSimulate,
+        const std::vector< std::map< TimeType, SingleObservationLinkEndData< ObservationScalarType, ObservationSize > > >&
+        simulatedObservations,
+        const SystemOfBodies& bodies )
+{
+    using namespace observation_models;
+
+    typedef SingleObservationLinkEndData< ObservationScalarType, ObservationSize > SingleObservationData;
+
+    Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > currentObservation;
+    std::vector< Eigen::Vector6d > vectorOfStates;
+    std::vector< double > vectorOfTimes;
+    bool observationFeasible;
+
+    LinkEndType referenceLinkEnd = observationsToSimulate->getReferenceLinkEndType( );
+    std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > ancilliarySettings =
+            observationsToSimulate->getAncilliarySettings( );
+
     std::vector< std::shared_ptr< observation_models::ObservationViabilityCalculator > > additionalViabilityCalculators =
             observation_models::createObservationViabilityCalculators(
                 bodies,
@@ -318,7 +389,7 @@ simulatePerArcSingleObservationSet(
             {
                 addNoiseAndDependentVariableToObservation< ObservationSize , ObservationScalarType, TimeType >(
                             currentObservation, it.first, currentDependentVariable, vectorOfStates, vectorOfTimes, ancilliarySettings,
-                            observationModel->getObservableType( ),
+                            observationsToSimulate->getObservableType( ),
                             observationsToSimulate->getObservationNoiseFunction( ),
                             observationsToSimulate->getDependentVariableCalculator( ) );
                 observations.push_back( currentObservation );
@@ -329,11 +400,33 @@ simulatePerArcSingleObservationSet(
     }
 
     return std::make_shared< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >(
-                observationModel->getObservableType( ), observationModel->getLinkEnds( ),
+                observationsToSimulate->getObservableType( ), observationsToSimulate->getLinkEnds( ).linkEnds_,
                 observations, observationTimes, referenceLinkEnd, observationsDependentVariables,
                 observationsToSimulate->getDependentVariableCalculator( ), ancilliarySettings );
 }
 
+template< typename ObservationScalarType = double, typename TimeType = double,
+          int ObservationSize = 1 >
+std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >
+simulatePerArcSingleObservationSet(
+        const std::shared_ptr< PerArcObservationSimulationSettings< TimeType > > observationsToSimulate,
+        const std::shared_ptr< observation_models::ObservationModel< ObservationSize, ObservationScalarType, TimeType > > observationModel,
+        const SystemOfBodies& bodies )
+{
+    // Create viability settings for arc-defining constraint
+    std::vector< std::shared_ptr< observation_models::ObservationViabilityCalculator > > arcDefiningViabilityCalculators =
+            observation_models::createObservationViabilityCalculators(
+                bodies,
+                observationsToSimulate->getLinkEnds( ).linkEnds_,
+                observationsToSimulate->getObservableType( ), { observationsToSimulate->arcDefiningConstraint_ } );
+
+    return createPerArcSingleObservationSet< ObservationScalarType, TimeType, ObservationSize >(
+                observationsToSimulate,
+                computePerArcObservationArcs< ObservationScalarType, TimeType, ObservationSize >(
+                    observationsToSimulate, observationModel, arcDefiningViabilityCalculators ),
+                bodies );
+}
+
 //! Function to compute observations at times defined by settings object using a given observation model
 /*!
  *  Function to compute observations at times defined by settings object using a given observation model
@@ -513,6 +606,314 @@ std::shared_ptr< observation_models::ObservationCollection< ObservationScalarTyp
 }
 
 
+//! Function to create the tasks to simulate a single observation set in parallel.
+/*!
+ *  Function to create the tasks to simulate a single observation set in parallel, as used by
+ *  simulateObservationsInParallel. The computation of the observables (including light-time iterations) is split into
+ *  tasks that can be run concurrently, each using the observation model of the thread on which it is run. The viability
+ *  checks, noise and dependent variables are then added by a function that is to be called (serially) after all tasks
+ *  are completed, in the same order as they are performed by simulateSingleObservationSet.
+ *  \param observationsToSimulate Object that computes/defines settings for observation times/reference link end
+ *  \param threadObservationSimulators List of observation simulators per thread (may be filled after calling this function,
+ *  but before running the tasks)
+ *  \param bodies System of bodies
+ *  \param numberOfObservationsPerTask Number of tabulated observation times that are computed in a single task
+ *  \param simulationTasks List of tasks (with thread index as input), to which the tasks for this set are added
+ *  \return Function that creates the observation set, once all tasks are completed
+ */
+template< typename ObservationScalarType = double, typename TimeType = double, int ObservationSize = 1 >
+std::function< std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >( ) >
+createParallelObservationSetSimulationTasks(
+        const std::shared_ptr< ObservationSimulationSettings< TimeType > > observationsToSimulate,
+        const std::vector< std::vector< std::shared_ptr< observation_models::ObservationSimulatorBase< ObservationScalarType, TimeType > > > >&
+        threadObservationSimulators,
+        const SystemOfBodies& bodies,
+        const unsigned int numberOfObservationsPerTask,
+        std::vector< std::function< void( const unsigned int ) > >& simulationTasks )
+{
+    typedef SingleObservationLinkEndData< ObservationScalarType, ObservationSize > SingleObservationData;
+
+    // Function to retrieve observation model of a given thread
+    observation_models::ObservableType observableType = observationsToSimulate->getObservableType( );
+    observation_models::LinkEnds linkEnds = observationsToSimulate->getLinkEnds( ).linkEnds_;
+    std::function< std::shared_ptr< observation_models::ObservationModel< ObservationSize, ObservationScalarType, TimeType > >(
+                const unsigned int ) > getThreadObservationModel = [ &threadObservationSimulators, observableType, linkEnds ](
+            const unsigned int threadIndex )
+    {
+        std::shared_ptr< observation_models::ObservationSimulator< ObservationSize, ObservationScalarType, TimeType > > observationSimulator =
+                observation_models::getObservationSimulatorOfType< ObservationSize >(
+                    threadObservationSimulators.at( threadIndex ), observableType );
+        if( observationSimulator == nullptr )
+        {
+            throw std::runtime_error( "Error when simulating observations in parallel: dynamic cast to size " +
+                                      std::to_string( ObservationSize ) + " is nullptr" );
+        }
+        return observationSimulator->getObservationModel( linkEnds );
+    };
+
+    std::function< std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >( ) > createObservationSet;
+    if( std::dynamic_pointer_cast< TabulatedObservationSimulationSettings< TimeType > >( observationsToSimulate ) != nullptr )
+    {
+        std::shared_ptr< TabulatedObservationSimulationSettings< TimeType > > tabulatedObservationSettings =
+                std::dynamic_pointer_cast< TabulatedObservationSimulationSettings< TimeType > >( observationsToSimulate );
+        const std::vector< TimeType >& observationTimes = tabulatedObservationSettings->simulationTimes_;
+        std::shared_ptr< std::vector< SingleObservationData > > computedObservations =
+                std::make_shared< std::vector< SingleObservationData > >( observationTimes.size( ) );
+
+        // Compute observables for blocks of observation times
+        for( unsigned int startIndex = 0; startIndex < observationTimes.size( ); startIndex += numberOfObservationsPerTask )
+        {
+            unsigned int endIndex = std::min( startIndex + numberOfObservationsPerTask,
+                                              static_cast< unsigned int >( observationTimes.size( ) ) );
+            simulationTasks.push_back(
+                        [ = ]( const unsigned int threadIndex )
+            {
+                std::shared_ptr< observation_models::ObservationModel< ObservationSize, ObservationScalarType, TimeType > > observationModel =
+                        getThreadObservationModel( threadIndex );
+                for( unsigned int i = startIndex; i < endIndex; i++ )
+                {
+                    SingleObservationData& currentObservation = computedObservations->at( i );
+                    std::get< 0 >( currentObservation ) = observationModel->computeObservationsWithLinkEndData(
+                                tabulatedObservationSettings->simulationTimes_.at( i ),
+                                tabulatedObservationSettings->getReferenceLinkEndType( ),
+                                std::get< 2 >( currentObservation ), std::get< 1 >( currentObservation ),
+                                tabulatedObservationSettings->getAncilliarySettings( ) );
+                }
+            } );
+        }
+
+        // Check viability, and add noise and dependent variables, as in simulateObservationsWithCheck
+        createObservationSet = [ = ]( )
+        {
+            std::vector< std::shared_ptr< observation_models::ObservationViabilityCalculator > > viabilityCalculators =
+                    observation_models::createObservationViabilityCalculators(
+                        bodies, linkEnds, observableType, tabulatedObservationSettings->getViabilitySettingsList( ) );
+
+            std::multimap< TimeType, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > observations;
+            std::vector< Eigen::VectorXd > dependentVariables;
+            for( unsigned int i = 0; i < computedObservations->size( ); i++ )
+            {
+                const SingleObservationData& currentObservation = computedObservations->at( i );
+                std::tuple< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >, bool, Eigen::VectorXd > simulatedObservation =
+                        checkAndFinalizeSimulatedObservation< ObservationSize, ObservationScalarType, TimeType >(
+                            std::get< 0 >( currentObservation ), tabulatedObservationSettings->simulationTimes_.at( i ),
+                            std::get< 1 >( currentObservation ), std::get< 2 >( currentObservation ), observableType,
+                            viabilityCalculators, tabulatedObservationSettings->getObservationNoiseFunction( ),
+                            tabulatedObservationSettings->getDependentVariableCalculator( ),
+                            tabulatedObservationSettings->getAncilliarySettings( ) );
+                if( std::get< 1 >( simulatedObservation ) )
+                {
+                    observations.insert( { tabulatedObservationSettings->simulationTimes_.at( i ), std::get< 0 >( simulatedObservation ) } );
+                    dependentVariables.push_back( std::get< 2 >( simulatedObservation ) );
+                }
+            }
+
+            return std::make_shared< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >(
+                        observableType, linkEnds,
+                        utilities::createVectorFromMultiMapValues( observations ),
+                        utilities::createVectorFromMultiMapKeys( observations ),
+                        tabulatedObservationSettings->getReferenceLinkEndType( ), dependentVariables,
+                        tabulatedObservationSettings->getDependentVariableCalculator( ),
+                        tabulatedObservationSettings->getAncilliarySettings( ) );
+        };
+    }
+    else if( std::dynamic_pointer_cast< PerArcObservationSimulationSettings< TimeType > >( observationsToSimulate ) != nullptr )
+    {
+        std::shared_ptr< PerArcObservationSimulationSettings< TimeType > > perArcObservationSettings =
+                std::dynamic_pointer_cast< PerArcObservationSimulationSettings< TimeType > >( observationsToSimulate );
+        std::shared_ptr< std::vector< std::map< TimeType, SingleObservationData > > > computedObservationArcs =
+                std::make_shared< std::vector< std::map< TimeType, SingleObservationData > > >( );
+
+        // Arcs depend on preceding observations, so are computed in a single task
+        std::shared_ptr< std::vector< std::shared_ptr< observation_models::ObservationViabilityCalculator > > > arcDefiningViabilityCalculators =
+                std::make_shared< std::vector< std::shared_ptr< observation_models::ObservationViabilityCalculator > > >(
+                    observation_models::createObservationViabilityCalculators(
+                        bodies, linkEnds, observableType, { perArcObservationSettings->arcDefiningConstraint_ } ) );
+        simulationTasks.push_back(
+                    [ = ]( const unsigned int threadIndex )
+        {
+            *computedObservationArcs = computePerArcObservationArcs< ObservationScalarType, TimeType, ObservationSize >(
+                        perArcObservationSettings, getThreadObservationModel( threadIndex ), *arcDefiningViabilityCalculators );
+        } );
+
+        createObservationSet = [ = ]( )
+        {
+            return createPerArcSingleObservationSet< ObservationScalarType, TimeType, ObservationSize >(
+                        perArcObservationSettings, *computedObservationArcs, bodies );
+        };
+    }
+    else
+    {
+        createObservationSet = [ ]( )
+        {
+            return std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >( );
+        };
+    }
+
+    return createObservationSet;
+}
+
+//! Function to check whether an ephemeris is known to be safe for concurrent evaluation from multiple threads
+/*!
+ *  Function to check whether an ephemeris is known to be safe for concurrent evaluation from multiple threads, i.e. whether
+ *  it is evaluated without modifying any shared state. This is the case for tabulated, constant and Kepler ephemerides,
+ *  and for multi-arc ephemerides for which all single-arc ephemerides are safe. All other ephemerides (e.g. SPICE,
+ *  custom and composite ephemerides) are considered to be unsafe.
+ *  \param ephemeris Ephemeris that is to be checked (nullptr is considered safe)
+ *  \return True if the ephemeris can be evaluated concurrently
+ */
+bool isEphemerisThreadSafe( const std::shared_ptr< ephemerides::Ephemeris > ephemeris );
+
+//! Function to check whether a rotation model is known to be safe for concurrent evaluation from multiple threads
+/*!
+ *  Function to check whether a rotation model is known to be safe for concurrent evaluation from multiple threads, i.e.
+ *  whether it is evaluated without modifying any shared state. This is the case for simple and constant rotation models,
+ *  provided that the per-epoch cache (see RotationalEphemeris::setUseEpochCache) is disabled. All other rotation models
+ *  (e.g. SPICE, tabulated, custom and high-accuracy Earth rotation models) are considered to be unsafe.
+ *  \param rotationalEphemeris Rotation model that is to be checked (nullptr is considered safe)
+ *  \return True if the rotation model can be evaluated concurrently
+ */
+bool isRotationalEphemerisThreadSafe( const std::shared_ptr< ephemerides::RotationalEphemeris > rotationalEphemeris );
+
+//! Function to check whether a ground station motion model is known to be safe for concurrent evaluation
+/*!
+ *  Function to check whether a ground station motion model is known to be safe for concurrent evaluation from multiple
+ *  threads. This is the case for linear station motion, and for combined station motion models for which all constituent
+ *  models are safe. All other models (e.g. piecewise constant, custom and body-deformation station motion) are considered
+ *  to be unsafe.
+ *  \param stationMotionModel Station motion model that is to be checked (nullptr is considered safe)
+ *  \return True if the station motion model can be evaluated concurrently
+ */
+bool isStationMotionModelThreadSafe( const std::shared_ptr< ground_stations::StationMotionModel > stationMotionModel );
+
+//! Function to retrieve the environment models that cannot be evaluated concurrently from multiple threads
+/*!
+ *  Function to retrieve the environment models of a set of bodies that are not known to be safe for concurrent evaluation
+ *  from multiple threads (see isEphemerisThreadSafe and isRotationalEphemerisThreadSafe), such as ephemerides and
+ *  rotation models that are evaluated directly from SPICE (which is not thread-safe), rotation models for which the
+ *  per-epoch cache is enabled, and ground stations with station motion models other than linear ones. Note that the
+ *  states of bodies are retrieved by the observation models without modifying the Body objects (see
+ *  Body::getStateInBaseFrameFromEphemeris), so that only the underlying models need to be checked. Unsafe models
+ *  should be replaced by (for instance) tabulated ephemerides and simple rotation models before simulating observations
+ *  or computing partials on multiple threads.
+ *  \param bodies System of bodies
+ *  \return Description of each of the environment models that cannot be evaluated concurrently (empty if none)
+ */
+std::vector< std::string > getThreadUnsafeEnvironmentModels( const SystemOfBodies& bodies );
+
+//! Function to determine the number of threads with which the environment can be evaluated concurrently
+/*!
+ *  Function to determine the number of threads with which the environment models of a set of bodies can be evaluated
+ *  concurrently. If more than one thread is requested, and any of the environment models cannot be evaluated
+ *  concurrently (see getThreadUnsafeEnvironmentModels), a warning is printed and a single thread is used.
+ *  \param bodies System of bodies
+ *  \param numberOfThreads Number of threads that is requested
+ *  \return Number of threads that is to be used
+ */
+unsigned int getNumberOfThreadsForEnvironmentEvaluation( const SystemOfBodies& bodies,
+                                                         const unsigned int numberOfThreads );
+
+//! Function to simulate observations from set of observables and link and sets, using multiple threads
+/*!
+ *  Function to simulate observations from set of observables, link ends and observation time settings, using multiple
+ *  threads. The computation of the observables is distributed over the threads, in blocks of observation times (for
+ *  tabulated observation settings) or per observation set (for per-arc observation settings, which are computed
+ *  sequentially). Since observation models store the state of the most recent computation, a separate set of observation
+ *  models is created for each thread from the observation model settings. The viability checks, noise and dependent
+ *  variables are computed after the observables, on a single thread, in the same order as done by simulateObservations,
+ *  such that the resulting observation collection is identical to the one produced by simulateObservations (also when
+ *  using random noise functions).
+ *
+ *  The environment models (e.g. ephemerides and rotation models) are evaluated concurrently from the different threads.
+ *  If any of these models is not known to be safe for concurrent evaluation (e.g. ephemerides and rotation models evaluated
+ *  directly from SPICE, see getThreadUnsafeEnvironmentModels), the observations are simulated on a single thread.
+ *  \param observationsToSimulate List of observation time settings per link end set per observable type.
+ *  \param observationModelSettings List of settings for the observation models, from which the observation models for
+ *  each thread are created.
+ *  \param bodies System of bodies
+ *  \param numberOfThreads Number of threads to use (0 to use all hardware threads)
+ *  \param numberOfObservationsPerTask Number of tabulated observation times that are computed in a single task
+ *  \return Simulated observation values and associated times for requested observable types and link end sets.
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > simulateObservationsInParallel(
+        const std::vector< std::shared_ptr< ObservationSimulationSettings< TimeType > > >& observationsToSimulate,
+        const std::vector< std::shared_ptr< observation_models::ObservationModelSettings > >& observationModelSettings,
+        const SystemOfBodies& bodies,
+        const unsigned int numberOfThreads = 0,
+        const unsigned int numberOfObservationsPerTask = 100 )
+{
+    if( numberOfObservationsPerTask == 0 )
+    {
+        throw std::runtime_error( "Error when simulating observations in parallel, number of observations per task must be positive" );
+    }
+
+    // Create tasks to compute observables, and functions to create observation sets from computed observables
+    std::vector< std::vector< std::shared_ptr< observation_models::ObservationSimulatorBase< ObservationScalarType, TimeType > > > >
+            threadObservationSimulators;
+    std::vector< std::function< void( const unsigned int ) > > simulationTasks;
+    std::vector< std::function< std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >( ) > >
+            observationSetCreationFunctions;
+    for( unsigned int i = 0; i < observationsToSimulate.size( ); i++ )
+    {
+        int observationSize = observation_models::getObservableSize( observationsToSimulate.at( i )->getObservableType( ) );
+        switch( observationSize )
+        {
+        case 1:
+            observationSetCreationFunctions.push_back(
+                        createParallelObservationSetSimulationTasks< ObservationScalarType, TimeType, 1 >(
+                            observationsToSimulate.at( i ), threadObservationSimulators, bodies,
+                            numberOfObservationsPerTask, simulationTasks ) );
+            break;
+        case 2:
+            observationSetCreationFunctions.push_back(
+                        createParallelObservationSetSimulationTasks< ObservationScalarType, TimeType, 2 >(
+                            observationsToSimulate.at( i ), threadObservationSimulators, bodies,
+                            numberOfObservationsPerTask, simulationTasks ) );
+            break;
+        case 3:
+            observationSetCreationFunctions.push_back(
+                        createParallelObservationSetSimulationTasks< ObservationScalarType, TimeType, 3 >(
+                            observationsToSimulate.at( i ), threadObservationSimulators, bodies,
+                            numberOfObservationsPerTask, simulationTasks ) );
+            break;
+        default:
+            throw std::runtime_error( "Error, simulation of observations not yet implemented for size " +
+                                      std::to_string( observationSize ) );
+        }
+    }
+
+    // Create observation models for each thread
+    unsigned int numberOfThreadsToUse = utilities::getNumberOfThreadsToUse( numberOfThreads, simulationTasks.size( ) );
+    numberOfThreadsToUse = getNumberOfThreadsForEnvironmentEvaluation( bodies, numberOfThreadsToUse );
+    for( unsigned int i = 0; i < numberOfThreadsToUse; i++ )
+    {
+        threadObservationSimulators.push_back(
+                    observation_models::createObservationSimulators< ObservationScalarType, TimeType >(
+                        observationModelSettings, bodies ) );
+    }
+
+    // Compute observables, distributing tasks over threads
+    utilities::parallelFor( numberOfThreadsToUse, [ & ]( const unsigned int threadIndex )
+    {
+        for( unsigned int i = threadIndex; i < simulationTasks.size( ); i += numberOfThreadsToUse )
+        {
+            simulationTasks.at( i )( threadIndex );
+        }
+    }, numberOfThreadsToUse );
+
+    // Create observation sets, in same order as serial simulation
+    typename observation_models::ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets sortedObservations;
+    for( unsigned int i = 0; i < observationsToSimulate.size( ); i++ )
+    {
+        sortedObservations[ observationsToSimulate.at( i )->getObservableType( ) ][
+                observationsToSimulate.at( i )->getLinkEnds( ).linkEnds_ ].push_back(
+                    observationSetCreationFunctions.at( i )( ) );
+    }
+
+    return std::make_shared< observation_models::ObservationCollection< ObservationScalarType, TimeType > >( sortedObservations );
+}
+
 template< typename ObservationScalarType = double, typename TimeType = double >
 std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > setExistingObservations(
         const std::map< observation_models::ObservableType, std::pair< observation_models::LinkEnds,
@@ -35,6 +35,69 @@ namespace tudat
 namespace propagators
 {
 
+//! Settings for the (compressed) storage of the state transition and sensitivity matrix histories
+/*!
+ *  Settings for the storage of the state transition and sensitivity matrix histories, from which the matrices are
+ *  interpolated when computing the observation partials. By default, the matrices are stored at each epoch of the
+ *  numerical solution, in double precision, and interpolated with a cubic Lagrange interpolator. To reduce the memory
+ *  that is required for large parameter vectors (e.g. gravity field coefficients), the matrices may be stored at a
+ *  subset of the epochs (using a higher-order interpolator), and the sensitivity matrix may be stored in single
+ *  precision. The error that is introduced by the compression can be controlled by comparing the interpolated matrices
+ *  to the numerical solution at all epochs: if the error is too large, the tabulation step is reduced (and, if
+ *  required, double precision is used).
+ */
+class StateTransitionMatrixStorageSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param tabulationStepMultiple Number of epochs of the numerical solution per tabulated epoch (the first and last
+     *  epochs are always tabulated)
+     *  \param numberOfInterpolationPoints Number of data points used by the Lagrange interpolator (must be even)
+     *  \param useSinglePrecisionSensitivityMatrix Boolean denoting whether the sensitivity matrix is stored in single
+     *  precision
+     *  \param maximumRelativeError Maximum interpolation error of the (compressed) matrices at the epochs of the
+     *  numerical solution, relative to the maximum absolute value of the corresponding column of the matrix over the
+     *  full propagation. If equal to or smaller than 0, the error is not checked.
+     */
+    StateTransitionMatrixStorageSettings(
+            const int tabulationStepMultiple = 1,
+            const int numberOfInterpolationPoints = 4,
+            const bool useSinglePrecisionSensitivityMatrix = false,
+            const double maximumRelativeError = 0.0 ):
+        tabulationStepMultiple_( tabulationStepMultiple ),
+        numberOfInterpolationPoints_( numberOfInterpolationPoints ),
+        useSinglePrecisionSensitivityMatrix_( useSinglePrecisionSensitivityMatrix ),
+        maximumRelativeError_( maximumRelativeError )
+    {
+        if( tabulationStepMultiple_ < 1 )
+        {
+            throw std::runtime_error( "Error when creating state transition matrix storage settings, tabulation step multiple must be at least 1" );
+        }
+
+        if( numberOfInterpolationPoints_ < 2 || numberOfInterpolationPoints_ % 2 != 0 )
+        {
+            throw std::runtime_error( "Error when creating state transition matrix storage settings, number of interpolation points must be even" );
+        }
+    }
+
+    //! Destructor
+    virtual ~StateTransitionMatrixStorageSettings( ){ }
+
+    //! Number of epochs of the numerical solution per tabulated epoch
+    int tabulationStepMultiple_;
+
+    //! Number of data points used by the Lagrange interpolator
+    int numberOfInterpolationPoints_;
+
+    //! Boolean denoting whether the sensitivity matrix is stored in single precision
+    bool useSinglePrecisionSensitivityMatrix_;
+
+    //! Maximum relative interpolation error at the epochs of the numerical solution (not checked if <= 0)
+    double maximumRelativeError_;
+};
 
 //! Base class to manage and execute the numerical integration of equations of motion and variational equations.
 /*!
@@ -138,6 +201,24 @@ public:
 
     virtual std::shared_ptr< SimulationResults< StateScalarType, TimeType > > getVariationalPropagationResults( ) = 0;
 
+    //! Function to set the settings for the storage of the state transition and sensitivity matrix histories
+    /*!
+     *  Function to set the settings for the (compressed) storage of the state transition and sensitivity matrix
+     *  histories, which are used from the next integration of the variational equations onwards.
+     *  \param storageSettings Settings for the storage of the matrix histories (nullptr for default storage)
+     */
+    virtual void setStateTransitionMatrixStorageSettings(
+            const std::shared_ptr< StateTransitionMatrixStorageSettings > storageSettings )
+    {
+        stateTransitionMatrixStorageSettings_ = storageSettings;
+    }
+
+    //! Function to retrieve the settings for the storage of the state transition and sensitivity matrix histories
+    std::shared_ptr< StateTransitionMatrixStorageSettings > getStateTransitionMatrixStorageSettings( )
+    {
+        return stateTransitionMatrixStorageSettings_;
+    }
+
 
 protected:
 
@@ -211,6 +292,9 @@ protected:
 
     //! Object used for interpolating numerical results of state transition and sensitivity matrix.
     std::shared_ptr< CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionInterface_;
+
+    //! Settings for the storage of the state transition and sensitivity matrix histories (nullptr for default storage)
+    std::shared_ptr< StateTransitionMatrixStorageSettings > stateTransitionMatrixStorageSettings_;
 };
 
 //! Function to separate the time histories of the sensitivity and state transition matrices from a full numerical solution.
@@ -271,6 +355,7 @@ void setVariationalEquationsSolution(
  *  is state transition matrix history, second entry is sensitivity matrix history.
  * \param clearRawSolution Boolean denoting whether to clear entries of variationalEquationsSolution after creation
  * of interpolators.
+ * \param storageSettings Settings for the (compressed) storage of the matrix histories (default storage if nullptr)
  */
 void createStateTransitionAndSensitivityMatrixInterpolator(
         std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >&
@@ -279,7 +364,8 @@ void createStateTransitionAndSensitivityMatrixInterpolator(
         sensitivityMatrixInterpolator,
         std::map< double, Eigen::MatrixXd >& stateTransitionSolution,
         std::map< double, Eigen::MatrixXd >& sensitivitySolution,
-        const bool clearRawSolution = 1 );
+        const bool clearRawSolution = 1,
+        const std::shared_ptr< StateTransitionMatrixStorageSettings > storageSettings = nullptr );
 
 //! Function to check the consistency between propagation settings of equations of motion, and estimated parameters.
 /*!
@@ -993,7 +1079,7 @@ private:
                         stateTransitionMatrixInterpolator, sensitivityMatrixInterpolator,
                         variationalPropagationResults_->getStateTransitionSolution( ),
                         variationalPropagationResults_->getSensitivitySolution( ),
-                        this->clearNumericalSolution_ );
+                        this->clearNumericalSolution_, this->stateTransitionMatrixStorageSettings_ );
 
         }
         catch( const std::exception& caughtException )
@@ -1166,7 +1252,8 @@ public:
                 propagatorSettings->getOutputSettingsWithCheck( )->getClearNumericalSolutions( ) : false  ),
         propagatorSettings_( propagatorSettings ),
         resetMultiArcDynamicsAfterPropagation_( propagatorSettings != nullptr ?
-                propagatorSettings->getOutputSettingsWithCheck( )->getSetIntegratedResult( ) : false )
+                propagatorSettings->getOutputSettingsWithCheck( )->getSetIntegratedResult( ) : false ),
+        numberOfThreads_( 1 )
     {
         if(  std::dynamic_pointer_cast< MultiArcPropagatorSettings< StateScalarType, TimeType > >( propagatorSettings ) == nullptr )
         {
@@ -1477,6 +1564,26 @@ public:
       return getMultiArcVariationalPropagationResults( );
    }
 
+    //! Function to set the number of threads used to post-process the variational equations solution of the arcs
+    /*!
+     *  Function to set the number of threads used to post-process the numerical variational equations solution of the
+     *  arcs (creation and, if requested, compression and error control of the state transition and sensitivity matrix
+     *  interpolators, see StateTransitionMatrixStorageSettings). The arcs are distributed over the threads, and the
+     *  resulting interpolators do not depend on the number of threads. The numerical integration of the arcs is not
+     *  affected, since the arcs share the environment models (e.g. body states) that are updated during propagation.
+     *  \param numberOfThreads Number of threads to use (0 to use all hardware threads)
+     */
+    void setNumberOfThreads( const unsigned int numberOfThreads )
+    {
+        numberOfThreads_ = numberOfThreads;
+    }
+
+    //! Function to retrieve the number of threads used to post-process the variational equations solution of the arcs
+    unsigned int getNumberOfThreads( ) const
+    {
+        return numberOfThreads_;
+    }
+
 protected:
 
 private:
@@ -1502,12 +1609,19 @@ private:
         // Create interpolators.
         std::vector< double > arcStartTimesToUse;
         std::vector< double > arcEndTimesToUse;
-
-        for( unsigned int i = 0; i < variationalPropagationResults_->getSingleArcResults( ).size( ); i++ )
+        unsigned int numberOfArcsToProcess = variationalPropagationResults_->getSingleArcResults( ).size( );
+        for( unsigned int i = 0; i < numberOfArcsToProcess; i++ )
         {
             arcStartTimesToUse.push_back( dynamicsSimulator_->getArcStartTimes( ).at( i ) );
             arcEndTimesToUse.push_back( dynamicsSimulator_->getArcEndTimes( ).at( i ) );
+        }
 
+        // Create interpolators of each arc (only accessing the results of that arc), storing error messages per arc
+        std::vector< std::string > arcErrorMessages( numberOfArcsToProcess );
+        std::vector< int > numberOfArcEpochs( numberOfArcsToProcess );
+        utilities::parallelFor( numberOfArcsToProcess, [ & ]( const unsigned int i )
+        {
+            numberOfArcEpochs[ i ] = variationalPropagationResults_->getSingleArcResults( ).at( i )->getStateTransitionSolution( ).size( );
             try
             {
                 createStateTransitionAndSensitivityMatrixInterpolator(
@@ -1515,17 +1629,24 @@ private:
                             sensitivityMatrixInterpolators[ i ],
                             variationalPropagationResults_->getSingleArcResults( ).at( i )->getStateTransitionSolution( ),
                             variationalPropagationResults_->getSingleArcResults( ).at( i )->getSensitivitySolution( ),
-                            this->clearNumericalSolution_ );
+                            this->clearNumericalSolution_, this->stateTransitionMatrixStorageSettings_ );
             }
             catch( const std::exception& caughtException )
+            {
+                arcErrorMessages[ i ] = caughtException.what( );
+            }
+        }, utilities::getNumberOfThreadsToUse( numberOfThreads_, numberOfArcsToProcess ) );
+
+        // Report errors in order of arcs
+        for( unsigned int i = 0; i < numberOfArcsToProcess; i++ )
+        {
+            if( arcErrorMessages.at( i ) != "" )
             {
                 std::cerr << "Error occured when post-processing multi-arc variational equation integration results, and creating interpolators in arc" + std::to_string( i ) + ", caught error is: " << std::endl << std::endl;
-                std::cerr << caughtException.what( ) << std::endl << std::endl;
+                std::cerr << arcErrorMessages.at( i ) << std::endl << std::endl;
                 std::cerr << "The problem may be that there is an insufficient number of data points (epochs) at which propagation results are produced for one or more arcs. Integrated results are given at" +
-                             std::to_string( variationalPropagationResults_->getSingleArcResults( ).at( 0 )->getStateTransitionSolution( ).size( ) ) + " epochs"<< std::endl;
+                             std::to_string( numberOfArcEpochs.at( i ) ) + " epochs"<< std::endl;
             }
-
-
         }
 
         // Create stare transition matrix interface if needed, reset otherwise.
@@ -1589,6 +1710,9 @@ private:
     //! Boolean denoting whether to reset the multi-arc dynamics after propagation.
     bool resetMultiArcDynamicsAfterPropagation_;
 
+    //! Number of threads used to post-process the variational equations solution of the arcs (0 for all hardware threads)
+    unsigned int numberOfThreads_;
+
     //! Map containing, for each arc, a vector with the names of the bodies whose initial states are to be estimated.
     std::map< int, std::vector< std::string > > estimatedBodiesPerArc_;
 
@@ -1990,6 +2114,20 @@ public:
         return propagatorSettings_;
     }
 
+    //! Function to set the settings for the storage of the state transition and sensitivity matrix histories
+    /*!
+     *  Function to set the settings for the (compressed) storage of the state transition and sensitivity matrix
+     *  histories, for both the single-arc and multi-arc variational equations.
+     *  \param storageSettings Settings for the storage of the matrix histories (nullptr for default storage)
+     */
+    void setStateTransitionMatrixStorageSettings(
+            const std::shared_ptr< StateTransitionMatrixStorageSettings > storageSettings )
+    {
+        this->stateTransitionMatrixStorageSettings_ = storageSettings;
+        singleArcSolver_->setStateTransitionMatrixStorageSettings( storageSettings );
+        multiArcSolver_->setStateTransitionMatrixStorageSettings( storageSettings );
+    }
+
     //! Function to retrieve the dynamics simulator object (as base-class pointer)
     /*!
      * Function to retrieve the dynamics simulator object (as base-class pointer). This function is not yet implemented
@@ -938,9 +938,9 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
         }
 
         variableFunction = std::bind(
-                    &aerodynamics::AerodynamicCoefficientInterface::getCurrentForceCoefficients,
+                    &aerodynamics::AtmosphericFlightConditions::getCurrentForceCoefficients,
                     std::dynamic_pointer_cast< aerodynamics::AtmosphericFlightConditions >(
-                        bodies.at( bodyWithProperty )->getFlightConditions( ) )->getAerodynamicCoefficientInterface( ) );
+                        bodies.at( bodyWithProperty )->getFlightConditions( ) ) );
         parameterSize = 3;
 
         break;
@@ -955,9 +955,9 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
         }
 
         variableFunction = std::bind(
-                    &aerodynamics::AerodynamicCoefficientInterface::getCurrentMomentCoefficients,
+                    &aerodynamics::AtmosphericFlightConditions::getCurrentMomentCoefficients,
                     std::dynamic_pointer_cast< aerodynamics::AtmosphericFlightConditions >(
-                        bodies.at( bodyWithProperty )->getFlightConditions( ) )->getAerodynamicCoefficientInterface( ) );
+                        bodies.at( bodyWithProperty )->getFlightConditions( ) ) );
         parameterSize = 3;
 
         break;
@@ -971,10 +971,14 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                     bodies, bodyWithProperty, secondaryBody );
         }
 
-        variableFunction = std::bind(
-                &aerodynamics::AerodynamicCoefficientInterface::getCurrentControlSurfaceFreeForceCoefficients,
+        std::shared_ptr< aerodynamics::AtmosphericFlightConditions > flightConditions =
                 std::dynamic_pointer_cast< aerodynamics::AtmosphericFlightConditions >(
-                        bodies.at( bodyWithProperty )->getFlightConditions( ) )->getAerodynamicCoefficientInterface( ) );
+                    bodies.at( bodyWithProperty )->getFlightConditions( ) );
+        variableFunction = [ = ]( )
+        {
+            flightConditions->updateAerodynamicCoefficients( );
+            return flightConditions->getAerodynamicCoefficientInterface( )->getCurrentControlSurfaceFreeForceCoefficients( );
+        };
         parameterSize = 3;
 
         break;
@@ -988,10 +992,14 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                     bodies, bodyWithProperty, secondaryBody );
         }
 
-        variableFunction = std::bind(
-                &aerodynamics::AerodynamicCoefficientInterface::getCurrentControlSurfaceFreeMomentCoefficients,
+        std::shared_ptr< aerodynamics::AtmosphericFlightConditions > flightConditions =
                 std::dynamic_pointer_cast< aerodynamics::AtmosphericFlightConditions >(
-                        bodies.at( bodyWithProperty )->getFlightConditions( ) )->getAerodynamicCoefficientInterface( ) );
+                    bodies.at( bodyWithProperty )->getFlightConditions( ) );
+        variableFunction = [ = ]( )
+        {
+            flightConditions->updateAerodynamicCoefficients( );
+            return flightConditions->getAerodynamicCoefficientInterface( )->getCurrentControlSurfaceFreeMomentCoefficients( );
+        };
         parameterSize = 3;
 
         break;
@@ -1014,11 +1022,16 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                         bodies, bodyWithProperty, secondaryBody );
             }
 
-            variableFunction = std::bind(
-                    &aerodynamics::AerodynamicCoefficientInterface::getCurrentForceCoefficientIncrement,
+            std::shared_ptr< aerodynamics::AtmosphericFlightConditions > flightConditions =
                     std::dynamic_pointer_cast< aerodynamics::AtmosphericFlightConditions >(
-                            bodies.at( bodyWithProperty )->getFlightConditions( ) )->getAerodynamicCoefficientInterface( ),
-                            controlSurfaceVariabelSettings->controlSurfaceName_ );
+                        bodies.at( bodyWithProperty )->getFlightConditions( ) );
+            std::string controlSurfaceName = controlSurfaceVariabelSettings->controlSurfaceName_;
+            variableFunction = [ = ]( )
+            {
+                flightConditions->updateAerodynamicCoefficients( );
+                return flightConditions->getAerodynamicCoefficientInterface( )->getCurrentForceCoefficientIncrement(
+                            controlSurfaceName );
+            };
             parameterSize = 3;
         }
         break;
@@ -1041,11 +1054,16 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
                         bodies, bodyWithProperty, secondaryBody );
             }
 
-            variableFunction = std::bind(
-                    &aerodynamics::AerodynamicCoefficientInterface::getCurrentMomentCoefficientIncrement,
+            std::shared_ptr< aerodynamics::AtmosphericFlightConditions > flightConditions =
                     std::dynamic_pointer_cast< aerodynamics::AtmosphericFlightConditions >(
-                            bodies.at( bodyWithProperty )->getFlightConditions( ) )->getAerodynamicCoefficientInterface( ),
-                    controlSurfaceVariabelSettings->controlSurfaceName_ );
+                        bodies.at( bodyWithProperty )->getFlightConditions( ) );
+            std::string controlSurfaceName = controlSurfaceVariabelSettings->controlSurfaceName_;
+            variableFunction = [ = ]( )
+            {
+                flightConditions->updateAerodynamicCoefficients( );
+                return flightConditions->getAerodynamicCoefficientInterface( )->getCurrentMomentCoefficientIncrement(
+                            controlSurfaceName );
+            };
             parameterSize = 3;
         }
         break;
@@ -91,7 +91,9 @@ AtmosphericFlightConditions::AtmosphericFlightConditions(
     FlightConditions( shapeModel, centralBodyName, aerodynamicAngleCalculator ),
     atmosphereModel_( atmosphereModel ),
     aerodynamicCoefficientInterface_( aerodynamicCoefficientInterface ),
-    controlSurfaceDeflectionFunction_( controlSurfaceDeflectionFunction )
+    controlSurfaceDeflectionFunction_( controlSurfaceDeflectionFunction ),
+    isAerodynamicCoefficientInputComputed_( false ),
+    areAerodynamicCoefficientsUpdated_( false )
 {
 
     if(  aerodynamicAngleCalculator_== nullptr )
@@ -134,22 +136,36 @@ void AtmosphericFlightConditions::updateConditions( const double currentTime )
         // Calculate state of vehicle in global frame and corotating frame.
         currentBodyCenteredAirspeedBasedBodyFixedState_ = bodyCenteredPseudoBodyFixedStateFunction_( );
 
-        updateAerodynamicCoefficientInput( );
+        resetAerodynamicCoefficientStatus( );
 
-        // Update angles from aerodynamic to body-fixed frame (if relevant).
+        // Update angles from aerodynamic to body-fixed frame (if relevant). The coefficient input may be computed
+        // during this update (e.g. for trim), in which case it is to be recomputed using the updated angles.
         if( aerodynamicAngleCalculator_!= nullptr )
         {
             aerodynamicAngleCalculator_->update( currentTime, true );
-            updateAerodynamicCoefficientInput( );
+            resetAerodynamicCoefficientStatus( );
         }
+    }
+}
 
-        // Update aerodynamic coefficients.
-        if( aerodynamicCoefficientInterface_ != nullptr )
+//! Function to update the aerodynamic coefficients to the current flight conditions (computing input if needed)
+void AtmosphericFlightConditions::computeAerodynamicCoefficients( )
+{
+    if( aerodynamicCoefficientInterface_ != nullptr )
+    {
+        if( !isAerodynamicCoefficientInputComputed_ )
         {
-            aerodynamicCoefficientInterface_->updateFullCurrentCoefficients(
-                        aerodynamicCoefficientIndependentVariables_, controlSurfaceAerodynamicCoefficientIndependentVariables_,
-                        currentTime_ );
+            updateAerodynamicCoefficientInput( );
         }
+
+        aerodynamicCoefficientInterface_->updateFullCurrentCoefficients(
+                    aerodynamicCoefficientIndependentVariables_, controlSurfaceAerodynamicCoefficientIndependentVariables_,
+                    currentTime_ );
+    }
+
+    if( currentTime_ == currentTime_ )
+    {
+        areAerodynamicCoefficientsUpdated_ = true;
     }
 }
 
@@ -297,6 +313,11 @@ void AtmosphericFlightConditions::updateAerodynamicCoefficientInput( )
             }
         }
     }
+
+    if( currentTime_ == currentTime_ )
+    {
+        isAerodynamicCoefficientInputComputed_ = true;
+    }
 }
 
 } // namespace aerodynamics
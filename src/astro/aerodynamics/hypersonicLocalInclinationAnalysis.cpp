@@ -19,6 +19,7 @@
 
 
 #include <functional>
+#include <boost/filesystem.hpp>
 #include <boost/lambda/lambda.hpp>
 
 #include <boost/pointer_cast.hpp>
@@ -33,6 +34,7 @@
 #include "tudat/math/geometric/compositeSurfaceGeometry.h"
 #include "tudat/math/geometric/surfaceGeometry.h"
 #include "tudat/io/basicInputOutput.h"
+#include "tudat/basics/utilities.h"
 
 namespace tudat
 {
@@ -44,6 +46,12 @@ using mathematical_constants::PI;
 
 using namespace geometric_shapes;
 
+//! File identifier of HypersonicLocalInclinationAnalysis coefficient cache file
+static const char hypersonicLocalInclinationCacheFileIdentifier[ 9 ] = "TUDATHLI";
+
+//! Byte order marker of HypersonicLocalInclinationAnalysis coefficient cache file
+static const uint32_t hypersonicLocalInclinationCacheByteOrderMarker = 0x01020304;
+
 //! Returns default values of mach number for use in HypersonicLocalInclinationAnalysis.
 std::vector< double > getDefaultHypersonicLocalInclinationMachPoints(
         const std::string& machRegime )
@@ -177,15 +185,18 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
         const double referenceArea,
         const double referenceLength,
         const Eigen::Vector3d& momentReferencePoint,
-        const bool savePressureCoefficients )
+        const bool savePressureCoefficients,
+        const unsigned int numberOfThreads,
+        const std::string& cacheDirectory )
     : AerodynamicCoefficientGenerator< 3, 6 >(
           dataPointsOfIndependentVariables, referenceLength, referenceArea,
           momentReferencePoint, { mach_number_dependent, angle_of_attack_dependent, angle_of_sideslip_dependent },
           positive_aerodynamic_frame_coefficients, positive_aerodynamic_frame_coefficients ),
-      stagnationPressureCoefficient( 2.0 ),
       ratioOfSpecificHeats( 1.4 ),
       selectedMethods_( selectedMethods ),
-      savePressureCoefficients_( savePressureCoefficients )
+      savePressureCoefficients_( savePressureCoefficients ),
+      numberOfThreads_( numberOfThreads ),
+      areCoefficientsLoadedFromCache_( false )
 {
     // Set geometry if it is a single surface.
     if ( std::dynamic_pointer_cast< SingleSurfaceGeometry > ( inputVehicleSurface ) !=
@@ -255,17 +266,17 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
         }
     }
 
-    // Allocate memory for panel inclinations and pressureCoefficient_.
-    inclination_.resize( vehicleParts_.size( ) );
-    pressureCoefficient_.resize( vehicleParts_.size( ) );
-    for ( unsigned int i = 0 ; i < vehicleParts_.size( ); i++ )
+    // Set panel data in contiguous form, and precompute panel inclinations for all attitudes.
+    setPanelData( );
+    unsigned int numberOfAnglesOfSideslip = dataPointsOfIndependentVariables_[ 2 ].size( );
+    panelInclinations_.resize( dataPointsOfIndependentVariables_[ 1 ].size( ) * numberOfAnglesOfSideslip );
+    for( unsigned int i = 0; i < dataPointsOfIndependentVariables_[ 1 ].size( ); i++ )
     {
-        inclination_[ i ].resize( vehicleParts_[ i ]->getNumberOfLines( ) );
-        pressureCoefficient_[ i ].resize( vehicleParts_[ i ]->getNumberOfLines( ) );
-        for ( int j = 0 ; j < vehicleParts_[ i ]->getNumberOfLines( ) ; j++ )
+        for( unsigned int j = 0; j < numberOfAnglesOfSideslip; j++ )
         {
-            inclination_[ i ][ j ].resize( vehicleParts_[ i ]->getNumberOfPoints( ) );
-            pressureCoefficient_[ i ][ j ].resize( vehicleParts_[ i ]->getNumberOfPoints( ) );
+            computePanelInclinations( dataPointsOfIndependentVariables_[ 1 ][ i ],
+                                      dataPointsOfIndependentVariables_[ 2 ][ j ],
+                                      panelInclinations_[ i * numberOfAnglesOfSideslip + j ] );
         }
     }
 
@@ -277,11 +288,32 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
     }
 
     isCoefficientGenerated_.resize( numberOfPointsPerIndependentVariables );
-
     std::fill( isCoefficientGenerated_.origin( ),
                isCoefficientGenerated_.origin( ) + isCoefficientGenerated_.num_elements( ), 0 );
 
-    generateCoefficients( );
+    // Determine name of cache file, and load coefficients from it, if possible.
+    analysisHash_ = computeAnalysisHash( );
+    if( cacheDirectory != "" )
+    {
+        std::stringstream hashStream;
+        hashStream << std::hex << std::setw( 16 ) << std::setfill( '0' ) << analysisHash_;
+        coefficientCacheFile_ = ( boost::filesystem::path( cacheDirectory ) /
+                                  ( "hypersonicLocalInclinationAnalysis_" + hashStream.str( ) + ".bin" ) ).string( );
+        if( !savePressureCoefficients_ )
+        {
+            areCoefficientsLoadedFromCache_ = readCoefficientsFromCacheFile( );
+        }
+    }
+
+    if( !areCoefficientsLoadedFromCache_ )
+    {
+        generateCoefficients( );
+        if( coefficientCacheFile_ != "" )
+        {
+            writeCoefficientsToCacheFile( );
+        }
+    }
+
     createInterpolator( );
 }
 
@@ -301,27 +333,41 @@ Vector6d HypersonicLocalInclinationAnalysis::getAerodynamicCoefficientsDataPoint
 //! Generate aerodynamic database.
 void HypersonicLocalInclinationAnalysis::generateCoefficients( )
 {
-    // Allocate variable to pass to coefficient determination for independent
-    // variable indices.
-    boost::array< int, 3 > independentVariableIndices;
-
-    // Iterate over all combinations of independent variables.
-    for ( unsigned int i = 0 ; i < dataPointsOfIndependentVariables_[ 0 ].size( ) ; i++ )
+    unsigned int numberOfMachNumbers = dataPointsOfIndependentVariables_[ 0 ].size( );
+    unsigned int numberOfAnglesOfAttack = dataPointsOfIndependentVariables_[ 1 ].size( );
+    unsigned int numberOfAnglesOfSideslip = dataPointsOfIndependentVariables_[ 2 ].size( );
+    unsigned int numberOfDataPoints = numberOfMachNumbers * numberOfAnglesOfAttack * numberOfAnglesOfSideslip;
+
+    // Compute coefficients at all combinations of independent variables; each data point only modifies its own entries
+    // of the coefficient arrays, so that the data points can be computed concurrently.
+    std::vector< std::vector< Eigen::VectorXd > > pressureCoefficientsPerDataPoint(
+                savePressureCoefficients_ ? numberOfDataPoints : 0 );
+    utilities::parallelFor(
+                numberOfDataPoints, [ & ]( const unsigned int dataPointIndex )
     {
-        independentVariableIndices[ 0 ] = i;
-        for ( unsigned  int j = 0 ; j < dataPointsOfIndependentVariables_[
-              1 ].size( ) ; j++ )
+        boost::array< int, 3 > independentVariableIndices;
+        independentVariableIndices[ 0 ] = dataPointIndex / ( numberOfAnglesOfAttack * numberOfAnglesOfSideslip );
+        independentVariableIndices[ 1 ] = ( dataPointIndex / numberOfAnglesOfSideslip ) % numberOfAnglesOfAttack;
+        independentVariableIndices[ 2 ] = dataPointIndex % numberOfAnglesOfSideslip;
+
+        std::vector< Eigen::VectorXd > pressureCoefficients;
+        aerodynamicCoefficients_( independentVariableIndices ) =
+                computeVehicleCoefficients( independentVariableIndices, pressureCoefficients );
+        isCoefficientGenerated_( independentVariableIndices ) = 1;
+        if( savePressureCoefficients_ )
         {
-            independentVariableIndices[ 1 ] = j;
-            for ( unsigned  int k = 0 ; k < dataPointsOfIndependentVariables_[
-                  2 ].size( ) ; k++ )
-            {
-                independentVariableIndices[ 2 ] = k;
-
-                determineVehicleCoefficients( independentVariableIndices );
-            }
-
+            pressureCoefficientsPerDataPoint[ dataPointIndex ] = pressureCoefficients;
         }
+    }, numberOfThreads_ );
+
+    // Save pressure coefficients, if required.
+    for( unsigned int i = 0; i < pressureCoefficientsPerDataPoint.size( ); i++ )
+    {
+        boost::array< int, 3 > independentVariableIndices;
+        independentVariableIndices[ 0 ] = i / ( numberOfAnglesOfAttack * numberOfAnglesOfSideslip );
+        independentVariableIndices[ 1 ] = ( i / numberOfAnglesOfSideslip ) % numberOfAnglesOfAttack;
+        independentVariableIndices[ 2 ] = i % numberOfAnglesOfSideslip;
+        setPressureCoefficientList( independentVariableIndices, pressureCoefficientsPerDataPoint[ i ] );
     }
 }
 
@@ -329,180 +375,170 @@ void HypersonicLocalInclinationAnalysis::generateCoefficients( )
 void HypersonicLocalInclinationAnalysis::determineVehicleCoefficients(
         const boost::array< int, 3 > independentVariableIndices )
 {
-    // Declare coefficients vector and initialize to zeros.
-    Vector6d coefficients = Vector6d::Zero( );
-
-    // Loop over all vehicle parts, calculate aerodynamic coefficients and add
-    // to aerodynamicCoefficients_.
-    for ( unsigned int i = 0 ; i < vehicleParts_.size( ) ; i++ )
-    {
-        coefficients += determinePartCoefficients( i, independentVariableIndices );
-    }
+    std::vector< Eigen::VectorXd > pressureCoefficients;
+    aerodynamicCoefficients_( independentVariableIndices ) =
+            computeVehicleCoefficients( independentVariableIndices, pressureCoefficients );
 
     if( savePressureCoefficients_ )
     {
-        pressureCoefficientList_[ independentVariableIndices ] = pressureCoefficient_;
+        setPressureCoefficientList( independentVariableIndices, pressureCoefficients );
     }
 
-    aerodynamicCoefficients_( independentVariableIndices ) = coefficients;
     isCoefficientGenerated_( independentVariableIndices ) = 1;
 }
 
-//! Determine aerodynamic coefficients of a single vehicle part.
-Vector6d HypersonicLocalInclinationAnalysis::determinePartCoefficients(
-        const int partNumber, const boost::array< int, 3 > independentVariableIndices )
+//! Save the pressure coefficients at a single set of independent variables.
+void HypersonicLocalInclinationAnalysis::setPressureCoefficientList(
+        const boost::array< int, 3 > independentVariableIndices,
+        const std::vector< Eigen::VectorXd >& pressureCoefficients )
 {
-    // Declare and determine angles of attack and sideslip for analysis.
-    double angleOfAttack =  dataPointsOfIndependentVariables_[ 1 ]
-            [ independentVariableIndices[ 1 ] ];
-
-    double angleOfSideslip =  dataPointsOfIndependentVariables_[ 2 ]
-            [ independentVariableIndices[ 2 ] ];
-
-    // Declare partCoefficient vector.
-    Vector6d partCoefficients = Vector6d::Zero( );
-
-    // Check whether the inclinations of the vehicle part have already been computed.
-    if ( previouslyComputedInclinations_.count( std::pair< double, double >(
-                                                    angleOfAttack, angleOfSideslip ) ) == 0 )
-    {
-        // Determine panel inclinations for part.
-        determineInclinations( angleOfAttack, angleOfSideslip );
-
-        // Add panel inclinations to container
-        previouslyComputedInclinations_[ std::pair< double, double >(
-                    angleOfAttack, angleOfSideslip ) ] = inclination_;
-    }
-
-    else
+    // Convert pressure coefficients to part-line-point ordering.
+    std::vector< std::vector< std::vector< double > > > pressureCoefficientsPerPanel( vehicleParts_.size( ) );
+    for ( unsigned int i = 0 ; i < vehicleParts_.size( ) ; i++ )
     {
-        // Fetch inclinations from container
-        inclination_ = previouslyComputedInclinations_[ std::pair< double, double >(
-                    angleOfAttack, angleOfSideslip ) ];
+        int numberOfLines = vehicleParts_[ i ]->getNumberOfLines( );
+        int numberOfPoints = vehicleParts_[ i ]->getNumberOfPoints( );
+        pressureCoefficientsPerPanel[ i ].resize(
+                    numberOfLines, std::vector< double >( numberOfPoints, 0.0 ) );
+        for ( int j = 0 ; j < numberOfLines - 1 ; j++ )
+        {
+            for ( int k = 0 ; k < numberOfPoints - 1 ; k++ )
+            {
+                pressureCoefficientsPerPanel[ i ][ j ][ k ] =
+                        pressureCoefficients[ i ]( j * ( numberOfPoints - 1 ) + k );
+            }
+        }
     }
+    pressureCoefficientList_[ independentVariableIndices ] = pressureCoefficientsPerPanel;
+}
 
-    // Set pressureCoefficient_ array for given independent variables.
-    determinePressureCoefficients( partNumber, independentVariableIndices );
+//! Compute aerodynamic coefficients at a single set of independent variables.
+Vector6d HypersonicLocalInclinationAnalysis::computeVehicleCoefficients(
+        const boost::array< int, 3 > independentVariableIndices,
+        std::vector< Eigen::VectorXd >& pressureCoefficients ) const
+{
+    // Retrieve Mach number and (precomputed) panel inclinations.
+    double machNumber = dataPointsOfIndependentVariables_[ 0 ][ independentVariableIndices[ 0 ] ];
+    const std::vector< Eigen::VectorXd >& inclinations = panelInclinations_.at(
+                independentVariableIndices[ 1 ] * dataPointsOfIndependentVariables_[ 2 ].size( ) +
+            independentVariableIndices[ 2 ] );
 
-    // Calculate force coefficients from pressure coefficients.
-    partCoefficients.segment( 0, 3 ) = calculateForceCoefficients( partNumber );
+    // Declare coefficients vector and initialize to zeros.
+    Vector6d coefficients = Vector6d::Zero( );
 
-    // Calculate moment coefficients from pressure coefficients.
-    partCoefficients.segment( 3, 3 ) = calculateMomentCoefficients( partNumber );
+    // Loop over all vehicle parts, calculate aerodynamic coefficients and add
+    // to coefficients.
+    pressureCoefficients.resize( vehicleParts_.size( ) );
+    for ( unsigned int i = 0 ; i < vehicleParts_.size( ) ; i++ )
+    {
+        determinePressureCoefficients( machNumber, i, inclinations[ i ], pressureCoefficients[ i ] );
+        coefficients += calculatePartCoefficients( i, pressureCoefficients[ i ] );
+    }
 
-    return partCoefficients;
+    return coefficients;
 }
 
 //! Determine the pressure coefficients on a single vehicle part.
 void HypersonicLocalInclinationAnalysis::determinePressureCoefficients(
-        const int partNumber, const boost::array< int, 3 > independentVariableIndices )
+        const double machNumber,
+        const int partNumber,
+        const Eigen::VectorXd& inclinations,
+        Eigen::VectorXd& pressureCoefficients ) const
 {
-    // Retrieve Mach number.
-    double machNumber = dataPointsOfIndependentVariables_[ 0 ]
-            [ independentVariableIndices[ 0 ] ];
-
-    // Determine stagnation point pressure coefficients. Value is computed once
-    // here to prevent its calculation in inner loop.
-    stagnationPressureCoefficient = computeStagnationPressure(
-                machNumber, ratioOfSpecificHeats );
+    pressureCoefficients = Eigen::VectorXd::Zero( inclinations.rows( ) );
+    updateCompressionPressures( machNumber, partNumber, inclinations, pressureCoefficients );
+    updateExpansionPressures( machNumber, partNumber, inclinations, pressureCoefficients );
+}
 
-    updateCompressionPressures( machNumber, partNumber );
-    updateExpansionPressures( machNumber, partNumber );
+//! Determine force and moment coefficients from pressure coefficients.
+Vector6d HypersonicLocalInclinationAnalysis::calculatePartCoefficients(
+        const int partNumber, const Eigen::VectorXd& pressureCoefficients ) const
+{
+    // Sum contributions of all panels (area- and moment arm-weighted surface normals, scaled by pressure coefficients).
+    return panelCoefficientContributions_[ partNumber ] * pressureCoefficients;
 }
 
-//! Determine force coefficients from pressure coefficients.
-Eigen::Vector3d HypersonicLocalInclinationAnalysis::calculateForceCoefficients(
-        const int partNumber )
+//! Determines the inclination angle of panels on all parts.
+std::vector< std::vector< std::vector< double > > > HypersonicLocalInclinationAnalysis::determineInclinations(
+        const double angleOfAttack, const double angleOfSideslip ) const
 {
-    // Declare force coefficient vector and intialize to zeros.
-    Eigen::Vector3d forceCoefficients = Eigen::Vector3d::Zero( );
+    std::vector< Eigen::VectorXd > inclinations;
+    computePanelInclinations( angleOfAttack, angleOfSideslip, inclinations );
 
-    // Loop over all panels and add pressures, scaled by panel area, to force
-    // coefficients.
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
+    // Set inclinations in part-line-point ordering.
+    std::vector< std::vector< std::vector< double > > > partInclinations( vehicleParts_.size( ) );
+    for( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
     {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++)
+        int numberOfLines = vehicleParts_[ k ]->getNumberOfLines( );
+        int numberOfPoints = vehicleParts_[ k ]->getNumberOfPoints( );
+        partInclinations[ k ].resize( numberOfLines );
+        for ( int i = 0 ; i < numberOfLines ; i++ )
         {
-            forceCoefficients -=
-                    pressureCoefficient_[ partNumber ][ i ][ j ] *
-                    vehicleParts_[ partNumber ]->getPanelArea( i, j ) *
-                    vehicleParts_[ partNumber ]->getPanelSurfaceNormal( i, j );
+            partInclinations[ k ][ i ].resize( numberOfPoints );
+        }
+        for ( int i = 0 ; i < numberOfLines - 1 ; i++ )
+        {
+            for ( int j = 0 ; j < numberOfPoints - 1 ; j++ )
+            {
+                partInclinations[ k ][ i ][ j ] = inclinations[ k ]( i * ( numberOfPoints - 1 ) + j );
+            }
         }
     }
-
-    // Normalize result by reference area.
-    forceCoefficients /= referenceArea_;
-
-    return forceCoefficients;
+    return partInclinations;
 }
 
-//! Determine moment coefficients from pressure coefficients.
-Eigen::Vector3d HypersonicLocalInclinationAnalysis::calculateMomentCoefficients(
-        const int partNumber )
+//! Compute the inclination angles of the panels of all parts.
+void HypersonicLocalInclinationAnalysis::computePanelInclinations(
+        const double angleOfAttack,
+        const double angleOfSideslip,
+        std::vector< Eigen::VectorXd >& inclinations ) const
 {
-    // Declare moment coefficient vector and intialize to zeros.
-    Eigen::Vector3d momentCoefficients = Eigen::Vector3d::Zero( );
-
-    // Declare moment arm for panel moment determination.
-    Eigen::Vector3d referenceDistance;
+    // Set freestream velocity vector in body frame.
+    Eigen::Vector3d freestreamVelocityDirection;
+    freestreamVelocityDirection( 0 ) = cos( angleOfAttack )* cos( angleOfSideslip );
+    freestreamVelocityDirection( 1 ) = sin( angleOfSideslip );
+    freestreamVelocityDirection( 2 ) = sin( angleOfAttack ) * cos( angleOfSideslip );
 
-    // Loop over all panels and add moments due pressures.
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
+    // Determine inclination angles from inner product between surface normals and free-stream direction.
+    inclinations.resize( vehicleParts_.size( ) );
+    for( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
     {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
-        {
-            // Determine moment arm for given panel centroid.
-            referenceDistance = ( vehicleParts_[ partNumber ]->getPanelCentroid( i, j ) -
-                                  momentReferencePoint_ );
-
-            momentCoefficients -=
-                    pressureCoefficient_[ partNumber ][ i ][ j ] *
-                    vehicleParts_[ partNumber ]->getPanelArea( i, j ) *
-                    ( referenceDistance.cross( vehicleParts_[ partNumber ]->
-                                               getPanelSurfaceNormal( i, j ) ) );
-        }
+        inclinations[ k ] = PI / 2.0 - ( panelSurfaceNormals_[ k ].transpose( ) *
+                                         freestreamVelocityDirection ).array( ).acos( );
     }
-
-    // Scale result by reference length and area.
-    momentCoefficients /= ( referenceLength_ * referenceArea_ );
-
-    return momentCoefficients;
 }
 
-//! Determines the inclination angle of panels on a single part.
-void HypersonicLocalInclinationAnalysis::determineInclinations( const double angleOfAttack,
-                                                                const double angleOfSideslip )
+//! Set the panel data of all parts in the contiguous representation used for the analysis.
+void HypersonicLocalInclinationAnalysis::setPanelData( )
 {
-    // Declare free-stream velocity vector.
-    Eigen::Vector3d freestreamVelocityDirection;
-
-    // Set freestream velocity vector in body frame.
-    double freestreamVelocityDirectionX = cos( angleOfAttack )* cos( angleOfSideslip );
-    double freestreamVelocityDirectionY = sin( angleOfSideslip );
-    double freestreamVelocityDirectionZ = sin( angleOfAttack ) * cos( angleOfSideslip );
-    freestreamVelocityDirection( 0 ) = freestreamVelocityDirectionX;
-    freestreamVelocityDirection( 1 ) = freestreamVelocityDirectionY;
-    freestreamVelocityDirection( 2 ) = freestreamVelocityDirectionZ;
-
-    // Declare cosine of inclination angle.
-    double cosineOfInclination;
-
-    // Loop over all panels of given vehicle part and set inclination angles.
+    panelSurfaceNormals_.resize( vehicleParts_.size( ) );
+    panelCoefficientContributions_.resize( vehicleParts_.size( ) );
     for( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
     {
-        for ( int i = 0 ; i < vehicleParts_[ k ]->getNumberOfLines( ) - 1 ; i++ )
+        int numberOfLines = vehicleParts_[ k ]->getNumberOfLines( );
+        int numberOfPoints = vehicleParts_[ k ]->getNumberOfPoints( );
+        int numberOfPanels = ( numberOfLines > 1 && numberOfPoints > 1 ) ?
+                    ( numberOfLines - 1 ) * ( numberOfPoints - 1 ) : 0;
+
+        panelSurfaceNormals_[ k ].resize( 3, numberOfPanels );
+        panelCoefficientContributions_[ k ].resize( 6, numberOfPanels );
+        for ( int i = 0 ; i < numberOfLines - 1 ; i++ )
         {
-            for ( int j = 0 ; j < vehicleParts_[ k ]->getNumberOfPoints( ) - 1 ; j++ )
+            for ( int j = 0 ; j < numberOfPoints - 1 ; j++ )
             {
-
-                // Determine cosine of inclination angle from inner product between
-                // surface normal and free-stream direction.
-                cosineOfInclination = vehicleParts_[ k ]->
-                        getPanelSurfaceNormal( i, j ).
-                        dot( freestreamVelocityDirection );
-
-                // Set inclination angle.
-                inclination_[ k ][ i ][ j ] = PI / 2.0 - acos( cosineOfInclination );
+                int panelIndex = i * ( numberOfPoints - 1 ) + j;
+                Eigen::Vector3d surfaceNormal = vehicleParts_[ k ]->getPanelSurfaceNormal( i, j );
+                double panelArea = vehicleParts_[ k ]->getPanelArea( i, j );
+
+                // Determine moment arm for given panel centroid.
+                Eigen::Vector3d referenceDistance =
+                        vehicleParts_[ k ]->getPanelCentroid( i, j ) - momentReferencePoint_;
+
+                panelSurfaceNormals_[ k ].col( panelIndex ) = surfaceNormal;
+                panelCoefficientContributions_[ k ].block( 0, panelIndex, 3, 1 ) =
+                        -panelArea * surfaceNormal / referenceArea_;
+                panelCoefficientContributions_[ k ].block( 3, panelIndex, 3, 1 ) =
+                        -panelArea * referenceDistance.cross( surfaceNormal ) / ( referenceLength_ * referenceArea_ );
             }
         }
     }
@@ -510,10 +546,11 @@ void HypersonicLocalInclinationAnalysis::determineInclinations( const double ang
 
 //! Determine compression pressure coefficients on all parts.
 void HypersonicLocalInclinationAnalysis::updateCompressionPressures( const double machNumber,
-                                                                     const int partNumber )
+                                                                     const int partNumber,
+                                                                     const Eigen::VectorXd& inclinations,
+                                                                     Eigen::VectorXd& pressureCoefficients ) const
 {
     int method = selectedMethods_[ 0 ][ partNumber ];
-
     std::function< double( double ) > pressureFunction;
 
     // Switch to analyze part using correct method.
@@ -527,7 +564,7 @@ void HypersonicLocalInclinationAnalysis::updateCompressionPressures( const doubl
     case 1:
         pressureFunction =
                 std::bind( aerodynamics::computeModifiedNewtonianPressureCoefficient, std::placeholders::_1,
-                           stagnationPressureCoefficient );
+                           computeStagnationPressure( machNumber, ratioOfSpecificHeats ) );
         break;
 
     case 2:
@@ -578,23 +615,21 @@ void HypersonicLocalInclinationAnalysis::updateCompressionPressures( const doubl
         break;
     }
 
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1; i++ )
+    for ( int i = 0 ; i < inclinations.rows( ) ; i++ )
     {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
+        if ( inclinations( i ) > 0 )
         {
-            if ( inclination_[ partNumber ][ i ][ j ] > 0 )
-            {
-                // If panel inclination is positive, calculate pressure coefficient.
-                pressureCoefficient_[ partNumber ][ i ][ j ] =
-                        pressureFunction( inclination_[ partNumber ][ i ][ j ] );
-            }
+            // If panel inclination is positive, calculate pressure coefficient.
+            pressureCoefficients( i ) = pressureFunction( inclinations( i ) );
         }
     }
 }
 
 //! Determines expansion pressure coefficients on all parts.
 void HypersonicLocalInclinationAnalysis::updateExpansionPressures( const double machNumber,
-                                                                   const int partNumber )
+                                                                   const int partNumber,
+                                                                   const Eigen::VectorXd& inclinations,
+                                                                   Eigen::VectorXd& pressureCoefficients ) const
 {
     // Get analysis method of part to analyze.
     int method = selectedMethods_[ 1 ][ partNumber ];
@@ -621,17 +656,13 @@ void HypersonicLocalInclinationAnalysis::updateExpansionPressures( const double
         }
 
         // Iterate over all panels on part.
-        for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
+        for ( int i = 0 ; i < inclinations.rows( ) ; i++ )
         {
-            for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
+            if ( inclinations( i ) <= 0 )
             {
-                if ( inclination_[ partNumber ][ i ][ j ] <= 0 )
-                {
-                    // If panel inclination is negative, calculate pressure using
-                    // Van Dyke unified method.
-                    pressureCoefficient_[ partNumber ][ i ][ j ] =
-                            pressureFunction( );
-                }
+                // If panel inclination is negative, calculate pressure using
+                // Van Dyke unified method.
+                pressureCoefficients( i ) = pressureFunction( );
             }
         }
     }
@@ -670,17 +701,13 @@ void HypersonicLocalInclinationAnalysis::updateExpansionPressures( const double
         }
 
         // Iterate over all panels on part.
-        for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
+        for ( int i = 0 ; i < inclinations.rows( ) ; i++ )
         {
-            for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
+            if ( inclinations( i ) <= 0 )
             {
-                if ( inclination_[ partNumber ][ i ][ j ] <= 0 )
-                {
-                    // If panel inclination is negative, calculate pressure using
-                    // Van Dyke unified method.
-                    pressureCoefficient_[ partNumber ][ i ][ j ] =
-                            pressureFunction( inclination_[ partNumber ][ i ][ j ] );
-                }
+                // If panel inclination is negative, calculate pressure using
+                // Van Dyke unified method.
+                pressureCoefficients( i ) = pressureFunction( inclinations( i ) );
             }
         }
     }
@@ -693,5 +720,136 @@ void HypersonicLocalInclinationAnalysis::updateExpansionPressures( const double
     }
 }
 
+//! Compute the hash of the panel geometry and analysis settings.
+uint64_t HypersonicLocalInclinationAnalysis::computeAnalysisHash( ) const
+{
+    uint64_t hash = utilities::FNV1A_HASH_OFFSET_BASIS;
+    hash = utilities::updateFnv1aHash( hash, &HYPERSONIC_LOCAL_INCLINATION_CACHE_FILE_VERSION, sizeof( uint32_t ) );
+
+    // Add panel geometry
+    uint64_t numberOfParts = vehicleParts_.size( );
+    hash = utilities::updateFnv1aHash( hash, &numberOfParts, sizeof( uint64_t ) );
+    for( unsigned int i = 0; i < vehicleParts_.size( ); i++ )
+    {
+        uint64_t numberOfPanels = panelSurfaceNormals_[ i ].cols( );
+        hash = utilities::updateFnv1aHash( hash, &numberOfPanels, sizeof( uint64_t ) );
+        hash = utilities::updateFnv1aHash( hash, panelSurfaceNormals_[ i ].data( ),
+                                panelSurfaceNormals_[ i ].size( ) * sizeof( double ) );
+        hash = utilities::updateFnv1aHash( hash, panelCoefficientContributions_[ i ].data( ),
+                                panelCoefficientContributions_[ i ].size( ) * sizeof( double ) );
+    }
+
+    // Add analysis settings
+    for( unsigned int i = 0; i < selectedMethods_.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < selectedMethods_[ i ].size( ); j++ )
+        {
+            int64_t method = selectedMethods_[ i ][ j ];
+            hash = utilities::updateFnv1aHash( hash, &method, sizeof( int64_t ) );
+        }
+    }
+    for( unsigned int i = 0; i < dataPointsOfIndependentVariables_.size( ); i++ )
+    {
+        uint64_t numberOfDataPoints = dataPointsOfIndependentVariables_[ i ].size( );
+        hash = utilities::updateFnv1aHash( hash, &numberOfDataPoints, sizeof( uint64_t ) );
+        hash = utilities::updateFnv1aHash( hash, dataPointsOfIndependentVariables_[ i ].data( ),
+                                numberOfDataPoints * sizeof( double ) );
+    }
+    hash = utilities::updateFnv1aHash( hash, &referenceArea_, sizeof( double ) );
+    hash = utilities::updateFnv1aHash( hash, &referenceLength_, sizeof( double ) );
+    hash = utilities::updateFnv1aHash( hash, momentReferencePoint_.data( ), 3 * sizeof( double ) );
+    hash = utilities::updateFnv1aHash( hash, &ratioOfSpecificHeats, sizeof( double ) );
+
+    return hash;
+}
+
+//! Read the aerodynamic coefficients from the cache file.
+bool HypersonicLocalInclinationAnalysis::readCoefficientsFromCacheFile( )
+{
+    std::ifstream inputFile( coefficientCacheFile_, std::ios::binary );
+    if( !inputFile.good( ) )
+    {
+        return false;
+    }
+
+    // Check consistency of header with current analysis
+    HypersonicLocalInclinationCacheFileHeader header;
+    inputFile.read( reinterpret_cast< char* >( &header ), sizeof( HypersonicLocalInclinationCacheFileHeader ) );
+    if( !inputFile.good( ) ||
+            std::memcmp( header.fileIdentifier_, hypersonicLocalInclinationCacheFileIdentifier, 8 ) != 0 ||
+            header.fileVersion_ != HYPERSONIC_LOCAL_INCLINATION_CACHE_FILE_VERSION ||
+            header.byteOrderMarker_ != hypersonicLocalInclinationCacheByteOrderMarker ||
+            header.analysisHash_ != analysisHash_ )
+    {
+        return false;
+    }
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        if( header.numberOfDataPoints_[ i ] != dataPointsOfIndependentVariables_[ i ].size( ) )
+        {
+            return false;
+        }
+    }
+
+    // Read coefficients (contiguous in memory, in row-major order)
+    static_assert( sizeof( Vector6d ) == 6 * sizeof( double ), "Error, Eigen::Vector6d contains padding" );
+    boost::multi_array< Vector6d, 3 > readCoefficients( aerodynamicCoefficients_ );
+    inputFile.read( reinterpret_cast< char* >( readCoefficients.data( ) ),
+                    readCoefficients.num_elements( ) * sizeof( Vector6d ) );
+    if( !inputFile.good( ) )
+    {
+        return false;
+    }
+
+    aerodynamicCoefficients_ = readCoefficients;
+    std::fill( isCoefficientGenerated_.origin( ),
+               isCoefficientGenerated_.origin( ) + isCoefficientGenerated_.num_elements( ), 1 );
+    return true;
+}
+
+//! Write the aerodynamic coefficients to the cache file.
+void HypersonicLocalInclinationAnalysis::writeCoefficientsToCacheFile( ) const
+{
+    // Set up file header
+    HypersonicLocalInclinationCacheFileHeader header;
+    std::memset( &header, 0, sizeof( HypersonicLocalInclinationCacheFileHeader ) );
+    std::memcpy( header.fileIdentifier_, hypersonicLocalInclinationCacheFileIdentifier, 8 );
+    header.fileVersion_ = HYPERSONIC_LOCAL_INCLINATION_CACHE_FILE_VERSION;
+    header.byteOrderMarker_ = hypersonicLocalInclinationCacheByteOrderMarker;
+    header.analysisHash_ = analysisHash_;
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        header.numberOfDataPoints_[ i ] = dataPointsOfIndependentVariables_[ i ].size( );
+    }
+
+    boost::filesystem::path cacheFilePath( coefficientCacheFile_ );
+    if( cacheFilePath.has_parent_path( ) )
+    {
+        boost::filesystem::create_directories( cacheFilePath.parent_path( ) );
+    }
+
+    // Write to temporary file, and move to cache file once complete.
+    boost::filesystem::path temporaryFilePath = cacheFilePath;
+    temporaryFilePath += boost::filesystem::unique_path( ".%%%%-%%%%-%%%%.tmp" );
+    {
+        std::ofstream outputFile( temporaryFilePath.string( ), std::ios::binary | std::ios::trunc );
+        if( !outputFile.good( ) )
+        {
+            throw std::runtime_error( "Error when writing local inclination coefficient cache, could not open file " +
+                                      temporaryFilePath.string( ) );
+        }
+        outputFile.write( reinterpret_cast< const char* >( &header ),
+                          sizeof( HypersonicLocalInclinationCacheFileHeader ) );
+        outputFile.write( reinterpret_cast< const char* >( aerodynamicCoefficients_.data( ) ),
+                          aerodynamicCoefficients_.num_elements( ) * sizeof( Vector6d ) );
+        if( !outputFile.good( ) )
+        {
+            throw std::runtime_error( "Error when writing local inclination coefficient cache, failed to write file " +
+                                      temporaryFilePath.string( ) );
+        }
+    }
+    boost::filesystem::rename( temporaryFilePath, cacheFilePath );
+}
+
 } // namespace aerodynamics
 } // namespace tudat
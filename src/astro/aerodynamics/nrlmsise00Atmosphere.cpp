@@ -18,28 +18,52 @@ namespace tudat
 namespace aerodynamics
 {
 
-void NRLMSISE00Atmosphere::setInputStruct( const double altitude, const double longitude,
-                                           const double latitude, const double time )
+void NRLMSISE00Atmosphere::setTimeDependentInputStructEntries( )
 {
-// Retrieve input data.
-    inputData_ = nrlmsise00InputFunction_(
-        altitude, longitude, latitude, time );
-    std::copy( inputData_.apVector.begin( ), inputData_.apVector.end( ), aph_.a );
-    std::copy( inputData_.switches.begin( ), inputData_.switches.end( ), flags_.switches );
-
-    input_.g_lat = latitude * 180.0 / mathematical_constants::PI; // rad to deg
-    input_.g_long = longitude * 180.0 / mathematical_constants::PI; // rad to deg
-    input_.alt = altitude * 1.0E-3; // m to km
+    // Copy magnetic index vector (at most 7 entries, size of ap_array).
+    std::fill( aph_.a, aph_.a + 7, 0.0 );
+    std::copy( inputData_.apVector.begin( ), inputData_.apVector.begin( ) +
+               std::min< std::size_t >( inputData_.apVector.size( ), 7 ), aph_.a );
+    std::copy( inputData_.switches.begin( ), inputData_.switches.begin( ) +
+               std::min< std::size_t >( inputData_.switches.size( ), 24 ), flags_.switches );
     input_.year = inputData_.year;
     input_.doy = inputData_.dayOfTheYear;
     input_.sec = inputData_.secondOfTheDay;
-    input_.lst = inputData_.localSolarTime;
     input_.f107 = inputData_.f107;
     input_.f107A = inputData_.f107a;
     input_.ap = inputData_.apDaily;
     input_.ap_a = &aph_;
 }
 
+void NRLMSISE00Atmosphere::setInputStruct( const double altitude, const double longitude,
+                                           const double latitude, const double time )
+{
+    if( solarActivityTable_ != nullptr )
+    {
+        // Recompute time-dependent input only if time has changed.
+        if( !( time == currentInputTime_ ) )
+        {
+            setTimeDependentNrlmsise00Input( *solarActivityTable_, time, inputData_ );
+            setTimeDependentInputStructEntries( );
+            currentInputTime_ = time;
+        }
+        inputData_.localSolarTime = inputData_.secondOfTheDay / 3600.0
+                + longitude / ( mathematical_constants::PI / 12.0 );
+    }
+    else
+    {
+        // Retrieve input data.
+        inputData_ = nrlmsise00InputFunction_(
+                    altitude, longitude, latitude, time );
+        setTimeDependentInputStructEntries( );
+    }
+
+    input_.g_lat = latitude * 180.0 / mathematical_constants::PI; // rad to deg
+    input_.g_long = longitude * 180.0 / mathematical_constants::PI; // rad to deg
+    input_.alt = altitude * 1.0E-3; // m to km
+    input_.lst = inputData_.localSolarTime;
+}
+
 void NRLMSISE00Atmosphere::computeProperties(
         const double altitude, const double longitude,
         const double latitude, const double time )
@@ -122,6 +146,35 @@ void NRLMSISE00Atmosphere::computeProperties(
     }
 }
 
+//! Get local densities at a list of points.
+std::vector< double > NRLMSISE00Atmosphere::getDensities( const std::vector< double >& altitudes,
+                                                          const std::vector< double >& longitudes,
+                                                          const std::vector< double >& latitudes,
+                                                          const std::vector< double >& times )
+{
+    if( longitudes.size( ) != altitudes.size( ) || latitudes.size( ) != altitudes.size( ) ||
+            times.size( ) != altitudes.size( ) )
+    {
+        throw std::runtime_error( "Error when computing NRLMSISE00 densities, input sizes are inconsistent: " +
+                                  std::to_string( altitudes.size( ) ) + ", " +
+                                  std::to_string( longitudes.size( ) ) + ", " +
+                                  std::to_string( latitudes.size( ) ) + ", " +
+                                  std::to_string( times.size( ) ) );
+    }
+
+    // Output is stored in local structure, so that properties of last call to computeProperties remain valid.
+    nrlmsise_output currentOutput;
+    std::vector< double > densities( altitudes.size( ) );
+    for( unsigned int i = 0; i < altitudes.size( ); i++ )
+    {
+        setInputStruct( altitudes[ i ], longitudes[ i ], latitudes[ i ], times[ i ] );
+        gtd7( &input_, &flags_, &currentOutput );
+        densities[ i ] = currentOutput.d[ 5 ] * 1000.0; // GM/CM3 to kg/M3
+    }
+
+    return densities;
+}
+
 //! Overloaded ostream to print class information.
 std::ostream& operator << ( std::ostream& stream,
                             NRLMSISE00Input& nrlmsiseInput ){
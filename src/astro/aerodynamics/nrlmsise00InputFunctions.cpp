@@ -8,6 +8,10 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
 #include "tudat/astro/aerodynamics/nrlmsise00Atmosphere.h"
 #include "tudat/astro/aerodynamics/nrlmsise00InputFunctions.h"
 #include "tudat/math/basic/mathematicalConstants.h"
@@ -105,5 +109,114 @@ NRLMSISE00Input nrlmsiseInputFunction( const double altitude, const double longi
     return nrlmsiseInputData;
 }
 
+//! Constructor
+NRLMSISE00SolarActivityTable::NRLMSISE00SolarActivityTable(
+        const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityMap )
+{
+    using namespace tudat::input_output::solar_activity;
+
+    if( solarActivityMap.empty( ) )
+    {
+        throw std::runtime_error( "Error when creating NRLMSISE00 solar activity table, no solar activity data provided" );
+    }
+
+    // Allow data of last day to be used up to 30 days after the last entry, consistent with nrlmsiseInputFunction
+    firstJulianDay_ = solarActivityMap.begin( )->first;
+    int numberOfDays = static_cast< int >(
+                std::round( solarActivityMap.rbegin( )->first - firstJulianDay_ ) ) + 31;
+    dailySolarActivity_.resize( numberOfDays );
+
+    // Fill table, using the first subsequent entry for days missing in the solar activity data
+    auto activityIterator = solarActivityMap.begin( );
+    for( int i = 0; i < numberOfDays; i++ )
+    {
+        double currentJulianDay = firstJulianDay_ + static_cast< double >( i );
+        while( std::next( activityIterator ) != solarActivityMap.end( ) && activityIterator->first < currentJulianDay )
+        {
+            activityIterator++;
+        }
+        const SolarActivityDataPtr solarActivity = activityIterator->second;
+
+        NRLMSISE00DailySolarActivity& currentDailyActivity = dailySolarActivity_[ i ];
+        currentDailyActivity.year = solarActivity->year;
+        currentDailyActivity.julianDayOnFirstOfJanuary = tudat::basic_astrodynamics::convertCalendarDateToJulianDay(
+                    solarActivity->year, 1, 1, 0, 0, 0.0 );
+        if( solarActivity->fluxQualifier == 1 )
+        {
+            currentDailyActivity.f107 = solarActivity->solarRadioFlux107Adjusted;
+            currentDailyActivity.f107a = solarActivity->centered81DaySolarRadioFlux107Adjusted;
+        }
+        else
+        {
+            currentDailyActivity.f107 = solarActivity->solarRadioFlux107Observed;
+            currentDailyActivity.f107a = solarActivity->centered81DaySolarRadioFlux107Observed;
+        }
+        currentDailyActivity.apDaily = solarActivity->planetaryEquivalentAmplitudeAverage;
+        // Only the first 7 entries of the magnetic index vector are used by NRLMSISE00 (size of ap_array)
+        for( int j = 0; j < 7; j++ )
+        {
+            currentDailyActivity.apVector[ j ] =
+                    ( j < solarActivity->planetaryEquivalentAmplitudeVector.rows( ) ) ?
+                        solarActivity->planetaryEquivalentAmplitudeVector( j ) : 0.0;
+        }
+    }
+}
+
+//! Function to retrieve the solar activity data for a given day
+const NRLMSISE00DailySolarActivity& NRLMSISE00SolarActivityTable::getDailySolarActivity( const double julianDay ) const
+{
+    long dayIndex = std::lround( julianDay - firstJulianDay_ );
+    if( dayIndex < 0 )
+    {
+        dayIndex = 0;
+    }
+    else if( dayIndex >= static_cast< long >( dailySolarActivity_.size( ) ) )
+    {
+        throw std::runtime_error( "Error when retrieving solar activity data at JD" + std::to_string( julianDay ) +
+                                  ", most recent data is more than 30 days old" );
+    }
+    return dailySolarActivity_[ dayIndex ];
+}
+
+//! Function to compute the NRLMSISE00 input from the tabulated solar activity
+NRLMSISE00Input NRLMSISE00SolarActivityTable::getNrlmsise00Input(
+        const double altitude, const double longitude,
+        const double latitude, const double time ) const
+{
+    NRLMSISE00Input nrlmsiseInputData;
+    setTimeDependentNrlmsise00Input( *this, time, nrlmsiseInputData );
+    nrlmsiseInputData.localSolarTime = nrlmsiseInputData.secondOfTheDay / 3600.0
+            + longitude / ( tudat::mathematical_constants::PI / 12.0 );
+    return nrlmsiseInputData;
+}
+
+//! Function to compute the Julian day (at 0h) corresponding to a time
+double getNrlmsise00JulianDay( const double time )
+{
+    double julianDate = tudat::basic_astrodynamics::convertSecondsSinceEpochToJulianDay(
+                time, basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+    return std::floor( julianDate - 0.5 ) + 0.5;
+}
+
+//! Function to set the time-dependent entries of the NRLMSISE00 input from the tabulated solar activity
+void setTimeDependentNrlmsise00Input(
+        const NRLMSISE00SolarActivityTable& solarActivityTable,
+        const double time,
+        NRLMSISE00Input& nrlmsiseInputData )
+{
+    double julianDay = getNrlmsise00JulianDay( time );
+    const NRLMSISE00DailySolarActivity& solarActivity = solarActivityTable.getDailySolarActivity( julianDay );
+
+    nrlmsiseInputData.year = solarActivity.year;
+    nrlmsiseInputData.dayOfTheYear = julianDay - solarActivity.julianDayOnFirstOfJanuary + 1;
+    nrlmsiseInputData.secondOfTheDay = time -
+            tudat::basic_astrodynamics::convertJulianDayToSecondsSinceEpoch(
+                julianDay, tudat::basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+    nrlmsiseInputData.f107 = solarActivity.f107;
+    nrlmsiseInputData.f107a = solarActivity.f107a;
+    nrlmsiseInputData.apDaily = solarActivity.apDaily;
+    nrlmsiseInputData.apVector.assign( solarActivity.apVector, solarActivity.apVector + 7 );
+}
+
 }  // namespace aerodynamics
 }  // namespace tudat
@@ -0,0 +1,511 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <typeinfo>
+
+#include <boost/filesystem.hpp>
+
+#include "tudat/astro/aerodynamics/precomputedAtmosphere.h"
+#include "tudat/astro/basic_astro/physicalConstants.h"
+#include "tudat/basics/utilities.h"
+
+namespace tudat
+{
+
+namespace aerodynamics
+{
+
+//! File identifier of binary precomputed atmosphere files
+static const char precomputedAtmosphereFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'P', 'A', 'T' };
+
+//! Byte order marker of binary precomputed atmosphere files
+static const uint32_t precomputedAtmosphereByteOrderMarker = 0x01020304;
+
+//! Function to compute the second of the (UT) day from a time in seconds since J2000 (which is at 12h).
+double computeSecondOfDay( const double time )
+{
+    double secondOfDay = std::fmod( time + physical_constants::JULIAN_DAY / 2.0, physical_constants::JULIAN_DAY );
+    if( secondOfDay < 0.0 )
+    {
+        secondOfDay += physical_constants::JULIAN_DAY;
+    }
+    return secondOfDay;
+}
+
+//! Function to compute the local solar time from the longitude and time.
+double computeLocalSolarTime( const double longitude, const double time )
+{
+    double localSolarTime = std::fmod(
+                computeSecondOfDay( time ) / 3600.0 + longitude / ( mathematical_constants::PI / 12.0 ), 24.0 );
+    if( localSolarTime < 0.0 )
+    {
+        localSolarTime += 24.0;
+    }
+    return localSolarTime;
+}
+
+//! Function to compute the longitude at which a given local solar time is attained at a given time.
+double computeLongitudeFromLocalSolarTime( const double localSolarTime, const double time )
+{
+    double longitude = std::fmod(
+                ( localSolarTime - computeSecondOfDay( time ) / 3600.0 ) * mathematical_constants::PI / 12.0 +
+                mathematical_constants::PI, 2.0 * mathematical_constants::PI );
+    if( longitude < 0.0 )
+    {
+        longitude += 2.0 * mathematical_constants::PI;
+    }
+    return longitude - mathematical_constants::PI;
+}
+
+//! Function to compute the equidistant latitude nodes of a precomputed atmosphere
+std::vector< double > getPrecomputedAtmosphereLatitudes( const unsigned int numberOfLatitudes )
+{
+    std::vector< double > latitudes( numberOfLatitudes );
+    for( unsigned int i = 0; i < numberOfLatitudes; i++ )
+    {
+        latitudes[ i ] = -mathematical_constants::PI / 2.0 +
+                static_cast< double >( i ) * mathematical_constants::PI / static_cast< double >( numberOfLatitudes - 1 );
+    }
+    return latitudes;
+}
+
+//! Function to compute the equidistant local solar time nodes of a precomputed atmosphere
+std::vector< double > getPrecomputedAtmosphereLocalSolarTimes( const unsigned int numberOfLocalSolarTimes )
+{
+    std::vector< double > localSolarTimes( numberOfLocalSolarTimes );
+    for( unsigned int i = 0; i < numberOfLocalSolarTimes; i++ )
+    {
+        localSolarTimes[ i ] = static_cast< double >( i ) * 24.0 / static_cast< double >( numberOfLocalSolarTimes - 1 );
+    }
+    return localSolarTimes;
+}
+
+//! Constructor, from precomputed table.
+PrecomputedAtmosphere::PrecomputedAtmosphere(
+        const std::vector< double >& altitudes,
+        const unsigned int numberOfLatitudes,
+        const unsigned int numberOfLocalSolarTimes,
+        const std::vector< double >& times,
+        const boost::multi_array< Eigen::Vector4d, 4 >& tabulatedData,
+        const double maximumSampledRelativeDensityError,
+        const interpolators::BoundaryInterpolationType boundaryHandling ):
+    maximumSampledRelativeDensityError_( maximumSampledRelativeDensityError ),
+    currentIndependentVariables_( 4 )
+{
+    independentValues_.push_back( altitudes );
+    independentValues_.push_back( getPrecomputedAtmosphereLatitudes( numberOfLatitudes ) );
+    independentValues_.push_back( getPrecomputedAtmosphereLocalSolarTimes( numberOfLocalSolarTimes ) );
+    independentValues_.push_back( times );
+
+    for( unsigned int i = 0; i < 4; i++ )
+    {
+        if( independentValues_.at( i ).size( ) != tabulatedData.shape( )[ i ] )
+        {
+            throw std::runtime_error( "Error when creating precomputed atmosphere, size of independent variable " +
+                                      std::to_string( i ) + " (" + std::to_string( independentValues_.at( i ).size( ) ) +
+                                      ") is inconsistent with table (" + std::to_string( tabulatedData.shape( )[ i ] ) + ")" );
+        }
+    }
+
+    // Latitude and local solar time cover their full range; values marginally out of range are due to rounding
+    interpolator_ = std::make_shared< interpolators::MultiLinearInterpolator< double, Eigen::Vector4d, 4 > >(
+                independentValues_, tabulatedData, interpolators::huntingAlgorithm,
+                std::vector< interpolators::BoundaryInterpolationType >(
+                    { boundaryHandling, interpolators::use_boundary_value,
+                      interpolators::use_boundary_value, boundaryHandling } ) );
+
+    currentInput_.setConstant( TUDAT_NAN );
+}
+
+//! Function to interpolate the table at the given position and time, if these have changed since the last call.
+void PrecomputedAtmosphere::computeProperties( const double altitude, const double longitude,
+                                               const double latitude, const double time )
+{
+    if( !( altitude == currentInput_( 0 ) && longitude == currentInput_( 1 ) &&
+           latitude == currentInput_( 2 ) && time == currentInput_( 3 ) ) )
+    {
+        currentIndependentVariables_[ 0 ] = altitude;
+        currentIndependentVariables_[ 1 ] = latitude;
+        currentIndependentVariables_[ 2 ] = computeLocalSolarTime( longitude, time );
+        currentIndependentVariables_[ 3 ] = time;
+        currentProperties_ = interpolator_->interpolate( currentIndependentVariables_ );
+
+        currentInput_ << altitude, longitude, latitude, time;
+    }
+}
+
+//! Function to write the table to a binary file
+void PrecomputedAtmosphere::writeToFile( const std::string& fileName,
+                                         const PrecomputedAtmosphereGridSettings& gridSettings,
+                                         const uint64_t baseModelFingerprint )
+{
+    // Set up file header
+    PrecomputedAtmosphereFileHeader header;
+    std::memset( &header, 0, sizeof( PrecomputedAtmosphereFileHeader ) );
+    std::memcpy( header.fileIdentifier_, precomputedAtmosphereFileIdentifier, 8 );
+    header.fileVersion_ = PRECOMPUTED_ATMOSPHERE_FILE_VERSION;
+    header.byteOrderMarker_ = precomputedAtmosphereByteOrderMarker;
+    header.numberOfAltitudes_ = independentValues_.at( 0 ).size( );
+    header.numberOfLatitudes_ = independentValues_.at( 1 ).size( );
+    header.numberOfLocalSolarTimes_ = independentValues_.at( 2 ).size( );
+    header.numberOfTimes_ = independentValues_.at( 3 ).size( );
+    header.minimumAltitude_ = gridSettings.minimumAltitude_;
+    header.maximumAltitude_ = gridSettings.maximumAltitude_;
+    header.initialAltitudeStep_ = gridSettings.initialAltitudeStep_;
+    header.minimumAltitudeStep_ = gridSettings.minimumAltitudeStep_;
+    header.densityTolerance_ = gridSettings.densityTolerance_;
+    header.startTime_ = gridSettings.startTime_;
+    header.timeStep_ = gridSettings.timeStep_;
+    header.maximumSampledRelativeDensityError_ = maximumSampledRelativeDensityError_;
+    header.baseModelFingerprint_ = baseModelFingerprint;
+
+    // Write to temporary file, and move to requested file once complete.
+    boost::filesystem::path filePath( fileName );
+    boost::filesystem::path temporaryFilePath = filePath;
+    temporaryFilePath += boost::filesystem::unique_path( ".%%%%-%%%%-%%%%.tmp" );
+    {
+        std::ofstream outputFile( temporaryFilePath.string( ), std::ios::binary | std::ios::trunc );
+        if( !outputFile.good( ) )
+        {
+            throw std::runtime_error( "Error when writing precomputed atmosphere, could not open file " +
+                                      temporaryFilePath.string( ) );
+        }
+        outputFile.write( reinterpret_cast< const char* >( &header ), sizeof( PrecomputedAtmosphereFileHeader ) );
+        outputFile.write( reinterpret_cast< const char* >( independentValues_.at( 0 ).data( ) ),
+                          independentValues_.at( 0 ).size( ) * sizeof( double ) );
+
+        // Write table entries (contiguous in memory, in row-major order)
+        static_assert( sizeof( Eigen::Vector4d ) == 4 * sizeof( double ), "Error, Eigen::Vector4d contains padding" );
+        const boost::multi_array< Eigen::Vector4d, 4 >& tabulatedData = interpolator_->getDependentValues( );
+        outputFile.write( reinterpret_cast< const char* >( tabulatedData.data( ) ),
+                          tabulatedData.num_elements( ) * sizeof( Eigen::Vector4d ) );
+
+        if( !outputFile.good( ) )
+        {
+            throw std::runtime_error( "Error when writing precomputed atmosphere, failed to write file " +
+                                      temporaryFilePath.string( ) );
+        }
+    }
+    boost::filesystem::rename( temporaryFilePath, filePath );
+}
+
+//! Function to compute the (log-linear) density interpolation error at the midpoint of an altitude interval.
+double computeMaximumAltitudeIntervalDensityError(
+        const std::vector< double >& lowerLogDensities,
+        const std::vector< double >& upperLogDensities,
+        const std::vector< double >& midpointLogDensities )
+{
+    double maximumError = 0.0;
+    for( unsigned int i = 0; i < midpointLogDensities.size( ); i++ )
+    {
+        double currentError = std::fabs( std::expm1(
+                    0.5 * ( lowerLogDensities.at( i ) + upperLogDensities.at( i ) ) - midpointLogDensities.at( i ) ) );
+        if( !( currentError <= maximumError ) )
+        {
+            maximumError = currentError;
+        }
+    }
+    return maximumError;
+}
+
+//! Function to adaptively refine an altitude interval, until the density interpolation error is below the tolerance.
+void refineAltitudeInterval(
+        const double lowerAltitude,
+        const double upperAltitude,
+        const std::vector< double >& lowerLogDensities,
+        const std::vector< double >& upperLogDensities,
+        const std::function< std::vector< double >( const double ) >& logDensityFunction,
+        const PrecomputedAtmosphereGridSettings& gridSettings,
+        std::vector< double >& refinedAltitudes )
+{
+    if( upperAltitude - lowerAltitude >= 2.0 * gridSettings.minimumAltitudeStep_ )
+    {
+        double midpointAltitude = 0.5 * ( lowerAltitude + upperAltitude );
+        std::vector< double > midpointLogDensities = logDensityFunction( midpointAltitude );
+        if( computeMaximumAltitudeIntervalDensityError(
+                    lowerLogDensities, upperLogDensities, midpointLogDensities ) > gridSettings.densityTolerance_ )
+        {
+            refineAltitudeInterval( lowerAltitude, midpointAltitude, lowerLogDensities, midpointLogDensities,
+                                    logDensityFunction, gridSettings, refinedAltitudes );
+            refineAltitudeInterval( midpointAltitude, upperAltitude, midpointLogDensities, upperLogDensities,
+                                    logDensityFunction, gridSettings, refinedAltitudes );
+            return;
+        }
+    }
+    refinedAltitudes.push_back( upperAltitude );
+}
+
+//! Function to compute a table of atmospheric properties from an atmosphere model.
+std::shared_ptr< PrecomputedAtmosphere > computePrecomputedAtmosphere(
+        const std::shared_ptr< AtmosphereModel > atmosphereModel,
+        const PrecomputedAtmosphereGridSettings& gridSettings,
+        const interpolators::BoundaryInterpolationType boundaryHandling )
+{
+    std::vector< double > latitudes = getPrecomputedAtmosphereLatitudes( gridSettings.numberOfLatitudes_ );
+    std::vector< double > localSolarTimes = getPrecomputedAtmosphereLocalSolarTimes( gridSettings.numberOfLocalSolarTimes_ );
+    std::vector< double > times( gridSettings.getNumberOfTimes( ) );
+    for( unsigned int i = 0; i < times.size( ); i++ )
+    {
+        times[ i ] = gridSettings.startTime_ + static_cast< double >( i ) * gridSettings.timeStep_;
+    }
+
+    // Define reference points (latitude, longitude, time) at which the altitude refinement is evaluated: poles, mid-
+    // latitudes and equator, at four local solar times, at the start, middle and end of the table.
+    std::vector< Eigen::Vector3d > referencePoints;
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        double currentTime = times.at( i * ( times.size( ) - 1 ) / 2 );
+        for( unsigned int j = 0; j < 4; j++ )
+        {
+            double currentLongitude = computeLongitudeFromLocalSolarTime( 6.0 * static_cast< double >( j ), currentTime );
+            for( unsigned int k = 0; k < 5; k++ )
+            {
+                referencePoints.push_back(
+                            ( Eigen::Vector3d( ) << latitudes.at( k * ( latitudes.size( ) - 1 ) / 4 ),
+                              currentLongitude, currentTime ).finished( ) );
+            }
+        }
+    }
+    std::function< std::vector< double >( const double ) > logDensityFunction =
+            [ & ]( const double altitude )
+    {
+        std::vector< double > logDensities( referencePoints.size( ) );
+        for( unsigned int i = 0; i < referencePoints.size( ); i++ )
+        {
+            logDensities[ i ] = std::log( atmosphereModel->getDensity(
+                        altitude, referencePoints.at( i )( 1 ), referencePoints.at( i )( 0 ), referencePoints.at( i )( 2 ) ) );
+        }
+        return logDensities;
+    };
+
+    // Determine altitude nodes, refining equidistant initial grid.
+    unsigned int numberOfInitialAltitudeIntervals = static_cast< unsigned int >( std::ceil(
+                ( gridSettings.maximumAltitude_ - gridSettings.minimumAltitude_ ) / gridSettings.initialAltitudeStep_ ) );
+    double initialAltitudeStep = ( gridSettings.maximumAltitude_ - gridSettings.minimumAltitude_ ) /
+            static_cast< double >( numberOfInitialAltitudeIntervals );
+    std::vector< double > altitudes = { gridSettings.minimumAltitude_ };
+    std::vector< double > lowerLogDensities = logDensityFunction( gridSettings.minimumAltitude_ );
+    for( unsigned int i = 1; i <= numberOfInitialAltitudeIntervals; i++ )
+    {
+        double upperAltitude = ( i == numberOfInitialAltitudeIntervals ) ? gridSettings.maximumAltitude_ :
+                                                                            gridSettings.minimumAltitude_ + static_cast< double >( i ) * initialAltitudeStep;
+        std::vector< double > upperLogDensities = logDensityFunction( upperAltitude );
+        refineAltitudeInterval( altitudes.back( ), upperAltitude, lowerLogDensities, upperLogDensities,
+                                logDensityFunction, gridSettings, altitudes );
+        lowerLogDensities = upperLogDensities;
+    }
+
+    // Compute table; time is varied in the outermost loop, so that time-dependent computations in the atmosphere model
+    // can be reused for subsequent calls.
+    boost::multi_array< Eigen::Vector4d, 4 > tabulatedData(
+                boost::extents[ altitudes.size( ) ][ latitudes.size( ) ][ localSolarTimes.size( ) ][ times.size( ) ] );
+    for( unsigned int l = 0; l < times.size( ); l++ )
+    {
+        for( unsigned int k = 0; k < localSolarTimes.size( ); k++ )
+        {
+            double currentLongitude = computeLongitudeFromLocalSolarTime( localSolarTimes.at( k ), times.at( l ) );
+            for( unsigned int j = 0; j < latitudes.size( ); j++ )
+            {
+                for( unsigned int i = 0; i < altitudes.size( ); i++ )
+                {
+                    Eigen::Vector4d& currentEntry = tabulatedData[ i ][ j ][ k ][ l ];
+                    currentEntry( 0 ) = std::log( atmosphereModel->getDensity(
+                                                      altitudes.at( i ), currentLongitude, latitudes.at( j ), times.at( l ) ) );
+                    currentEntry( 1 ) = std::log( atmosphereModel->getPressure(
+                                                      altitudes.at( i ), currentLongitude, latitudes.at( j ), times.at( l ) ) );
+                    currentEntry( 2 ) = atmosphereModel->getTemperature(
+                                altitudes.at( i ), currentLongitude, latitudes.at( j ), times.at( l ) );
+                    currentEntry( 3 ) = atmosphereModel->getSpeedOfSound(
+                                altitudes.at( i ), currentLongitude, latitudes.at( j ), times.at( l ) );
+                }
+            }
+        }
+    }
+
+    std::shared_ptr< PrecomputedAtmosphere > precomputedAtmosphere = std::make_shared< PrecomputedAtmosphere >(
+                altitudes, latitudes.size( ), localSolarTimes.size( ), times, tabulatedData, TUDAT_NAN, boundaryHandling );
+    tabulatedData.resize( boost::extents[ 0 ][ 0 ][ 0 ][ 0 ] );
+
+    // Determine interpolation error at centers of pseudo-randomly selected grid cells (fixed seed, for reproducibility)
+    std::mt19937 randomNumberGenerator( 0 );
+    std::vector< unsigned int > gridSizes =
+    { static_cast< unsigned int >( altitudes.size( ) ), static_cast< unsigned int >( latitudes.size( ) ),
+      static_cast< unsigned int >( localSolarTimes.size( ) ), static_cast< unsigned int >( times.size( ) ) };
+    std::vector< std::vector< double > > gridValues = { altitudes, latitudes, localSolarTimes, times };
+    double maximumSampledRelativeDensityError = 0.0;
+    Eigen::Vector4d checkPoint;
+    for( unsigned int i = 0; i < gridSettings.numberOfErrorCheckPoints_; i++ )
+    {
+        for( unsigned int j = 0; j < 4; j++ )
+        {
+            unsigned int cellIndex = randomNumberGenerator( ) % ( gridSizes.at( j ) - 1 );
+            checkPoint( j ) = 0.5 * ( gridValues.at( j ).at( cellIndex ) + gridValues.at( j ).at( cellIndex + 1 ) );
+        }
+        double checkLongitude = computeLongitudeFromLocalSolarTime( checkPoint( 2 ), checkPoint( 3 ) );
+        double trueDensity = atmosphereModel->getDensity( checkPoint( 0 ), checkLongitude, checkPoint( 1 ), checkPoint( 3 ) );
+        double interpolatedDensity = precomputedAtmosphere->getDensity(
+                    checkPoint( 0 ), checkLongitude, checkPoint( 1 ), checkPoint( 3 ) );
+        double currentError = std::fabs( interpolatedDensity / trueDensity - 1.0 );
+        if( !( currentError <= maximumSampledRelativeDensityError ) )
+        {
+            maximumSampledRelativeDensityError = currentError;
+        }
+    }
+
+    precomputedAtmosphere->setMaximumSampledRelativeDensityError( maximumSampledRelativeDensityError );
+
+    return precomputedAtmosphere;
+}
+
+//! Function to compute a fingerprint of an atmosphere model, used to identify the model from which a table was generated
+uint64_t computeAtmosphereModelFingerprint(
+        const std::shared_ptr< AtmosphereModel > atmosphereModel,
+        const PrecomputedAtmosphereGridSettings& gridSettings )
+{
+    uint64_t fingerprint = utilities::FNV1A_HASH_OFFSET_BASIS;
+    std::string modelType = typeid( *atmosphereModel ).name( );
+    fingerprint = utilities::updateFnv1aHash( fingerprint, modelType.data( ), modelType.size( ) );
+
+    double finalTime = gridSettings.startTime_ +
+            static_cast< double >( gridSettings.getNumberOfTimes( ) - 1 ) * gridSettings.timeStep_;
+    for( double time : { gridSettings.startTime_, 0.5 * ( gridSettings.startTime_ + finalTime ), finalTime } )
+    {
+        for( double altitude : { gridSettings.minimumAltitude_,
+                                 0.5 * ( gridSettings.minimumAltitude_ + gridSettings.maximumAltitude_ ),
+                                 gridSettings.maximumAltitude_ } )
+        {
+            for( double latitude : { -mathematical_constants::PI / 3.0, 0.0, mathematical_constants::PI / 3.0 } )
+            {
+                for( double longitude : { -mathematical_constants::PI / 2.0, mathematical_constants::PI / 2.0 } )
+                {
+                    double properties[ 3 ] =
+                    { atmosphereModel->getDensity( altitude, longitude, latitude, time ),
+                      atmosphereModel->getPressure( altitude, longitude, latitude, time ),
+                      atmosphereModel->getTemperature( altitude, longitude, latitude, time ) };
+                    fingerprint = utilities::updateFnv1aHash( fingerprint, properties, sizeof( properties ) );
+                }
+            }
+        }
+    }
+    return fingerprint;
+}
+
+//! Function to read a precomputed atmosphere table from a binary file
+std::shared_ptr< PrecomputedAtmosphere > readPrecomputedAtmosphereFromFile(
+        const std::string& fileName,
+        const PrecomputedAtmosphereGridSettings& gridSettings,
+        const uint64_t baseModelFingerprint,
+        const interpolators::BoundaryInterpolationType boundaryHandling )
+{
+    std::ifstream inputFile( fileName, std::ios::binary );
+    if( !inputFile.good( ) )
+    {
+        return nullptr;
+    }
+
+    // Read and check header
+    PrecomputedAtmosphereFileHeader header;
+    inputFile.read( reinterpret_cast< char* >( &header ), sizeof( PrecomputedAtmosphereFileHeader ) );
+    if( !inputFile.good( ) ||
+            std::memcmp( header.fileIdentifier_, precomputedAtmosphereFileIdentifier, 8 ) != 0 )
+    {
+        throw std::runtime_error( "Error when reading precomputed atmosphere, file " + fileName +
+                                  " is not a precomputed atmosphere file" );
+    }
+    else if( header.byteOrderMarker_ != precomputedAtmosphereByteOrderMarker )
+    {
+        throw std::runtime_error( "Error when reading precomputed atmosphere, file " + fileName +
+                                  " was written with different byte order" );
+    }
+
+    // Check if file was written in current format (older files are regenerated)
+    if( header.fileVersion_ != PRECOMPUTED_ATMOSPHERE_FILE_VERSION )
+    {
+        return nullptr;
+    }
+
+    // Check if table was generated with requested settings, from the same atmosphere model
+    if( header.baseModelFingerprint_ != baseModelFingerprint ||
+            header.numberOfLatitudes_ != gridSettings.numberOfLatitudes_ ||
+            header.numberOfLocalSolarTimes_ != gridSettings.numberOfLocalSolarTimes_ ||
+            header.numberOfTimes_ != gridSettings.getNumberOfTimes( ) ||
+            header.minimumAltitude_ != gridSettings.minimumAltitude_ ||
+            header.maximumAltitude_ != gridSettings.maximumAltitude_ ||
+            header.initialAltitudeStep_ != gridSettings.initialAltitudeStep_ ||
+            header.minimumAltitudeStep_ != gridSettings.minimumAltitudeStep_ ||
+            header.densityTolerance_ != gridSettings.densityTolerance_ ||
+            header.startTime_ != gridSettings.startTime_ ||
+            header.timeStep_ != gridSettings.timeStep_ )
+    {
+        return nullptr;
+    }
+
+    // Read altitudes and table entries
+    std::vector< double > altitudes( header.numberOfAltitudes_ );
+    inputFile.read( reinterpret_cast< char* >( altitudes.data( ) ), altitudes.size( ) * sizeof( double ) );
+
+    boost::multi_array< Eigen::Vector4d, 4 > tabulatedData(
+                boost::extents[ header.numberOfAltitudes_ ][ header.numberOfLatitudes_ ]
+            [ header.numberOfLocalSolarTimes_ ][ header.numberOfTimes_ ] );
+    inputFile.read( reinterpret_cast< char* >( tabulatedData.data( ) ),
+                    tabulatedData.num_elements( ) * sizeof( Eigen::Vector4d ) );
+    if( !inputFile.good( ) )
+    {
+        throw std::runtime_error( "Error when reading precomputed atmosphere, file " + fileName + " is truncated" );
+    }
+
+    std::vector< double > times( header.numberOfTimes_ );
+    for( unsigned int i = 0; i < times.size( ); i++ )
+    {
+        times[ i ] = header.startTime_ + static_cast< double >( i ) * header.timeStep_;
+    }
+
+    return std::make_shared< PrecomputedAtmosphere >(
+                altitudes, header.numberOfLatitudes_, header.numberOfLocalSolarTimes_, times, tabulatedData,
+                header.maximumSampledRelativeDensityError_, boundaryHandling );
+}
+
+//! Function to create a precomputed atmosphere, using a table stored on disk if available.
+std::shared_ptr< PrecomputedAtmosphere > createPrecomputedAtmosphere(
+        const std::shared_ptr< AtmosphereModel > atmosphereModel,
+        const PrecomputedAtmosphereGridSettings& gridSettings,
+        const std::string& cacheFileName,
+        const interpolators::BoundaryInterpolationType boundaryHandling )
+{
+    std::shared_ptr< PrecomputedAtmosphere > precomputedAtmosphere;
+    uint64_t baseModelFingerprint = 0;
+    if( cacheFileName != "" )
+    {
+        baseModelFingerprint = computeAtmosphereModelFingerprint( atmosphereModel, gridSettings );
+        if( boost::filesystem::exists( cacheFileName ) )
+        {
+            precomputedAtmosphere = readPrecomputedAtmosphereFromFile(
+                        cacheFileName, gridSettings, baseModelFingerprint, boundaryHandling );
+        }
+    }
+
+    if( precomputedAtmosphere == nullptr )
+    {
+        precomputedAtmosphere = computePrecomputedAtmosphere( atmosphereModel, gridSettings, boundaryHandling );
+        if( cacheFileName != "" )
+        {
+            precomputedAtmosphere->writeToFile( cacheFileName, gridSettings, baseModelFingerprint );
+        }
+    }
+
+    return precomputedAtmosphere;
+}
+
+} // namespace aerodynamics
+
+} // namespace tudat
@@ -17,69 +17,20 @@ namespace tudat
 namespace earth_orientation
 {
 
-//! Function to sum all the corrcetion terms.
+//! Function to convert output of correctionSeries_ for a single epoch to OutputType
 template< >
-double ShortPeriodEarthOrientationCorrectionCalculator< double >::sumCorrectionTerms( const Eigen::Vector6d& arguments )
+double ShortPeriodEarthOrientationCorrectionCalculator< double >::convertSeriesOutput(
+        const Eigen::Matrix< double, 1, 1 >& seriesOutput )
 {
-    // Initialize corrections to zero.
-    double currentCorrection = 0;
-    double tideAngle = 0.0;
-
-    // Iterate over all correction types
-    for( unsigned int i = 0; i < argumentAmplitudes_.size( ); i++ )
-    {
-        Eigen::MatrixXd currentArgumentMultipliers = argumentMultipliers_.at( i );
-        Eigen::MatrixXd currentAmplitudes = argumentAmplitudes_.at( i );
-
-        // Iterte over all libration corrections.
-        for( int j = 0; j < currentAmplitudes.rows( ); j++ )
-        {
-            // Calculate current phase angle of tide.
-            tideAngle = ( arguments.transpose( ) *
-                          currentArgumentMultipliers.block( j, 0, 1, 6 ).transpose( ) )( 0, 0 );
-
-            currentCorrection += currentAmplitudes( j, 0 ) * std::sin( tideAngle ) +
-                    currentAmplitudes( j, 1 ) * std::cos( tideAngle );
-        }
-    }
-
-
-    return currentCorrection;
+    return seriesOutput( 0 );
 }
 
-//! Function to sum all the corrcetion terms.
+//! Function to convert output of correctionSeries_ for a single epoch to OutputType
 template< >
-Eigen::Vector2d ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d >::sumCorrectionTerms(
-        const Eigen::Vector6d& arguments )
+Eigen::Vector2d ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d >::convertSeriesOutput(
+        const Eigen::Vector2d& seriesOutput )
 {
-
-    // Initialize corrections to zero.
-    Eigen::Vector2d currentCorrection = Eigen::Vector2d::Zero( );
-    double tideAngle = 0.0;
-
-    // Iterate over all correction types
-    for( unsigned int i = 0; i < argumentAmplitudes_.size( ); i++ )
-    {
-        Eigen::MatrixXd currentArgumentMultipliers = argumentMultipliers_.at( i );
-        Eigen::MatrixXd currentAmplitudes = argumentAmplitudes_.at( i );
-
-        // Iterte over all libration corrections.
-        for( int j = 0; j < currentAmplitudes.rows( ); j++ )
-        {
-            // Calculate current phase angle of tide.
-            tideAngle = ( arguments.transpose( ) *
-                          currentArgumentMultipliers.block( j, 0, 1, 6 ).transpose( ) )( 0, 0 );
-
-            // Calculate and add sine and cosine terms
-            currentCorrection.x( ) += currentAmplitudes( j, 0 ) * std::sin( tideAngle ) +
-                    currentAmplitudes( j, 1 ) * std::cos( tideAngle );
-            currentCorrection.y( ) += currentAmplitudes( j, 2 ) * std::sin( tideAngle ) +
-                    currentAmplitudes( j, 3 ) * std::cos( tideAngle );
-        }
-    }
-
-
-    return currentCorrection;
+    return seriesOutput;
 }
 
 //! Function to retrieve the default UT1 short-period correction calculator
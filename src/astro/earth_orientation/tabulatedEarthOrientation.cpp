@@ -0,0 +1,346 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+
+#include "tudat/astro/earth_orientation/tabulatedEarthOrientation.h"
+#include "tudat/astro/basic_astro/physicalConstants.h"
+#include "tudat/basics/utilities.h"
+
+namespace tudat
+{
+
+namespace earth_orientation
+{
+
+//! File identifier of binary Earth orientation table files
+static const char earthOrientationTableFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'E', 'O', 'T' };
+
+//! Byte order marker of binary Earth orientation table files
+static const uint32_t earthOrientationTableByteOrderMarker = 0x01020304;
+
+//! Function to compute fingerprints of the EOP data and short-period corrections used by an Earth orientation calculator
+std::pair< uint64_t, uint64_t > computeEarthOrientationTableFingerprints(
+        const std::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator,
+        const double intervalStart,
+        const double intervalEnd )
+{
+    std::shared_ptr< PolarMotionCalculator > polarMotionCalculator =
+            earthOrientationCalculator->getPolarMotionCalculator( );
+    std::shared_ptr< PrecessionNutationCalculator > precessionNutationCalculator =
+            earthOrientationCalculator->getPrecessionNutationCalculator( );
+    std::shared_ptr< TerrestrialTimeScaleConverter > timeScaleConverter =
+            earthOrientationCalculator->getTerrestrialTimeScaleConverter( );
+
+    // Hash daily EOP values, sampled (at most) daily over the interval
+    uint64_t eopDataFingerprint = utilities::FNV1A_HASH_OFFSET_BASIS;
+    int numberOfEopSamples = std::min( 100000, static_cast< int >( std::ceil(
+                                           ( intervalEnd - intervalStart ) / physical_constants::JULIAN_DAY ) ) + 1 );
+    for( int i = 0; i < numberOfEopSamples; i++ )
+    {
+        double currentTime = intervalStart + ( intervalEnd - intervalStart ) * static_cast< double >( i ) /
+                static_cast< double >( std::max( numberOfEopSamples - 1, 1 ) );
+        Eigen::Vector5d currentValues = Eigen::Vector5d::Zero( );
+        if( polarMotionCalculator->getDailyIersValueInterpolator( ) != nullptr )
+        {
+            currentValues.segment< 2 >( 0 ) =
+                    polarMotionCalculator->getDailyIersValueInterpolator( )->interpolate( currentTime );
+        }
+        if( precessionNutationCalculator->getDailyCorrectionInterpolator( ) != nullptr )
+        {
+            currentValues.segment< 2 >( 2 ) =
+                    precessionNutationCalculator->getDailyCorrectionInterpolator( )->interpolate( currentTime );
+        }
+        if( timeScaleConverter->getDailyUtcUt1CorrectionInterpolator( ) != nullptr )
+        {
+            currentValues( 4 ) = timeScaleConverter->getDailyUtcUt1CorrectionInterpolator( )->interpolate( currentTime );
+        }
+        eopDataFingerprint = utilities::updateFnv1aHash( eopDataFingerprint, currentValues.data( ), 5 * sizeof( double ) );
+    }
+
+    // Hash short-period polar motion and UT1 corrections
+    uint64_t shortPeriodCorrectionsFingerprint = utilities::FNV1A_HASH_OFFSET_BASIS;
+    const int numberOfShortPeriodSamples = 101;
+    for( int i = 0; i < numberOfShortPeriodSamples; i++ )
+    {
+        double currentTime = intervalStart + ( intervalEnd - intervalStart ) * static_cast< double >( i ) /
+                static_cast< double >( numberOfShortPeriodSamples - 1 );
+        Eigen::Vector3d currentValues = Eigen::Vector3d::Zero( );
+        if( polarMotionCalculator->getShortPeriodPolarMotionCalculator( ) != nullptr )
+        {
+            currentValues.segment< 2 >( 0 ) =
+                    polarMotionCalculator->getShortPeriodPolarMotionCalculator( )->getCorrections( currentTime );
+        }
+        if( timeScaleConverter->getShortPeriodUt1CorrectionCalculator( ) != nullptr )
+        {
+            currentValues( 2 ) = timeScaleConverter->getShortPeriodUt1CorrectionCalculator( )->getCorrections( currentTime );
+        }
+        shortPeriodCorrectionsFingerprint = utilities::updateFnv1aHash(
+                    shortPeriodCorrectionsFingerprint, currentValues.data( ), 3 * sizeof( double ) );
+    }
+
+    return std::make_pair( eopDataFingerprint, shortPeriodCorrectionsFingerprint );
+}
+
+//! Function to compute an Earth orientation table and write it to a binary file.
+void writeEarthOrientationTableToFile(
+        const std::string& fileName,
+        const std::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator,
+        const double intervalStart,
+        const double intervalEnd,
+        const double timeStep,
+        const basic_astrodynamics::TimeScales timeScale,
+        const unsigned int numberOfInterpolationPoints )
+{
+    if( !( timeStep > 0.0 ) || !( intervalEnd > intervalStart ) )
+    {
+        throw std::runtime_error( "Error when writing Earth orientation table, time interval or step size is invalid" );
+    }
+
+    if( numberOfInterpolationPoints < 2 || numberOfInterpolationPoints > 32 || numberOfInterpolationPoints % 2 != 0 )
+    {
+        throw std::runtime_error( "Error when writing Earth orientation table, number of interpolation points must be even, "
+                                  "and between 2 and 32" );
+    }
+
+    // Set up file header
+    EarthOrientationTableHeader header;
+    std::memset( &header, 0, sizeof( EarthOrientationTableHeader ) );
+    std::memcpy( header.fileIdentifier_, earthOrientationTableFileIdentifier, 8 );
+    header.fileVersion_ = EARTH_ORIENTATION_TABLE_FILE_VERSION;
+    header.byteOrderMarker_ = earthOrientationTableByteOrderMarker;
+    header.timeScale_ = static_cast< uint32_t >( timeScale );
+    header.precessionNutationTheory_ = static_cast< uint32_t >(
+                earthOrientationCalculator->getPrecessionNutationCalculator( )->getPrecessionNutationTheory( ) );
+    header.numberOfColumns_ = EARTH_ORIENTATION_TABLE_NUMBER_OF_COLUMNS;
+    header.numberOfInterpolationPoints_ = numberOfInterpolationPoints;
+    header.numberOfEpochs_ = static_cast< uint64_t >( std::ceil( ( intervalEnd - intervalStart ) / timeStep ) ) + 1;
+    header.startTime_ = intervalStart;
+    header.timeStep_ = timeStep;
+    std::pair< uint64_t, uint64_t > tableFingerprints = computeEarthOrientationTableFingerprints(
+                earthOrientationCalculator, intervalStart,
+                intervalStart + static_cast< double >( header.numberOfEpochs_ - 1 ) * timeStep );
+    header.eopDataFingerprint_ = tableFingerprints.first;
+    header.shortPeriodCorrectionsFingerprint_ = tableFingerprints.second;
+
+    if( header.numberOfEpochs_ < numberOfInterpolationPoints )
+    {
+        throw std::runtime_error( "Error when writing Earth orientation table, number of epochs is smaller than number of "
+                                  "interpolation points" );
+    }
+
+    std::ofstream outputFile( fileName, std::ios::binary | std::ios::trunc );
+    if( !outputFile.good( ) )
+    {
+        throw std::runtime_error( "Error when writing Earth orientation table, could not open file " + fileName );
+    }
+    outputFile.write( reinterpret_cast< const char* >( &header ), sizeof( EarthOrientationTableHeader ) );
+
+    // Compute and write table entries; UT1 is computed in extended precision and stored as offset w.r.t. the input time.
+    double currentEntries[ EARTH_ORIENTATION_TABLE_NUMBER_OF_COLUMNS ];
+    std::pair< Eigen::Vector5d, Time > currentRotationValues;
+    for( uint64_t i = 0; i < header.numberOfEpochs_; i++ )
+    {
+        Time currentTime = Time( intervalStart ) + static_cast< double >( i ) * timeStep;
+        currentRotationValues = earthOrientationCalculator->getRotationAnglesFromItrsToGcrs< Time >(
+                    currentTime, timeScale );
+        for( unsigned int j = 0; j < 5; j++ )
+        {
+            currentEntries[ j ] = currentRotationValues.first( j );
+        }
+        currentEntries[ 5 ] = static_cast< double >( currentRotationValues.second - currentTime );
+        outputFile.write( reinterpret_cast< const char* >( currentEntries ), sizeof( currentEntries ) );
+    }
+
+    if( !outputFile.good( ) )
+    {
+        throw std::runtime_error( "Error when writing Earth orientation table, failed to write file " + fileName );
+    }
+}
+
+//! Constructor, maps the table file into memory and checks its consistency.
+TabulatedEarthOrientationAngles::TabulatedEarthOrientationAngles( const std::string& fileName ):
+    fileName_( fileName )
+{
+    try
+    {
+        fileMapping_ = boost::interprocess::file_mapping( fileName.c_str( ), boost::interprocess::read_only );
+        mappedRegion_ = boost::interprocess::mapped_region( fileMapping_, boost::interprocess::read_only );
+    }
+    catch( const boost::interprocess::interprocess_exception& caughtException )
+    {
+        throw std::runtime_error( "Error when loading Earth orientation table, could not map file " + fileName + ": " +
+                                  caughtException.what( ) );
+    }
+
+    // Check file header
+    if( mappedRegion_.get_size( ) < sizeof( EarthOrientationTableHeader ) )
+    {
+        throw std::runtime_error( "Error when loading Earth orientation table, file " + fileName + " is too small" );
+    }
+    std::memcpy( &header_, mappedRegion_.get_address( ), sizeof( EarthOrientationTableHeader ) );
+
+    if( std::memcmp( header_.fileIdentifier_, earthOrientationTableFileIdentifier, 8 ) != 0 )
+    {
+        throw std::runtime_error( "Error when loading Earth orientation table, file " + fileName +
+                                  " is not an Earth orientation table" );
+    }
+    else if( header_.byteOrderMarker_ != earthOrientationTableByteOrderMarker )
+    {
+        throw std::runtime_error( "Error when loading Earth orientation table, file " + fileName +
+                                  " was written with different byte order" );
+    }
+    else if( header_.fileVersion_ != EARTH_ORIENTATION_TABLE_FILE_VERSION )
+    {
+        throw std::runtime_error( "Error when loading Earth orientation table, file " + fileName + " has version " +
+                                  std::to_string( header_.fileVersion_ ) + ", expected version " +
+                                  std::to_string( EARTH_ORIENTATION_TABLE_FILE_VERSION ) );
+    }
+    else if( header_.numberOfColumns_ != EARTH_ORIENTATION_TABLE_NUMBER_OF_COLUMNS )
+    {
+        throw std::runtime_error( "Error when loading Earth orientation table, file " + fileName +
+                                  " has inconsistent number of columns" );
+    }
+    else if( header_.numberOfInterpolationPoints_ < 2 || header_.numberOfInterpolationPoints_ > 32 ||
+             header_.numberOfInterpolationPoints_ % 2 != 0 ||
+             header_.numberOfEpochs_ < header_.numberOfInterpolationPoints_ || !( header_.timeStep_ > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when loading Earth orientation table, file " + fileName +
+                                  " has inconsistent table settings" );
+    }
+    else if( mappedRegion_.get_size( ) != sizeof( EarthOrientationTableHeader ) +
+             header_.numberOfEpochs_ * header_.numberOfColumns_ * sizeof( double ) )
+    {
+        throw std::runtime_error( "Error when loading Earth orientation table, file " + fileName +
+                                  " has inconsistent size" );
+    }
+
+    tableEntries_ = reinterpret_cast< const double* >(
+                static_cast< const char* >( mappedRegion_.get_address( ) ) + sizeof( EarthOrientationTableHeader ) );
+    inverseTimeStep_ = 1.0 / header_.timeStep_;
+
+    // Precompute Lagrange denominators for equidistant nodes: prod_{k!=j}( j - k ) = ( -1 )^( n - 1 - j ) j! ( n - 1 - j )!
+    int numberOfPoints = static_cast< int >( header_.numberOfInterpolationPoints_ );
+    lagrangeWeightDenominators_.resize( numberOfPoints );
+    for( int j = 0; j < numberOfPoints; j++ )
+    {
+        double denominator = 1.0;
+        for( int k = 0; k < numberOfPoints; k++ )
+        {
+            if( k != j )
+            {
+                denominator *= static_cast< double >( j - k );
+            }
+        }
+        lagrangeWeightDenominators_[ j ] = 1.0 / denominator;
+    }
+}
+
+//! Function to interpolate all table entries (X, Y, s, x_p, y_p, UT1 minus time) at given time
+Eigen::Vector6d TabulatedEarthOrientationAngles::interpolateTableEntries( const double time ) const
+{
+    if( !( time >= getStartTime( ) && time <= getEndTime( ) ) )
+    {
+        throw std::runtime_error( "Error when interpolating Earth orientation table " + fileName_ + ", time " +
+                                  std::to_string( time ) + " is outside of table range [" +
+                                  std::to_string( getStartTime( ) ) + ", " + std::to_string( getEndTime( ) ) + "]" );
+    }
+
+    const int numberOfPoints = static_cast< int >( header_.numberOfInterpolationPoints_ );
+
+    // Determine first node of the interpolation stencil, centered on the current interval where possible
+    double normalizedTime = ( time - header_.startTime_ ) * inverseTimeStep_;
+    int64_t firstNode = static_cast< int64_t >( std::floor( normalizedTime ) ) - numberOfPoints / 2 + 1;
+    if( firstNode < 0 )
+    {
+        firstNode = 0;
+    }
+    else if( firstNode > static_cast< int64_t >( header_.numberOfEpochs_ ) - numberOfPoints )
+    {
+        firstNode = static_cast< int64_t >( header_.numberOfEpochs_ ) - numberOfPoints;
+    }
+    double localTime = normalizedTime - static_cast< double >( firstNode );
+
+    // Compute Lagrange weights from prefix/suffix products, which remains well-defined when evaluating exactly at a node
+    double prefixProducts[ 32 ];
+    double weights[ 32 ];
+    double currentProduct = 1.0;
+    for( int j = 0; j < numberOfPoints; j++ )
+    {
+        prefixProducts[ j ] = currentProduct;
+        currentProduct *= ( localTime - static_cast< double >( j ) );
+    }
+    currentProduct = 1.0;
+    for( int j = numberOfPoints - 1; j >= 0; j-- )
+    {
+        weights[ j ] = prefixProducts[ j ] * currentProduct * lagrangeWeightDenominators_[ j ];
+        currentProduct *= ( localTime - static_cast< double >( j ) );
+    }
+
+    // Accumulate weighted table entries
+    Eigen::Vector6d interpolatedEntries = Eigen::Vector6d::Zero( );
+    const double* currentRow = tableEntries_ + firstNode * EARTH_ORIENTATION_TABLE_NUMBER_OF_COLUMNS;
+    for( int j = 0; j < numberOfPoints; j++ )
+    {
+        interpolatedEntries += weights[ j ] * Eigen::Map< const Eigen::Vector6d >( currentRow );
+        currentRow += EARTH_ORIENTATION_TABLE_NUMBER_OF_COLUMNS;
+    }
+    return interpolatedEntries;
+}
+
+//! Function to retrieve the Earth orientation table from a given file
+std::shared_ptr< TabulatedEarthOrientationAngles > getTabulatedEarthOrientationAngles( const std::string& fileName )
+{
+    static std::map< std::string, std::weak_ptr< TabulatedEarthOrientationAngles > > loadedTables;
+    static std::mutex loadedTablesMutex;
+
+    std::lock_guard< std::mutex > lock( loadedTablesMutex );
+    std::shared_ptr< TabulatedEarthOrientationAngles > table = loadedTables[ fileName ].lock( );
+    if( table == nullptr )
+    {
+        table = std::make_shared< TabulatedEarthOrientationAngles >( fileName );
+        loadedTables[ fileName ] = table;
+    }
+    return table;
+}
+
+//! Function to compute the maximum difference between tabulated and directly computed Earth orientation
+Eigen::Vector6d computeMaximumEarthOrientationTableErrors(
+        const std::shared_ptr< TabulatedEarthOrientationAngles > tabulatedEarthOrientation,
+        const std::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator,
+        const std::vector< double >& testTimes )
+{
+    Eigen::Vector6d maximumErrors = Eigen::Vector6d::Zero( );
+    for( unsigned int i = 0; i < testTimes.size( ); i++ )
+    {
+        Time currentTime = Time( testTimes.at( i ) );
+        std::pair< Eigen::Vector5d, Time > directValues =
+                earthOrientationCalculator->getRotationAnglesFromItrsToGcrs< Time >(
+                    currentTime, tabulatedEarthOrientation->getTimeScale( ) );
+        std::pair< Eigen::Vector5d, Time > tabulatedValues =
+                tabulatedEarthOrientation->getRotationAnglesFromItrsToGcrs< Time >( currentTime );
+
+        Eigen::Vector6d currentErrors;
+        currentErrors.segment< 5 >( 0 ) = ( directValues.first - tabulatedValues.first ).cwiseAbs( );
+        currentErrors( 5 ) = std::fabs( static_cast< double >( directValues.second - tabulatedValues.second ) );
+        maximumErrors = maximumErrors.cwiseMax( currentErrors );
+    }
+    return maximumErrors;
+}
+
+} // namespace earth_orientation
+
+} // namespace tudat
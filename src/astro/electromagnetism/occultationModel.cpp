@@ -37,6 +37,16 @@ double SingleOccultingBodyOccultationModel::evaluateReceivedFractionFromExtended
         const std::shared_ptr<basic_astrodynamics::BodyShapeModel>& occultedSourceShapeModel,
         const Eigen::Vector3d& targetPosition) const
 {
+    if (isPointOutsidePenumbraCone(
+            occultedSourcePosition,
+            occultedSourceShapeModel->getAverageRadius(),
+            occultingBodyPosition,
+            occultingBodyShapeModel_->getAverageRadius(),
+            targetPosition))
+    {
+        return 1.0;
+    }
+
     const auto shadowFunction = mission_geometry::computeShadowFunction(
             occultedSourcePosition,
             occultedSourceShapeModel->getAverageRadius(),
@@ -73,6 +83,17 @@ double SimpleMultipleOccultingBodyOccultationModel::evaluateReceivedFractionFrom
     unsigned int numberOfCurrentlyOccultingBodies = 0;
     for (unsigned int i = 0; i < getNumberOfOccultingBodies(); i++)
     {
+        if (isPointOutsidePenumbraCone(
+                occultedSourcePosition,
+                occultedSourceShapeModel->getAverageRadius(),
+                occultingBodyPositions[i],
+                occultingBodyShapeModels_[i]->getAverageRadius(),
+                targetPosition))
+        {
+            // Target not shadowed by this body
+            continue;
+        }
+
         shadowFunctionOfBody = mission_geometry::computeShadowFunction(
                 occultedSourcePosition,
                 occultedSourceShapeModel->getAverageRadius(),
@@ -127,9 +148,25 @@ bool evaluatePointToPointVisibilityWithOccultation(
         double occultingBodyRadius,
         const Eigen::Vector3d& targetPosition)
 {
-    // Vallado (2013), Sec. 5.3.3
     const Eigen::Vector3d sourceToOccultingBodyVector = occultedSourcePosition - occultingBodyPosition;
     const Eigen::Vector3d targetToOccultingBodyVector = targetPosition - occultingBodyPosition;
+
+    // If the line through source and target does not intersect the occulting body, the target is always visible. This
+    // avoids the trigonometric functions below for most source/target pairs.
+    const Eigen::Vector3d sourceToTargetVector = targetPosition - occultedSourcePosition;
+    const double sourceToTargetSquaredDistance = sourceToTargetVector.squaredNorm();
+    if (sourceToTargetSquaredDistance > 0)
+    {
+        const double projection = targetToOccultingBodyVector.dot(sourceToTargetVector);
+        const double lineToOccultingBodySquaredDistance =
+                targetToOccultingBodyVector.squaredNorm() - projection * projection / sourceToTargetSquaredDistance;
+        if (lineToOccultingBodySquaredDistance > occultingBodyRadius * occultingBodyRadius)
+        {
+            return true;
+        }
+    }
+
+    // Vallado (2013), Sec. 5.3.3
     const double theta =
             acos(linear_algebra::computeCosineOfAngleBetweenVectors(sourceToOccultingBodyVector, targetToOccultingBodyVector));
     const double theta1 = acos(occultingBodyRadius / sourceToOccultingBodyVector.norm());
@@ -139,5 +176,42 @@ bool evaluatePointToPointVisibilityWithOccultation(
     return isSourceVisibleFromTarget;
 }
 
+bool isPointOutsidePenumbraCone(
+        const Eigen::Vector3d& occultedSourcePosition,
+        const double occultedSourceRadius,
+        const Eigen::Vector3d& occultingBodyPosition,
+        const double occultingBodyRadius,
+        const Eigen::Vector3d& targetPosition)
+{
+    const Eigen::Vector3d occultingBodyToSourceVector = occultedSourcePosition - occultingBodyPosition;
+    const double occultingBodyToSourceDistance = occultingBodyToSourceVector.norm();
+    const double sumOfRadii = occultedSourceRadius + occultingBodyRadius;
+    if (occultingBodyToSourceDistance <= sumOfRadii)
+    {
+        // Bodies overlap, no cone can be defined
+        return false;
+    }
+
+    // Position of target along (towards source) and perpendicular to axis from occulting body to source
+    const Eigen::Vector3d targetPositionRelativeToOccultingBody = targetPosition - occultingBodyPosition;
+    const double axialDistance =
+            targetPositionRelativeToOccultingBody.dot(occultingBodyToSourceVector) / occultingBodyToSourceDistance;
+    if (axialDistance >= occultingBodyRadius)
+    {
+        // Target is in front of occulting body
+        return true;
+    }
+    const double squaredPerpendicularDistance =
+            targetPositionRelativeToOccultingBody.squaredNorm() - axialDistance * axialDistance;
+
+    // Apex of penumbra cone lies between the bodies, with half-angle alpha such that sin(alpha) = sumOfRadii / distance
+    const double apexDistance = occultingBodyToSourceDistance * occultingBodyRadius / sumOfRadii;
+    const double sineOfHalfAngle = sumOfRadii / occultingBodyToSourceDistance;
+    const double squaredTangentOfHalfAngle = sineOfHalfAngle * sineOfHalfAngle / (1.0 - sineOfHalfAngle * sineOfHalfAngle);
+    const double distanceFromApex = apexDistance - axialDistance;
+
+    return squaredPerpendicularDistance > distanceFromApex * distanceFromApex * squaredTangentOfHalfAngle;
+}
+
 } // electromagnetism
 } // tudat
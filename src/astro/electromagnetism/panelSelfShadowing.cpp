@@ -0,0 +1,356 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include "tudat/astro/electromagnetism/panelSelfShadowing.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "tudat/basics/utilities.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+
+
+namespace tudat
+{
+namespace electromagnetism
+{
+
+PanelBoundingVolumeHierarchy::PanelBoundingVolumeHierarchy(
+        const std::vector< Eigen::Vector3d >& panelCentroids,
+        const std::vector< Eigen::Vector3d >& panelNormals,
+        const std::vector< double >& panelRadii,
+        const unsigned int maximumNumberOfPanelsPerLeaf ):
+    panelCentroids_( panelCentroids ),
+    panelNormals_( panelNormals ),
+    panelRadii_( panelRadii ),
+    maximumNumberOfPanelsPerLeaf_( std::max( maximumNumberOfPanelsPerLeaf, 1u ) )
+{
+    if( panelNormals_.size( ) != panelCentroids_.size( ) || panelRadii_.size( ) != panelCentroids_.size( ) )
+    {
+        throw std::runtime_error( "Error when creating panel bounding volume hierarchy, inconsistent panel input sizes." );
+    }
+
+    // Compute bounding box of each disk: extent along axis i is r * sqrt( 1 - n_i^2 )
+    double maximumExtent = 0.0;
+    for( unsigned int i = 0; i < panelCentroids_.size( ); i++ )
+    {
+        Eigen::Vector3d halfExtent;
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            halfExtent( j ) = panelRadii_.at( i ) *
+                    std::sqrt( std::max( 0.0, 1.0 - panelNormals_.at( i )( j ) * panelNormals_.at( i )( j ) ) );
+        }
+        panelMinimumBounds_.push_back( panelCentroids_.at( i ) - halfExtent );
+        panelMaximumBounds_.push_back( panelCentroids_.at( i ) + halfExtent );
+        maximumExtent = std::max( maximumExtent, panelCentroids_.at( i ).cwiseAbs( ).maxCoeff( ) + panelRadii_.at( i ) );
+        orderedPanelIndices_.push_back( i );
+    }
+    minimumIntersectionDistance_ = 1.0E-9 * maximumExtent;
+
+    if( panelCentroids_.size( ) > 0 )
+    {
+        nodes_.reserve( 2 * panelCentroids_.size( ) );
+        buildNode( 0, panelCentroids_.size( ) );
+    }
+}
+
+int PanelBoundingVolumeHierarchy::buildNode( const unsigned int firstPanelIndex, const unsigned int numberOfPanels )
+{
+    Node node;
+    node.minimumBound_ = Eigen::Vector3d::Constant( std::numeric_limits< double >::infinity( ) );
+    node.maximumBound_ = Eigen::Vector3d::Constant( -std::numeric_limits< double >::infinity( ) );
+    Eigen::Vector3d minimumCentroid = node.minimumBound_;
+    Eigen::Vector3d maximumCentroid = node.maximumBound_;
+    for( unsigned int i = firstPanelIndex; i < firstPanelIndex + numberOfPanels; i++ )
+    {
+        unsigned int panelIndex = orderedPanelIndices_.at( i );
+        node.minimumBound_ = node.minimumBound_.cwiseMin( panelMinimumBounds_.at( panelIndex ) );
+        node.maximumBound_ = node.maximumBound_.cwiseMax( panelMaximumBounds_.at( panelIndex ) );
+        minimumCentroid = minimumCentroid.cwiseMin( panelCentroids_.at( panelIndex ) );
+        maximumCentroid = maximumCentroid.cwiseMax( panelCentroids_.at( panelIndex ) );
+    }
+    node.firstChildIndex_ = -1;
+    node.secondChildIndex_ = -1;
+    node.firstPanelIndex_ = firstPanelIndex;
+    node.numberOfPanels_ = numberOfPanels;
+
+    int nodeIndex = nodes_.size( );
+    nodes_.push_back( node );
+
+    if( numberOfPanels > maximumNumberOfPanelsPerLeaf_ )
+    {
+        // Split panels at median centroid along axis of largest extent
+        int splitAxis;
+        ( maximumCentroid - minimumCentroid ).maxCoeff( &splitAxis );
+        unsigned int numberOfPanelsInFirstChild = numberOfPanels / 2;
+        std::nth_element( orderedPanelIndices_.begin( ) + firstPanelIndex,
+                          orderedPanelIndices_.begin( ) + firstPanelIndex + numberOfPanelsInFirstChild,
+                          orderedPanelIndices_.begin( ) + firstPanelIndex + numberOfPanels,
+                          [ & ]( const unsigned int firstIndex, const unsigned int secondIndex )
+        {
+            return panelCentroids_.at( firstIndex )( splitAxis ) < panelCentroids_.at( secondIndex )( splitAxis );
+        } );
+
+        int firstChildIndex = buildNode( firstPanelIndex, numberOfPanelsInFirstChild );
+        int secondChildIndex = buildNode( firstPanelIndex + numberOfPanelsInFirstChild,
+                                          numberOfPanels - numberOfPanelsInFirstChild );
+        nodes_.at( nodeIndex ).firstChildIndex_ = firstChildIndex;
+        nodes_.at( nodeIndex ).secondChildIndex_ = secondChildIndex;
+        nodes_.at( nodeIndex ).numberOfPanels_ = 0;
+    }
+    return nodeIndex;
+}
+
+bool PanelBoundingVolumeHierarchy::doesRayIntersectBox(
+        const Node& node, const Eigen::Vector3d& rayOrigin, const Eigen::Vector3d& inverseRayDirection ) const
+{
+    // Slab test
+    double minimumDistance = -std::numeric_limits< double >::infinity( );
+    double maximumDistance = std::numeric_limits< double >::infinity( );
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        double firstDistance = ( node.minimumBound_( i ) - rayOrigin( i ) ) * inverseRayDirection( i );
+        double secondDistance = ( node.maximumBound_( i ) - rayOrigin( i ) ) * inverseRayDirection( i );
+        if( firstDistance != firstDistance || secondDistance != secondDistance )
+        {
+            // Ray parallel to slab, and origin on its boundary
+            continue;
+        }
+        minimumDistance = std::max( minimumDistance, std::min( firstDistance, secondDistance ) );
+        maximumDistance = std::min( maximumDistance, std::max( firstDistance, secondDistance ) );
+    }
+    return ( maximumDistance >= std::max( minimumDistance, 0.0 ) );
+}
+
+bool PanelBoundingVolumeHierarchy::doesRayIntersectPanel(
+        const unsigned int panelIndex, const Eigen::Vector3d& rayOrigin, const Eigen::Vector3d& rayDirection ) const
+{
+    const Eigen::Vector3d& panelNormal = panelNormals_[ panelIndex ];
+    double directionNormalProjection = panelNormal.dot( rayDirection );
+    if( directionNormalProjection == 0.0 )
+    {
+        return false;
+    }
+
+    double intersectionDistance = panelNormal.dot( panelCentroids_[ panelIndex ] - rayOrigin ) / directionNormalProjection;
+    if( !( intersectionDistance > minimumIntersectionDistance_ ) )
+    {
+        return false;
+    }
+
+    // Points on the edge of the disk do not block the ray, so that adjacent panels sharing an edge do not shadow each other
+    return ( rayOrigin + intersectionDistance * rayDirection - panelCentroids_[ panelIndex ] ).squaredNorm( ) <
+            panelRadii_[ panelIndex ] * panelRadii_[ panelIndex ];
+}
+
+bool PanelBoundingVolumeHierarchy::isRayBlocked(
+        const Eigen::Vector3d& rayOrigin,
+        const Eigen::Vector3d& rayDirection,
+        const int originPanelIndex ) const
+{
+    if( nodes_.size( ) == 0 )
+    {
+        return false;
+    }
+
+    const Eigen::Vector3d inverseRayDirection = rayDirection.cwiseInverse( );
+
+    // Depth-first traversal, terminated at the first intersection found
+    int nodeStack[ 64 ];
+    int stackSize = 0;
+    nodeStack[ stackSize++ ] = 0;
+    while( stackSize > 0 )
+    {
+        const Node& currentNode = nodes_[ nodeStack[ --stackSize ] ];
+        if( !doesRayIntersectBox( currentNode, rayOrigin, inverseRayDirection ) )
+        {
+            continue;
+        }
+
+        if( currentNode.firstChildIndex_ < 0 )
+        {
+            for( unsigned int i = currentNode.firstPanelIndex_;
+                 i < currentNode.firstPanelIndex_ + currentNode.numberOfPanels_; i++ )
+            {
+                unsigned int panelIndex = orderedPanelIndices_[ i ];
+                if( static_cast< int >( panelIndex ) != originPanelIndex &&
+                        doesRayIntersectPanel( panelIndex, rayOrigin, rayDirection ) )
+                {
+                    return true;
+                }
+            }
+        }
+        else
+        {
+            nodeStack[ stackSize++ ] = currentNode.firstChildIndex_;
+            nodeStack[ stackSize++ ] = currentNode.secondChildIndex_;
+        }
+    }
+    return false;
+}
+
+PanelSelfShadowingModel::PanelSelfShadowingModel(
+        const std::vector< std::shared_ptr< system_models::VehicleExteriorPanel > >& panels,
+        const unsigned int numberOfAzimuthPoints,
+        const unsigned int numberOfElevationPoints,
+        const unsigned int numberOfSamplesPerPanelSide,
+        const unsigned int numberOfThreads ):
+    numberOfAzimuthPoints_( numberOfAzimuthPoints ),
+    numberOfElevationPoints_( numberOfElevationPoints )
+{
+    if( numberOfAzimuthPoints_ < 2 || numberOfElevationPoints_ < 2 )
+    {
+        throw std::runtime_error( "Error when creating panel self-shadowing model, at least two azimuth and elevation points are required." );
+    }
+
+    if( numberOfSamplesPerPanelSide < 1 )
+    {
+        throw std::runtime_error( "Error when creating panel self-shadowing model, at least one sample per panel side is required." );
+    }
+
+    // Retrieve panel geometry, and represent each panel by the disk inscribed in the square of equal area. A disk of equal
+    // area would extend beyond the edges of the panel, such that adjacent panels (e.g. the faces of a box) would
+    // erroneously shadow each other.
+    std::vector< Eigen::Vector3d > panelCentroids;
+    std::vector< double > panelRadii;
+    for( unsigned int i = 0; i < panels.size( ); i++ )
+    {
+        Eigen::Vector3d panelCentroid = panels.at( i )->getFrameFixedPositionVector( ) != nullptr ?
+                    panels.at( i )->getFrameFixedPositionVector( )( ) : Eigen::Vector3d::Constant( TUDAT_NAN );
+        if( !panelCentroid.allFinite( ) )
+        {
+            throw std::runtime_error( "Error when creating panel self-shadowing model, position of panel " +
+                                      std::to_string( i ) + " is not defined." );
+        }
+        if( !( panels.at( i )->getPanelArea( ) > 0.0 ) )
+        {
+            throw std::runtime_error( "Error when creating panel self-shadowing model, area of panel " +
+                                      std::to_string( i ) + " is not positive." );
+        }
+        panelCentroids.push_back( panelCentroid );
+        panelNormals_.push_back( panels.at( i )->getFrameFixedSurfaceNormal( )( ).normalized( ) );
+        panelRadii.push_back( 0.5 * std::sqrt( panels.at( i )->getPanelArea( ) ) );
+    }
+
+    boundingVolumeHierarchy_ = std::make_shared< PanelBoundingVolumeHierarchy >(
+                panelCentroids, panelNormals_, panelRadii );
+
+    // Sample each panel on a square grid, retaining points inside the disk
+    for( unsigned int i = 0; i < panelNormals_.size( ); i++ )
+    {
+        Eigen::Vector3d firstInPlaneAxis;
+        int minimumNormalComponentIndex;
+        panelNormals_.at( i ).cwiseAbs( ).minCoeff( &minimumNormalComponentIndex );
+        firstInPlaneAxis = panelNormals_.at( i ).cross(
+                    Eigen::Vector3d::Unit( minimumNormalComponentIndex ) ).normalized( );
+        Eigen::Vector3d secondInPlaneAxis = panelNormals_.at( i ).cross( firstInPlaneAxis );
+
+        std::vector< Eigen::Vector3d > currentSamplePoints;
+        double gridSpacing = 2.0 * panelRadii.at( i ) / static_cast< double >( numberOfSamplesPerPanelSide );
+        for( unsigned int j = 0; j < numberOfSamplesPerPanelSide; j++ )
+        {
+            double firstCoordinate = -panelRadii.at( i ) + ( static_cast< double >( j ) + 0.5 ) * gridSpacing;
+            for( unsigned int k = 0; k < numberOfSamplesPerPanelSide; k++ )
+            {
+                double secondCoordinate = -panelRadii.at( i ) + ( static_cast< double >( k ) + 0.5 ) * gridSpacing;
+                if( firstCoordinate * firstCoordinate + secondCoordinate * secondCoordinate <=
+                        panelRadii.at( i ) * panelRadii.at( i ) )
+                {
+                    currentSamplePoints.push_back(
+                                panelCentroids.at( i ) + firstCoordinate * firstInPlaneAxis +
+                                secondCoordinate * secondInPlaneAxis );
+                }
+            }
+        }
+        panelSamplePoints_.push_back( currentSamplePoints );
+    }
+
+    // Compute illumination fraction table, with each source direction evaluated independently
+    azimuthStep_ = 2.0 * mathematical_constants::PI / static_cast< double >( numberOfAzimuthPoints_ );
+    elevationStep_ = mathematical_constants::PI / static_cast< double >( numberOfElevationPoints_ - 1 );
+    illuminationFractionTable_.setZero( panelNormals_.size( ), numberOfAzimuthPoints_ * numberOfElevationPoints_ );
+    utilities::parallelFor(
+                numberOfAzimuthPoints_ * numberOfElevationPoints_,
+                [ & ]( const unsigned int directionIndex )
+    {
+        Eigen::Vector3d directionToSource = getTableDirection(
+                    directionIndex % numberOfAzimuthPoints_, directionIndex / numberOfAzimuthPoints_ );
+        for( unsigned int i = 0; i < panelNormals_.size( ); i++ )
+        {
+            illuminationFractionTable_( i, directionIndex ) = computeIlluminationFraction( i, directionToSource );
+        }
+    }, utilities::getNumberOfThreadsToUse( numberOfThreads, numberOfAzimuthPoints_ * numberOfElevationPoints_ ) );
+
+    currentIlluminationFractions_ = Eigen::VectorXd::Ones( panelNormals_.size( ) );
+}
+
+double PanelSelfShadowingModel::computeIlluminationFraction(
+        const unsigned int panelIndex,
+        const Eigen::Vector3d& directionToSource ) const
+{
+    const std::vector< Eigen::Vector3d >& samplePoints = panelSamplePoints_.at( panelIndex );
+    unsigned int numberOfIlluminatedPoints = 0;
+    for( unsigned int i = 0; i < samplePoints.size( ); i++ )
+    {
+        if( !boundingVolumeHierarchy_->isRayBlocked( samplePoints[ i ], directionToSource, panelIndex ) )
+        {
+            numberOfIlluminatedPoints++;
+        }
+    }
+    return static_cast< double >( numberOfIlluminatedPoints ) / static_cast< double >( samplePoints.size( ) );
+}
+
+void PanelSelfShadowingModel::updateIlluminationFractions( const Eigen::Vector3d& directionToSource )
+{
+    // Compute source azimuth and elevation in panel frame
+    double azimuth = std::atan2( directionToSource.y( ), directionToSource.x( ) );
+    if( azimuth < 0.0 )
+    {
+        azimuth += 2.0 * mathematical_constants::PI;
+    }
+    double elevation = std::asin( std::max( -1.0, std::min( 1.0, directionToSource.z( ) / directionToSource.norm( ) ) ) );
+
+    // Find surrounding table nodes (azimuth is periodic)
+    double scaledAzimuth = azimuth / azimuthStep_;
+    unsigned int lowerAzimuthIndex = std::min(
+                static_cast< unsigned int >( scaledAzimuth ), numberOfAzimuthPoints_ - 1 );
+    unsigned int upperAzimuthIndex = ( lowerAzimuthIndex + 1 ) % numberOfAzimuthPoints_;
+    double azimuthFraction = std::min( 1.0, scaledAzimuth - static_cast< double >( lowerAzimuthIndex ) );
+
+    double scaledElevation = ( elevation + mathematical_constants::PI / 2.0 ) / elevationStep_;
+    unsigned int lowerElevationIndex = std::min(
+                static_cast< unsigned int >( std::max( scaledElevation, 0.0 ) ), numberOfElevationPoints_ - 2 );
+    double elevationFraction = std::max( 0.0, std::min( 1.0, scaledElevation - static_cast< double >( lowerElevationIndex ) ) );
+
+    // Interpolate illumination fractions bi-linearly
+    unsigned int lowerElevationOffset = lowerElevationIndex * numberOfAzimuthPoints_;
+    unsigned int upperElevationOffset = lowerElevationOffset + numberOfAzimuthPoints_;
+    currentIlluminationFractions_ =
+            ( 1.0 - elevationFraction ) * (
+                ( 1.0 - azimuthFraction ) * illuminationFractionTable_.col( lowerElevationOffset + lowerAzimuthIndex ) +
+                azimuthFraction * illuminationFractionTable_.col( lowerElevationOffset + upperAzimuthIndex ) ) +
+            elevationFraction * (
+                ( 1.0 - azimuthFraction ) * illuminationFractionTable_.col( upperElevationOffset + lowerAzimuthIndex ) +
+                azimuthFraction * illuminationFractionTable_.col( upperElevationOffset + upperAzimuthIndex ) );
+}
+
+Eigen::Vector3d PanelSelfShadowingModel::getTableDirection(
+        const unsigned int azimuthIndex, const unsigned int elevationIndex ) const
+{
+    double azimuth = static_cast< double >( azimuthIndex ) * azimuthStep_;
+    double elevation = -mathematical_constants::PI / 2.0 + static_cast< double >( elevationIndex ) * elevationStep_;
+    return ( Eigen::Vector3d( ) << std::cos( elevation ) * std::cos( azimuth ),
+             std::cos( elevation ) * std::sin( azimuth ),
+             std::sin( elevation ) ).finished( );
+}
+
+} // namespace electromagnetism
+} // namespace tudat
@@ -72,6 +72,7 @@ void PaneledRadiationPressureTargetModel::updateRadiationPressureForcing(
     }
     Eigen::Vector3d currentPanelForce = Eigen::Vector3d::Zero( );
     Eigen::Vector3d currentPanelTorque = Eigen::Vector3d::Zero( );
+    updateIlluminationFractions( sourceToTargetDirectionLocalFrame );
 
     for( unsigned int i = 0; i < segmentFixedPanels_.size( ) + 1; i++ )
     {
@@ -98,7 +99,7 @@ void PaneledRadiationPressureTargetModel::updateRadiationPressureForcing(
             if (surfacePanelCosines_[ counter ] > 0)
             {
                 currentPanelForce = radiationPressure * currentPanels_.at( j )->getPanelArea() * surfacePanelCosines_[ counter ] *
-                    currentPanels_.at( j )->getReflectionLaw()->evaluateReactionVector(surfaceNormals_[ counter ], sourceToTargetDirectionLocalFrame );
+                    getIlluminationFraction( counter ) * currentPanels_.at( j )->getReflectionLaw()->evaluateReactionVector(surfaceNormals_[ counter ], sourceToTargetDirectionLocalFrame );
                 this->currentRadiationPressureForce_[ sourceName ] += currentPanelForce;
                 if( computeTorques_ )
                 {
@@ -152,6 +153,7 @@ Eigen::Vector3d PaneledRadiationPressureTargetModel::evaluateRadiationPressureFo
     auto segmentFixedPanelsIterator = segmentFixedPanels_.begin( );
     int counter = 0;
     Eigen::Quaterniond currentOrientation;
+    updateIlluminationFractions( sourceToTargetDirectionLocalFrame );
 
     for( unsigned int i = 0; i < segmentFixedPanels_.size( ) + 1; i++ )
     {
@@ -172,7 +174,7 @@ Eigen::Vector3d PaneledRadiationPressureTargetModel::evaluateRadiationPressureFo
             if (surfacePanelCosines_[ counter ] > 0)
             {
                 Eigen::Vector3d panelForce = radiationPressure * currentPanels_.at( j )->getPanelArea() * surfacePanelCosines_[ counter ] *
-                    currentPanels_.at( j )->getReflectionLaw()->evaluateReactionVectorPartialWrtDiffuseReflectivity(surfaceNormals_[ counter ], sourceToTargetDirectionLocalFrame );
+                    getIlluminationFraction( counter ) * currentPanels_.at( j )->getReflectionLaw()->evaluateReactionVectorPartialWrtDiffuseReflectivity(surfaceNormals_[ counter ], sourceToTargetDirectionLocalFrame );
                 forcePartialWrtDiffuseReflectivity += panelForce;
             }
 
@@ -196,6 +198,7 @@ Eigen::Vector3d PaneledRadiationPressureTargetModel::evaluateRadiationPressureFo
     auto segmentFixedPanelsIterator = segmentFixedPanels_.begin( );
     int counter = 0;
     Eigen::Quaterniond currentOrientation;
+    updateIlluminationFractions( sourceToTargetDirectionLocalFrame );
 
     for( unsigned int i = 0; i < segmentFixedPanels_.size( ) + 1; i++ )
     {
@@ -216,7 +219,7 @@ Eigen::Vector3d PaneledRadiationPressureTargetModel::evaluateRadiationPressureFo
             if (surfacePanelCosines_[ counter ] > 0)
             {
                 Eigen::Vector3d panelForce = radiationPressure * currentPanels_.at( j )->getPanelArea() * surfacePanelCosines_[ counter ] *
-                    currentPanels_.at( j )->getReflectionLaw()->evaluateReactionVectorPartialWrtSpecularReflectivity(surfaceNormals_[ counter ], sourceToTargetDirectionLocalFrame );
+                    getIlluminationFraction( counter ) * currentPanels_.at( j )->getReflectionLaw()->evaluateReactionVectorPartialWrtSpecularReflectivity(surfaceNormals_[ counter ], sourceToTargetDirectionLocalFrame );
                 forcePartialWrtSpecularReflectivity += panelForce;
             }
 
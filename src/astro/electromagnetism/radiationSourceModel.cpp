@@ -85,6 +85,11 @@ void IsotropicPointRadiationSourceModel::updateMembers_(double currentTime)
 IrradianceWithSourceList PaneledRadiationSourceModel::evaluateIrradianceAtPosition(
         const Eigen::Vector3d& targetPosition)
 {
+    if (usePanelArrays_)
+    {
+        return evaluateIrradianceAtPositionFromPanelArrays(targetPosition);
+    }
+
     IrradianceWithSourceList irradiances{};
 
     visibleArea = 0;
@@ -121,6 +126,71 @@ IrradianceWithSourceList PaneledRadiationSourceModel::evaluateIrradianceAtPositi
     return irradiances;
 }
 
+IrradianceWithSourceList PaneledRadiationSourceModel::evaluateIrradianceAtPositionFromPanelArrays(
+        const Eigen::Vector3d& targetPosition)
+{
+    const unsigned int numberOfPanels = panelAreas_.rows();
+    currentTargetPositionsRelativeToPanels_ = (-panelCenters_).colwise() + targetPosition;
+    currentPanelNormalProjections_ = currentTargetPositionsRelativeToPanels_.cwiseProduct(
+            panelSurfaceNormals_).colwise().sum().transpose().array();
+
+    // Irradiance is factor * cos(angle) / distance^2 = factor * projection / distance^3 for panels facing target
+    const Eigen::ArrayXd squaredDistances =
+            currentTargetPositionsRelativeToPanels_.colwise().squaredNorm().transpose().array();
+    currentPanelIrradiances_ = (currentPanelNormalProjections_ > 0).select(
+            panelIrradianceFactors_.array() * currentPanelNormalProjections_ /
+                    (squaredDistances * squaredDistances.sqrt()), 0.0);
+
+    IrradianceWithSourceList irradiances{};
+    visibleArea = 0;
+    for (unsigned int i = 0; i < numberOfPanels; ++i)
+    {
+        if (currentPanelNormalProjections_(i) <= 0)
+        {
+            continue;
+        }
+
+        visibleArea += panelAreas_(i);
+        if (currentPanelIrradiances_(i) > 0)
+        {
+            irradiances.emplace_back(currentPanelIrradiances_(i), panelCenters_.col(i));
+        }
+    }
+
+    return irradiances;
+}
+
+void PaneledRadiationSourceModel::updatePanelArrays()
+{
+    const auto& panels = getPanels();
+    const unsigned int numberOfPanels = panels.size();
+    panelCenters_.resize(3, numberOfPanels);
+    panelSurfaceNormals_.resize(3, numberOfPanels);
+    panelAreas_.resize(numberOfPanels);
+    panelIrradianceFactors_.resize(numberOfPanels);
+
+    usePanelArrays_ = true;
+    for (unsigned int i = 0; i < numberOfPanels; ++i)
+    {
+        panelCenters_.col(i) = panels[i].getRelativeCenter();
+        panelSurfaceNormals_.col(i) = panels[i].getSurfaceNormal();
+        panelAreas_(i) = panels[i].getArea();
+
+        // The irradiance factor of a panel is the sum of the factors of all of its radiosity models
+        double irradianceFactor = 0;
+        for (auto& radiosityModel : panels[i].getRadiosityModels())
+        {
+            irradianceFactor += radiosityModel->evaluateLambertianIrradianceFactor(
+                    panels[i].getArea(), panels[i].getSurfaceNormal());
+        }
+        if (irradianceFactor != irradianceFactor)
+        {
+            // Non-Lambertian radiosity model, evaluate panel-by-panel
+            usePanelArrays_ = false;
+        }
+        panelIrradianceFactors_(i) = irradianceFactor;
+    }
+}
 
 void StaticallyPaneledRadiationSourceModel::updateMembers_(double currentTime)
 {
@@ -130,6 +200,7 @@ void StaticallyPaneledRadiationSourceModel::updateMembers_(double currentTime)
         panel.updateMembers(currentTime);
         sourcePanelRadiosityModelUpdater_->updatePanel(panel);
     }
+    updatePanelArrays();
 }
 
 void StaticallyPaneledRadiationSourceModel::generatePanels(
@@ -179,9 +250,11 @@ DynamicallyPaneledRadiationSourceModel::DynamicallyPaneledRadiationSourceModel(
         std::unique_ptr<SourcePanelRadiosityModelUpdater> sourcePanelRadiosityModelUpdater,
         const std::vector<std::unique_ptr<SourcePanelRadiosityModel>>& baseRadiosityModels,
         const std::vector<int>& numberOfPanelsPerRing,
-        const std::string& sourceName) :
+        const std::string& sourceName,
+        const double panelRegenerationTolerance) :
         PaneledRadiationSourceModel(sourceBodyShapeModel, std::move(sourcePanelRadiosityModelUpdater),sourceName),
-        numberOfPanelsPerRing_(numberOfPanelsPerRing)
+        numberOfPanelsPerRing_(numberOfPanelsPerRing),
+        panelRegenerationTolerance_(panelRegenerationTolerance)
 {
     if( sourceBodyShapeModel == nullptr )
     {
@@ -215,29 +288,46 @@ DynamicallyPaneledRadiationSourceModel::DynamicallyPaneledRadiationSourceModel(
 IrradianceWithSourceList DynamicallyPaneledRadiationSourceModel::evaluateIrradianceAtPosition(
         const Eigen::Vector3d& targetPosition)
 {
-    // Generate center points of panels in spherical coordinates
-    const auto panelProperties = generatePaneledSphericalCap_EqualProjectedAttenuatedArea(
-            targetPosition, numberOfPanelsPerRing_, sourceBodyShapeModel_->getAverageRadius());
-    const auto panelCenters = std::get<0>(panelProperties);
-    const auto polarAngles = std::get<1>(panelProperties);
-    const auto azimuthAngles = std::get<2>(panelProperties);
-    const auto areas = std::get<3>(panelProperties);
+    // Reuse existing panels if target has moved sufficiently little since their generation (evaluations may come
+    // from different targets each call)
+    const bool regeneratePanels = !((targetPosition - panelGenerationTargetPosition_).norm() <=
+            panelRegenerationTolerance_ * panelGenerationTargetPosition_.norm());
 
-    for (unsigned int i = 0; i < numberOfPanels; ++i)
+    if (regeneratePanels)
     {
-        const auto& relativeCenter = panelCenters[i];
-        const Eigen::Vector3d surfaceNormal = relativeCenter.normalized();
-        const auto polarAngle = polarAngles[i];
-        const auto azimuthAngle = azimuthAngles[i];
-        const auto area = areas[i];
-
-        panels_[i].setRelativeCenter(relativeCenter, polarAngle, azimuthAngle);
-        panels_[i].setSurfaceNormal(surfaceNormal);
-        panels_[i].setArea(area);
+        // Generate center points of panels in spherical coordinates
+        const auto panelProperties = generatePaneledSphericalCap_EqualProjectedAttenuatedArea(
+                targetPosition, numberOfPanelsPerRing_, sourceBodyShapeModel_->getAverageRadius());
+        const auto panelCenters = std::get<0>(panelProperties);
+        const auto polarAngles = std::get<1>(panelProperties);
+        const auto azimuthAngles = std::get<2>(panelProperties);
+        const auto areas = std::get<3>(panelProperties);
+
+        for (unsigned int i = 0; i < numberOfPanels; ++i)
+        {
+            const auto& relativeCenter = panelCenters[i];
+            const Eigen::Vector3d surfaceNormal = relativeCenter.normalized();
+            const auto polarAngle = polarAngles[i];
+            const auto azimuthAngle = azimuthAngles[i];
+            const auto area = areas[i];
+
+            panels_[i].setRelativeCenter(relativeCenter, polarAngle, azimuthAngle);
+            panels_[i].setSurfaceNormal(surfaceNormal);
+            panels_[i].setArea(area);
+        }
+        panelGenerationTargetPosition_ = targetPosition;
+    }
 
-        // Always update (independently of current time) because evaluation may come from different targets each call
-        panels_[i].updateMembers(currentTime_);
-        sourcePanelRadiosityModelUpdater_->updatePanel(panels_[i]);
+    // Update radiosity models of new panels, or of existing panels at new time
+    if (regeneratePanels || !(panelUpdateTime_ == currentTime_))
+    {
+        for (unsigned int i = 0; i < numberOfPanels; ++i)
+        {
+            panels_[i].updateMembers(currentTime_);
+            sourcePanelRadiosityModelUpdater_->updatePanel(panels_[i]);
+        }
+        panelUpdateTime_ = currentTime_;
+        updatePanelArrays();
     }
 
     return PaneledRadiationSourceModel::evaluateIrradianceAtPosition(targetPosition);
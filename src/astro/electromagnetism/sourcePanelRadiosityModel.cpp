@@ -61,6 +61,13 @@ double ConstantSourcePanelRadiosityModel::evaluateIrradianceAtPosition(
     return irradiance;
 }
 
+double ConstantSourcePanelRadiosityModel::evaluateLambertianIrradianceFactor(
+        double panelArea,
+        const Eigen::Vector3d& panelSurfaceNormal) const
+{
+    return constantRadiosity_ * panelArea / PI;
+}
+
 double CustomInherentSourcePanelRadiosityModel::evaluateIrradianceAtPosition(
         double panelArea,
         const Eigen::Vector3d& panelSurfaceNormal,
@@ -80,6 +87,13 @@ double CustomInherentSourcePanelRadiosityModel::evaluateIrradianceAtPosition(
     return irradiance;
 }
 
+double CustomInherentSourcePanelRadiosityModel::evaluateLambertianIrradianceFactor(
+        double panelArea,
+        const Eigen::Vector3d& panelSurfaceNormal) const
+{
+    return radiosity_ * panelArea / PI;
+}
+
 void CustomInherentSourcePanelRadiosityModel::updateMembers_(
         double panelLatitude,
         double panelLongitude,
@@ -122,6 +136,24 @@ double AlbedoSourcePanelRadiosityModel::evaluateIrradianceAtPosition(
     return albedoIrradiance;
 }
 
+double AlbedoSourcePanelRadiosityModel::evaluateLambertianIrradianceFactor(
+        double panelArea,
+        const Eigen::Vector3d& panelSurfaceNormal) const
+{
+    const double cosBetweenNormalAndOriginalSource = panelSurfaceNormal.dot(-originalSourceToPanelDirection_);
+    if (cosBetweenNormalAndOriginalSource <= 0 || originalSourceOccultedIrradiance_ == 0)
+    {
+        // Original source is on backside of panel, or panel is occulted
+        return 0;
+    }
+
+    // Lambertian reflected fraction is independent of observer direction (as long as observer is in front of panel)
+    const auto receivedIrradiance = cosBetweenNormalAndOriginalSource * originalSourceOccultedIrradiance_;
+    const auto reflectedFraction =
+            reflectionLaw_->evaluateReflectedFraction(panelSurfaceNormal, originalSourceToPanelDirection_, panelSurfaceNormal);
+    return receivedIrradiance * reflectedFraction * panelArea;
+}
+
 void AlbedoSourcePanelRadiosityModel::updateMembers_(
         double panelLatitude,
         double panelLongitude,
@@ -155,6 +187,14 @@ double DelayedThermalSourcePanelRadiosityModel::evaluateIrradianceAtPosition(
     return thermalIrradiance;
 }
 
+double DelayedThermalSourcePanelRadiosityModel::evaluateLambertianIrradianceFactor(
+        double panelArea,
+        const Eigen::Vector3d& panelSurfaceNormal) const
+{
+    const auto emittedExitance = emissivity * originalSourceUnoccultedIrradiance_ / 4;
+    return emittedExitance * panelArea / PI;
+}
+
 void DelayedThermalSourcePanelRadiosityModel::updateMembers_(
         double panelLatitude,
         double panelLongitude,
@@ -193,6 +233,20 @@ double AngleBasedThermalSourcePanelRadiosityModel::evaluateIrradianceAtPosition(
     return thermalIrradiance;
 }
 
+double AngleBasedThermalSourcePanelRadiosityModel::evaluateLambertianIrradianceFactor(
+        double panelArea,
+        const Eigen::Vector3d& panelSurfaceNormal) const
+{
+    const double cosBetweenNormalAndOriginalSource = panelSurfaceNormal.dot(-originalSourceToPanelDirection_);
+    const double positiveCosBetweenNormalAndOriginalSource = std::max(cosBetweenNormalAndOriginalSource, 0.);
+
+    const auto temperature = std::max(
+            maxTemperature_ * pow(positiveCosBetweenNormalAndOriginalSource, 1./4),
+            minTemperature_);
+    const auto emittedExitance = emissivity * physical_constants::STEFAN_BOLTZMANN_CONSTANT * pow(temperature, 4);
+    return emittedExitance * panelArea / PI;
+}
+
 void AngleBasedThermalSourcePanelRadiosityModel::updateMembers_(
         double panelLatitude,
         double panelLongitude,
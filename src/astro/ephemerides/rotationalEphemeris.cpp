@@ -38,11 +38,44 @@ Eigen::Matrix3d getDerivativeOfRotationMatrixToFrame(
             rotationToTargetFrame;
 }
 
+//! Function to update the per-epoch cache of rotational quantities to the given epoch (if not already at this epoch)
+void RotationalEphemeris::updateEpochCache( const double secondsSinceEpoch )
+{
+    if( !isEpochCacheValid_ || isCachedEpochExtended_ || !( secondsSinceEpoch == cachedEpoch_ ) )
+    {
+        getFullRotationalQuantitiesToTargetFrame(
+                    cachedRotationToTargetFrame_, cachedDerivativeOfRotationToTargetFrame_,
+                    cachedAngularVelocityVectorInBaseFrame_, secondsSinceEpoch );
+        cachedEpoch_ = secondsSinceEpoch;
+        isCachedEpochExtended_ = false;
+        isEpochCacheValid_ = true;
+    }
+}
+
+//! Function to update the per-epoch cache of rotational quantities to the given epoch (if not already at this epoch)
+void RotationalEphemeris::updateEpochCache( const Time& timeSinceEpoch )
+{
+    if( !isEpochCacheValid_ || !isCachedEpochExtended_ || !( timeSinceEpoch == cachedExtendedEpoch_ ) )
+    {
+        getFullRotationalQuantitiesToTargetFrameFromExtendedTime(
+                    cachedRotationToTargetFrame_, cachedDerivativeOfRotationToTargetFrame_,
+                    cachedAngularVelocityVectorInBaseFrame_, timeSinceEpoch );
+        cachedExtendedEpoch_ = timeSinceEpoch;
+        isCachedEpochExtended_ = true;
+        isEpochCacheValid_ = true;
+    }
+}
+
 //! Get rotation quaternion from target frame to base frame.
 template< >
 Eigen::Quaterniond RotationalEphemeris::getRotationToBaseFrameTemplated< double >(
             const double timeSinceEpoch )
 {
+    if( useEpochCache_ )
+    {
+        updateEpochCache( timeSinceEpoch );
+        return cachedRotationToTargetFrame_.inverse( );
+    }
     return getRotationToBaseFrame( timeSinceEpoch );
 }
 
@@ -51,6 +84,11 @@ template< >
 Eigen::Quaterniond RotationalEphemeris::getRotationToBaseFrameTemplated< Time >(
             const Time timeSinceEpoch )
 {
+    if( useEpochCache_ )
+    {
+        updateEpochCache( timeSinceEpoch );
+        return cachedRotationToTargetFrame_.inverse( );
+    }
     return getRotationToBaseFrameFromExtendedTime( timeSinceEpoch );
 }
 
@@ -59,6 +97,11 @@ template< >
 Eigen::Quaterniond RotationalEphemeris::getRotationToTargetFrameTemplated< double >(
         const double secondsSinceEpoch )
 {
+    if( useEpochCache_ )
+    {
+        updateEpochCache( secondsSinceEpoch );
+        return cachedRotationToTargetFrame_;
+    }
     return getRotationToTargetFrame( secondsSinceEpoch );
 }
 
@@ -67,6 +110,11 @@ template< >
 Eigen::Quaterniond RotationalEphemeris::getRotationToTargetFrameTemplated< Time >(
         const Time secondsSinceEpoch )
 {
+    if( useEpochCache_ )
+    {
+        updateEpochCache( secondsSinceEpoch );
+        return cachedRotationToTargetFrame_;
+    }
     return getRotationToTargetFrameFromExtendedTime( secondsSinceEpoch );
 }
 
@@ -75,6 +123,11 @@ template< >
 Eigen::Matrix3d RotationalEphemeris::getDerivativeOfRotationToBaseFrameTemplated< double >(
             const double timeSinceEpoch )
 {
+    if( useEpochCache_ )
+    {
+        updateEpochCache( timeSinceEpoch );
+        return cachedDerivativeOfRotationToTargetFrame_.transpose( );
+    }
     return getDerivativeOfRotationToBaseFrame( timeSinceEpoch );
 }
 
@@ -83,6 +136,11 @@ template< >
 Eigen::Matrix3d RotationalEphemeris::getDerivativeOfRotationToBaseFrameTemplated< Time >(
             const Time timeSinceEpoch )
 {
+    if( useEpochCache_ )
+    {
+        updateEpochCache( timeSinceEpoch );
+        return cachedDerivativeOfRotationToTargetFrame_.transpose( );
+    }
     return getDerivativeOfRotationToBaseFrameFromExtendedTime( timeSinceEpoch );
 }
 
@@ -92,6 +150,11 @@ template< >
 Eigen::Matrix3d RotationalEphemeris::getDerivativeOfRotationToTargetFrameTemplated< double >(
         const double secondsSinceEpoch )
 {
+    if( useEpochCache_ )
+    {
+        updateEpochCache( secondsSinceEpoch );
+        return cachedDerivativeOfRotationToTargetFrame_;
+    }
     return getDerivativeOfRotationToTargetFrame( secondsSinceEpoch );
 }
 
@@ -100,6 +163,11 @@ template< >
 Eigen::Matrix3d RotationalEphemeris::getDerivativeOfRotationToTargetFrameTemplated< Time >(
         const Time secondsSinceEpoch )
 {
+    if( useEpochCache_ )
+    {
+        updateEpochCache( secondsSinceEpoch );
+        return cachedDerivativeOfRotationToTargetFrame_;
+    }
     return getDerivativeOfRotationToTargetFrameFromExtendedTime( secondsSinceEpoch );
 }
 
@@ -111,22 +179,42 @@ void RotationalEphemeris::getFullRotationalQuantitiesToTargetFrameTemplated< dou
         Eigen::Vector3d& currentAngularVelocityVectorInGlobalFrame,
         const double timeSinceEpoch )
 {
-    getFullRotationalQuantitiesToTargetFrame(
-                currentRotationToLocalFrame, currentRotationToLocalFrameDerivative, currentAngularVelocityVectorInGlobalFrame,
-                timeSinceEpoch );
+    if( useEpochCache_ )
+    {
+        updateEpochCache( timeSinceEpoch );
+        currentRotationToLocalFrame = cachedRotationToTargetFrame_;
+        currentRotationToLocalFrameDerivative = cachedDerivativeOfRotationToTargetFrame_;
+        currentAngularVelocityVectorInGlobalFrame = cachedAngularVelocityVectorInBaseFrame_;
+    }
+    else
+    {
+        getFullRotationalQuantitiesToTargetFrame(
+                    currentRotationToLocalFrame, currentRotationToLocalFrameDerivative, currentAngularVelocityVectorInGlobalFrame,
+                    timeSinceEpoch );
+    }
 }
 
 //! Function to calculate the full rotational state at given time
 template< >
-void  RotationalEphemeris::getFullRotationalQuantitiesToTargetFrameTemplated< Time >(
+void RotationalEphemeris::getFullRotationalQuantitiesToTargetFrameTemplated< Time >(
         Eigen::Quaterniond& currentRotationToLocalFrame,
         Eigen::Matrix3d& currentRotationToLocalFrameDerivative,
         Eigen::Vector3d& currentAngularVelocityVectorInGlobalFrame,
         const Time timeSinceEpoch )
 {
-    getFullRotationalQuantitiesToTargetFrameFromExtendedTime(
-                currentRotationToLocalFrame, currentRotationToLocalFrameDerivative, currentAngularVelocityVectorInGlobalFrame,
-                timeSinceEpoch );
+    if( useEpochCache_ )
+    {
+        updateEpochCache( timeSinceEpoch );
+        currentRotationToLocalFrame = cachedRotationToTargetFrame_;
+        currentRotationToLocalFrameDerivative = cachedDerivativeOfRotationToTargetFrame_;
+        currentAngularVelocityVectorInGlobalFrame = cachedAngularVelocityVectorInBaseFrame_;
+    }
+    else
+    {
+        getFullRotationalQuantitiesToTargetFrameFromExtendedTime(
+                    currentRotationToLocalFrame, currentRotationToLocalFrameDerivative, currentAngularVelocityVectorInGlobalFrame,
+                    timeSinceEpoch );
+    }
 }
 
 
@@ -61,6 +61,8 @@ void SimpleRotationalEphemeris::resetInitialPoleRightAscensionAndDeclination(
     // Reset angles in vector of Euler angles.
     initialEulerAngles_.x( ) = rightAscension;
     initialEulerAngles_.y( ) = declination;
+
+    clearEpochCache( );
 }
 
 } // namespace tudat
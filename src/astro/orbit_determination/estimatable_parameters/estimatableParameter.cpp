@@ -538,6 +538,45 @@ bool isParameterClockProperty( const EstimatebleParametersEnum parameterType )
     return flag;
 }
 
+bool isParameterArcWise( const EstimatebleParametersEnum parameterType )
+{
+    bool flag;
+    switch( parameterType )
+    {
+        case arc_wise_initial_body_state:
+            flag = true;
+            break;
+        case arc_wise_radiation_pressure_coefficient:
+            flag = true;
+            break;
+        case arcwise_constant_additive_observation_bias:
+            flag = true;
+            break;
+        case arcwise_constant_relative_observation_bias:
+            flag = true;
+            break;
+        case arc_wise_empirical_acceleration_coefficients:
+            flag = true;
+            break;
+        case arc_wise_constant_drag_coefficient:
+            flag = true;
+            break;
+        case arc_wise_time_drift_observation_bias:
+            flag = true;
+            break;
+        case arc_wise_time_observation_bias:
+            flag = true;
+            break;
+        case arc_wise_polynomial_clock_corrections:
+            flag = true;
+            break;
+        default:
+            flag = false;
+            break;
+    }
+    return flag;
+}
+
 
 
 }
@@ -8,6 +8,9 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <exception>
+#include <thread>
+
 #include "tudat/basics/utilities.h"
 
 namespace tudat
@@ -61,6 +64,104 @@ boost::array< boost::multi_array< double, 3 >::index, 3 > getMultiArrayIndexArra
     return currentIndices;
 }
 
+//! Function to determine the number of threads to use for a parallel computation
+unsigned int getNumberOfThreadsToUse( const unsigned int requestedNumberOfThreads,
+                                      const unsigned int numberOfIterations )
+{
+    unsigned int numberOfThreads = requestedNumberOfThreads;
+    if( numberOfThreads == 0 )
+    {
+        numberOfThreads = std::thread::hardware_concurrency( );
+    }
+    if( numberOfThreads > numberOfIterations )
+    {
+        numberOfThreads = numberOfIterations;
+    }
+    return ( numberOfThreads > 0 ) ? numberOfThreads : 1;
+}
+
+//! Function to evaluate the iterations of a loop in parallel
+void parallelFor( const unsigned int numberOfIterations,
+                  const std::function< void( const unsigned int ) >& loopFunction,
+                  const unsigned int numberOfThreads )
+{
+    unsigned int numberOfThreadsToUse = getNumberOfThreadsToUse( numberOfThreads, numberOfIterations );
+    if( numberOfThreadsToUse == 1 )
+    {
+        for( unsigned int i = 0; i < numberOfIterations; i++ )
+        {
+            loopFunction( i );
+        }
+        return;
+    }
+
+    // Evaluate contiguous block of iterations on each thread, storing any exception that is thrown
+    std::vector< std::exception_ptr > threadExceptions( numberOfThreadsToUse );
+    auto evaluateBlock = [ & ]( const unsigned int threadIndex )
+    {
+        unsigned int startIndex = static_cast< unsigned int >(
+                    static_cast< unsigned long long >( numberOfIterations ) * threadIndex / numberOfThreadsToUse );
+        unsigned int endIndex = static_cast< unsigned int >(
+                    static_cast< unsigned long long >( numberOfIterations ) * ( threadIndex + 1 ) / numberOfThreadsToUse );
+        try
+        {
+            for( unsigned int i = startIndex; i < endIndex; i++ )
+            {
+                loopFunction( i );
+            }
+        }
+        catch( ... )
+        {
+            threadExceptions[ threadIndex ] = std::current_exception( );
+        }
+    };
+
+    // Evaluate first block on calling thread, remaining blocks on newly started threads. If a thread cannot be started,
+    // the threads that were already started are joined before rethrowing (destroying a joinable thread terminates).
+    std::vector< std::thread > threads;
+    threads.reserve( numberOfThreadsToUse - 1 );
+    try
+    {
+        for( unsigned int i = 1; i < numberOfThreadsToUse; i++ )
+        {
+            threads.emplace_back( evaluateBlock, i );
+        }
+    }
+    catch( ... )
+    {
+        for( unsigned int i = 0; i < threads.size( ); i++ )
+        {
+            threads[ i ].join( );
+        }
+        throw;
+    }
+    evaluateBlock( 0 );
+    for( unsigned int i = 0; i < threads.size( ); i++ )
+    {
+        threads[ i ].join( );
+    }
+
+    for( unsigned int i = 0; i < threadExceptions.size( ); i++ )
+    {
+        if( threadExceptions[ i ] )
+        {
+            std::rethrow_exception( threadExceptions[ i ] );
+        }
+    }
+}
+
+//! Function to update a 64-bit FNV-1a hash with a block of data
+uint64_t updateFnv1aHash( uint64_t hash, const void* data, const std::size_t numberOfBytes )
+{
+    const unsigned char* bytes = static_cast< const unsigned char* >( data );
+    for( std::size_t i = 0; i < numberOfBytes; i++ )
+    {
+        hash ^= static_cast< uint64_t >( bytes[ i ] );
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
 /*!
  * Function to extract a map from string to 3d vector from a file. The first 4 columns are used and the rest is ignored if present
  * @param fileName path to file of interest
@@ -0,0 +1,442 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#include "tudat/math/basic/blockSparseDesignMatrix.h"
+#include "tudat/math/basic/leastSquaresEstimation.h"
+
+namespace tudat
+{
+
+namespace linear_algebra
+{
+
+//! Function to merge a list of (possibly overlapping or adjacent) blocks of columns
+std::vector< std::pair< int, int > > mergeColumnBlocks(
+        const std::vector< std::pair< int, int > >& columnBlocks )
+{
+    std::vector< std::pair< int, int > > sortedColumnBlocks;
+    for( unsigned int i = 0; i < columnBlocks.size( ); i++ )
+    {
+        if( columnBlocks.at( i ).second > 0 )
+        {
+            sortedColumnBlocks.push_back( columnBlocks.at( i ) );
+        }
+    }
+    std::sort( sortedColumnBlocks.begin( ), sortedColumnBlocks.end( ) );
+
+    std::vector< std::pair< int, int > > mergedColumnBlocks;
+    for( unsigned int i = 0; i < sortedColumnBlocks.size( ); i++ )
+    {
+        if( mergedColumnBlocks.size( ) > 0 &&
+                sortedColumnBlocks.at( i ).first <= mergedColumnBlocks.back( ).first + mergedColumnBlocks.back( ).second )
+        {
+            int blockEnd = std::max( mergedColumnBlocks.back( ).first + mergedColumnBlocks.back( ).second,
+                                     sortedColumnBlocks.at( i ).first + sortedColumnBlocks.at( i ).second );
+            mergedColumnBlocks.back( ).second = blockEnd - mergedColumnBlocks.back( ).first;
+        }
+        else
+        {
+            mergedColumnBlocks.push_back( sortedColumnBlocks.at( i ) );
+        }
+    }
+    return mergedColumnBlocks;
+}
+
+//! Function to determine the blocks of columns of a matrix that contain non-zero entries
+std::vector< std::pair< int, int > > getNonZeroColumnBlocks(
+        const Eigen::MatrixXd& matrix,
+        const std::vector< std::pair< int, int > >& candidateColumnBlocks )
+{
+    std::vector< std::pair< int, int > > mergedCandidateBlocks = mergeColumnBlocks( candidateColumnBlocks );
+
+    std::vector< std::pair< int, int > > nonZeroColumnBlocks;
+    for( unsigned int i = 0; i < mergedCandidateBlocks.size( ); i++ )
+    {
+        if( mergedCandidateBlocks.at( i ).first < 0 ||
+                mergedCandidateBlocks.at( i ).first + mergedCandidateBlocks.at( i ).second > matrix.cols( ) )
+        {
+            throw std::runtime_error( "Error when determining non-zero blocks of columns, candidate block (" +
+                                      std::to_string( mergedCandidateBlocks.at( i ).first ) + ", " +
+                                      std::to_string( mergedCandidateBlocks.at( i ).second ) +
+                                      ") is outside of matrix with " + std::to_string( matrix.cols( ) ) + " columns" );
+        }
+
+        // Add consecutive non-zero columns of the candidate block
+        for( int j = mergedCandidateBlocks.at( i ).first;
+             j < mergedCandidateBlocks.at( i ).first + mergedCandidateBlocks.at( i ).second; j++ )
+        {
+            if( !matrix.col( j ).isZero( 0.0 ) )
+            {
+                if( nonZeroColumnBlocks.size( ) > 0 &&
+                        nonZeroColumnBlocks.back( ).first + nonZeroColumnBlocks.back( ).second == j )
+                {
+                    nonZeroColumnBlocks.back( ).second++;
+                }
+                else
+                {
+                    nonZeroColumnBlocks.push_back( std::make_pair( j, 1 ) );
+                }
+            }
+        }
+    }
+    return nonZeroColumnBlocks;
+}
+
+//! Function to add a block of observations with block-sparse partials to the normal equations
+void addObservationsToNormalEquations(
+        const Eigen::MatrixXd& designMatrixBlock,
+        const std::vector< std::pair< int, int > >& columnBlocks,
+        const Eigen::VectorXd& observationResidualsBlock,
+        const Eigen::VectorXd& diagonalOfWeightMatrixBlock,
+        Eigen::MatrixXd& normalMatrix,
+        Eigen::VectorXd& normalRightHandSide )
+{
+    if( designMatrixBlock.rows( ) != observationResidualsBlock.rows( ) ||
+            designMatrixBlock.rows( ) != diagonalOfWeightMatrixBlock.rows( ) )
+    {
+        throw std::runtime_error( "Error when adding observations to normal equations, sizes of partials, residuals and weights are incompatible" );
+    }
+
+    if( normalMatrix.rows( ) != designMatrixBlock.cols( ) || normalMatrix.cols( ) != designMatrixBlock.cols( ) ||
+            normalRightHandSide.rows( ) != designMatrixBlock.cols( ) )
+    {
+        throw std::runtime_error( "Error when adding observations to normal equations, size of normal equations is incompatible with partials" );
+    }
+
+    for( unsigned int i = 0; i < columnBlocks.size( ); i++ )
+    {
+        Eigen::MatrixXd weightedSubBlock = multiplyDesignMatrixByDiagonalWeightMatrix(
+                    designMatrixBlock.middleCols( columnBlocks.at( i ).first, columnBlocks.at( i ).second ),
+                    diagonalOfWeightMatrixBlock );
+        normalRightHandSide.segment( columnBlocks.at( i ).first, columnBlocks.at( i ).second ).noalias( ) +=
+                weightedSubBlock.transpose( ) * observationResidualsBlock;
+
+        for( unsigned int j = i; j < columnBlocks.size( ); j++ )
+        {
+            Eigen::MatrixXd normalSubBlock = weightedSubBlock.transpose( ) *
+                    designMatrixBlock.middleCols( columnBlocks.at( j ).first, columnBlocks.at( j ).second );
+            normalMatrix.block( columnBlocks.at( i ).first, columnBlocks.at( j ).first,
+                                columnBlocks.at( i ).second, columnBlocks.at( j ).second ) += normalSubBlock;
+            if( j != i )
+            {
+                normalMatrix.block( columnBlocks.at( j ).first, columnBlocks.at( i ).first,
+                                    columnBlocks.at( j ).second, columnBlocks.at( i ).second ) += normalSubBlock.transpose( );
+            }
+        }
+    }
+}
+
+//! Constructor
+BlockSparseDesignMatrix::BlockSparseDesignMatrix( const int numberOfRows, const int numberOfColumns ):
+    numberOfRows_( numberOfRows ), numberOfColumns_( numberOfColumns )
+{
+    if( numberOfRows < 0 || numberOfColumns < 0 )
+    {
+        throw std::runtime_error( "Error when creating block-sparse design matrix, size (" + std::to_string( numberOfRows ) +
+                                  ", " + std::to_string( numberOfColumns ) + ") is invalid" );
+    }
+}
+
+//! Function to add a block of rows to the matrix
+void BlockSparseDesignMatrix::addRowBlock(
+        const int firstRow,
+        const Eigen::MatrixXd& rowBlock,
+        const std::vector< std::pair< int, int > >& columnBlocks )
+{
+    if( rowBlock.cols( ) != numberOfColumns_ )
+    {
+        throw std::runtime_error( "Error when adding rows to block-sparse design matrix, number of columns (" +
+                                  std::to_string( rowBlock.cols( ) ) + ") is incompatible with matrix (" +
+                                  std::to_string( numberOfColumns_ ) + ")" );
+    }
+
+    std::vector< std::pair< int, int > > rowColumnBlocks;
+    if( columnBlocks.size( ) == 0 )
+    {
+        rowColumnBlocks = getNonZeroColumnBlocks(
+                    rowBlock, { std::make_pair( 0, static_cast< int >( numberOfColumns_ ) ) } );
+    }
+    else
+    {
+        rowColumnBlocks = mergeColumnBlocks( columnBlocks );
+        if( rowColumnBlocks.size( ) > 0 && ( rowColumnBlocks.front( ).first < 0 ||
+                rowColumnBlocks.back( ).first + rowColumnBlocks.back( ).second > numberOfColumns_ ) )
+        {
+            throw std::runtime_error( "Error when adding rows to block-sparse design matrix, blocks of columns are outside of matrix" );
+        }
+    }
+
+    std::vector< Eigen::MatrixXd > subBlocks;
+    for( unsigned int i = 0; i < rowColumnBlocks.size( ); i++ )
+    {
+        subBlocks.push_back( rowBlock.middleCols( rowColumnBlocks.at( i ).first, rowColumnBlocks.at( i ).second ) );
+    }
+    insertRowBlock( std::make_pair( firstRow, static_cast< int >( rowBlock.rows( ) ) ), rowColumnBlocks, subBlocks );
+}
+
+//! Function to add all blocks of rows of another matrix (of the same size) to this matrix
+void BlockSparseDesignMatrix::addRowBlocks( const BlockSparseDesignMatrix& otherMatrix )
+{
+    if( otherMatrix.numberOfRows_ != numberOfRows_ || otherMatrix.numberOfColumns_ != numberOfColumns_ )
+    {
+        throw std::runtime_error( "Error when combining block-sparse design matrices, sizes are incompatible" );
+    }
+
+    for( unsigned int i = 0; i < otherMatrix.rowBlockStartAndSize_.size( ); i++ )
+    {
+        insertRowBlock( otherMatrix.rowBlockStartAndSize_.at( i ), otherMatrix.columnBlocks_.at( i ),
+                        otherMatrix.subBlocks_.at( i ) );
+    }
+}
+
+//! Function to multiply the columns of the matrix by a set of factors
+void BlockSparseDesignMatrix::scaleColumns( const Eigen::VectorXd& scalingFactors )
+{
+    if( scalingFactors.rows( ) != numberOfColumns_ )
+    {
+        throw std::runtime_error( "Error when scaling columns of block-sparse design matrix, number of scaling factors (" +
+                                  std::to_string( scalingFactors.rows( ) ) + ") is incompatible with matrix (" +
+                                  std::to_string( numberOfColumns_ ) + ")" );
+    }
+
+    for( unsigned int i = 0; i < subBlocks_.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < subBlocks_.at( i ).size( ); j++ )
+        {
+            subBlocks_.at( i ).at( j ) *= scalingFactors.segment(
+                        columnBlocks_.at( i ).at( j ).first, columnBlocks_.at( i ).at( j ).second ).asDiagonal( );
+        }
+    }
+}
+
+//! Function to create a matrix consisting of a subset of the columns of this matrix
+BlockSparseDesignMatrix BlockSparseDesignMatrix::getColumnSubset( const std::vector< int >& columnIndices ) const
+{
+    // Determine index of each column of this matrix in the new matrix (-1 if not included)
+    std::vector< int > newColumnIndices( numberOfColumns_, -1 );
+    for( unsigned int i = 0; i < columnIndices.size( ); i++ )
+    {
+        if( columnIndices.at( i ) < 0 || columnIndices.at( i ) >= numberOfColumns_ )
+        {
+            throw std::runtime_error( "Error when retrieving columns of block-sparse design matrix, column " +
+                                      std::to_string( columnIndices.at( i ) ) + " is outside of matrix" );
+        }
+        else if( newColumnIndices.at( columnIndices.at( i ) ) >= 0 )
+        {
+            throw std::runtime_error( "Error when retrieving columns of block-sparse design matrix, column " +
+                                      std::to_string( columnIndices.at( i ) ) + " is requested more than once" );
+        }
+        newColumnIndices.at( columnIndices.at( i ) ) = i;
+    }
+
+    BlockSparseDesignMatrix columnSubset( numberOfRows_, columnIndices.size( ) );
+    for( unsigned int i = 0; i < rowBlockStartAndSize_.size( ); i++ )
+    {
+        // Split stored blocks into runs of columns that are consecutive in both the old and new matrix
+        std::vector< std::pair< int, std::pair< int, int > > > newStartOldStartAndSize;
+        for( unsigned int j = 0; j < columnBlocks_.at( i ).size( ); j++ )
+        {
+            for( int k = columnBlocks_.at( i ).at( j ).first;
+                 k < columnBlocks_.at( i ).at( j ).first + columnBlocks_.at( i ).at( j ).second; k++ )
+            {
+                if( newColumnIndices.at( k ) >= 0 )
+                {
+                    if( newStartOldStartAndSize.size( ) > 0 &&
+                            newStartOldStartAndSize.back( ).second.first + newStartOldStartAndSize.back( ).second.second == k &&
+                            newStartOldStartAndSize.back( ).first + newStartOldStartAndSize.back( ).second.second == newColumnIndices.at( k ) )
+                    {
+                        newStartOldStartAndSize.back( ).second.second++;
+                    }
+                    else
+                    {
+                        newStartOldStartAndSize.push_back( std::make_pair( newColumnIndices.at( k ), std::make_pair( k, 1 ) ) );
+                    }
+                }
+            }
+        }
+        std::sort( newStartOldStartAndSize.begin( ), newStartOldStartAndSize.end( ) );
+
+        // Extract entries of runs from stored blocks
+        std::vector< std::pair< int, int > > newColumnBlocks;
+        std::vector< Eigen::MatrixXd > newSubBlocks;
+        for( unsigned int j = 0; j < newStartOldStartAndSize.size( ); j++ )
+        {
+            int oldStart = newStartOldStartAndSize.at( j ).second.first;
+            int size = newStartOldStartAndSize.at( j ).second.second;
+            for( unsigned int k = 0; k < columnBlocks_.at( i ).size( ); k++ )
+            {
+                if( oldStart >= columnBlocks_.at( i ).at( k ).first &&
+                        oldStart < columnBlocks_.at( i ).at( k ).first + columnBlocks_.at( i ).at( k ).second )
+                {
+                    newColumnBlocks.push_back( std::make_pair( newStartOldStartAndSize.at( j ).first, size ) );
+                    newSubBlocks.push_back( subBlocks_.at( i ).at( k ).middleCols(
+                                                oldStart - columnBlocks_.at( i ).at( k ).first, size ) );
+                    break;
+                }
+            }
+        }
+        columnSubset.insertRowBlock( rowBlockStartAndSize_.at( i ), newColumnBlocks, newSubBlocks );
+    }
+    return columnSubset;
+}
+
+//! Function to compute the product H x of the matrix with a vector
+Eigen::VectorXd BlockSparseDesignMatrix::multiply( const Eigen::VectorXd& vector ) const
+{
+    if( vector.rows( ) != numberOfColumns_ )
+    {
+        throw std::runtime_error( "Error when multiplying block-sparse design matrix with vector, sizes are incompatible" );
+    }
+
+    Eigen::VectorXd product = Eigen::VectorXd::Zero( numberOfRows_ );
+    for( unsigned int i = 0; i < rowBlockStartAndSize_.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < columnBlocks_.at( i ).size( ); j++ )
+        {
+            product.segment( rowBlockStartAndSize_.at( i ).first, rowBlockStartAndSize_.at( i ).second ).noalias( ) +=
+                    subBlocks_.at( i ).at( j ) *
+                    vector.segment( columnBlocks_.at( i ).at( j ).first, columnBlocks_.at( i ).at( j ).second );
+        }
+    }
+    return product;
+}
+
+//! Function to compute the product H^T y of the transpose of the matrix with a vector
+Eigen::VectorXd BlockSparseDesignMatrix::multiplyTranspose( const Eigen::VectorXd& vector ) const
+{
+    if( vector.rows( ) != numberOfRows_ )
+    {
+        throw std::runtime_error( "Error when multiplying transpose of block-sparse design matrix with vector, sizes are incompatible" );
+    }
+
+    Eigen::VectorXd product = Eigen::VectorXd::Zero( numberOfColumns_ );
+    for( unsigned int i = 0; i < rowBlockStartAndSize_.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < columnBlocks_.at( i ).size( ); j++ )
+        {
+            product.segment( columnBlocks_.at( i ).at( j ).first, columnBlocks_.at( i ).at( j ).second ).noalias( ) +=
+                    subBlocks_.at( i ).at( j ).transpose( ) *
+                    vector.segment( rowBlockStartAndSize_.at( i ).first, rowBlockStartAndSize_.at( i ).second );
+        }
+    }
+    return product;
+}
+
+//! Function to compute the normal equations of the matrix
+void BlockSparseDesignMatrix::computeNormalEquations(
+        const Eigen::VectorXd& observationResiduals,
+        const Eigen::VectorXd& diagonalOfWeightMatrix,
+        Eigen::MatrixXd& normalMatrix,
+        Eigen::VectorXd& normalRightHandSide ) const
+{
+    if( observationResiduals.rows( ) != numberOfRows_ || diagonalOfWeightMatrix.rows( ) != numberOfRows_ )
+    {
+        throw std::runtime_error( "Error when computing normal equations of block-sparse design matrix, sizes of residuals and weights are incompatible" );
+    }
+
+    normalMatrix = Eigen::MatrixXd::Zero( numberOfColumns_, numberOfColumns_ );
+    normalRightHandSide = Eigen::VectorXd::Zero( numberOfColumns_ );
+    for( unsigned int i = 0; i < rowBlockStartAndSize_.size( ); i++ )
+    {
+        int firstRow = rowBlockStartAndSize_.at( i ).first;
+        int numberOfBlockRows = rowBlockStartAndSize_.at( i ).second;
+        for( unsigned int j = 0; j < columnBlocks_.at( i ).size( ); j++ )
+        {
+            Eigen::MatrixXd weightedSubBlock = multiplyDesignMatrixByDiagonalWeightMatrix(
+                        subBlocks_.at( i ).at( j ), diagonalOfWeightMatrix.segment( firstRow, numberOfBlockRows ) );
+            normalRightHandSide.segment( columnBlocks_.at( i ).at( j ).first, columnBlocks_.at( i ).at( j ).second ).noalias( ) +=
+                    weightedSubBlock.transpose( ) * observationResiduals.segment( firstRow, numberOfBlockRows );
+
+            for( unsigned int k = j; k < columnBlocks_.at( i ).size( ); k++ )
+            {
+                Eigen::MatrixXd normalSubBlock = weightedSubBlock.transpose( ) * subBlocks_.at( i ).at( k );
+                normalMatrix.block( columnBlocks_.at( i ).at( j ).first, columnBlocks_.at( i ).at( k ).first,
+                                    columnBlocks_.at( i ).at( j ).second, columnBlocks_.at( i ).at( k ).second ) += normalSubBlock;
+                if( k != j )
+                {
+                    normalMatrix.block( columnBlocks_.at( i ).at( k ).first, columnBlocks_.at( i ).at( j ).first,
+                                        columnBlocks_.at( i ).at( k ).second, columnBlocks_.at( i ).at( j ).second ) +=
+                            normalSubBlock.transpose( );
+                }
+            }
+        }
+    }
+}
+
+//! Function to create the equivalent dense matrix
+Eigen::MatrixXd BlockSparseDesignMatrix::getDenseMatrix( ) const
+{
+    Eigen::MatrixXd denseMatrix = Eigen::MatrixXd::Zero( numberOfRows_, numberOfColumns_ );
+    for( unsigned int i = 0; i < rowBlockStartAndSize_.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < columnBlocks_.at( i ).size( ); j++ )
+        {
+            denseMatrix.block( rowBlockStartAndSize_.at( i ).first, columnBlocks_.at( i ).at( j ).first,
+                               rowBlockStartAndSize_.at( i ).second, columnBlocks_.at( i ).at( j ).second ) =
+                    subBlocks_.at( i ).at( j );
+        }
+    }
+    return denseMatrix;
+}
+
+//! Function to retrieve the number of matrix entries that are stored
+long long BlockSparseDesignMatrix::getNumberOfStoredEntries( ) const
+{
+    long long numberOfStoredEntries = 0;
+    for( unsigned int i = 0; i < subBlocks_.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < subBlocks_.at( i ).size( ); j++ )
+        {
+            numberOfStoredEntries += static_cast< long long >( subBlocks_.at( i ).at( j ).size( ) );
+        }
+    }
+    return numberOfStoredEntries;
+}
+
+//! Function to insert a block of rows with its (already extracted) sub-blocks, sorted by first row
+void BlockSparseDesignMatrix::insertRowBlock(
+        const std::pair< int, int >& rowStartAndSize,
+        const std::vector< std::pair< int, int > >& columnBlocks,
+        const std::vector< Eigen::MatrixXd >& subBlocks )
+{
+    if( rowStartAndSize.first < 0 || rowStartAndSize.first + rowStartAndSize.second > numberOfRows_ )
+    {
+        throw std::runtime_error( "Error when adding rows to block-sparse design matrix, rows " +
+                                  std::to_string( rowStartAndSize.first ) + " to " +
+                                  std::to_string( rowStartAndSize.first + rowStartAndSize.second ) +
+                                  " are outside of matrix with " + std::to_string( numberOfRows_ ) + " rows" );
+    }
+
+    // Find position of new block, and check that it does not overlap with its neighbours
+    int insertionIndex = std::distance(
+                rowBlockStartAndSize_.begin( ),
+                std::upper_bound( rowBlockStartAndSize_.begin( ), rowBlockStartAndSize_.end( ), rowStartAndSize ) );
+    if( ( insertionIndex > 0 && rowBlockStartAndSize_.at( insertionIndex - 1 ).first +
+          rowBlockStartAndSize_.at( insertionIndex - 1 ).second > rowStartAndSize.first ) ||
+            ( insertionIndex < static_cast< int >( rowBlockStartAndSize_.size( ) ) &&
+              rowStartAndSize.first + rowStartAndSize.second > rowBlockStartAndSize_.at( insertionIndex ).first ) )
+    {
+        throw std::runtime_error( "Error when adding rows to block-sparse design matrix, rows starting at " +
+                                  std::to_string( rowStartAndSize.first ) + " overlap with existing rows" );
+    }
+
+    rowBlockStartAndSize_.insert( rowBlockStartAndSize_.begin( ) + insertionIndex, rowStartAndSize );
+    columnBlocks_.insert( columnBlocks_.begin( ) + insertionIndex, columnBlocks );
+    subBlocks_.insert( subBlocks_.begin( ) + insertionIndex, subBlocks );
+}
+
+} // namespace linear_algebra
+
+} // namespace tudat
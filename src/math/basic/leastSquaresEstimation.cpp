@@ -10,8 +10,10 @@
  */
 
 #include <cmath>
+#include <functional>
 #include <iostream>
 
+#include <Eigen/Cholesky>
 #include <Eigen/LU>
 
 #include "tudat/basics/utilities.h"
@@ -84,6 +86,18 @@ Eigen::MatrixXd calculateInverseOfUpdatedCovarianceMatrix(
     Eigen::MatrixXd inverseOfCovarianceMatrix =
             inverseOfAPrioriCovarianceMatrix + designMatrix.transpose( ) * multiplyDesignMatrixByDiagonalWeightMatrix(
                 designMatrix, diagonalOfWeightMatrix );
+    addConstraintsToInverseCovarianceMatrix( inverseOfCovarianceMatrix, constraintMultiplier, constraintRightHandside );
+
+    return inverseOfCovarianceMatrix;
+
+}
+
+//! Function to add linear constraints to the inverse covariance matrix, using Lagrange multipliers
+void addConstraintsToInverseCovarianceMatrix(
+        Eigen::MatrixXd& inverseOfCovarianceMatrix,
+        const Eigen::MatrixXd& constraintMultiplier,
+        const Eigen::VectorXd& constraintRightHandside )
+{
     if( constraintMultiplier.rows( ) != 0 )
     {
         if( constraintMultiplier.rows( ) != constraintRightHandside.rows( ) )
@@ -91,7 +105,7 @@ Eigen::MatrixXd calculateInverseOfUpdatedCovarianceMatrix(
             throw std::runtime_error( "Error when performing constrained least-squares, constraints are incompatible" );
         }
 
-        if( constraintMultiplier.cols( ) != designMatrix.cols( ) )
+        if( constraintMultiplier.cols( ) != inverseOfCovarianceMatrix.cols( ) )
         {
             throw std::runtime_error( "Error when performing constrained least-squares, constraints are incompatible with partials" );
         }
@@ -108,9 +122,6 @@ Eigen::MatrixXd calculateInverseOfUpdatedCovarianceMatrix(
         inverseOfCovarianceMatrix.block(
                     numberOfParameters, numberOfParameters, numberOfConstraints, numberOfConstraints ).setZero( );
     }
-
-    return inverseOfCovarianceMatrix;
-
 }
 
 
@@ -181,6 +192,280 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromD
 
 }
 
+//! Function to add the contribution of a block of observations to the normal equations
+void addObservationsToNormalEquations(
+        const Eigen::MatrixXd& designMatrixBlock,
+        const Eigen::VectorXd& observationResidualsBlock,
+        const Eigen::VectorXd& diagonalOfWeightMatrixBlock,
+        Eigen::MatrixXd& normalMatrix,
+        Eigen::VectorXd& normalRightHandSide )
+{
+    if( designMatrixBlock.rows( ) != observationResidualsBlock.rows( ) ||
+            designMatrixBlock.rows( ) != diagonalOfWeightMatrixBlock.rows( ) )
+    {
+        throw std::runtime_error( "Error when adding observations to normal equations, sizes of partials, residuals and weights are incompatible" );
+    }
+
+    if( normalMatrix.rows( ) != designMatrixBlock.cols( ) || normalMatrix.cols( ) != designMatrixBlock.cols( ) ||
+            normalRightHandSide.rows( ) != designMatrixBlock.cols( ) )
+    {
+        throw std::runtime_error( "Error when adding observations to normal equations, size of normal equations is incompatible with partials" );
+    }
+
+    Eigen::MatrixXd weightedDesignMatrixBlock = multiplyDesignMatrixByDiagonalWeightMatrix(
+                designMatrixBlock, diagonalOfWeightMatrixBlock );
+    normalMatrix.noalias( ) += designMatrixBlock.transpose( ) * weightedDesignMatrixBlock;
+    normalRightHandSide.noalias( ) += weightedDesignMatrixBlock.transpose( ) * observationResidualsBlock;
+}
+
+//! Function to retrieve the entries of a matrix at a given set of rows and columns
+Eigen::MatrixXd getMatrixEntries(
+        const Eigen::MatrixXd& matrix,
+        const std::vector< int >& rowIndices,
+        const std::vector< int >& columnIndices )
+{
+    Eigen::MatrixXd matrixEntries( rowIndices.size( ), columnIndices.size( ) );
+    for( unsigned int j = 0; j < columnIndices.size( ); j++ )
+    {
+        for( unsigned int i = 0; i < rowIndices.size( ); i++ )
+        {
+            matrixEntries( i, j ) = matrix( rowIndices.at( i ), columnIndices.at( j ) );
+        }
+    }
+    return matrixEntries;
+}
+
+//! Function to partition a subset of the parameters into blocks that are mutually uncoupled in a symmetric matrix
+std::vector< std::vector< int > > getDecoupledParameterBlocks(
+        const Eigen::MatrixXd& symmetricMatrix,
+        const std::vector< int >& candidateParameterIndices )
+{
+    // Determine connected sets of candidate parameters (union-find, with root of each set at lowest index)
+    std::vector< int > parentIndices( candidateParameterIndices.size( ) );
+    for( unsigned int i = 0; i < candidateParameterIndices.size( ); i++ )
+    {
+        parentIndices.at( i ) = i;
+    }
+
+    std::function< int( const int ) > findRoot = [ & ]( const int index )
+    {
+        int root = index;
+        while( parentIndices.at( root ) != root )
+        {
+            root = parentIndices.at( root );
+        }
+        parentIndices.at( index ) = root;
+        return root;
+    };
+
+    for( unsigned int i = 0; i < candidateParameterIndices.size( ); i++ )
+    {
+        for( unsigned int j = i + 1; j < candidateParameterIndices.size( ); j++ )
+        {
+            if( symmetricMatrix( candidateParameterIndices.at( i ), candidateParameterIndices.at( j ) ) != 0.0 )
+            {
+                int firstRoot = findRoot( i );
+                int secondRoot = findRoot( j );
+                if( firstRoot != secondRoot )
+                {
+                    parentIndices.at( std::max( firstRoot, secondRoot ) ) = std::min( firstRoot, secondRoot );
+                }
+            }
+        }
+    }
+
+    // Collect blocks, ordered by their first parameter
+    std::map< int, std::vector< int > > parameterBlocks;
+    for( unsigned int i = 0; i < candidateParameterIndices.size( ); i++ )
+    {
+        parameterBlocks[ findRoot( i ) ].push_back( candidateParameterIndices.at( i ) );
+    }
+    return utilities::createVectorFromMapValues( parameterBlocks );
+}
+
+//! Function to solve a symmetric positive definite system of equations by elimination of mutually uncoupled blocks of
+//! parameters
+bool solveSystemOfEquationsWithSchurComplement(
+        const Eigen::MatrixXd& matrixToInvert,
+        const Eigen::VectorXd& rightHandSideVector,
+        const std::vector< std::vector< int > >& localParameterBlocks,
+        Eigen::VectorXd& solution,
+        const double limitConditionNumberForWarning,
+        const unsigned int numberOfThreads )
+{
+    // Retrieve indices of global parameters (not in any of the local blocks)
+    std::vector< bool > isParameterLocal( matrixToInvert.rows( ), false );
+    for( unsigned int i = 0; i < localParameterBlocks.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < localParameterBlocks.at( i ).size( ); j++ )
+        {
+            isParameterLocal.at( localParameterBlocks.at( i ).at( j ) ) = true;
+        }
+    }
+    std::vector< int > globalParameterIndices;
+    for( unsigned int i = 0; i < isParameterLocal.size( ); i++ )
+    {
+        if( !isParameterLocal.at( i ) )
+        {
+            globalParameterIndices.push_back( i );
+        }
+    }
+    int numberOfGlobalParameters = globalParameterIndices.size( );
+
+    // Reduce each local block (in parallel), storing the block solutions for back-substitution
+    unsigned int numberOfBlocks = localParameterBlocks.size( );
+    unsigned int numberOfThreadsToUse = utilities::getNumberOfThreadsToUse( numberOfThreads, numberOfBlocks );
+    std::vector< Eigen::MatrixXd > blockInverseTimesCoupling( numberOfBlocks );
+    std::vector< Eigen::VectorXd > blockInverseTimesRightHandSide( numberOfBlocks );
+    std::vector< Eigen::MatrixXd > threadReducedMatrices(
+                numberOfThreadsToUse, Eigen::MatrixXd::Zero( numberOfGlobalParameters, numberOfGlobalParameters ) );
+    std::vector< Eigen::VectorXd > threadReducedRightHandSides(
+                numberOfThreadsToUse, Eigen::VectorXd::Zero( numberOfGlobalParameters ) );
+    std::vector< int > isBlockPositiveDefinite( numberOfBlocks, true );
+    utilities::parallelFor( numberOfThreadsToUse, [ & ]( const unsigned int threadIndex )
+    {
+        for( unsigned int i = threadIndex; i < numberOfBlocks; i += numberOfThreadsToUse )
+        {
+            const std::vector< int >& currentBlock = localParameterBlocks.at( i );
+            Eigen::MatrixXd localMatrix = getMatrixEntries( matrixToInvert, currentBlock, currentBlock );
+            Eigen::MatrixXd couplingMatrix = getMatrixEntries( matrixToInvert, currentBlock, globalParameterIndices );
+
+            Eigen::LDLT< Eigen::MatrixXd > localDecomposition( localMatrix );
+            if( localDecomposition.info( ) != Eigen::Success || !( localDecomposition.vectorD( ).minCoeff( ) > 0.0 ) )
+            {
+                isBlockPositiveDefinite.at( i ) = false;
+                continue;
+            }
+            blockInverseTimesCoupling.at( i ) = localDecomposition.solve( couplingMatrix );
+            blockInverseTimesRightHandSide.at( i ) = localDecomposition.solve(
+                        getMatrixEntries( rightHandSideVector, currentBlock, { 0 } ) );
+
+            threadReducedMatrices.at( threadIndex ).noalias( ) -= couplingMatrix.transpose( ) * blockInverseTimesCoupling.at( i );
+            threadReducedRightHandSides.at( threadIndex ).noalias( ) -=
+                    couplingMatrix.transpose( ) * blockInverseTimesRightHandSide.at( i );
+        }
+    }, numberOfThreadsToUse );
+
+    for( unsigned int i = 0; i < numberOfBlocks; i++ )
+    {
+        if( !isBlockPositiveDefinite.at( i ) )
+        {
+            return false;
+        }
+    }
+
+    // Solve reduced system for global parameters
+    Eigen::MatrixXd reducedMatrix = getMatrixEntries( matrixToInvert, globalParameterIndices, globalParameterIndices );
+    Eigen::VectorXd reducedRightHandSide = getMatrixEntries( rightHandSideVector, globalParameterIndices, { 0 } );
+    for( unsigned int i = 0; i < numberOfThreadsToUse; i++ )
+    {
+        reducedMatrix += threadReducedMatrices.at( i );
+        reducedRightHandSide += threadReducedRightHandSides.at( i );
+    }
+
+    Eigen::VectorXd globalSolution = Eigen::VectorXd::Zero( numberOfGlobalParameters );
+    if( numberOfGlobalParameters > 0 )
+    {
+        Eigen::LDLT< Eigen::MatrixXd > reducedDecomposition( reducedMatrix );
+        if( reducedDecomposition.info( ) != Eigen::Success || !( reducedDecomposition.vectorD( ).minCoeff( ) > 0.0 ) )
+        {
+            return false;
+        }
+
+        if( limitConditionNumberForWarning == limitConditionNumberForWarning )
+        {
+            double conditionNumber = 1.0 / reducedDecomposition.rcond( );
+            if( conditionNumber > limitConditionNumberForWarning )
+            {
+                std::cerr << "Warning when performing least squares, condition number of reduced system is " << conditionNumber << std::endl;
+            }
+        }
+        globalSolution = reducedDecomposition.solve( reducedRightHandSide );
+    }
+
+    // Back-substitute global solution to obtain local parameters
+    solution = Eigen::VectorXd::Zero( matrixToInvert.rows( ) );
+    for( int i = 0; i < numberOfGlobalParameters; i++ )
+    {
+        solution( globalParameterIndices.at( i ) ) = globalSolution( i );
+    }
+    utilities::parallelFor( numberOfBlocks, [ & ]( const unsigned int i )
+    {
+        Eigen::VectorXd localSolution =
+                blockInverseTimesRightHandSide.at( i ) - blockInverseTimesCoupling.at( i ) * globalSolution;
+        for( unsigned int j = 0; j < localParameterBlocks.at( i ).size( ); j++ )
+        {
+            solution( localParameterBlocks.at( i ).at( j ) ) = localSolution( j );
+        }
+    }, numberOfThreadsToUse );
+
+    return true;
+}
+
+//! Function to perform an iteration of least squares estimation from the normal equations, a priori information and
+//! constraints
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromNormalEquations(
+        const Eigen::MatrixXd& normalMatrix,
+        const Eigen::VectorXd& normalRightHandSide,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const double limitConditionNumberForWarning,
+        const Eigen::MatrixXd& constraintMultiplier,
+        const Eigen::VectorXd& constraintRightHandside,
+        const std::vector< int >& localParameterIndices,
+        const unsigned int numberOfThreads )
+{
+    Eigen::MatrixXd inverseOfCovarianceMatrix = inverseOfAPrioriCovarianceMatrix + normalMatrix;
+
+    // Eliminate mutually uncoupled blocks of local parameters, if any
+    if( localParameterIndices.size( ) > 0 && constraintMultiplier.rows( ) == 0 )
+    {
+        Eigen::VectorXd solution;
+        if( solveSystemOfEquationsWithSchurComplement(
+                    inverseOfCovarianceMatrix, normalRightHandSide,
+                    getDecoupledParameterBlocks( inverseOfCovarianceMatrix, localParameterIndices ),
+                    solution, limitConditionNumberForWarning, numberOfThreads ) )
+        {
+            return std::make_pair( solution, inverseOfCovarianceMatrix );
+        }
+    }
+
+    addConstraintsToInverseCovarianceMatrix( inverseOfCovarianceMatrix, constraintMultiplier, constraintRightHandside );
+
+    Eigen::VectorXd rightHandSide = normalRightHandSide;
+    if( constraintMultiplier.rows( ) != 0 )
+    {
+        // Constrained system is indefinite, use SVD for the (small) matrix of size parameters + constraints
+        int numberOfConstraints = constraintMultiplier.rows( );
+        int numberOfParameters = constraintMultiplier.cols( );
+
+        rightHandSide.conservativeResize( numberOfParameters + numberOfConstraints );
+        rightHandSide.segment( numberOfParameters, numberOfConstraints ) = constraintRightHandside;
+
+        return std::make_pair( solveSystemOfEquationsWithSvd(
+                inverseOfCovarianceMatrix, rightHandSide, limitConditionNumberForWarning ), inverseOfCovarianceMatrix );
+    }
+
+    // Solve symmetric system using LDLT decomposition, falling back to SVD if the matrix is not positive definite
+    Eigen::LDLT< Eigen::MatrixXd > ldltDecomposition( inverseOfCovarianceMatrix );
+    if( ldltDecomposition.info( ) != Eigen::Success || !ldltDecomposition.isPositive( ) ||
+            !( ldltDecomposition.vectorD( ).minCoeff( ) > 0.0 ) )
+    {
+        return std::make_pair( solveSystemOfEquationsWithSvd(
+                inverseOfCovarianceMatrix, rightHandSide, limitConditionNumberForWarning ), inverseOfCovarianceMatrix );
+    }
+
+    if( limitConditionNumberForWarning == limitConditionNumberForWarning )
+    {
+        double conditionNumber = 1.0 / ldltDecomposition.rcond( );
+        if( conditionNumber > limitConditionNumberForWarning )
+        {
+            std::cerr << "Warning when performing least squares, condition number is " << conditionNumber << std::endl;
+        }
+    }
+
+    return std::make_pair( Eigen::VectorXd( ldltDecomposition.solve( rightHandSide ) ), inverseOfCovarianceMatrix );
+}
+
 //! Function to perform an iteration least squares estimation from information matrix, weights and residuals
 std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromDesignMatrix(
         const Eigen::MatrixXd& designMatrix,
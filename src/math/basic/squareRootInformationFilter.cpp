@@ -0,0 +1,258 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include <Eigen/Cholesky>
+#include <Eigen/Eigenvalues>
+#include <Eigen/QR>
+
+#include "tudat/math/basic/squareRootInformationFilter.h"
+
+namespace tudat
+{
+
+namespace linear_algebra
+{
+
+//! Constructor, without a priori information
+SquareRootInformationFilter::SquareRootInformationFilter( const int numberOfParameters ):
+    numberOfParameters_( numberOfParameters ),
+    squareRootInformationMatrix_( Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters ) ),
+    squareRootInformationVector_( Eigen::VectorXd::Zero( numberOfParameters ) ),
+    residualSumOfSquares_( 0.0 )
+{
+    if( numberOfParameters <= 0 )
+    {
+        throw std::runtime_error( "Error when creating square-root information filter, number of parameters is " +
+                                  std::to_string( numberOfParameters ) );
+    }
+}
+
+//! Constructor, with a priori information
+SquareRootInformationFilter::SquareRootInformationFilter( const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix ):
+    SquareRootInformationFilter( inverseOfAPrioriCovarianceMatrix.rows( ) )
+{
+    addAprioriInformation( inverseOfAPrioriCovarianceMatrix );
+}
+
+//! Constructor, from existing square-root information
+SquareRootInformationFilter::SquareRootInformationFilter(
+        const Eigen::MatrixXd& squareRootInformationMatrix,
+        const Eigen::VectorXd& squareRootInformationVector,
+        const double residualSumOfSquares ):
+    SquareRootInformationFilter( squareRootInformationMatrix.cols( ) )
+{
+    if( squareRootInformationMatrix.rows( ) == numberOfParameters_ && squareRootInformationMatrix.isUpperTriangular( 0.0 ) &&
+            squareRootInformationVector.rows( ) == numberOfParameters_ )
+    {
+        squareRootInformationMatrix_ = squareRootInformationMatrix;
+        squareRootInformationVector_ = squareRootInformationVector;
+        residualSumOfSquares_ = residualSumOfSquares;
+    }
+    else
+    {
+        addSquareRootInformation( squareRootInformationMatrix, squareRootInformationVector, residualSumOfSquares );
+    }
+}
+
+//! Function to add a block of observations to the filter
+void SquareRootInformationFilter::addObservations(
+        const Eigen::MatrixXd& designMatrixBlock,
+        const Eigen::VectorXd& observationResidualsBlock,
+        const Eigen::VectorXd& diagonalOfWeightMatrixBlock )
+{
+    int numberOfObservations = designMatrixBlock.rows( );
+    if( designMatrixBlock.cols( ) != numberOfParameters_ )
+    {
+        throw std::runtime_error( "Error when adding observations to square-root information filter, number of columns of partials (" +
+                                  std::to_string( designMatrixBlock.cols( ) ) + ") is incompatible with number of parameters (" +
+                                  std::to_string( numberOfParameters_ ) + ")" );
+    }
+    if( observationResidualsBlock.rows( ) != numberOfObservations || diagonalOfWeightMatrixBlock.rows( ) != numberOfObservations )
+    {
+        throw std::runtime_error( "Error when adding observations to square-root information filter, sizes of partials, residuals and weights are incompatible" );
+    }
+    if( numberOfObservations == 0 )
+    {
+        return;
+    }
+
+    // Stack current [R z] on top of weighted [H y]
+    Eigen::MatrixXd augmentedMatrix = Eigen::MatrixXd( numberOfParameters_ + numberOfObservations, numberOfParameters_ + 1 );
+    augmentedMatrix.topLeftCorner( numberOfParameters_, numberOfParameters_ ) = squareRootInformationMatrix_;
+    augmentedMatrix.topRightCorner( numberOfParameters_, 1 ) = squareRootInformationVector_;
+
+    Eigen::VectorXd squareRootOfWeights = diagonalOfWeightMatrixBlock.cwiseSqrt( );
+    augmentedMatrix.bottomLeftCorner( numberOfObservations, numberOfParameters_ ) =
+            squareRootOfWeights.asDiagonal( ) * designMatrixBlock;
+    augmentedMatrix.bottomRightCorner( numberOfObservations, 1 ) = squareRootOfWeights.cwiseProduct( observationResidualsBlock );
+
+    triangularizeAugmentedMatrix( augmentedMatrix );
+}
+
+//! Function to add the information of another square-root information filter to this filter
+void SquareRootInformationFilter::addSquareRootInformation(
+        const Eigen::MatrixXd& squareRootInformationMatrix,
+        const Eigen::VectorXd& squareRootInformationVector,
+        const double residualSumOfSquares )
+{
+    if( squareRootInformationMatrix.cols( ) != numberOfParameters_ ||
+            squareRootInformationVector.rows( ) != squareRootInformationMatrix.rows( ) )
+    {
+        throw std::runtime_error( "Error when adding square-root information to square-root information filter, sizes are incompatible" );
+    }
+
+    int numberOfRows = squareRootInformationMatrix.rows( );
+    Eigen::MatrixXd augmentedMatrix = Eigen::MatrixXd( numberOfParameters_ + numberOfRows, numberOfParameters_ + 1 );
+    augmentedMatrix.topLeftCorner( numberOfParameters_, numberOfParameters_ ) = squareRootInformationMatrix_;
+    augmentedMatrix.topRightCorner( numberOfParameters_, 1 ) = squareRootInformationVector_;
+    augmentedMatrix.bottomLeftCorner( numberOfRows, numberOfParameters_ ) = squareRootInformationMatrix;
+    augmentedMatrix.bottomRightCorner( numberOfRows, 1 ) = squareRootInformationVector;
+
+    triangularizeAugmentedMatrix( augmentedMatrix );
+    residualSumOfSquares_ += residualSumOfSquares;
+}
+
+//! Function to add a priori information to the filter
+void SquareRootInformationFilter::addAprioriInformation( const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix )
+{
+    if( inverseOfAPrioriCovarianceMatrix.rows( ) != numberOfParameters_ ||
+            inverseOfAPrioriCovarianceMatrix.cols( ) != numberOfParameters_ )
+    {
+        throw std::runtime_error( "Error when adding a priori information to square-root information filter, size of inverse a priori covariance is incompatible with number of parameters" );
+    }
+
+    if( inverseOfAPrioriCovarianceMatrix.isZero( 0.0 ) )
+    {
+        return;
+    }
+
+    // Compute square root S (with S^T S equal to the inverse a priori covariance) from eigenvalue decomposition
+    Eigen::SelfAdjointEigenSolver< Eigen::MatrixXd > eigenDecomposition( inverseOfAPrioriCovarianceMatrix );
+    if( eigenDecomposition.info( ) != Eigen::Success )
+    {
+        throw std::runtime_error( "Error when adding a priori information to square-root information filter, eigenvalue decomposition failed" );
+    }
+
+    Eigen::VectorXd squareRootOfEigenvalues = eigenDecomposition.eigenvalues( ).cwiseMax( 0.0 ).cwiseSqrt( );
+    addSquareRootInformation( squareRootOfEigenvalues.asDiagonal( ) * eigenDecomposition.eigenvectors( ).transpose( ),
+                              Eigen::VectorXd::Zero( numberOfParameters_ ) );
+}
+
+//! Function to add process noise to the estimated parameters
+void SquareRootInformationFilter::addProcessNoise(
+        const Eigen::MatrixXd& noiseMappingMatrix,
+        const Eigen::MatrixXd& processNoiseCovariance )
+{
+    int numberOfNoiseParameters = processNoiseCovariance.rows( );
+    if( noiseMappingMatrix.rows( ) != numberOfParameters_ || noiseMappingMatrix.cols( ) != numberOfNoiseParameters ||
+            processNoiseCovariance.cols( ) != numberOfNoiseParameters )
+    {
+        throw std::runtime_error( "Error when adding process noise to square-root information filter, sizes of noise mapping and covariance are incompatible" );
+    }
+
+    // Compute square root of inverse noise covariance, R_w = L^-1 with Q = L L^T
+    Eigen::LLT< Eigen::MatrixXd > noiseCovarianceDecomposition( processNoiseCovariance );
+    if( noiseCovarianceDecomposition.info( ) != Eigen::Success )
+    {
+        throw std::runtime_error( "Error when adding process noise to square-root information filter, noise covariance is not positive definite" );
+    }
+    Eigen::MatrixXd squareRootNoiseInformation = noiseCovarianceDecomposition.matrixL( ).solve(
+                Eigen::MatrixXd::Identity( numberOfNoiseParameters, numberOfNoiseParameters ) );
+
+    // Set augmented matrix [ R_w 0 0; -R G R z ], and eliminate the noise parameters
+    Eigen::MatrixXd augmentedMatrix = Eigen::MatrixXd::Zero(
+                numberOfNoiseParameters + numberOfParameters_, numberOfNoiseParameters + numberOfParameters_ + 1 );
+    augmentedMatrix.topLeftCorner( numberOfNoiseParameters, numberOfNoiseParameters ) = squareRootNoiseInformation;
+    augmentedMatrix.block( numberOfNoiseParameters, 0, numberOfParameters_, numberOfNoiseParameters ) =
+            -squareRootInformationMatrix_ * noiseMappingMatrix;
+    augmentedMatrix.block( numberOfNoiseParameters, numberOfNoiseParameters, numberOfParameters_, numberOfParameters_ ) =
+            squareRootInformationMatrix_;
+    augmentedMatrix.bottomRightCorner( numberOfParameters_, 1 ) = squareRootInformationVector_;
+
+    triangularizeAugmentedMatrix( augmentedMatrix, numberOfNoiseParameters );
+}
+
+//! Function to rescale the estimated parameters
+void SquareRootInformationFilter::scaleParameters( const Eigen::VectorXd& scalingFactors )
+{
+    if( scalingFactors.rows( ) != numberOfParameters_ )
+    {
+        throw std::runtime_error( "Error when scaling parameters of square-root information filter, number of scaling factors is incompatible with number of parameters" );
+    }
+    squareRootInformationMatrix_ = squareRootInformationMatrix_ * scalingFactors.cwiseInverse( ).asDiagonal( );
+}
+
+//! Function to compute the current parameter estimate
+Eigen::VectorXd SquareRootInformationFilter::getParameterEstimate( const double limitConditionNumberForWarning ) const
+{
+    // Check whether matrix is (numerically) singular
+    Eigen::VectorXd absoluteDiagonal = squareRootInformationMatrix_.diagonal( ).cwiseAbs( );
+    if( !( absoluteDiagonal.minCoeff( ) > std::numeric_limits< double >::epsilon( ) * numberOfParameters_ * absoluteDiagonal.maxCoeff( ) ) )
+    {
+        throw std::runtime_error( "Error when computing parameter estimate of square-root information filter, information matrix is singular" );
+    }
+
+    if( limitConditionNumberForWarning == limitConditionNumberForWarning )
+    {
+        double conditionNumber = std::pow( absoluteDiagonal.maxCoeff( ) / absoluteDiagonal.minCoeff( ), 2 );
+        if( conditionNumber > limitConditionNumberForWarning )
+        {
+            std::cerr << "Warning when performing least squares, condition number is " << conditionNumber << std::endl;
+        }
+    }
+
+    return squareRootInformationMatrix_.triangularView< Eigen::Upper >( ).solve( squareRootInformationVector_ );
+}
+
+//! Function to compute the covariance matrix R^-1 R^-T
+Eigen::MatrixXd SquareRootInformationFilter::getCovarianceMatrix( ) const
+{
+    Eigen::MatrixXd inverseSquareRootInformationMatrix = squareRootInformationMatrix_.triangularView< Eigen::Upper >( ).solve(
+                Eigen::MatrixXd::Identity( numberOfParameters_, numberOfParameters_ ) );
+    return inverseSquareRootInformationMatrix * inverseSquareRootInformationMatrix.transpose( );
+}
+
+//! Function to triangularize an augmented matrix [A b], and set its upper part as the new [R z]
+void SquareRootInformationFilter::triangularizeAugmentedMatrix(
+        const Eigen::MatrixXd& augmentedMatrix,
+        const int numberOfLeadingColumns )
+{
+    // Pad with zero rows if needed, so that the triangularized matrix contains the full [R z] and the residual entry
+    int numberOfColumns = augmentedMatrix.cols( );
+    Eigen::HouseholderQR< Eigen::MatrixXd > qrDecomposition;
+    if( augmentedMatrix.rows( ) < numberOfColumns )
+    {
+        Eigen::MatrixXd paddedMatrix = Eigen::MatrixXd::Zero( numberOfColumns, numberOfColumns );
+        paddedMatrix.topRows( augmentedMatrix.rows( ) ) = augmentedMatrix;
+        qrDecomposition.compute( paddedMatrix );
+    }
+    else
+    {
+        qrDecomposition.compute( augmentedMatrix );
+    }
+    const Eigen::MatrixXd& triangularizedMatrix = qrDecomposition.matrixQR( );
+
+    squareRootInformationMatrix_ = triangularizedMatrix.block(
+                numberOfLeadingColumns, numberOfLeadingColumns, numberOfParameters_, numberOfParameters_ ).triangularView< Eigen::Upper >( );
+    squareRootInformationVector_ = triangularizedMatrix.block(
+                numberOfLeadingColumns, numberOfColumns - 1, numberOfParameters_, 1 );
+    residualSumOfSquares_ += std::pow( triangularizedMatrix( numberOfColumns - 1, numberOfColumns - 1 ), 2 );
+}
+
+} // namespace linear_algebra
+
+} // namespace tudat
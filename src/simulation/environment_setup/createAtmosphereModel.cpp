@@ -227,6 +227,28 @@ std::shared_ptr< aerodynamics::AtmosphereModel > createAtmosphereModel(
         }
         break;
     }
+    case precomputed_atmosphere:
+    {
+        // Check consistency of type and class.
+        std::shared_ptr< PrecomputedAtmosphereSettings > precomputedAtmosphereSettings =
+                std::dynamic_pointer_cast< PrecomputedAtmosphereSettings >(
+                    atmosphereSettings );
+        if( precomputedAtmosphereSettings == nullptr )
+        {
+            throw std::runtime_error(
+                        "Error, expected precomputed atmosphere settings for body " + body );
+        }
+        else
+        {
+            std::shared_ptr< AtmosphereModel > baseAtmosphere = createAtmosphereModel(
+                        precomputedAtmosphereSettings->getBaseSettings( ), body );
+            atmosphereModel = createPrecomputedAtmosphere(
+                        baseAtmosphere, precomputedAtmosphereSettings->getGridSettings( ),
+                        precomputedAtmosphereSettings->getCacheFile( ),
+                        precomputedAtmosphereSettings->getBoundaryHandling( ) );
+        }
+        break;
+    }
     default:
         throw std::runtime_error( "Error, did not recognize atmosphere model settings type " +
                                   std::to_string( atmosphereSettings->getAtmosphereType( ) ) );
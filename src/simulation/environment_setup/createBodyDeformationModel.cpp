@@ -73,7 +73,7 @@ std::shared_ptr< basic_astrodynamics::Iers2010EarthDeformation > createDefaultEa
     std::shared_ptr< Iers2010EarthDeformation > deformationModel = std::make_shared< Iers2010EarthDeformation >
             ( std::bind( &Ephemeris::getCartesianState, earthEphemeris, std::placeholders::_1 ),
               ephemerides,
-              std::bind( &RotationalEphemeris::getRotationToTargetFrame, earthRotation, std::placeholders::_1 ),
+              std::bind( &RotationalEphemeris::getRotationToTargetFrameTemplated< double >, earthRotation, std::placeholders::_1 ),
               gravitionalParametersOfEarth, gravitationalParameters,
               equatorialRadius, nominalDisplacementLoveNumbers, latitudeTerms, areTermsCalculated,
               correctionNumbers, diurnalFile, longPeriodFile, doodsonArgumentFunction );
@@ -161,7 +161,7 @@ std::shared_ptr< basic_astrodynamics::BodyDeformationModel > createBodyDeformati
                         std::bind( &Body::getStateInBaseFrameFromEphemeris< double, double >, bodyMap.at( body ),
                                    std::placeholders::_1 ),
                         deformingBodyEphemerides,
-                        std::bind( &ephemerides::RotationalEphemeris::getRotationToTargetFrame, bodyMap.at( body )->getRotationalEphemeris( ),
+                        std::bind( &ephemerides::RotationalEphemeris::getRotationToTargetFrameTemplated< double >, bodyMap.at( body )->getRotationalEphemeris( ),
                                    std::placeholders::_1 ),
                         gravitionalParameterOfDeformedBody,
                         gravitionalParametersOfDeformingBodies,
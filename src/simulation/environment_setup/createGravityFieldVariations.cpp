@@ -229,7 +229,7 @@ std::shared_ptr< gravitation::GravityFieldVariations > createGravityFieldVariati
             deformedBodyStateFunction = std::bind( &Body::getStateInBaseFrameFromEphemeris< double, double >,
                                                      bodies.at( body ), std::placeholders::_1 );
             deformedBodyOrientationFunction = std::bind(
-                        &ephemerides::RotationalEphemeris::getRotationToTargetFrame,
+                        &ephemerides::RotationalEphemeris::getRotationToTargetFrameTemplated< double >,
                         bodies.at( body )->getRotationalEphemeris( ), std::placeholders::_1 );
         }
         else
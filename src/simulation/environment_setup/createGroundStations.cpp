@@ -25,7 +25,7 @@ void createGroundStation(
 {
     std::shared_ptr< ground_stations::PointingAnglesCalculator > pointingAnglesCalculator =
             std::make_shared< ground_stations::PointingAnglesCalculator >(
-                std::bind( &ephemerides::RotationalEphemeris::getRotationToTargetFrame, body->getRotationalEphemeris( ), std::placeholders::_1 ),
+                std::bind( &ephemerides::RotationalEphemeris::getRotationToTargetFrameTemplated< double >, body->getRotationalEphemeris( ), std::placeholders::_1 ),
                 std::bind( &ground_stations::GroundStationState::getRotationFromBodyFixedToTopocentricFrame, groundStationState, std::placeholders::_1 ) );
     body->addGroundStation( groundStationName, std::make_shared< ground_stations::GroundStation >(
                                 groundStationState, pointingAnglesCalculator, groundStationName ) );
@@ -103,7 +103,7 @@ std::shared_ptr< ground_stations::StationMotionModel > createGroundStationMotion
             }
 
             std::function< Eigen::Quaterniond( const double ) > inertialToBodyFixedRotationFunction = std::bind(
-                &ephemerides::RotationalEphemeris::getRotationToTargetFrame, body->getRotationalEphemeris( ), std::placeholders::_1 );
+                &ephemerides::RotationalEphemeris::getRotationToTargetFrameTemplated< double >, body->getRotationalEphemeris( ), std::placeholders::_1 );
 
             std::function< Eigen::Vector3d( const double ) > centralBodyBarycentricPositionFunction = nullptr;
             std::function< double( ) > centralBodyGravitationalParameterFunction = nullptr;
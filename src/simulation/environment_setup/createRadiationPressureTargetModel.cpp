@@ -198,8 +198,26 @@ std::vector< std::shared_ptr<electromagnetism::RadiationPressureTargetModel> > c
             }
 
 
-            radiationPressureTargetModels.push_back( std::make_shared<PaneledRadiationPressureTargetModel>(
-                bodyFixedPanels, segmentFixedPanels, segmentFixedToBodyFixedRotations, sourceToTargetOccultingBodies) );
+            std::shared_ptr< PaneledRadiationPressureTargetModel > paneledTargetModel =
+                std::make_shared<PaneledRadiationPressureTargetModel>(
+                    bodyFixedPanels, segmentFixedPanels, segmentFixedToBodyFixedRotations, sourceToTargetOccultingBodies );
+
+            // Create self-shadowing model, if requested
+            std::shared_ptr< PaneledRadiationPressureTargetModelSettings > paneledTargetModelSettings =
+                std::dynamic_pointer_cast< PaneledRadiationPressureTargetModelSettings >( modelSettings );
+            if( paneledTargetModelSettings != nullptr && paneledTargetModelSettings->getSelfShadowingSettings( ) != nullptr )
+            {
+                std::shared_ptr< PanelSelfShadowingSettings > selfShadowingSettings =
+                    paneledTargetModelSettings->getSelfShadowingSettings( );
+                paneledTargetModel->setSelfShadowingModel( std::make_shared< electromagnetism::PanelSelfShadowingModel >(
+                    bodyFixedPanels,
+                    selfShadowingSettings->numberOfAzimuthPoints_,
+                    selfShadowingSettings->numberOfElevationPoints_,
+                    selfShadowingSettings->numberOfSamplesPerPanelSide_,
+                    selfShadowingSettings->numberOfThreads_ ) );
+            }
+
+            radiationPressureTargetModels.push_back( paneledTargetModel );
             break;
         }
         case RadiationPressureTargetModelType::multi_type_target:
@@ -317,7 +317,8 @@ std::shared_ptr<electromagnetism::RadiationSourceModel> createRadiationSourceMod
                 std::move(sourcePanelRadiosityModelUpdater),
                 radiosityModels,
                 paneledModelSettings->getNumberOfPanelsPerRing(),
-                sourceBodyName);
+                sourceBodyName,
+                paneledModelSettings->getPanelRegenerationTolerance());
         break;
     }
     default:
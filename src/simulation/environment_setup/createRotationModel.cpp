@@ -518,9 +518,38 @@ std::shared_ptr< ephemerides::RotationalEphemeris > createRotationModel(
             std::shared_ptr< earth_orientation::EarthOrientationAnglesCalculator > earthOrientationCalculator =
                     std::make_shared< earth_orientation::EarthOrientationAnglesCalculator >(
                         polarMotionCalculator, precessionNutationCalculator, terrestrialTimeScaleConverter );
+
+            // Load precomputed Earth orientation table, if requested
+            std::shared_ptr< earth_orientation::TabulatedEarthOrientationAngles > tabulatedAngles;
+            if( gcrsToItrsRotationSettings->getEarthOrientationTableFile( ) != "" )
+            {
+                tabulatedAngles = earth_orientation::getTabulatedEarthOrientationAngles(
+                            gcrsToItrsRotationSettings->getEarthOrientationTableFile( ) );
+                if( tabulatedAngles->getPrecessionNutationTheory( ) != gcrsToItrsRotationSettings->getNutationTheory( ) )
+                {
+                    throw std::runtime_error( "Error when creating GCRS to ITRS rotation model for " + body +
+                                              ", Earth orientation table uses different precession-nutation theory" );
+                }
+
+                // Check if table was generated with the same EOP data and short-period corrections
+                std::pair< uint64_t, uint64_t > currentFingerprints =
+                        earth_orientation::computeEarthOrientationTableFingerprints(
+                            earthOrientationCalculator, tabulatedAngles->getStartTime( ), tabulatedAngles->getEndTime( ) );
+                if( tabulatedAngles->getEopDataFingerprint( ) != currentFingerprints.first )
+                {
+                    throw std::runtime_error( "Error when creating GCRS to ITRS rotation model for " + body +
+                                              ", Earth orientation table was generated with different EOP data" );
+                }
+                if( tabulatedAngles->getShortPeriodCorrectionsFingerprint( ) != currentFingerprints.second )
+                {
+                    throw std::runtime_error( "Error when creating GCRS to ITRS rotation model for " + body +
+                                              ", Earth orientation table was generated with different short-period corrections" );
+                }
+            }
+
             rotationalEphemeris = std::make_shared< ephemerides::GcrsToItrsRotationModel >(
                         earthOrientationCalculator, gcrsToItrsRotationSettings->getInputTimeScale( ),
-                        gcrsToItrsRotationSettings->getOriginalFrame( ) );
+                        gcrsToItrsRotationSettings->getOriginalFrame( ), tabulatedAngles );
 
             break;
         }
@@ -799,6 +828,26 @@ std::shared_ptr< ephemerides::RotationalEphemeris > createRotationModel(
                     std::to_string( rotationModelSettings->getRotationType( ) ) );
     }
 
+    // Enable per-epoch caching of rotational quantities, if requested (only for models that depend on time only)
+    if( rotationModelSettings->getUseEpochCache( ) )
+    {
+        switch( rotationModelSettings->getRotationType( ) )
+        {
+        case simple_rotation_model:
+        case spice_rotation_model:
+        case gcrs_to_itrs_rotation_model:
+        case planetary_rotation_model:
+        case tabulated_rotation_model:
+            rotationalEphemeris->setUseEpochCache( true );
+            break;
+        default:
+            throw std::runtime_error(
+                        "Error when creating rotation model for " + body +
+                        ", per-epoch caching is not supported for state-dependent or custom rotation model type " +
+                        std::to_string( rotationModelSettings->getRotationType( ) ) );
+        }
+    }
+
     return rotationalEphemeris;
 }
 
@@ -85,7 +85,7 @@ std::map< observation_models::LinkEndType, std::shared_ptr< CartesianStatePartia
             // Create partial
             partialMap[ linkEndIterator->first ] = std::make_shared< CartesianStatePartialWrtRotationMatrixParameter >(
                         std::make_shared< RotationMatrixPartialWrtRotationalState >(
-                            std::bind( &ephemerides::RotationalEphemeris::getRotationToBaseFrame,
+                            std::bind( &ephemerides::RotationalEphemeris::getRotationToBaseFrameTemplated< double >,
                                          currentBody->getRotationalEphemeris( ), std::placeholders::_1 ) ), groundStationPositionFunction );
         }
     }
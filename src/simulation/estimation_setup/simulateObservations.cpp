@@ -1,4 +1,15 @@
+#include <algorithm>
+#include <iostream>
+
 #include "tudat/simulation/estimation_setup/simulateObservations.h"
+#include "tudat/astro/ephemerides/constantEphemeris.h"
+#include "tudat/astro/ephemerides/constantRotationalEphemeris.h"
+#include "tudat/astro/ephemerides/keplerEphemeris.h"
+#include "tudat/astro/ephemerides/multiArcEphemeris.h"
+#include "tudat/astro/ephemerides/simpleRotationalEphemeris.h"
+#include "tudat/astro/ephemerides/tabulatedEphemeris.h"
+#include "tudat/interface/spice/spiceEphemeris.h"
+#include "tudat/interface/spice/spiceRotationalEphemeris.h"
 
 namespace tudat
 {
@@ -6,6 +17,151 @@ namespace tudat
 namespace simulation_setup
 {
 
+//! Function to check whether an ephemeris is known to be safe for concurrent evaluation
+bool isEphemerisThreadSafe( const std::shared_ptr< ephemerides::Ephemeris > ephemeris )
+{
+    if( ephemeris == nullptr ||
+            ephemerides::isTabulatedEphemeris( ephemeris ) ||
+            std::dynamic_pointer_cast< ephemerides::ConstantEphemeris >( ephemeris ) != nullptr ||
+            std::dynamic_pointer_cast< ephemerides::KeplerEphemeris >( ephemeris ) != nullptr )
+    {
+        return true;
+    }
+    else if( std::dynamic_pointer_cast< ephemerides::MultiArcEphemeris >( ephemeris ) != nullptr )
+    {
+        std::vector< std::shared_ptr< ephemerides::Ephemeris > > singleArcEphemerides =
+                std::dynamic_pointer_cast< ephemerides::MultiArcEphemeris >( ephemeris )->getSingleArcEphemerides( );
+        for( unsigned int i = 0; i < singleArcEphemerides.size( ); i++ )
+        {
+            if( !isEphemerisThreadSafe( singleArcEphemerides.at( i ) ) )
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+//! Function to check whether a rotation model is known to be safe for concurrent evaluation
+bool isRotationalEphemerisThreadSafe( const std::shared_ptr< ephemerides::RotationalEphemeris > rotationalEphemeris )
+{
+    if( rotationalEphemeris == nullptr )
+    {
+        return true;
+    }
+    else if( rotationalEphemeris->getUseEpochCache( ) )
+    {
+        return false;
+    }
+    return ( std::dynamic_pointer_cast< ephemerides::SimpleRotationalEphemeris >( rotationalEphemeris ) != nullptr ||
+             std::dynamic_pointer_cast< ephemerides::ConstantRotationalEphemeris >( rotationalEphemeris ) != nullptr );
+}
+
+//! Function to check whether a ground station motion model is known to be safe for concurrent evaluation
+bool isStationMotionModelThreadSafe( const std::shared_ptr< ground_stations::StationMotionModel > stationMotionModel )
+{
+    if( stationMotionModel == nullptr ||
+            std::dynamic_pointer_cast< ground_stations::LinearStationMotionModel >( stationMotionModel ) != nullptr )
+    {
+        return true;
+    }
+    else if( std::dynamic_pointer_cast< ground_stations::CombinedStationMotionModel >( stationMotionModel ) != nullptr )
+    {
+        std::vector< std::shared_ptr< ground_stations::StationMotionModel > > modelList =
+                std::dynamic_pointer_cast< ground_stations::CombinedStationMotionModel >( stationMotionModel )->getModelList( );
+        for( unsigned int i = 0; i < modelList.size( ); i++ )
+        {
+            if( !isStationMotionModelThreadSafe( modelList.at( i ) ) )
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+//! Function to retrieve the environment models that cannot be evaluated concurrently from multiple threads
+std::vector< std::string > getThreadUnsafeEnvironmentModels( const SystemOfBodies& bodies )
+{
+    // Sort bodies by name, for reproducible output
+    std::vector< std::string > bodyNames;
+    for( auto bodyIterator : bodies.getMap( ) )
+    {
+        bodyNames.push_back( bodyIterator.first );
+    }
+    std::sort( bodyNames.begin( ), bodyNames.end( ) );
+
+    std::vector< std::string > threadUnsafeModels;
+    for( unsigned int i = 0; i < bodyNames.size( ); i++ )
+    {
+        std::shared_ptr< Body > currentBody = bodies.at( bodyNames.at( i ) );
+
+        // Check ephemeris
+        if( std::dynamic_pointer_cast< ephemerides::SpiceEphemeris >( currentBody->getEphemeris( ) ) != nullptr )
+        {
+            threadUnsafeModels.push_back( "SPICE ephemeris of " + bodyNames.at( i ) );
+        }
+        else if( !isEphemerisThreadSafe( currentBody->getEphemeris( ) ) )
+        {
+            threadUnsafeModels.push_back( "ephemeris of " + bodyNames.at( i ) );
+        }
+
+        // Check rotation model
+        std::shared_ptr< ephemerides::RotationalEphemeris > rotationalEphemeris = currentBody->getRotationalEphemeris( );
+        if( std::dynamic_pointer_cast< ephemerides::SpiceRotationalEphemeris >( rotationalEphemeris ) != nullptr )
+        {
+            threadUnsafeModels.push_back( "SPICE rotation model of " + bodyNames.at( i ) );
+        }
+        else if( rotationalEphemeris != nullptr && rotationalEphemeris->getUseEpochCache( ) )
+        {
+            threadUnsafeModels.push_back( "per-epoch cached rotation model of " + bodyNames.at( i ) );
+        }
+        else if( !isRotationalEphemerisThreadSafe( rotationalEphemeris ) )
+        {
+            threadUnsafeModels.push_back( "rotation model of " + bodyNames.at( i ) );
+        }
+
+        // Check ground station motion models
+        std::map< std::string, std::shared_ptr< ground_stations::GroundStation > > groundStations =
+                currentBody->getGroundStationMap( );
+        for( auto stationIterator : groundStations )
+        {
+            if( !isStationMotionModelThreadSafe(
+                        stationIterator.second->getNominalStationState( )->getStationMotionModel( ) ) )
+            {
+                threadUnsafeModels.push_back( "station motion model of " + bodyNames.at( i ) + " station " +
+                                              stationIterator.first );
+            }
+        }
+    }
+    return threadUnsafeModels;
+}
+
+//! Function to determine the number of threads with which the environment can be evaluated concurrently
+unsigned int getNumberOfThreadsForEnvironmentEvaluation( const SystemOfBodies& bodies,
+                                                         const unsigned int numberOfThreads )
+{
+    if( numberOfThreads == 1 )
+    {
+        return 1;
+    }
+
+    std::vector< std::string > threadUnsafeModels = getThreadUnsafeEnvironmentModels( bodies );
+    if( threadUnsafeModels.size( ) > 0 )
+    {
+        std::cerr << "Warning, environment contains models that cannot be evaluated concurrently (";
+        for( unsigned int i = 0; i < threadUnsafeModels.size( ); i++ )
+        {
+            std::cerr << ( i > 0 ? ", " : "" ) << threadUnsafeModels.at( i );
+        }
+        std::cerr << "), using a single thread instead of " << numberOfThreads << std::endl;
+        return 1;
+    }
+    return numberOfThreads;
+}
+
 
 std::map< double, Eigen::VectorXd > getTargetAnglesAndRange(
         const simulation_setup::SystemOfBodies& bodies,
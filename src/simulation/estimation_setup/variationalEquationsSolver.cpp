@@ -10,6 +10,9 @@
 
 #include "tudat/simulation/estimation_setup/variationalEquationsSolver.h"
 
+#include "tudat/math/interpolators/lagrangeInterpolator.h"
+#include "tudat/math/interpolators/singlePrecisionLagrangeInterpolator.h"
+
 namespace tudat
 {
 
@@ -35,31 +38,183 @@ namespace propagators
 ////template class MultiArcVariationalEquationsSolver< double, Time >;
 ////template class MultiArcVariationalEquationsSolver< long double, Time >;
 
-//! Function to create interpolators for state transition and sensitivity matrices from numerical results.
-void createStateTransitionAndSensitivityMatrixInterpolator(
+//! Function to create the state transition and sensitivity matrix interpolators from a subset of the tabulated epochs
+void createCompressedStateTransitionAndSensitivityMatrixInterpolator(
         std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >& stateTransitionMatrixInterpolator,
         std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >& sensitivityMatrixInterpolator,
-        std::map< double, Eigen::MatrixXd >& stateTransitionSolution,
-        std::map< double, Eigen::MatrixXd >& sensitivitySolution,
-        const bool clearRawSolution )
+        const std::vector< double >& times,
+        const std::vector< Eigen::MatrixXd >& stateTransitionMatrices,
+        const std::vector< Eigen::MatrixXd >& sensitivityMatrices,
+        const int tabulationStepMultiple,
+        const int numberOfInterpolationPoints,
+        const bool useSinglePrecisionSensitivityMatrix )
 {
+    // Select tabulated epochs. All epochs are retained near the start and end, where the (lower-order) cubic spline
+    // boundary interpolation is used.
+    std::vector< double > tabulatedTimes;
+    std::vector< Eigen::MatrixXd > tabulatedStateTransitionMatrices;
+    std::vector< Eigen::MatrixXd > tabulatedSensitivityMatrices;
+    int numberOfEpochs = static_cast< int >( times.size( ) );
+    for( int i = 0; i < numberOfEpochs; i++ )
+    {
+        if( ( i % tabulationStepMultiple == 0 ) || ( i < numberOfInterpolationPoints ) ||
+                ( i >= numberOfEpochs - numberOfInterpolationPoints ) )
+        {
+            tabulatedTimes.push_back( times.at( i ) );
+            tabulatedStateTransitionMatrices.push_back( stateTransitionMatrices.at( i ) );
+            tabulatedSensitivityMatrices.push_back( sensitivityMatrices.at( i ) );
+        }
+    }
+
     // Create interpolator for state transition matrix.
-    stateTransitionMatrixInterpolator=
+    stateTransitionMatrixInterpolator =
             std::make_shared< interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > >(
-                utilities::createVectorFromMapKeys< Eigen::MatrixXd, double >( stateTransitionSolution ),
-                utilities::createVectorFromMapValues< Eigen::MatrixXd, double >( stateTransitionSolution ), 4,
+                tabulatedTimes, tabulatedStateTransitionMatrices, numberOfInterpolationPoints,
                 interpolators::huntingAlgorithm,
                 interpolators::lagrange_cubic_spline_boundary_interpolation,
                 interpolators::throw_exception_at_boundary );
 
     // Create interpolator for sensitivity matrix.
-    sensitivityMatrixInterpolator =
-            std::make_shared< interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > >(
-                utilities::createVectorFromMapKeys< Eigen::MatrixXd, double >( sensitivitySolution ),
-                utilities::createVectorFromMapValues< Eigen::MatrixXd, double >( sensitivitySolution ), 4,
-                interpolators::huntingAlgorithm,
-                interpolators::lagrange_cubic_spline_boundary_interpolation,
-                interpolators::throw_exception_at_boundary );
+    if( useSinglePrecisionSensitivityMatrix )
+    {
+        sensitivityMatrixInterpolator =
+                std::make_shared< interpolators::SinglePrecisionLagrangeInterpolator >(
+                    tabulatedTimes, tabulatedSensitivityMatrices, numberOfInterpolationPoints,
+                    interpolators::huntingAlgorithm,
+                    interpolators::lagrange_cubic_spline_boundary_interpolation,
+                    interpolators::throw_exception_at_boundary );
+    }
+    else
+    {
+        sensitivityMatrixInterpolator =
+                std::make_shared< interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > >(
+                    tabulatedTimes, tabulatedSensitivityMatrices, numberOfInterpolationPoints,
+                    interpolators::huntingAlgorithm,
+                    interpolators::lagrange_cubic_spline_boundary_interpolation,
+                    interpolators::throw_exception_at_boundary );
+    }
+}
+
+//! Function to compute the maximum interpolation error of a matrix history, relative to the maximum value of each column
+double getMaximumRelativeInterpolationError(
+        const std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > > matrixInterpolator,
+        const std::vector< double >& times,
+        const std::vector< Eigen::MatrixXd >& matrices )
+{
+    if( matrices.size( ) == 0 || matrices.at( 0 ).size( ) == 0 )
+    {
+        return 0.0;
+    }
+
+    // Determine maximum absolute value of each column over all epochs
+    Eigen::RowVectorXd columnScales = Eigen::RowVectorXd::Zero( matrices.at( 0 ).cols( ) );
+    for( unsigned int i = 0; i < matrices.size( ); i++ )
+    {
+        columnScales = columnScales.cwiseMax( matrices.at( i ).cwiseAbs( ).colwise( ).maxCoeff( ) );
+    }
+    for( int j = 0; j < columnScales.cols( ); j++ )
+    {
+        if( columnScales( j ) == 0.0 )
+        {
+            columnScales( j ) = 1.0;
+        }
+    }
+
+    // Compare interpolated to numerical matrices at all epochs
+    double maximumRelativeError = 0.0;
+    interpolators::LookUpCursor lookUpCursor;
+    for( unsigned int i = 0; i < times.size( ); i++ )
+    {
+        Eigen::MatrixXd interpolationError = matrixInterpolator->interpolate( times.at( i ), lookUpCursor ) - matrices.at( i );
+        maximumRelativeError = std::max(
+                    maximumRelativeError,
+                    ( interpolationError.cwiseAbs( ).array( ).rowwise( ) / columnScales.array( ) ).maxCoeff( ) );
+    }
+    return maximumRelativeError;
+}
+
+//! Function to create interpolators for state transition and sensitivity matrices from numerical results.
+void createStateTransitionAndSensitivityMatrixInterpolator(
+        std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >& stateTransitionMatrixInterpolator,
+        std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >& sensitivityMatrixInterpolator,
+        std::map< double, Eigen::MatrixXd >& stateTransitionSolution,
+        std::map< double, Eigen::MatrixXd >& sensitivitySolution,
+        const bool clearRawSolution,
+        const std::shared_ptr< StateTransitionMatrixStorageSettings > storageSettings )
+{
+    if( storageSettings == nullptr )
+    {
+        // Create interpolator for state transition matrix.
+        stateTransitionMatrixInterpolator=
+                std::make_shared< interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > >(
+                    utilities::createVectorFromMapKeys< Eigen::MatrixXd, double >( stateTransitionSolution ),
+                    utilities::createVectorFromMapValues< Eigen::MatrixXd, double >( stateTransitionSolution ), 4,
+                    interpolators::huntingAlgorithm,
+                    interpolators::lagrange_cubic_spline_boundary_interpolation,
+                    interpolators::throw_exception_at_boundary );
+
+        // Create interpolator for sensitivity matrix.
+        sensitivityMatrixInterpolator =
+                std::make_shared< interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > >(
+                    utilities::createVectorFromMapKeys< Eigen::MatrixXd, double >( sensitivitySolution ),
+                    utilities::createVectorFromMapValues< Eigen::MatrixXd, double >( sensitivitySolution ), 4,
+                    interpolators::huntingAlgorithm,
+                    interpolators::lagrange_cubic_spline_boundary_interpolation,
+                    interpolators::throw_exception_at_boundary );
+    }
+    else
+    {
+        std::vector< double > times = utilities::createVectorFromMapKeys< Eigen::MatrixXd, double >( stateTransitionSolution );
+        std::vector< Eigen::MatrixXd > stateTransitionMatrices =
+                utilities::createVectorFromMapValues< Eigen::MatrixXd, double >( stateTransitionSolution );
+        std::vector< Eigen::MatrixXd > sensitivityMatrices =
+                utilities::createVectorFromMapValues< Eigen::MatrixXd, double >( sensitivitySolution );
+        if( sensitivityMatrices.size( ) != times.size( ) )
+        {
+            throw std::runtime_error( "Error when creating compressed state transition and sensitivity matrix interpolators, histories are of different size" );
+        }
+
+        // Do not use a coarser tabulation if too few epochs remain for the interpolation
+        int tabulationStepMultiple = storageSettings->tabulationStepMultiple_;
+        while( ( tabulationStepMultiple > 1 ) && ( static_cast< int >( times.size( ) ) <
+                                                   4 * storageSettings->numberOfInterpolationPoints_ * tabulationStepMultiple ) )
+        {
+            tabulationStepMultiple /= 2;
+        }
+        bool useSinglePrecisionSensitivityMatrix = storageSettings->useSinglePrecisionSensitivityMatrix_ &&
+                ( sensitivityMatrices.size( ) > 0 ) && ( sensitivityMatrices.at( 0 ).size( ) > 0 );
+
+        // Create interpolators, and reduce the compression until the interpolation error is sufficiently small.
+        while( true )
+        {
+            createCompressedStateTransitionAndSensitivityMatrixInterpolator(
+                        stateTransitionMatrixInterpolator, sensitivityMatrixInterpolator, times,
+                        stateTransitionMatrices, sensitivityMatrices, tabulationStepMultiple,
+                        storageSettings->numberOfInterpolationPoints_, useSinglePrecisionSensitivityMatrix );
+
+            if( !( storageSettings->maximumRelativeError_ > 0.0 ) ||
+                    ( tabulationStepMultiple == 1 && !useSinglePrecisionSensitivityMatrix ) )
+            {
+                break;
+            }
+
+            double maximumRelativeError = std::max(
+                        getMaximumRelativeInterpolationError( stateTransitionMatrixInterpolator, times, stateTransitionMatrices ),
+                        getMaximumRelativeInterpolationError( sensitivityMatrixInterpolator, times, sensitivityMatrices ) );
+            if( maximumRelativeError <= storageSettings->maximumRelativeError_ )
+            {
+                break;
+            }
+            else if( tabulationStepMultiple > 1 )
+            {
+                tabulationStepMultiple /= 2;
+            }
+            else
+            {
+                useSinglePrecisionSensitivityMatrix = false;
+            }
+        }
+    }
 
     if( clearRawSolution )
     {
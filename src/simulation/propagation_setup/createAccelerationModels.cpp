@@ -1066,8 +1066,8 @@ std::shared_ptr< aerodynamics::AerodynamicAcceleration > createAerodynamicAccele
                 reference_frames::inertial_frame );
 
     std::function< Eigen::Vector3d&( ) > coefficientFunction =
-            std::bind( &AerodynamicCoefficientInterface::getCurrentForceCoefficientsReference,
-                       aerodynamicCoefficients );
+            std::bind( &AtmosphericFlightConditions::getCurrentForceCoefficientsReference,
+                       bodyFlightConditions );
     std::function< void( Eigen::Vector3d& ) > coefficientInPropagationFrameFunction =
             std::bind( &reference_frames::transformVectorFunctionFromVectorReferenceFunctions,
                        std::placeholders::_1,
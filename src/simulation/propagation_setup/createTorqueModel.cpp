@@ -95,8 +95,8 @@ std::shared_ptr< aerodynamics::AerodynamicTorque > createAerodynamicTorqueModel(
 
 
     std::function< Eigen::Vector3d( ) > coefficientFunction =
-            std::bind( &aerodynamics::AerodynamicCoefficientInterface::getCurrentMomentCoefficients,
-                         aerodynamicCoefficients );
+            std::bind( &aerodynamics::AtmosphericFlightConditions::getCurrentMomentCoefficients,
+                         bodyFlightConditions );
     std::function< Eigen::Vector3d( ) > coefficientInPropagationFrameFunction =
             std::bind( &reference_frames::transformVectorFunctionFromVectorFunctions,
                          coefficientFunction, toPropagationFrameTransformation );
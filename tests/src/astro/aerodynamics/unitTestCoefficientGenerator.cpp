@@ -17,6 +17,7 @@
 #define BOOST_TEST_MAIN
 
 #include <boost/array.hpp>
+#include <boost/filesystem.hpp>
 
 #include <memory>
 #include <boost/test/tools/floating_point_comparison.hpp>
@@ -245,7 +246,8 @@ BOOST_AUTO_TEST_CASE( testAerodynamicCoefficientGeneratorHypersonicLocalInclinat
     }
 }
 
-std::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInterface( )
+std::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInterface(
+        const unsigned int numberOfThreads = 1, const std::string& cacheDirectory = "" )
 {
 
     // Create test capsule.
@@ -303,7 +305,7 @@ std::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInterf
     return std::make_shared< HypersonicLocalInclinationAnalysis >(
                 independentVariableDataPoints, capsule, numberOfLines, numberOfPoints,
                 invertOrders, selectedMethods, PI * pow( capsule->getMiddleRadius( ), 2.0 ),
-                3.9116, momentReference );
+                3.9116, momentReference, false, numberOfThreads, cacheDirectory );
 }
 
 //! Apollo capsule test case.
@@ -392,6 +394,96 @@ BOOST_AUTO_TEST_CASE( testApolloCapsule )
                        toleranceAerodynamicCoefficients5 );
 }
 
+//! Test parallel generation and caching of local inclination coefficients.
+BOOST_AUTO_TEST_CASE( testLocalInclinationParallelGenerationAndCache )
+{
+    // Generate coefficients serially and in parallel.
+    std::shared_ptr< HypersonicLocalInclinationAnalysis > serialCoefficientInterface =
+            getApolloCoefficientInterface( 1 );
+    std::shared_ptr< HypersonicLocalInclinationAnalysis > parallelCoefficientInterface =
+            getApolloCoefficientInterface( 4 );
+
+    // Check that results are identical.
+    boost::multi_array< Vector6d, 3 > serialCoefficients =
+            serialCoefficientInterface->getAerodynamicCoefficientsTables( );
+    boost::multi_array< Vector6d, 3 > parallelCoefficients =
+            parallelCoefficientInterface->getAerodynamicCoefficientsTables( );
+    BOOST_CHECK_EQUAL( serialCoefficients.num_elements( ), parallelCoefficients.num_elements( ) );
+    for( unsigned int i = 0; i < serialCoefficients.num_elements( ); i++ )
+    {
+        for( unsigned int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_EQUAL( serialCoefficients.data( )[ i ]( j ), parallelCoefficients.data( )[ i ]( j ) );
+        }
+    }
+
+    // Generate coefficients with cache, and check that cache file is created.
+    boost::filesystem::path cacheDirectory =
+            boost::filesystem::temp_directory_path( ) / "tudatLocalInclinationCacheTest";
+    boost::filesystem::remove_all( cacheDirectory );
+    std::shared_ptr< HypersonicLocalInclinationAnalysis > firstCachedCoefficientInterface =
+            getApolloCoefficientInterface( 0, cacheDirectory.string( ) );
+    BOOST_CHECK_EQUAL( firstCachedCoefficientInterface->areCoefficientsLoadedFromCache( ), false );
+    BOOST_CHECK( boost::filesystem::exists( firstCachedCoefficientInterface->getCoefficientCacheFile( ) ) );
+    BOOST_CHECK_EQUAL( firstCachedCoefficientInterface->getAnalysisHash( ),
+                       serialCoefficientInterface->getAnalysisHash( ) );
+
+    // Check that coefficients are loaded from cache, and are identical to computed coefficients.
+    std::shared_ptr< HypersonicLocalInclinationAnalysis > secondCachedCoefficientInterface =
+            getApolloCoefficientInterface( 1, cacheDirectory.string( ) );
+    BOOST_CHECK_EQUAL( secondCachedCoefficientInterface->areCoefficientsLoadedFromCache( ), true );
+    BOOST_CHECK_EQUAL( secondCachedCoefficientInterface->getCoefficientCacheFile( ),
+                       firstCachedCoefficientInterface->getCoefficientCacheFile( ) );
+    boost::multi_array< Vector6d, 3 > cachedCoefficients =
+            secondCachedCoefficientInterface->getAerodynamicCoefficientsTables( );
+    for( unsigned int i = 0; i < serialCoefficients.num_elements( ); i++ )
+    {
+        for( unsigned int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_EQUAL( serialCoefficients.data( )[ i ]( j ), cachedCoefficients.data( )[ i ]( j ) );
+        }
+    }
+
+    std::vector< double > independentVariables = { 7.0, 0.1, 0.01 };
+    serialCoefficientInterface->updateCurrentCoefficients( independentVariables );
+    secondCachedCoefficientInterface->updateCurrentCoefficients( independentVariables );
+    for( unsigned int j = 0; j < 6; j++ )
+    {
+        BOOST_CHECK_EQUAL( serialCoefficientInterface->getCurrentAerodynamicCoefficients( )( j ),
+                           secondCachedCoefficientInterface->getCurrentAerodynamicCoefficients( )( j ) );
+    }
+
+    // Check that a different analysis (different local inclination methods) has a different hash.
+    std::shared_ptr< geometric_shapes::SphereSegment > sphere
+            = std::make_shared< geometric_shapes::SphereSegment >( 1.0 );
+    std::vector< std::vector< double > > independentVariableDataPoints( 3 );
+    independentVariableDataPoints[ 0 ] = getDefaultHypersonicLocalInclinationMachPoints( "Low" );
+    independentVariableDataPoints[ 1 ] = getDefaultHypersonicLocalInclinationAngleOfAttackPoints( );
+    independentVariableDataPoints[ 2 ] = getDefaultHypersonicLocalInclinationAngleOfSideslipPoints( );
+
+    std::vector< std::vector< int > > analysisMethod( 2, std::vector< int >( 1, 0 ) );
+    analysisMethod[ 1 ][ 0 ] = 1;
+    std::shared_ptr< HypersonicLocalInclinationAnalysis > sphereCoefficientInterface =
+            std::make_shared< HypersonicLocalInclinationAnalysis >(
+                independentVariableDataPoints, sphere, std::vector< int >( 1, 11 ), std::vector< int >( 1, 11 ),
+                std::vector< bool >( 1, false ), analysisMethod, PI, 1.0, Eigen::Vector3d::Zero( ),
+                false, 2, cacheDirectory.string( ) );
+
+    analysisMethod[ 0 ][ 0 ] = 1;
+    std::shared_ptr< HypersonicLocalInclinationAnalysis > modifiedSphereCoefficientInterface =
+            std::make_shared< HypersonicLocalInclinationAnalysis >(
+                independentVariableDataPoints, sphere, std::vector< int >( 1, 11 ), std::vector< int >( 1, 11 ),
+                std::vector< bool >( 1, false ), analysisMethod, PI, 1.0, Eigen::Vector3d::Zero( ),
+                false, 2, cacheDirectory.string( ) );
+    BOOST_CHECK( sphereCoefficientInterface->getAnalysisHash( ) !=
+                 modifiedSphereCoefficientInterface->getAnalysisHash( ) );
+    BOOST_CHECK( sphereCoefficientInterface->getCoefficientCacheFile( ) !=
+                 modifiedSphereCoefficientInterface->getCoefficientCacheFile( ) );
+    BOOST_CHECK_EQUAL( modifiedSphereCoefficientInterface->areCoefficientsLoadedFromCache( ), false );
+
+    boost::filesystem::remove_all( cacheDirectory );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -1138,6 +1138,86 @@ BOOST_AUTO_TEST_CASE( test_nrlmise_FullFileLoad )
 
 }
 
+//! Test whether tabulated solar activity input and batch density computation reproduce map-based computations.
+BOOST_AUTO_TEST_CASE( test_nrlmsise_SolarActivityTable )
+{
+    using namespace tudat::aerodynamics;
+    using namespace tudat::basic_astrodynamics;
+
+    // Load space weather file, and remove two days to check handling of missing data
+    std::string spaceWeatherFilePath = tudat::paths::getTudatTestDataPath( ) + "/sw19571001.txt";
+    tudat::input_output::solar_activity::SolarActivityDataMap solarActivityData =
+            tudat::input_output::solar_activity::readSolarActivityData( spaceWeatherFilePath );
+    double initialJulianDay = convertCalendarDateToJulianDay< double >( 2010, 12, 25, 0, 0, 0.0 );
+    solarActivityData.erase( initialJulianDay + 3.0 );
+    solarActivityData.erase( initialJulianDay + 4.0 );
+
+    NRLMSISE00SolarActivityTable solarActivityTable( solarActivityData );
+
+    // Create test points over 10 days, with multiple points at each time
+    std::vector< double > altitudes, longitudes, latitudes, times;
+    double initialTime = convertJulianDayToSecondsSinceEpoch( initialJulianDay, JULIAN_DAY_ON_J2000 );
+    for( unsigned int i = 0; i < 100; i++ )
+    {
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            times.push_back( initialTime + static_cast< double >( i ) * 8700.0 );
+            altitudes.push_back( 150.0E3 + 50.0E3 * static_cast< double >( ( i + j ) % 7 ) );
+            longitudes.push_back( -PI + 0.37 * static_cast< double >( ( 3 * i + j ) % 17 ) );
+            latitudes.push_back( -PI / 2.0 + 0.19 * static_cast< double >( ( i + 5 * j ) % 16 ) );
+        }
+    }
+
+    // Compare input computed from table and from map
+    for( unsigned int i = 0; i < times.size( ); i++ )
+    {
+        NRLMSISE00Input mapInput = nrlmsiseInputFunction(
+                    altitudes.at( i ), longitudes.at( i ), latitudes.at( i ), times.at( i ), solarActivityData );
+        NRLMSISE00Input tableInput = solarActivityTable.getNrlmsise00Input(
+                    altitudes.at( i ), longitudes.at( i ), latitudes.at( i ), times.at( i ) );
+
+        BOOST_CHECK_EQUAL( tableInput.year, mapInput.year );
+        BOOST_CHECK_EQUAL( tableInput.dayOfTheYear, mapInput.dayOfTheYear );
+        BOOST_CHECK_EQUAL( tableInput.secondOfTheDay, mapInput.secondOfTheDay );
+        BOOST_CHECK_EQUAL( tableInput.localSolarTime, mapInput.localSolarTime );
+        BOOST_CHECK_EQUAL( tableInput.f107, mapInput.f107 );
+        BOOST_CHECK_EQUAL( tableInput.f107a, mapInput.f107a );
+        BOOST_CHECK_EQUAL( tableInput.apDaily, mapInput.apDaily );
+        for( unsigned int j = 0; j < 7; j++ )
+        {
+            BOOST_CHECK_EQUAL( tableInput.apVector.at( j ), mapInput.apVector.at( j ) );
+        }
+    }
+
+    // Compare densities computed from table, from map, and from batch computation
+    NRLMSISE00Atmosphere tabulatedInputModel( solarActivityData );
+    NRLMSISE00Atmosphere mapInputModel(
+                std::bind( &nrlmsiseInputFunction, std::placeholders::_1, std::placeholders::_2,
+                           std::placeholders::_3, std::placeholders::_4, solarActivityData, false, 0.0 ) );
+    std::vector< double > batchDensities = tabulatedInputModel.getDensities( altitudes, longitudes, latitudes, times );
+    BOOST_CHECK_EQUAL( batchDensities.size( ), times.size( ) );
+    for( unsigned int i = 0; i < times.size( ); i++ )
+    {
+        double mapDensity = mapInputModel.getDensity( altitudes.at( i ), longitudes.at( i ), latitudes.at( i ), times.at( i ) );
+        double tableDensity = tabulatedInputModel.getDensity(
+                    altitudes.at( i ), longitudes.at( i ), latitudes.at( i ), times.at( i ) );
+        BOOST_CHECK_EQUAL( tableDensity, mapDensity );
+        BOOST_CHECK_EQUAL( batchDensities.at( i ), mapDensity );
+    }
+
+    // Check that data is not used more than 30 days after last entry
+    bool isExceptionCaught = false;
+    try
+    {
+        solarActivityTable.getDailySolarActivity( solarActivityData.rbegin( )->first + 31.0 );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
 BOOST_AUTO_TEST_CASE( testNRLMSISEInPropagation )
 //int main( )
 {
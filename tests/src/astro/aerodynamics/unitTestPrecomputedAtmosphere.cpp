@@ -0,0 +1,200 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <cstddef>
+#include <fstream>
+#include <limits>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/basics/testMacros.h"
+#include "tudat/astro/aerodynamics/customConstantTemperatureAtmosphere.h"
+#include "tudat/astro/aerodynamics/precomputedAtmosphere.h"
+#include "tudat/simulation/environment_setup/createAtmosphereModel.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace aerodynamics;
+using mathematical_constants::PI;
+
+BOOST_AUTO_TEST_SUITE( test_precomputed_atmosphere )
+
+//! Density function varying with altitude (with altitude-dependent scale height), latitude, local solar time and time
+double testDensityFunction( const double altitude, const double longitude, const double latitude, const double time )
+{
+    double localSolarTime = computeLocalSolarTime( longitude, time );
+    double scaleHeight = 50.0E3 * ( 1.0 + 0.1 * std::sin( latitude ) ) * ( 1.0 + 0.05 * std::sin( 2.0 * PI * time / 3.0E5 ) ) *
+            ( 1.0 + ( altitude - 200.0E3 ) / 400.0E3 );
+    return 1.0E-11 * std::exp( -( altitude - 400.0E3 ) / scaleHeight ) *
+            ( 1.0 + 0.3 * std::cos( ( localSolarTime - 14.0 ) * PI / 12.0 ) * std::cos( latitude ) );
+}
+
+//! Test generation, interpolation and caching of precomputed atmosphere
+BOOST_AUTO_TEST_CASE( testPrecomputedAtmosphere )
+{
+    std::shared_ptr< AtmosphereModel > baseAtmosphere = std::make_shared< CustomConstantTemperatureAtmosphere >(
+                &testDensityFunction, 1000.0, physical_constants::SPECIFIC_GAS_CONSTANT_AIR, 1.4 );
+
+    double startTime = 1.0E8;
+    PrecomputedAtmosphereGridSettings gridSettings(
+                200.0E3, 600.0E3, startTime, startTime + 86400.0, 21600.0, 100.0E3, 1.0E-3 );
+    std::shared_ptr< PrecomputedAtmosphere > precomputedAtmosphere =
+            computePrecomputedAtmosphere( baseAtmosphere, gridSettings );
+
+    // Check that altitude nodes are refined, and cover the requested range
+    std::vector< double > altitudes = precomputedAtmosphere->getAltitudes( );
+    BOOST_CHECK( altitudes.size( ) > 5 );
+    BOOST_CHECK_EQUAL( altitudes.front( ), 200.0E3 );
+    BOOST_CHECK_EQUAL( altitudes.back( ), 600.0E3 );
+    for( unsigned int i = 1; i < altitudes.size( ); i++ )
+    {
+        BOOST_CHECK( altitudes.at( i ) > altitudes.at( i - 1 ) );
+    }
+    BOOST_CHECK_EQUAL( precomputedAtmosphere->getTimes( ).size( ), 5 );
+
+    // Check that reported error is consistent with tolerance and grid resolution
+    double maximumSampledRelativeDensityError = precomputedAtmosphere->getMaximumSampledRelativeDensityError( );
+    BOOST_CHECK( maximumSampledRelativeDensityError > 0.0 );
+    BOOST_CHECK( maximumSampledRelativeDensityError < 0.05 );
+
+    // Check atmosphere at table nodes and in between
+    std::vector< double > latitudes = getPrecomputedAtmosphereLatitudes( gridSettings.numberOfLatitudes_ );
+    std::vector< double > localSolarTimes = getPrecomputedAtmosphereLocalSolarTimes( gridSettings.numberOfLocalSolarTimes_ );
+    for( unsigned int i = 0; i < altitudes.size( ) - 1; i += 3 )
+    {
+        for( unsigned int j = 0; j < latitudes.size( ); j += 4 )
+        {
+            for( unsigned int k = 0; k < localSolarTimes.size( ); k += 5 )
+            {
+                double currentTime = startTime + 21600.0;
+                double currentLongitude = computeLongitudeFromLocalSolarTime( localSolarTimes.at( k ), currentTime );
+                BOOST_CHECK_CLOSE_FRACTION(
+                            precomputedAtmosphere->getDensity( altitudes.at( i ), currentLongitude, latitudes.at( j ), currentTime ),
+                            baseAtmosphere->getDensity( altitudes.at( i ), currentLongitude, latitudes.at( j ), currentTime ),
+                            1.0E-12 );
+                BOOST_CHECK_CLOSE_FRACTION(
+                            precomputedAtmosphere->getPressure( altitudes.at( i ), currentLongitude, latitudes.at( j ), currentTime ),
+                            baseAtmosphere->getPressure( altitudes.at( i ), currentLongitude, latitudes.at( j ), currentTime ),
+                            1.0E-12 );
+                BOOST_CHECK_CLOSE_FRACTION(
+                            precomputedAtmosphere->getSpeedOfSound( altitudes.at( i ), currentLongitude, latitudes.at( j ), currentTime ),
+                            baseAtmosphere->getSpeedOfSound( altitudes.at( i ), currentLongitude, latitudes.at( j ), currentTime ),
+                            1.0E-12 );
+
+                double intermediateAltitude = altitudes.at( i ) + 0.37 * ( altitudes.at( i + 1 ) - altitudes.at( i ) );
+                double intermediateLatitude = latitudes.at( j ) + 0.02;
+                double intermediateLongitude = currentLongitude + 0.03;
+                double intermediateTime = currentTime + 1234.0;
+                BOOST_CHECK_CLOSE_FRACTION(
+                            precomputedAtmosphere->getDensity(
+                                intermediateAltitude, intermediateLongitude, intermediateLatitude, intermediateTime ),
+                            baseAtmosphere->getDensity(
+                                intermediateAltitude, intermediateLongitude, intermediateLatitude, intermediateTime ),
+                            maximumSampledRelativeDensityError );
+            }
+        }
+    }
+
+    // Check that table is not evaluated outside of its range
+    bool isExceptionCaught = false;
+    try
+    {
+        precomputedAtmosphere->getDensity( 400.0E3, 0.0, 0.0, startTime + 2.0 * 86400.0 );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+
+    // Check caching of table to file
+    std::string tableFile = ( boost::filesystem::temp_directory_path( ) / "tudatPrecomputedAtmosphereTest.bin" ).string( );
+    boost::filesystem::remove( tableFile );
+    std::shared_ptr< PrecomputedAtmosphere > cachedAtmosphere =
+            createPrecomputedAtmosphere( baseAtmosphere, gridSettings, tableFile );
+    BOOST_CHECK( boost::filesystem::exists( tableFile ) );
+
+    uint64_t baseModelFingerprint = computeAtmosphereModelFingerprint( baseAtmosphere, gridSettings );
+    std::shared_ptr< PrecomputedAtmosphere > loadedAtmosphere =
+            readPrecomputedAtmosphereFromFile( tableFile, gridSettings, baseModelFingerprint );
+    BOOST_CHECK( loadedAtmosphere != nullptr );
+    BOOST_CHECK_EQUAL( loadedAtmosphere->getMaximumSampledRelativeDensityError( ), maximumSampledRelativeDensityError );
+    BOOST_CHECK_EQUAL( loadedAtmosphere->getAltitudes( ).size( ), altitudes.size( ) );
+    for( unsigned int i = 0; i < 100; i++ )
+    {
+        double currentAltitude = 200.0E3 + 3.99E3 * static_cast< double >( i );
+        double currentLongitude = -PI + 0.0628 * static_cast< double >( i );
+        double currentLatitude = -1.5 + 0.03 * static_cast< double >( i );
+        double currentTime = startTime + 864.0 * static_cast< double >( i );
+        BOOST_CHECK_EQUAL(
+                    loadedAtmosphere->getDensity( currentAltitude, currentLongitude, currentLatitude, currentTime ),
+                    precomputedAtmosphere->getDensity( currentAltitude, currentLongitude, currentLatitude, currentTime ) );
+        BOOST_CHECK_EQUAL(
+                    loadedAtmosphere->getTemperature( currentAltitude, currentLongitude, currentLatitude, currentTime ),
+                    precomputedAtmosphere->getTemperature( currentAltitude, currentLongitude, currentLatitude, currentTime ) );
+    }
+
+    // Check that file generated with different settings is not used
+    PrecomputedAtmosphereGridSettings otherGridSettings(
+                200.0E3, 600.0E3, startTime, startTime + 86400.0, 21600.0, 100.0E3, 1.0E-2 );
+    BOOST_CHECK( readPrecomputedAtmosphereFromFile( tableFile, otherGridSettings, baseModelFingerprint ) == nullptr );
+
+    // Check that file generated from different atmosphere model is not used, and is regenerated
+    std::shared_ptr< AtmosphereModel > otherBaseAtmosphere = std::make_shared< CustomConstantTemperatureAtmosphere >(
+                [ ]( const double altitude, const double longitude, const double latitude, const double time )
+    {
+        return 2.0 * testDensityFunction( altitude, longitude, latitude, time );
+    }, 1000.0, physical_constants::SPECIFIC_GAS_CONSTANT_AIR, 1.4 );
+    uint64_t otherBaseModelFingerprint = computeAtmosphereModelFingerprint( otherBaseAtmosphere, gridSettings );
+    BOOST_CHECK( otherBaseModelFingerprint != baseModelFingerprint );
+    BOOST_CHECK( readPrecomputedAtmosphereFromFile( tableFile, gridSettings, otherBaseModelFingerprint ) == nullptr );
+    std::shared_ptr< PrecomputedAtmosphere > otherCachedAtmosphere =
+            createPrecomputedAtmosphere( otherBaseAtmosphere, gridSettings, tableFile );
+    BOOST_CHECK_CLOSE_FRACTION( otherCachedAtmosphere->getDensity( 432.1E3, 0.1, 0.2, startTime + 1.0E4 ),
+                                2.0 * precomputedAtmosphere->getDensity( 432.1E3, 0.1, 0.2, startTime + 1.0E4 ), 1.0E-12 );
+    BOOST_CHECK( readPrecomputedAtmosphereFromFile( tableFile, gridSettings, otherBaseModelFingerprint ) != nullptr );
+    BOOST_CHECK( readPrecomputedAtmosphereFromFile( tableFile, gridSettings, baseModelFingerprint ) == nullptr );
+
+    // Check creation from environment settings (regenerating table, since file was last written from other model)
+    std::shared_ptr< AtmosphereModel > createdAtmosphere = simulation_setup::createAtmosphereModel(
+                simulation_setup::precomputedAtmosphereSettings(
+                    simulation_setup::customConstantTemperatureAtmosphereSettings(
+                        &testDensityFunction, 1000.0, physical_constants::SPECIFIC_GAS_CONSTANT_AIR, 1.4 ),
+                    gridSettings, tableFile ), "Earth" );
+    BOOST_CHECK( std::dynamic_pointer_cast< PrecomputedAtmosphere >( createdAtmosphere ) != nullptr );
+    BOOST_CHECK_EQUAL( createdAtmosphere->getDensity( 432.1E3, 0.1, 0.2, startTime + 1.0E4 ),
+                       precomputedAtmosphere->getDensity( 432.1E3, 0.1, 0.2, startTime + 1.0E4 ) );
+
+    // Check that file written with different version of file format is not used, and is regenerated
+    {
+        std::fstream tableFileStream( tableFile, std::ios::binary | std::ios::in | std::ios::out );
+        uint32_t otherFileVersion = PRECOMPUTED_ATMOSPHERE_FILE_VERSION - 1;
+        tableFileStream.seekp( offsetof( PrecomputedAtmosphereFileHeader, fileVersion_ ) );
+        tableFileStream.write( reinterpret_cast< const char* >( &otherFileVersion ), sizeof( uint32_t ) );
+    }
+    BOOST_CHECK( readPrecomputedAtmosphereFromFile( tableFile, gridSettings, baseModelFingerprint ) == nullptr );
+    createPrecomputedAtmosphere( baseAtmosphere, gridSettings, tableFile );
+    BOOST_CHECK( readPrecomputedAtmosphereFromFile( tableFile, gridSettings, baseModelFingerprint ) != nullptr );
+
+    boost::filesystem::remove( tableFile );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
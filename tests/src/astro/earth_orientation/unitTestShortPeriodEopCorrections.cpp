@@ -235,6 +235,80 @@ BOOST_AUTO_TEST_CASE( testShortPeriodUt1CombinedCorrections )
     BOOST_CHECK_SMALL( std::fabs( ut1CorrectionTotal - ( ut1CorrectionLibration + ut1CorrectionOceanTides ) ), 1.0E-20 );
 }
 
+//! Test evaluation of short-period corrections at multiple epochs, and recurrence-based series evaluation
+BOOST_AUTO_TEST_CASE( testShortPeriodCorrectionsAtMultipleEpochs )
+{
+    // Create polar motion corrections
+    ShortPeriodEarthOrientationCorrectionCalculator < Eigen::Vector2d > polarMotionCorrectionCalculator(
+                convertArcSecondsToRadians< double >( 1.0E-6 ), 0.0,
+    { getEarthOrientationDataFilesPath(  ) + "/polarMotionLibrationAmplitudesQuasiDiurnalOnly.txt",
+      getEarthOrientationDataFilesPath(  ) + "/polarMotionOceanTidesAmplitudes.txt" },
+    { getEarthOrientationDataFilesPath(  ) + "/polarMotionLibrationFundamentalArgumentMultipliersQuasiDiurnalOnly.txt",
+      getEarthOrientationDataFilesPath(  ) + "/polarMotionOceanTidesFundamentalArgumentMultipliers.txt" } );
+
+    // Compare corrections computed for single and multiple epochs
+    std::vector< double > testTimes;
+    for( unsigned int i = 0; i < 100; i++ )
+    {
+        testTimes.push_back( 1.0E8 + static_cast< double >( i ) * 1234.5 );
+    }
+    std::vector< Eigen::Vector2d > polarMotionCorrections =
+            polarMotionCorrectionCalculator.getCorrectionsAtEpochs( testTimes );
+    BOOST_CHECK_EQUAL( polarMotionCorrections.size( ), testTimes.size( ) );
+    for( unsigned int i = 0; i < testTimes.size( ); i++ )
+    {
+        Eigen::Vector2d singleEpochCorrection = polarMotionCorrectionCalculator.getCorrections( testTimes.at( i ) );
+        BOOST_CHECK_SMALL( std::fabs( singleEpochCorrection( 0 ) - polarMotionCorrections.at( i )( 0 ) ), 1.0E-24 );
+        BOOST_CHECK_SMALL( std::fabs( singleEpochCorrection( 1 ) - polarMotionCorrections.at( i )( 1 ) ), 1.0E-24 );
+    }
+
+    // Compare recurrence-based series evaluation against direct evaluation of each term
+    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > seriesData = readAmplitudesAndFundamentalArgumentMultipliers(
+                getEarthOrientationDataFilesPath(  ) + "/polarMotionOceanTidesAmplitudes.txt",
+                getEarthOrientationDataFilesPath(  ) + "/polarMotionOceanTidesFundamentalArgumentMultipliers.txt" );
+    const FundamentalArgumentSeries< 2 > series( { seriesData.first }, { seriesData.second } );
+    BOOST_CHECK_EQUAL( series.getUseRecurrences( ), true );
+
+    for( unsigned int i = 0; i < testTimes.size( ); i++ )
+    {
+        Eigen::Vector6d fundamentalArguments =
+                sofa_interface::calculateApproximateDelaunayFundamentalArgumentsWithGmst( testTimes.at( i ) );
+        Eigen::Vector2d directCorrection = Eigen::Vector2d::Zero( );
+        for( int j = 0; j < seriesData.first.rows( ); j++ )
+        {
+            double phase = seriesData.second.row( j ).dot( fundamentalArguments.transpose( ) );
+            directCorrection.x( ) += seriesData.first( j, 0 ) * std::sin( phase ) + seriesData.first( j, 1 ) * std::cos( phase );
+            directCorrection.y( ) += seriesData.first( j, 2 ) * std::sin( phase ) + seriesData.first( j, 3 ) * std::cos( phase );
+        }
+
+        Eigen::Vector2d seriesCorrection = series.evaluate( fundamentalArguments );
+        BOOST_CHECK_SMALL( std::fabs( seriesCorrection( 0 ) - directCorrection( 0 ) ), 1.0E-10 );
+        BOOST_CHECK_SMALL( std::fabs( seriesCorrection( 1 ) - directCorrection( 1 ) ), 1.0E-10 );
+    }
+
+    // Check that only first columns of amplitude matrix are used for series with fewer components
+    const FundamentalArgumentSeries< 1 > singleComponentSeries( { seriesData.first }, { seriesData.second } );
+    for( unsigned int i = 0; i < testTimes.size( ); i++ )
+    {
+        Eigen::Vector6d fundamentalArguments =
+                sofa_interface::calculateApproximateDelaunayFundamentalArgumentsWithGmst( testTimes.at( i ) );
+        BOOST_CHECK_EQUAL( singleComponentSeries.evaluate( fundamentalArguments )( 0 ),
+                           series.evaluate( fundamentalArguments )( 0 ) );
+    }
+
+    // Check that amplitude matrix with too few columns is rejected
+    bool isExceptionCaught = false;
+    try
+    {
+        FundamentalArgumentSeries< 2 > invalidSeries( { seriesData.first.leftCols( 3 ) }, { seriesData.second } );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
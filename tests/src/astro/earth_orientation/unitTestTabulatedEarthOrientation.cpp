@@ -0,0 +1,158 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <limits>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/basics/testMacros.h"
+#include "tudat/astro/earth_orientation/tabulatedEarthOrientation.h"
+#include "tudat/astro/ephemerides/itrsToGcrsRotationModel.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace earth_orientation;
+
+BOOST_AUTO_TEST_SUITE( test_tabulated_earth_orientation )
+
+//! Test whether Earth orientation table reproduces directly computed Earth orientation
+BOOST_AUTO_TEST_CASE( testTabulatedEarthOrientation )
+{
+    std::string tableFile = ( boost::filesystem::temp_directory_path( ) / "tudatEarthOrientationTableTest.bin" ).string( );
+
+    // Create table over 10 days, with 1 hour resolution
+    std::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator =
+            createStandardEarthOrientationCalculator( );
+    double startTime = 1.0E8;
+    double endTime = startTime + 10.0 * physical_constants::JULIAN_DAY;
+    double timeStep = 3600.0;
+    writeEarthOrientationTableToFile(
+                tableFile, earthOrientationCalculator, startTime, endTime, timeStep, basic_astrodynamics::tdb_scale );
+
+    std::shared_ptr< TabulatedEarthOrientationAngles > tabulatedEarthOrientation =
+            getTabulatedEarthOrientationAngles( tableFile );
+
+    // Check table settings
+    BOOST_CHECK_EQUAL( tabulatedEarthOrientation->getTimeScale( ), basic_astrodynamics::tdb_scale );
+    BOOST_CHECK_EQUAL( tabulatedEarthOrientation->getNumberOfEpochs( ), 241 );
+    BOOST_CHECK_CLOSE_FRACTION( tabulatedEarthOrientation->getStartTime( ), startTime,
+                                std::numeric_limits< double >::epsilon( ) );
+    BOOST_CHECK_CLOSE_FRACTION( tabulatedEarthOrientation->getEndTime( ), endTime,
+                                std::numeric_limits< double >::epsilon( ) );
+
+    // Check that EOP data and short-period correction fingerprints are stored in table
+    std::pair< uint64_t, uint64_t > tableFingerprints = computeEarthOrientationTableFingerprints(
+                earthOrientationCalculator, tabulatedEarthOrientation->getStartTime( ), tabulatedEarthOrientation->getEndTime( ) );
+    BOOST_CHECK_EQUAL( tabulatedEarthOrientation->getEopDataFingerprint( ), tableFingerprints.first );
+    BOOST_CHECK_EQUAL( tabulatedEarthOrientation->getShortPeriodCorrectionsFingerprint( ), tableFingerprints.second );
+
+    // Check that fingerprints detect calculator with different EOP data and short-period corrections
+    std::shared_ptr< EarthOrientationAnglesCalculator > modifiedEarthOrientationCalculator =
+            std::make_shared< EarthOrientationAnglesCalculator >(
+                earthOrientationCalculator->getPolarMotionCalculator( ),
+                earthOrientationCalculator->getPrecessionNutationCalculator( ),
+                std::make_shared< TerrestrialTimeScaleConverter >( nullptr, nullptr ) );
+    std::pair< uint64_t, uint64_t > modifiedFingerprints = computeEarthOrientationTableFingerprints(
+                modifiedEarthOrientationCalculator, tabulatedEarthOrientation->getStartTime( ),
+                tabulatedEarthOrientation->getEndTime( ) );
+    BOOST_CHECK( tabulatedEarthOrientation->getEopDataFingerprint( ) != modifiedFingerprints.first );
+    BOOST_CHECK( tabulatedEarthOrientation->getShortPeriodCorrectionsFingerprint( ) != modifiedFingerprints.second );
+
+    // Check that same file is mapped only once
+    BOOST_CHECK_EQUAL( tabulatedEarthOrientation, getTabulatedEarthOrientationAngles( tableFile ) );
+
+    // Check that table values are reproduced at nodes
+    std::vector< double > nodeTimes;
+    for( unsigned int i = 0; i < 241; i += 10 )
+    {
+        nodeTimes.push_back( startTime + static_cast< double >( i ) * timeStep );
+    }
+    Eigen::Vector6d nodeErrors = computeMaximumEarthOrientationTableErrors(
+                tabulatedEarthOrientation, earthOrientationCalculator, nodeTimes );
+    for( unsigned int i = 0; i < 5; i++ )
+    {
+        BOOST_CHECK_SMALL( nodeErrors( i ), 1.0E-15 );
+    }
+    BOOST_CHECK_SMALL( nodeErrors( 5 ), 1.0E-12 );
+
+    // Check interpolation error in between nodes (including near table boundaries)
+    std::vector< double > testTimes;
+    for( unsigned int i = 0; i < 240; i++ )
+    {
+        testTimes.push_back( startTime + ( static_cast< double >( i ) + 0.37 ) * timeStep );
+    }
+    Eigen::Vector6d interpolationErrors = computeMaximumEarthOrientationTableErrors(
+                tabulatedEarthOrientation, earthOrientationCalculator, testTimes );
+    for( unsigned int i = 0; i < 5; i++ )
+    {
+        BOOST_CHECK_SMALL( interpolationErrors( i ), 1.0E-10 );
+    }
+    BOOST_CHECK_SMALL( interpolationErrors( 5 ), 1.0E-6 );
+
+    // Check rotation model using table against rotation model computing orientation directly
+    ephemerides::GcrsToItrsRotationModel directRotationModel(
+                earthOrientationCalculator, basic_astrodynamics::tdb_scale );
+    ephemerides::GcrsToItrsRotationModel tabulatedRotationModel(
+                earthOrientationCalculator, basic_astrodynamics::tdb_scale, "GCRS", tabulatedEarthOrientation );
+    for( unsigned int i = 0; i < testTimes.size( ); i += 20 )
+    {
+        Eigen::Matrix3d rotationDifference =
+                directRotationModel.getRotationMatrixToBaseFrame( testTimes.at( i ) ) -
+                tabulatedRotationModel.getRotationMatrixToBaseFrame( testTimes.at( i ) );
+        BOOST_CHECK_SMALL( rotationDifference.cwiseAbs( ).maxCoeff( ), 1.0E-10 );
+
+        Eigen::Matrix3d rotationDerivativeDifference =
+                directRotationModel.getDerivativeOfRotationToBaseFrame( testTimes.at( i ) ) -
+                tabulatedRotationModel.getDerivativeOfRotationToBaseFrame( testTimes.at( i ) );
+        BOOST_CHECK_SMALL( rotationDerivativeDifference.cwiseAbs( ).maxCoeff( ), 1.0E-14 );
+    }
+
+    // Check that table is not evaluated outside of its range
+    bool isExceptionCaught = false;
+    try
+    {
+        tabulatedEarthOrientation->getRotationAnglesFromItrsToGcrs< double >( endTime + timeStep );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+
+    // Check that table with inconsistent time scale is rejected by rotation model
+    isExceptionCaught = false;
+    try
+    {
+        ephemerides::GcrsToItrsRotationModel inconsistentRotationModel(
+                    earthOrientationCalculator, basic_astrodynamics::utc_scale, "GCRS", tabulatedEarthOrientation );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+
+    tabulatedEarthOrientation.reset( );
+    boost::filesystem::remove( tableFile );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
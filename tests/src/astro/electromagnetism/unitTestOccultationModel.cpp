@@ -15,6 +15,7 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include "tudat/astro/basic_astro/missionGeometry.h"
 #include "tudat/astro/electromagnetism/occultationModel.h"
 #include "tudat/astro/basic_astro/sphericalBodyShapeModel.h"
 
@@ -279,6 +280,62 @@ BOOST_AUTO_TEST_CASE( testEvaluateVisibilityWithOccultation_Commutativity )
     ));
 }
 
+// Test that targets outside the penumbra cone are fully illuminated, and that the cone contains the penumbra
+BOOST_AUTO_TEST_CASE( testIsPointOutsidePenumbraCone )
+{
+    const Eigen::Vector3d sourcePosition(1.5e11, 0, 0);
+    const double sourceRadius = 6.96e8;
+    const Eigen::Vector3d occultingBodyPosition(0, 0, 0);
+    const double occultingBodyRadius = 6.371e6;
+
+    unsigned int numberOfPointsInCone = 0;
+    unsigned int numberOfPointsInPenumbra = 0;
+    for (int i = -20; i <= 20; i++)
+    {
+        for (int j = 0; j <= 40; j++)
+        {
+            // Points from in front of to far behind the occulting body, up to twice its radius from the axis
+            const Eigen::Vector3d targetPosition(
+                    -1.0e6 * i * i * i / 20.0, 0.05 * j * occultingBodyRadius, 0.01 * j * occultingBodyRadius);
+            const double shadowFunction = mission_geometry::computeShadowFunction(
+                    sourcePosition, sourceRadius, occultingBodyPosition, occultingBodyRadius, targetPosition);
+
+            if (isPointOutsidePenumbraCone(
+                    sourcePosition, sourceRadius, occultingBodyPosition, occultingBodyRadius, targetPosition))
+            {
+                BOOST_CHECK_CLOSE_FRACTION(shadowFunction, 1.0, 1e-12);
+            }
+            else
+            {
+                numberOfPointsInCone++;
+            }
+
+            if (shadowFunction > 0.0 && shadowFunction < 1.0)
+            {
+                numberOfPointsInPenumbra++;
+            }
+        }
+    }
+    BOOST_CHECK(numberOfPointsInPenumbra > 0);
+    BOOST_CHECK(numberOfPointsInCone >= numberOfPointsInPenumbra);
+
+    // Check occultation model gives same result as shadow function inside and outside cone
+    auto occultationModel = SingleOccultingBodyOccultationModel(
+            "Earth",
+            [=] () { return occultingBodyPosition; },
+            std::make_shared<tudat::basic_astrodynamics::SphericalBodyShapeModel>(occultingBodyRadius));
+    occultationModel.updateMembers(TUDAT_NAN);
+    const auto sourceShapeModel = std::make_shared<tudat::basic_astrodynamics::SphericalBodyShapeModel>(sourceRadius);
+    for (const Eigen::Vector3d& targetPosition : {
+            Eigen::Vector3d(-7.0e6, 6.3e6, 0), Eigen::Vector3d(-7.0e6, 0, 0), Eigen::Vector3d(7.0e6, 0, 0) })
+    {
+        BOOST_CHECK_EQUAL(
+                occultationModel.evaluateReceivedFractionFromExtendedSource(sourcePosition, sourceShapeModel, targetPosition),
+                mission_geometry::computeShadowFunction(
+                        sourcePosition, sourceRadius, occultingBodyPosition, occultingBodyRadius, targetPosition));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace unit_tests
@@ -237,6 +237,161 @@ BOOST_AUTO_TEST_CASE( testRadiationPressureTargetModel_EquivalentSphere )
     }
 }
 
+//! Check bounding volume hierarchy of panels against brute-force intersection tests
+BOOST_AUTO_TEST_CASE( testPanelBoundingVolumeHierarchy )
+{
+    std::vector< Eigen::Vector3d > panelCentroids, panelNormals;
+    std::vector< double > panelRadii;
+    for( unsigned int i = 0; i < 50; i++ )
+    {
+        panelCentroids.push_back( Eigen::Vector3d( std::sin( 1.3 * i ), std::cos( 2.1 * i ), std::sin( 0.7 * i + 0.3 ) ) );
+        panelNormals.push_back( Eigen::Vector3d( std::cos( 0.9 * i ), std::sin( 1.7 * i ), 0.5 ).normalized( ) );
+        panelRadii.push_back( 0.05 + 0.1 * std::fabs( std::sin( 3.1 * i ) ) );
+    }
+
+    // Hierarchy with single leaf, containing all panels, is equivalent to a brute-force test
+    PanelBoundingVolumeHierarchy boundingVolumeHierarchy( panelCentroids, panelNormals, panelRadii );
+    PanelBoundingVolumeHierarchy singleLeafHierarchy( panelCentroids, panelNormals, panelRadii, 50 );
+    BOOST_CHECK( boundingVolumeHierarchy.getNumberOfNodes( ) > 1 );
+    BOOST_CHECK_EQUAL( singleLeafHierarchy.getNumberOfNodes( ), 1 );
+
+    int numberOfBlockedRays = 0;
+    for( unsigned int i = 0; i < 1000; i++ )
+    {
+        Eigen::Vector3d rayOrigin = 1.5 * Eigen::Vector3d( std::sin( 0.37 * i ), std::cos( 0.51 * i ), std::sin( 0.23 * i ) );
+        Eigen::Vector3d rayDirection = Eigen::Vector3d(
+                    std::cos( 0.77 * i ), std::sin( 0.19 * i ), std::cos( 0.43 * i + 1.0 ) ).normalized( );
+        bool isRayBlocked = boundingVolumeHierarchy.isRayBlocked( rayOrigin, rayDirection );
+        BOOST_CHECK_EQUAL( isRayBlocked, singleLeafHierarchy.isRayBlocked( rayOrigin, rayDirection ) );
+        numberOfBlockedRays += isRayBlocked;
+    }
+    BOOST_CHECK( numberOfBlockedRays > 50 );
+    BOOST_CHECK( numberOfBlockedRays < 950 );
+}
+
+//! Check self-shadowing of a panel by a larger panel (e.g. an antenna dish) above it
+BOOST_AUTO_TEST_CASE( testPaneledRadiationPressureTargetModel_SelfShadowing )
+{
+    const double busPanelArea = 1.0;
+    const double antennaArea = 4.0;
+    const double antennaHeight = 1.0;
+
+    const auto reflectionLaw = std::make_shared<SpecularDiffuseMixReflectionLaw>(0.2, 0.4, 0.4);
+    std::vector< std::shared_ptr< system_models::VehicleExteriorPanel > > panels {
+            std::make_shared< system_models::VehicleExteriorPanel >(
+                Eigen::Vector3d::UnitZ( ), busPanelArea, "", reflectionLaw, Eigen::Vector3d::Zero( ) ),
+            std::make_shared< system_models::VehicleExteriorPanel >(
+                Eigen::Vector3d::UnitZ( ), antennaArea, "", reflectionLaw, antennaHeight * Eigen::Vector3d::UnitZ( ) ) };
+
+    std::shared_ptr< PanelSelfShadowingModel > selfShadowingModel =
+            std::make_shared< PanelSelfShadowingModel >( panels, 72, 37, 30 );
+
+    // Source along panel normal: bus panel fully shadowed, antenna fully illuminated
+    BOOST_CHECK_EQUAL( selfShadowingModel->computeIlluminationFraction( 0, Eigen::Vector3d::UnitZ( ) ), 0.0 );
+    BOOST_CHECK_EQUAL( selfShadowingModel->computeIlluminationFraction( 1, Eigen::Vector3d::UnitZ( ) ), 1.0 );
+
+    // Source in plane of panels: no shadowing
+    BOOST_CHECK_EQUAL( selfShadowingModel->computeIlluminationFraction( 0, Eigen::Vector3d::UnitX( ) ), 1.0 );
+
+    // Source at 45 degrees elevation: compare with analytical overlap of bus panel and antenna shadow
+    const double elevation = mathematical_constants::PI / 4.0;
+    const Eigen::Vector3d directionToSource( std::cos( elevation ), 0.0, std::sin( elevation ) );
+    const double busRadius = 0.5 * std::sqrt( busPanelArea );
+    const double antennaRadius = 0.5 * std::sqrt( antennaArea );
+    const double shadowOffset = antennaHeight / std::tan( elevation );
+    const double overlapArea =
+            busRadius * busRadius * std::acos( ( shadowOffset * shadowOffset + busRadius * busRadius - antennaRadius * antennaRadius ) /
+                                               ( 2.0 * shadowOffset * busRadius ) ) +
+            antennaRadius * antennaRadius * std::acos( ( shadowOffset * shadowOffset + antennaRadius * antennaRadius - busRadius * busRadius ) /
+                                                       ( 2.0 * shadowOffset * antennaRadius ) ) -
+            0.5 * std::sqrt( ( -shadowOffset + busRadius + antennaRadius ) * ( shadowOffset + busRadius - antennaRadius ) *
+                             ( shadowOffset - busRadius + antennaRadius ) * ( shadowOffset + busRadius + antennaRadius ) );
+    const double expectedIlluminationFraction = 1.0 - overlapArea / ( mathematical_constants::PI * busRadius * busRadius );
+    const double computedIlluminationFraction = selfShadowingModel->computeIlluminationFraction( 0, directionToSource );
+    BOOST_CHECK( expectedIlluminationFraction > 0.1 && expectedIlluminationFraction < 0.9 );
+    BOOST_CHECK_SMALL( std::fabs( computedIlluminationFraction - expectedIlluminationFraction ), 0.02 );
+
+    // Check table lookup at table node, and in between nodes
+    selfShadowingModel->updateIlluminationFractions( directionToSource );
+    BOOST_CHECK_SMALL( std::fabs( selfShadowingModel->getCurrentIlluminationFraction( 0 ) - computedIlluminationFraction ), 1.0E-10 );
+    const Eigen::Vector3d intermediateDirectionToSource = Eigen::Vector3d( 0.7, 0.02, 0.71 ).normalized( );
+    selfShadowingModel->updateIlluminationFractions( intermediateDirectionToSource );
+    BOOST_CHECK_SMALL( std::fabs( selfShadowingModel->getCurrentIlluminationFraction( 0 ) -
+                                  selfShadowingModel->computeIlluminationFraction( 0, intermediateDirectionToSource ) ), 0.02 );
+
+    // Check that fully shadowed panel exerts no force
+    PaneledRadiationPressureTargetModel targetModel( panels );
+    targetModel.setSelfShadowingModel( selfShadowingModel );
+    PaneledRadiationPressureTargetModel antennaTargetModel( { panels.at( 1 ) } );
+    const auto sourceIrradiance = 1000;
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                targetModel.updateAndGetRadiationPressureForce( sourceIrradiance, -Eigen::Vector3d::UnitZ( ), true ),
+                antennaTargetModel.updateAndGetRadiationPressureForce( sourceIrradiance, -Eigen::Vector3d::UnitZ( ), true ),
+                1.0E-15 );
+
+    // Check that partially shadowed panel force is scaled by illumination fraction
+    PaneledRadiationPressureTargetModel busTargetModel( { panels.at( 0 ) } );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                targetModel.updateAndGetRadiationPressureForce( sourceIrradiance, -directionToSource, true ),
+                ( antennaTargetModel.updateAndGetRadiationPressureForce( sourceIrradiance, -directionToSource, true ) +
+                  computedIlluminationFraction *
+                  busTargetModel.updateAndGetRadiationPressureForce( sourceIrradiance, -directionToSource, true ) ).eval( ),
+                1.0E-10 );
+
+    // Check consistency of panel numbers
+    bool isExceptionCaught = false;
+    try
+    {
+        busTargetModel.setSelfShadowingModel( selfShadowingModel );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
+//! Check that the faces of a convex box do not shadow each other
+BOOST_AUTO_TEST_CASE( testPaneledRadiationPressureTargetModel_SelfShadowingConvexBox )
+{
+    const double boxSide = 2.0;
+
+    const auto reflectionLaw = std::make_shared<SpecularDiffuseMixReflectionLaw>(0.2, 0.4, 0.4);
+    std::vector< std::shared_ptr< system_models::VehicleExteriorPanel > > panels;
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        for( double sign : { -1.0, 1.0 } )
+        {
+            const Eigen::Vector3d panelNormal = sign * Eigen::Vector3d::Unit( i );
+            panels.push_back( std::make_shared< system_models::VehicleExteriorPanel >(
+                                  panelNormal, boxSide * boxSide, "", reflectionLaw, 0.5 * boxSide * panelNormal ) );
+        }
+    }
+    PanelSelfShadowingModel selfShadowingModel( panels, 72, 37, 30 );
+
+    // Sample source directions over the sphere (Fibonacci lattice), and check that each face that is facing the source
+    // is fully illuminated
+    const unsigned int numberOfDirections = 1000;
+    const double goldenAngle = mathematical_constants::PI * ( 3.0 - std::sqrt( 5.0 ) );
+    unsigned int numberOfCheckedFaces = 0;
+    for( unsigned int i = 0; i < numberOfDirections; i++ )
+    {
+        const double zComponent = 1.0 - ( 2.0 * static_cast< double >( i ) + 1.0 ) / static_cast< double >( numberOfDirections );
+        const double radialComponent = std::sqrt( 1.0 - zComponent * zComponent );
+        const Eigen::Vector3d directionToSource(
+                    radialComponent * std::cos( goldenAngle * i ), radialComponent * std::sin( goldenAngle * i ), zComponent );
+        for( unsigned int j = 0; j < panels.size( ); j++ )
+        {
+            if( panels.at( j )->getFrameFixedSurfaceNormal( )( ).dot( directionToSource ) > 0.0 )
+            {
+                BOOST_CHECK_EQUAL( selfShadowingModel.computeIlluminationFraction( j, directionToSource ), 1.0 );
+                numberOfCheckedFaces++;
+            }
+        }
+    }
+    BOOST_CHECK( numberOfCheckedFaces > numberOfDirections );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace unit_tests
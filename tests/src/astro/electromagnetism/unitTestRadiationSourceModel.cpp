@@ -436,6 +436,85 @@ BOOST_AUTO_TEST_CASE( testDynamicallyPaneledRadiationSourceModel_PanelMoving )
     }
 }
 
+//! Test vectorized irradiance evaluation and panel reuse of dynamically paneled source against
+//! panel-by-panel evaluation of radiosity models
+BOOST_AUTO_TEST_CASE( testDynamicallyPaneledRadiationSourceModel_PanelArrays )
+{
+    const auto radius = 6371e3;
+
+    std::vector<std::unique_ptr<SourcePanelRadiosityModel>> baseRadiosityModels;
+    baseRadiosityModels.push_back(std::make_unique<AlbedoSourcePanelRadiosityModel>(
+            "Sun", std::make_shared<ConstantSurfacePropertyDistribution>(0.3)));
+    baseRadiosityModels.push_back(std::make_unique<DelayedThermalSourcePanelRadiosityModel>(
+            "Sun", std::make_shared<ConstantSurfacePropertyDistribution>(0.95)));
+
+    std::vector<std::unique_ptr<DynamicallyPaneledRadiationSourceModel>> radiationSourceModels;
+    for (unsigned int i = 0; i < 2; ++i)
+    {
+        const std::map<std::string, std::shared_ptr<IsotropicPointRadiationSourceModel>>& originalSourceModels {
+            {"Sun", std::make_shared<IsotropicPointRadiationSourceModel>(
+                std::make_shared<ConstantLuminosityModel>(computeLuminosityFromIrradiance( 1360.0, 1.5e11 )))}};
+        const std::map<std::string, std::shared_ptr<basic_astrodynamics::BodyShapeModel>>& originalSourceBodyShapeModels {
+            {"Sun", nullptr}};
+        const std::map<std::string, std::function<Eigen::Vector3d()>>& originalSourcePositionFunctions {
+            {"Sun", [] { return Eigen::Vector3d(1.5e11, 0, 0); }}};
+        const std::map<std::string, std::shared_ptr<OccultationModel>>& originalSourceToSourceOccultationModels {
+            {"Sun", std::make_shared<NoOccultingBodyOccultationModel>()}};
+        auto sourcePanelRadiosityModelUpdater = std::make_unique<SourcePanelRadiosityModelUpdater>(
+                [] { return Eigen::Vector3d::Zero(); },
+                [] { return Eigen::Quaterniond::Identity(); },
+                originalSourceModels, originalSourceBodyShapeModels, originalSourcePositionFunctions, originalSourceToSourceOccultationModels);
+        originalSourceModels.at("Sun")->updateMembers(0);
+
+        // Second model reuses panels for small target displacements
+        radiationSourceModels.push_back(std::make_unique<DynamicallyPaneledRadiationSourceModel>(
+                std::make_shared<basic_astrodynamics::SphericalBodyShapeModel>(radius),
+                std::move(sourcePanelRadiosityModelUpdater),
+                baseRadiosityModels,
+                std::vector<int>{6, 12, 18, 24},
+                "Earth",
+                i == 1 ? 1e-3 : 0.0));
+        radiationSourceModels.at(i)->updateMembers(0);
+    }
+
+    // Target above terminator, such that part of the panels is not illuminated by the Sun
+    const Eigen::Vector3d targetPosition = (radius + 800e3) * Eigen::Vector3d(0.1, 1, 0.3).normalized();
+    const auto irradianceList = radiationSourceModels.at(0)->evaluateIrradianceAtPosition(targetPosition);
+
+    IrradianceWithSourceList expectedIrradianceList;
+    for (const auto& panel : radiationSourceModels.at(0)->getPanels())
+    {
+        const Eigen::Vector3d targetPositionRelativeToPanel = targetPosition - panel.getRelativeCenter();
+        double irradiance = 0;
+        for (auto& radiosityModel : panel.getRadiosityModels())
+        {
+            irradiance += radiosityModel->evaluateIrradianceAtPosition(
+                    panel.getArea(), panel.getSurfaceNormal(), targetPositionRelativeToPanel);
+        }
+        if (irradiance > 0)
+        {
+            expectedIrradianceList.emplace_back(irradiance, panel.getRelativeCenter());
+        }
+    }
+
+    BOOST_CHECK_EQUAL(irradianceList.size(), expectedIrradianceList.size());
+    for (unsigned int i = 0; i < irradianceList.size(); ++i)
+    {
+        BOOST_CHECK_CLOSE_FRACTION(irradianceList.at(i).first, expectedIrradianceList.at(i).first, 1e-14);
+        BOOST_CHECK_EQUAL(irradianceList.at(i).second, expectedIrradianceList.at(i).second);
+    }
+
+    // Panels should be reused for a target displacement below the tolerance, but not above it
+    radiationSourceModels.at(1)->evaluateIrradianceAtPosition(targetPosition);
+    const Eigen::Vector3d firstPanelCenter = radiationSourceModels.at(1)->getPanels().front().getRelativeCenter();
+
+    radiationSourceModels.at(1)->evaluateIrradianceAtPosition(targetPosition + Eigen::Vector3d(1e3, 0, 0));
+    BOOST_CHECK_EQUAL(radiationSourceModels.at(1)->getPanels().front().getRelativeCenter(), firstPanelCenter);
+
+    radiationSourceModels.at(1)->evaluateIrradianceAtPosition(targetPosition + Eigen::Vector3d(1e5, 0, 0));
+    BOOST_CHECK(radiationSourceModels.at(1)->getPanels().front().getRelativeCenter() != firstPanelCenter);
+}
+
 //! Test polar/azimuth angle to latitude/longitude conversion in constructor
 BOOST_AUTO_TEST_CASE( testPaneledRadiationSourceModelPanel )
 {
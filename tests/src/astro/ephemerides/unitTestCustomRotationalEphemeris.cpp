@@ -77,6 +77,18 @@ BOOST_AUTO_TEST_CASE( testCustomRotationalEphemeris )
     }
     TUDAT_CHECK_MATRIX_CLOSE_FRACTION( testAngularVelocity, spiceAngularVelocity, 1.0E-5 );
 
+    // Check that per-epoch caching is rejected for custom rotation model
+    rotationSettings->setUseEpochCache( true );
+    bool isExceptionCaught = false;
+    try
+    {
+        createRotationModel( rotationSettings, "Earth", SystemOfBodies( ) );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
 }
 
 BOOST_AUTO_TEST_SUITE_END( )
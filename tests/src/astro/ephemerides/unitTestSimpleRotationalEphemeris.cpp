@@ -322,6 +322,123 @@ BOOST_AUTO_TEST_CASE( testSimpleRotationalEphemeris )
     }
 }
 
+//! Simple rotational ephemeris that counts the number of evaluations of the full rotational state (for testing the cache)
+class CountingSimpleRotationalEphemeris: public SimpleRotationalEphemeris
+{
+public:
+
+    using SimpleRotationalEphemeris::SimpleRotationalEphemeris;
+
+    void getFullRotationalQuantitiesToTargetFrame(
+            Eigen::Quaterniond& currentRotationToLocalFrame,
+            Eigen::Matrix3d& currentRotationToLocalFrameDerivative,
+            Eigen::Vector3d& currentAngularVelocityVectorInGlobalFrame,
+            const double secondsSinceEpoch )
+    {
+        numberOfEvaluations_++;
+        SimpleRotationalEphemeris::getFullRotationalQuantitiesToTargetFrame(
+                    currentRotationToLocalFrame, currentRotationToLocalFrameDerivative,
+                    currentAngularVelocityVectorInGlobalFrame, secondsSinceEpoch );
+    }
+
+    void getFullRotationalQuantitiesToTargetFrameFromExtendedTime(
+            Eigen::Quaterniond& currentRotationToLocalFrame,
+            Eigen::Matrix3d& currentRotationToLocalFrameDerivative,
+            Eigen::Vector3d& currentAngularVelocityVectorInGlobalFrame,
+            const Time timeSinceEpoch )
+    {
+        numberOfEvaluations_++;
+        SimpleRotationalEphemeris::getFullRotationalQuantitiesToTargetFrameFromExtendedTime(
+                    currentRotationToLocalFrame, currentRotationToLocalFrameDerivative,
+                    currentAngularVelocityVectorInGlobalFrame, timeSinceEpoch );
+    }
+
+    int numberOfEvaluations_ = 0;
+};
+
+// Test per-epoch cache of rotational quantities, by comparing cached and uncached rotational ephemerides
+BOOST_AUTO_TEST_CASE( testRotationalEphemerisEpochCache )
+{
+    const double venusPoleRightAscension = convertDegreesToRadians( 272.76 );
+    const double venusPoleDeclination = convertDegreesToRadians( 67.16 );
+    const double venusPrimeMeridianAtJ2000 = convertDegreesToRadians( 160.20 );
+    const double venusRotationRate = convertDegreesToRadians( -1.4813688 ) /
+            physical_constants::JULIAN_DAY;
+
+    SimpleRotationalEphemeris uncachedEphemeris(
+                venusPoleRightAscension, venusPoleDeclination, venusPrimeMeridianAtJ2000,
+                venusRotationRate, 0.0, "J2000", "IAU_VENUS" );
+    CountingSimpleRotationalEphemeris cachedEphemeris(
+                venusPoleRightAscension, venusPoleDeclination, venusPrimeMeridianAtJ2000,
+                venusRotationRate, 0.0, "J2000", "IAU_VENUS" );
+    cachedEphemeris.setUseEpochCache( true );
+    BOOST_CHECK_EQUAL( cachedEphemeris.getUseEpochCache( ), true );
+    BOOST_CHECK_EQUAL( uncachedEphemeris.getUseEpochCache( ), false );
+
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        // Modify rotation rate in second iteration, and check that cache is invalidated
+        if( i == 1 )
+        {
+            uncachedEphemeris.resetRotationRate( 2.0 * venusRotationRate );
+            cachedEphemeris.resetRotationRate( 2.0 * venusRotationRate );
+        }
+
+        double testTime = 1.0E7;
+        int numberOfEvaluationsBefore = cachedEphemeris.numberOfEvaluations_;
+
+        // Retrieve all quantities (twice) at same epoch
+        for( unsigned int j = 0; j < 2; j++ )
+        {
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                        Eigen::Matrix3d( uncachedEphemeris.getRotationToBaseFrameTemplated< double >( testTime ) ),
+                        Eigen::Matrix3d( cachedEphemeris.getRotationToBaseFrameTemplated< double >( testTime ) ),
+                        std::numeric_limits< double >::epsilon( ) );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                        Eigen::Matrix3d( uncachedEphemeris.getRotationToTargetFrameTemplated< double >( testTime ) ),
+                        Eigen::Matrix3d( cachedEphemeris.getRotationToTargetFrameTemplated< double >( testTime ) ),
+                        std::numeric_limits< double >::epsilon( ) );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                        uncachedEphemeris.getDerivativeOfRotationToBaseFrameTemplated< double >( testTime ),
+                        cachedEphemeris.getDerivativeOfRotationToBaseFrameTemplated< double >( testTime ),
+                        std::numeric_limits< double >::epsilon( ) );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                        uncachedEphemeris.getDerivativeOfRotationToTargetFrameTemplated< double >( testTime ),
+                        cachedEphemeris.getDerivativeOfRotationToTargetFrameTemplated< double >( testTime ),
+                        std::numeric_limits< double >::epsilon( ) );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                        uncachedEphemeris.getRotationStateVector( testTime ),
+                        cachedEphemeris.getRotationStateVector( testTime ),
+                        std::numeric_limits< double >::epsilon( ) );
+        }
+
+        // Check that full rotational state is computed only once for this epoch
+        BOOST_CHECK_EQUAL( cachedEphemeris.numberOfEvaluations_ - numberOfEvaluationsBefore, 1 );
+
+        // Check that cache is updated for new epoch (in Time precision)
+        Time extendedTestTime = Time( 2778, 0.25L );
+        Eigen::Quaterniond uncachedRotation, cachedRotation;
+        Eigen::Matrix3d uncachedRotationDerivative, cachedRotationDerivative;
+        Eigen::Vector3d uncachedAngularVelocity, cachedAngularVelocity;
+        uncachedEphemeris.getFullRotationalQuantitiesToTargetFrameTemplated< Time >(
+                    uncachedRotation, uncachedRotationDerivative, uncachedAngularVelocity, extendedTestTime );
+        cachedEphemeris.getFullRotationalQuantitiesToTargetFrameTemplated< Time >(
+                    cachedRotation, cachedRotationDerivative, cachedAngularVelocity, extendedTestTime );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    Eigen::Matrix3d( uncachedRotation ), Eigen::Matrix3d( cachedRotation ),
+                    std::numeric_limits< double >::epsilon( ) );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    uncachedRotationDerivative, cachedRotationDerivative, std::numeric_limits< double >::epsilon( ) );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    uncachedAngularVelocity, cachedAngularVelocity, std::numeric_limits< double >::epsilon( ) );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    Eigen::Matrix3d( uncachedEphemeris.getRotationToTargetFrameTemplated< Time >( extendedTestTime ) ),
+                    Eigen::Matrix3d( cachedEphemeris.getRotationToTargetFrameTemplated< Time >( extendedTestTime ) ),
+                    std::numeric_limits< double >::epsilon( ) );
+        BOOST_CHECK_EQUAL( cachedEphemeris.numberOfEvaluations_ - numberOfEvaluationsBefore, 2 );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -0,0 +1,231 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+
+#include "tudat/simulation/estimation.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::observation_models;
+using namespace tudat::simulation_setup;
+using namespace tudat::statistics;
+
+BOOST_AUTO_TEST_SUITE( test_parallel_observation_simulation )
+
+//! Function to create noise function with fixed seed
+std::function< double( const double ) > createTestNoiseFunction( )
+{
+    std::function< double( ) > inputFreeNoiseFunction = createBoostContinuousRandomVariableGeneratorFunction(
+                normal_boost_distribution, { 0.0, 2.0 }, 0.0 );
+    return std::bind( &utilities::evaluateFunctionWithoutInputArgumentDependency< double, const double >,
+                      inputFreeNoiseFunction, std::placeholders::_1 );
+}
+
+//! Test whether observations simulated in parallel are identical to those simulated serially
+BOOST_AUTO_TEST_CASE( testParallelObservationSimulation )
+{
+    //Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Create bodies, with tabulated ephemerides and rotation models that are not evaluated directly from SPICE (which
+    // cannot be used from multiple threads concurrently)
+    double initialEphemerisTime = 1.0E7;
+    double finalEphemerisTime = 1.0E7 + 3.0 * physical_constants::JULIAN_DAY;
+    BodyListSettings bodySettings =
+            getDefaultBodySettings( { "Earth", "Moon" }, initialEphemerisTime - 3600.0, finalEphemerisTime + 3600.0 );
+
+    // Check that SPICE-based default rotation models are detected
+    {
+        SystemOfBodies defaultBodies = createSystemOfBodies( bodySettings );
+        std::vector< std::string > threadUnsafeModels = getThreadUnsafeEnvironmentModels( defaultBodies );
+        BOOST_CHECK_EQUAL( threadUnsafeModels.size( ), 2 );
+        BOOST_CHECK_EQUAL( threadUnsafeModels.at( 0 ), "SPICE rotation model of Earth" );
+        BOOST_CHECK_EQUAL( getNumberOfThreadsForEnvironmentEvaluation( defaultBodies, 4 ), 1 );
+    }
+
+    for( std::string bodyName : { "Earth", "Moon" } )
+    {
+        bodySettings.at( bodyName )->rotationModelSettings = std::make_shared< SimpleRotationModelSettings >(
+                    "ECLIPJ2000", "IAU_" + bodyName,
+                    spice_interface::computeRotationQuaternionBetweenFrames(
+                        "ECLIPJ2000", "IAU_" + bodyName, initialEphemerisTime ),
+                    initialEphemerisTime, 2.0 * mathematical_constants::PI / ( physical_constants::JULIAN_DAY ) );
+    }
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+    BOOST_CHECK_EQUAL( getThreadUnsafeEnvironmentModels( bodies ).size( ), 0 );
+    BOOST_CHECK_EQUAL( getNumberOfThreadsForEnvironmentEvaluation( bodies, 4 ), 4 );
+
+    // Check that a rotation model with (unsynchronized) per-epoch cache is not evaluated concurrently
+    bodies.at( "Earth" )->getRotationalEphemeris( )->setUseEpochCache( true );
+    BOOST_CHECK_EQUAL( getThreadUnsafeEnvironmentModels( bodies ).size( ), 1 );
+    BOOST_CHECK_EQUAL( getThreadUnsafeEnvironmentModels( bodies ).at( 0 ), "per-epoch cached rotation model of Earth" );
+    BOOST_CHECK_EQUAL( getNumberOfThreadsForEnvironmentEvaluation( bodies, 4 ), 1 );
+    bodies.at( "Earth" )->getRotationalEphemeris( )->setUseEpochCache( false );
+
+    // Check that ephemerides that are not known to be thread-safe are detected
+    std::shared_ptr< ephemerides::Ephemeris > moonEphemeris = bodies.at( "Moon" )->getEphemeris( );
+    bodies.at( "Moon" )->setEphemeris( std::make_shared< ephemerides::CustomEphemeris< > >(
+                                           [ = ]( const double time ){ return moonEphemeris->getCartesianState( time ); },
+                                           "Earth", "ECLIPJ2000" ) );
+    BOOST_CHECK_EQUAL( getThreadUnsafeEnvironmentModels( bodies ).size( ), 1 );
+    BOOST_CHECK_EQUAL( getThreadUnsafeEnvironmentModels( bodies ).at( 0 ), "ephemeris of Moon" );
+    bodies.at( "Moon" )->setEphemeris( moonEphemeris );
+
+    // Check that station motion models that are not known to be thread-safe are detected
+    {
+        SystemOfBodies stationBodies = createSystemOfBodies( bodySettings );
+        createGroundStation( stationBodies.at( "Earth" ), "LinearStation", Eigen::Vector3d::UnitX( ) * 6378.0E3,
+                             coordinate_conversions::cartesian_position,
+                             { linearGroundStationMotionSettings( Eigen::Vector3d::UnitZ( ) * 1.0E-9 ) } );
+        BOOST_CHECK_EQUAL( getThreadUnsafeEnvironmentModels( stationBodies ).size( ), 0 );
+
+        createGroundStation( stationBodies.at( "Earth" ), "MovingStation", Eigen::Vector3d::UnitY( ) * 6378.0E3,
+                             coordinate_conversions::cartesian_position,
+                             { piecewiseConstantGroundStationMotionSettings(
+                                   { { initialEphemerisTime, Eigen::Vector3d::UnitX( ) } } ) } );
+        std::vector< std::string > threadUnsafeModels = getThreadUnsafeEnvironmentModels( stationBodies );
+        BOOST_CHECK_EQUAL( threadUnsafeModels.size( ), 1 );
+        BOOST_CHECK_EQUAL( threadUnsafeModels.at( 0 ), "station motion model of Earth station MovingStation" );
+    }
+
+    std::vector< std::string > groundStationNames = { "Station1", "Station2", "Station3" };
+    createGroundStation( bodies.at( "Earth" ), "Station1", ( Eigen::Vector3d( ) << 0.0, 0.35, 0.0 ).finished( ), coordinate_conversions::geodetic_position );
+    createGroundStation( bodies.at( "Earth" ), "Station2", ( Eigen::Vector3d( ) << 0.0, -0.55, 2.0 ).finished( ), coordinate_conversions::geodetic_position );
+    createGroundStation( bodies.at( "Earth" ), "Station3", ( Eigen::Vector3d( ) << 0.0, 0.05, 4.0 ).finished( ), coordinate_conversions::geodetic_position );
+
+    // Define link ends from Moon to each ground station, for observables of different sizes
+    std::vector< std::shared_ptr< ObservationModelSettings > > observationSettingsList;
+    std::vector< std::pair< ObservableType, LinkEnds > > observedLinks;
+    for( unsigned int i = 0; i < groundStationNames.size( ); i++ )
+    {
+        LinkEnds linkEnds;
+        linkEnds[ receiver ] = std::pair< std::string, std::string >( std::make_pair( "Earth", groundStationNames.at( i ) ) );
+        linkEnds[ transmitter ] = std::make_pair< std::string, std::string >( "Moon", "" );
+
+        observationSettingsList.push_back( std::make_shared< ObservationModelSettings >( one_way_range, linkEnds ) );
+        observationSettingsList.push_back( std::make_shared< ObservationModelSettings >( angular_position, linkEnds ) );
+        observedLinks.push_back( std::make_pair( one_way_range, linkEnds ) );
+        observedLinks.push_back( std::make_pair( angular_position, linkEnds ) );
+    }
+
+    // Define observation simulation settings, with tabulated times for all links, and per-arc settings for the last link
+    std::vector< double > observationTimes;
+    for( unsigned int i = 0; i < 2000; i++ )
+    {
+        observationTimes.push_back( initialEphemerisTime + 1000.0 + static_cast< double >( i ) * 120.0 );
+    }
+
+    std::vector< std::shared_ptr< ObservationSimulationSettings< double > > > measurementSimulationInput;
+    for( unsigned int i = 0; i < observedLinks.size( ); i++ )
+    {
+        measurementSimulationInput.push_back(
+                    std::make_shared< TabulatedObservationSimulationSettings< > >(
+                        observedLinks.at( i ).first, observedLinks.at( i ).second, observationTimes, receiver ) );
+    }
+    measurementSimulationInput.push_back(
+                std::make_shared< PerArcObservationSimulationSettings< double > >(
+                    one_way_range, observedLinks.at( 0 ).second,
+                    initialEphemerisTime + 1000.0, finalEphemerisTime - 1000.0, 300.0,
+                    elevationAngleViabilitySettings( std::make_pair( "Earth", "Station1" ), 0.0 ) ) );
+    addViabilityToObservationSimulationSettings(
+                measurementSimulationInput,
+                { elevationAngleViabilitySettings( std::make_pair( "Earth", "" ), 5.0 * mathematical_constants::PI / 180.0 ) } );
+
+    // Simulate observations serially
+    std::vector< std::shared_ptr< ObservationSimulatorBase< double, double > > > observationSimulators =
+            createObservationSimulators( observationSettingsList, bodies );
+    addNoiseFunctionToObservationSimulationSettings( measurementSimulationInput, createTestNoiseFunction( ) );
+    std::shared_ptr< ObservationCollection< > > serialObservations = simulateObservations< double, double >(
+                measurementSimulationInput, observationSimulators, bodies );
+
+    // Simulate observations in parallel, with same noise
+    clearNoiseFunctionFromObservationSimulationSettings( measurementSimulationInput );
+    addNoiseFunctionToObservationSimulationSettings( measurementSimulationInput, createTestNoiseFunction( ) );
+    std::shared_ptr< ObservationCollection< > > parallelObservations = simulateObservationsInParallel< double, double >(
+                measurementSimulationInput, observationSettingsList, bodies, 4, 150 );
+
+    // Check that observations are identical
+    BOOST_CHECK( serialObservations->getObservationVector( ).rows( ) > 0 );
+    BOOST_CHECK_EQUAL( serialObservations->getObservationVector( ).rows( ),
+                       parallelObservations->getObservationVector( ).rows( ) );
+    BOOST_CHECK( serialObservations->getObservationVector( ) == parallelObservations->getObservationVector( ) );
+    BOOST_CHECK( serialObservations->getConcatenatedTimeVector( ) == parallelObservations->getConcatenatedTimeVector( ) );
+    BOOST_CHECK( serialObservations->getConcatenatedLinkEndIds( ) == parallelObservations->getConcatenatedLinkEndIds( ) );
+}
+
+//! Test whether body states retrieved from ephemerides on multiple threads are identical to those retrieved serially
+//! (the body states are retrieved without modifying the Body objects, which is checked for data races when building
+//! with TUDAT_BUILD_WITH_THREAD_SANITIZER)
+BOOST_AUTO_TEST_CASE( testConcurrentBodyStateEvaluation )
+{
+    // Create bodies with tabulated ephemerides, with the Earth ephemeris defined w.r.t. the Moon
+    std::map< double, Eigen::Vector6d > stateMap;
+    for( unsigned int i = 0; i < 1000; i++ )
+    {
+        double currentTime = static_cast< double >( i ) * 60.0;
+        stateMap[ currentTime ] = 7.0E6 * ( Eigen::Vector6d( ) << std::cos( currentTime * 1.0E-4 ),
+                                            std::sin( currentTime * 1.0E-4 ), 0.0, 0.0, 0.0, 0.0 ).finished( );
+    }
+    std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::Vector6d > > stateInterpolator =
+            std::make_shared< interpolators::LagrangeInterpolator< double, Eigen::Vector6d > >( stateMap, 8 );
+
+    SystemOfBodies bodies;
+    bodies.createEmptyBody( "Moon" );
+    bodies.createEmptyBody( "Earth" );
+    bodies.at( "Moon" )->setEphemeris( std::make_shared< ephemerides::TabulatedCartesianEphemeris< > >(
+                                           stateInterpolator, "SSB", "ECLIPJ2000" ) );
+    bodies.at( "Earth" )->setEphemeris( std::make_shared< ephemerides::TabulatedCartesianEphemeris< > >(
+                                            stateInterpolator, "Moon", "ECLIPJ2000" ) );
+    bodies.processBodyFrameDefinitions( );
+    BOOST_CHECK_EQUAL( getThreadUnsafeEnvironmentModels( bodies ).size( ), 0 );
+
+    // Retrieve states serially and on multiple threads, in different order per thread
+    unsigned int numberOfThreads = 4;
+    unsigned int numberOfTimes = 20000;
+    std::vector< Eigen::Vector6d > serialStates( numberOfTimes );
+    for( unsigned int i = 0; i < numberOfTimes; i++ )
+    {
+        serialStates[ i ] = bodies.at( "Earth" )->getStateInBaseFrameFromEphemeris( 100.0 + static_cast< double >( i ) * 2.5 );
+    }
+
+    std::vector< std::vector< Eigen::Vector6d > > parallelStates(
+                numberOfThreads, std::vector< Eigen::Vector6d >( numberOfTimes ) );
+    utilities::parallelFor( numberOfThreads, [ & ]( const unsigned int threadIndex )
+    {
+        for( unsigned int j = 0; j < numberOfTimes; j++ )
+        {
+            unsigned int i = ( j * 7919 + threadIndex * 104729 ) % numberOfTimes;
+            parallelStates[ threadIndex ][ i ] = bodies.at( "Earth" )->getStateInBaseFrameFromEphemeris(
+                        100.0 + static_cast< double >( i ) * 2.5 );
+        }
+    }, numberOfThreads );
+
+    for( unsigned int threadIndex = 0; threadIndex < numberOfThreads; threadIndex++ )
+    {
+        BOOST_CHECK( parallelStates[ threadIndex ] == serialStates );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
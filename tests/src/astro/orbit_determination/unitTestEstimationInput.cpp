@@ -492,6 +492,288 @@ BOOST_AUTO_TEST_CASE( test_WeightDefinitions )
     }
 }
 
+
+//! This test checks whether the design matrix and residuals computed on multiple threads are identical to those computed
+//! on a single thread
+BOOST_AUTO_TEST_CASE( test_ParallelDesignMatrix )
+{
+    //Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    const double initialEphemerisTime = 1.0E7;
+    const double finalEphemerisTime = initialEphemerisTime + 2.0 * 86400.0;
+
+    // Create bodies, with tabulated ephemerides (which may be evaluated concurrently)
+    BodyListSettings bodySettings = getDefaultBodySettings(
+        { "Earth", "Sun", "Moon" }, initialEphemerisTime - 3600.0, finalEphemerisTime + 3600.0, "Earth", "ECLIPJ2000" );
+
+    // Use rotation models that are not evaluated directly from SPICE, so that the environment can be evaluated from
+    // multiple threads
+    for( std::string bodyName : { "Earth", "Sun", "Moon" } )
+    {
+        bodySettings.at( bodyName )->rotationModelSettings = std::make_shared< SimpleRotationModelSettings >(
+            "ECLIPJ2000", "IAU_" + bodyName,
+            spice_interface::computeRotationQuaternionBetweenFrames(
+                "ECLIPJ2000", "IAU_" + bodyName, initialEphemerisTime ),
+            initialEphemerisTime, 2.0 * mathematical_constants::PI / ( physical_constants::JULIAN_DAY ) );
+    }
+
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+    BOOST_CHECK_EQUAL( getThreadUnsafeEnvironmentModels( bodies ).size( ), 0 );
+    bodies.createEmptyBody( "Vehicle" );
+    bodies.at( "Vehicle" )->setEphemeris( std::make_shared< TabulatedCartesianEphemeris< > >(
+        std::shared_ptr< interpolators::OneDimensionalInterpolator
+            < double, Eigen::Vector6d > >( ), "Earth", "ECLIPJ2000" ) );
+
+    std::vector< std::string > groundStationNames = { "Station1", "Station2", "Station3" };
+    createGroundStation( bodies.at( "Earth" ), "Station1", ( Eigen::Vector3d( ) << 0.0, 0.35, 0.0 ).finished( ), geodetic_position );
+    createGroundStation( bodies.at( "Earth" ), "Station2", ( Eigen::Vector3d( ) << 0.0, -0.55, 2.0 ).finished( ), geodetic_position );
+    createGroundStation( bodies.at( "Earth" ), "Station3", ( Eigen::Vector3d( ) << 0.0, 0.05, 4.0 ).finished( ), geodetic_position );
+
+    // Create propagator and integrator settings
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back( std::make_shared< SphericalHarmonicAccelerationSettings >( 4, 4 ) );
+    accelerationMap[ "Vehicle" ][ "Moon" ].push_back( std::make_shared< AccelerationSettings >( point_mass_gravity ) );
+    AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+        bodies, accelerationMap, { "Vehicle" }, { "Earth" } );
+
+    Eigen::Vector6d initialStateInKeplerianElements;
+    initialStateInKeplerianElements << 7200.0E3, 0.05, 1.49, 4.11, 0.41, 2.44;
+    Eigen::Vector6d systemInitialState = convertKeplerianToCartesianElements(
+        initialStateInKeplerianElements, bodies.at( "Earth" )->getGravityFieldModel( )->getGravitationalParameter( ) );
+
+    std::shared_ptr< IntegratorSettings< double > > integratorSettings =
+        rungeKuttaFixedStepSettings( 40.0, CoefficientSets::rungeKuttaFehlberg78 );
+    std::shared_ptr< TranslationalStatePropagatorSettings< double, double > > propagatorSettings =
+        std::make_shared< TranslationalStatePropagatorSettings< double, double > >(
+            std::vector< std::string >{ "Earth" }, accelerationModelMap, std::vector< std::string >{ "Vehicle" },
+            systemInitialState, initialEphemerisTime, integratorSettings,
+            propagationTimeTerminationSettings( finalEphemerisTime ) );
+
+    // Define observation models, for observables of different sizes
+    std::map< ObservableType, std::vector< LinkEnds > > linkEndsPerObservable;
+    for( unsigned int i = 0; i < groundStationNames.size( ); i++ )
+    {
+        LinkEnds linkEnds;
+        linkEnds[ receiver ] = LinkEndId( "Earth", groundStationNames.at( i ) );
+        linkEnds[ transmitter ] = LinkEndId( "Vehicle", "" );
+        linkEndsPerObservable[ one_way_range ].push_back( linkEnds );
+        linkEndsPerObservable[ angular_position ].push_back( linkEnds );
+        linkEndsPerObservable[ one_way_doppler ].push_back( linkEnds );
+    }
+
+    std::vector< std::shared_ptr< ObservationModelSettings > > observationSettingsList;
+    for( auto linkEndIterator : linkEndsPerObservable )
+    {
+        for( unsigned int i = 0; i < linkEndIterator.second.size( ); i++ )
+        {
+            observationSettingsList.push_back(
+                std::make_shared< ObservationModelSettings >( linkEndIterator.first, linkEndIterator.second.at( i ) ) );
+        }
+    }
+
+    // Define parameters to estimate
+    std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterNames;
+    parameterNames.push_back(
+        std::make_shared< InitialTranslationalStateEstimatableParameterSettings< double > >(
+            "Vehicle", systemInitialState, "Earth" ) );
+    parameterNames.push_back( std::make_shared< EstimatableParameterSettings >( "Earth", gravitational_parameter ) );
+    parameterNames.push_back( std::make_shared< SphericalHarmonicEstimatableParameterSettings >(
+        2, 0, 4, 4, "Earth", spherical_harmonics_cosine_coefficient_block ) );
+    std::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > > parametersToEstimate =
+        createParametersToEstimate< double, double >( parameterNames, bodies, propagatorSettings );
+
+    // Create orbit determination object, and simulate observations
+    OrbitDeterminationManager< double, double > orbitDeterminationManager =
+        OrbitDeterminationManager< double, double >(
+            bodies, parametersToEstimate, observationSettingsList, propagatorSettings );
+
+    std::vector< double > observationTimes;
+    for( double currentTime = initialEphemerisTime + 1000.0; currentTime < finalEphemerisTime - 1000.0; currentTime += 60.0 )
+    {
+        observationTimes.push_back( currentTime );
+    }
+    std::shared_ptr< ObservationCollection< double, double > > simulatedObservations =
+        simulateObservations< double, double >(
+            getObservationSimulationSettings< double >( linkEndsPerObservable, observationTimes, receiver ),
+            orbitDeterminationManager.getObservationSimulators( ), bodies );
+
+    // Perturb parameters, and estimate them using one, two and four threads
+    Eigen::VectorXd truthParameters = parametersToEstimate->getFullParameterValues< double >( );
+    Eigen::VectorXd initialParameterEstimate = truthParameters;
+    initialParameterEstimate.segment( 0, 3 ) += Eigen::Vector3d::Constant( 10.0 );
+
+    std::vector< unsigned int > numberOfThreadsList = { 1, 2, 4 };
+    std::vector< std::shared_ptr< EstimationOutput< double, double > > > estimationOutputs;
+    std::vector< std::shared_ptr< CovarianceAnalysisOutput< double, double > > > covarianceOutputs;
+    for( unsigned int i = 0; i < numberOfThreadsList.size( ); i++ )
+    {
+        parametersToEstimate->resetParameterValues( initialParameterEstimate );
+
+        std::shared_ptr< EstimationInput< double, double > > estimationInput =
+            std::make_shared< EstimationInput< double, double > >(
+                simulatedObservations, Eigen::MatrixXd::Zero( 0, 0 ), std::make_shared< EstimationConvergenceChecker >( 2 ) );
+        estimationInput->setNumberOfThreads( numberOfThreadsList.at( i ) );
+        estimationInput->defineEstimationSettings( true, true, true, false, true );
+        estimationOutputs.push_back( orbitDeterminationManager.estimateParameters( estimationInput ) );
+
+        std::shared_ptr< CovarianceAnalysisInput< double, double > > covarianceInput =
+            std::make_shared< CovarianceAnalysisInput< double, double > >( simulatedObservations );
+        covarianceInput->setNumberOfThreads( numberOfThreadsList.at( i ) );
+        covarianceInput->defineCovarianceSettings( false, false, true, false );
+        covarianceOutputs.push_back( orbitDeterminationManager.computeCovariance( covarianceInput ) );
+    }
+
+    // Check that results are bitwise identical to those computed on a single thread
+    BOOST_CHECK( estimationOutputs.at( 0 )->residualHistory_.size( ) > 0 );
+    for( unsigned int i = 1; i < numberOfThreadsList.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( estimationOutputs.at( i )->residualHistory_.size( ), estimationOutputs.at( 0 )->residualHistory_.size( ) );
+        for( unsigned int j = 0; j < estimationOutputs.at( 0 )->residualHistory_.size( ); j++ )
+        {
+            BOOST_CHECK( estimationOutputs.at( i )->residualHistory_.at( j ) == estimationOutputs.at( 0 )->residualHistory_.at( j ) );
+            BOOST_CHECK( estimationOutputs.at( i )->parameterHistory_.at( j ) == estimationOutputs.at( 0 )->parameterHistory_.at( j ) );
+        }
+        BOOST_CHECK( estimationOutputs.at( i )->getUnnormalizedDesignMatrix( ) ==
+                     estimationOutputs.at( 0 )->getUnnormalizedDesignMatrix( ) );
+        BOOST_CHECK( covarianceOutputs.at( i )->getUnnormalizedDesignMatrix( ) ==
+                     covarianceOutputs.at( 0 )->getUnnormalizedDesignMatrix( ) );
+    }
+
+    // Estimate parameters, and compute covariance, from normal equations and using square-root information filter
+    // (without storing design matrix), and from normal equations while storing block-sparse design matrix
+    for( unsigned int testCase = 0; testCase < 3; testCase++ )
+    {
+        parametersToEstimate->resetParameterValues( initialParameterEstimate );
+        std::shared_ptr< EstimationInput< double, double > > streamingEstimationInput =
+            std::make_shared< EstimationInput< double, double > >(
+                simulatedObservations, Eigen::MatrixXd::Zero( 0, 0 ), std::make_shared< EstimationConvergenceChecker >( 2 ) );
+        streamingEstimationInput->setNumberOfThreads( 2 );
+        if( testCase != 1 )
+        {
+            streamingEstimationInput->setUseNormalEquations( true );
+            streamingEstimationInput->setSaveBlockSparseDesignMatrix( testCase == 2 );
+        }
+        else
+        {
+            streamingEstimationInput->setUseSquareRootInformationFilter( true );
+        }
+        streamingEstimationInput->defineEstimationSettings( true, true, true, false, true );
+        std::shared_ptr< EstimationOutput< double, double > > streamingEstimationOutput =
+            orbitDeterminationManager.estimateParameters( streamingEstimationInput );
+
+        std::shared_ptr< CovarianceAnalysisInput< double, double > > streamingCovarianceInput =
+            std::make_shared< CovarianceAnalysisInput< double, double > >( simulatedObservations );
+        if( testCase != 1 )
+        {
+            streamingCovarianceInput->setUseNormalEquations( true );
+            streamingCovarianceInput->setSaveBlockSparseDesignMatrix( testCase == 2 );
+        }
+        else
+        {
+            streamingCovarianceInput->setUseSquareRootInformationFilter( true );
+        }
+        streamingCovarianceInput->defineCovarianceSettings( false, false, true, false );
+        std::shared_ptr< CovarianceAnalysisOutput< double, double > > streamingCovarianceOutput =
+            orbitDeterminationManager.computeCovariance( streamingCovarianceInput );
+
+        // Check that results are consistent with those computed from design matrix
+        if( testCase != 2 )
+        {
+            BOOST_CHECK_EQUAL( streamingEstimationOutput->getNormalizedDesignMatrix( ).size( ), 0 );
+            BOOST_CHECK( streamingEstimationOutput->getNormalizedBlockSparseDesignMatrix( ) == nullptr );
+        }
+        else
+        {
+            // Check that block-sparse design matrix is equal to full design matrix
+            for( unsigned int k = 0; k < 2; k++ )
+            {
+                std::shared_ptr< CovarianceAnalysisOutput< double, double > > denseOutput =
+                    ( k == 0 ) ? estimationOutputs.at( 0 ) : covarianceOutputs.at( 0 );
+                std::shared_ptr< CovarianceAnalysisOutput< double, double > > sparseOutput =
+                    ( k == 0 ) ? streamingEstimationOutput : streamingCovarianceOutput;
+                BOOST_CHECK( sparseOutput->getNormalizedBlockSparseDesignMatrix( ) != nullptr );
+                BOOST_CHECK( sparseOutput->normalizedDesignMatrix_.size( ) == 0 );
+
+                Eigen::MatrixXd denseDesignMatrix = denseOutput->getNormalizedDesignMatrix( );
+                Eigen::MatrixXd sparseDesignMatrix = sparseOutput->getNormalizedDesignMatrix( );
+                BOOST_CHECK_EQUAL( sparseDesignMatrix.rows( ), denseDesignMatrix.rows( ) );
+                BOOST_CHECK_EQUAL( sparseDesignMatrix.cols( ), denseDesignMatrix.cols( ) );
+                BOOST_CHECK( ( sparseDesignMatrix - denseDesignMatrix ).cwiseAbs( ).maxCoeff( ) < 1.0E-6 );
+            }
+        }
+        BOOST_CHECK_EQUAL( streamingEstimationOutput->residualHistory_.size( ), estimationOutputs.at( 0 )->residualHistory_.size( ) );
+        for( unsigned int j = 0; j < estimationOutputs.at( 0 )->residualHistory_.size( ); j++ )
+        {
+            BOOST_CHECK( ( streamingEstimationOutput->residualHistory_.at( j ) -
+                           estimationOutputs.at( 0 )->residualHistory_.at( j ) ).cwiseAbs( ).maxCoeff( ) <
+                         1.0E-6 * estimationOutputs.at( 0 )->residualHistory_.at( j ).cwiseAbs( ).maxCoeff( ) );
+        }
+        for( int j = 0; j < truthParameters.rows( ); j++ )
+        {
+            BOOST_CHECK( std::fabs( streamingEstimationOutput->parameterHistory_.back( )( j ) -
+                                    estimationOutputs.at( 0 )->parameterHistory_.back( )( j ) ) <
+                         1.0E-6 * estimationOutputs.at( 0 )->getFormalErrorVector( )( j ) );
+            BOOST_CHECK_CLOSE_FRACTION( streamingEstimationOutput->getNormalizationTerms( )( j ),
+                                        estimationOutputs.at( 0 )->getNormalizationTerms( )( j ), 1.0E-15 );
+            BOOST_CHECK_CLOSE_FRACTION( streamingEstimationOutput->getFormalErrorVector( )( j ),
+                                        estimationOutputs.at( 0 )->getFormalErrorVector( )( j ), 1.0E-6 );
+            BOOST_CHECK_CLOSE_FRACTION( streamingCovarianceOutput->getFormalErrorVector( )( j ),
+                                        covarianceOutputs.at( 0 )->getFormalErrorVector( )( j ), 1.0E-6 );
+        }
+    }
+
+    // Estimate parameters with frozen variational equations and partials: from design matrix (frozen after first
+    // iteration), from normal equations (frozen once the update is small w.r.t. the formal errors) and using the
+    // square-root information filter (frozen after second iteration). Compare to estimation without freezing, and
+    // to partials of first iteration.
+    std::vector< std::shared_ptr< EstimationOutput< double, double > > > freezingOutputs;
+    for( unsigned int testCase = 0; testCase < 5; testCase++ )
+    {
+        parametersToEstimate->resetParameterValues( initialParameterEstimate );
+        std::shared_ptr< EstimationInput< double, double > > freezingEstimationInput =
+            std::make_shared< EstimationInput< double, double > >(
+                simulatedObservations, Eigen::MatrixXd::Zero( 0, 0 ),
+                std::make_shared< EstimationConvergenceChecker >( ( testCase == 0 ) ? 1 : 4 ) );
+        freezingEstimationInput->setNumberOfThreads( 2 );
+        freezingEstimationInput->defineEstimationSettings( true, true, true, false, true );
+        if( testCase == 2 )
+        {
+            freezingEstimationInput->setPartialsFreezingSettings( 1 );
+        }
+        else if( testCase == 3 )
+        {
+            freezingEstimationInput->setUseNormalEquations( true );
+            freezingEstimationInput->setPartialsFreezingSettings( -1, 1.0 );
+        }
+        else if( testCase == 4 )
+        {
+            freezingEstimationInput->setUseSquareRootInformationFilter( true );
+            freezingEstimationInput->setPartialsFreezingSettings( 2 );
+        }
+        freezingOutputs.push_back( orbitDeterminationManager.estimateParameters( freezingEstimationInput ) );
+    }
+
+    // Check that frozen design matrix is equal to that of the first iteration
+    BOOST_CHECK( freezingOutputs.at( 2 )->getNormalizedDesignMatrix( ) == freezingOutputs.at( 0 )->getNormalizedDesignMatrix( ) );
+    BOOST_CHECK( freezingOutputs.at( 2 )->getNormalizationTerms( ) == freezingOutputs.at( 0 )->getNormalizationTerms( ) );
+    BOOST_CHECK( freezingOutputs.at( 3 )->getNormalizedBlockSparseDesignMatrix( ) == nullptr );
+
+    for( unsigned int testCase = 2; testCase < 5; testCase++ )
+    {
+        std::shared_ptr< EstimationOutput< double, double > > referenceOutput = freezingOutputs.at( 1 );
+        BOOST_CHECK_EQUAL( freezingOutputs.at( testCase )->residualHistory_.size( ), referenceOutput->residualHistory_.size( ) );
+        BOOST_CHECK( ( freezingOutputs.at( testCase )->residualHistory_.at( 0 ) - referenceOutput->residualHistory_.at( 0 ) ).cwiseAbs( ).maxCoeff( ) <
+                     1.0E-6 * referenceOutput->residualHistory_.at( 0 ).cwiseAbs( ).maxCoeff( ) );
+        for( int j = 0; j < truthParameters.rows( ); j++ )
+        {
+            BOOST_CHECK( std::fabs( freezingOutputs.at( testCase )->parameterHistory_.back( )( j ) -
+                                    referenceOutput->parameterHistory_.back( )( j ) ) <
+                         1.0E-2 * referenceOutput->getFormalErrorVector( )( j ) );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -52,7 +52,8 @@ using namespace tudat::basic_astrodynamics;
 
 template< typename ObservationScalarType = double , typename TimeType = double , typename StateScalarType  = double >
 Eigen::VectorXd  executeParameterEstimation(
-        const int linkArcs )
+        const int linkArcs,
+        const bool eliminateArcWiseParameters = false )
 {
     //Load spice kernels.f
     std::string kernelsPath = paths::getSpiceKernelPath( );
@@ -263,6 +264,8 @@ Eigen::VectorXd  executeParameterEstimation(
     std::shared_ptr< EstimationInput< ObservationScalarType, TimeType > > estimationInput =
             std::make_shared< EstimationInput< ObservationScalarType, TimeType > >(
                 observationsAndTimes );
+    estimationInput->setEliminateArcWiseParameters( eliminateArcWiseParameters );
+    estimationInput->setNumberOfThreads( eliminateArcWiseParameters ? 2 : 1 );
     std::shared_ptr< CovarianceAnalysisInput< ObservationScalarType, TimeType > > covarianceInput =
             std::make_shared< CovarianceAnalysisInput< ObservationScalarType, TimeType > >(
                 observationsAndTimes );
@@ -327,6 +330,34 @@ BOOST_AUTO_TEST_CASE( test_MultiArcStateEstimation )
 
 }
 
+BOOST_AUTO_TEST_CASE( test_MultiArcStateEstimationWithArcWiseElimination )
+{
+    // Execute test for linked arcs and separate arcs, and compare results with and without elimination of arc-wise
+    // parameters (Schur complement of each arc)
+    for( unsigned int testCase = 0; testCase < 2; testCase++ )
+    {
+        Eigen::VectorXd parameterError = executeParameterEstimation< double, double, double >( testCase, false );
+        Eigen::VectorXd eliminationParameterError = executeParameterEstimation< double, double, double >( testCase, true );
+        int numberOfEstimatedArcs = ( parameterError.rows( ) - 3 ) / 6;
+
+        BOOST_CHECK_EQUAL( eliminationParameterError.rows( ), parameterError.rows( ) );
+        for( int i = 0; i < numberOfEstimatedArcs; i++ )
+        {
+            for( unsigned int j = 0; j < 3; j++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( eliminationParameterError( i * 6 + j ) ), 1E-1 );
+                BOOST_CHECK_SMALL( std::fabs( eliminationParameterError( i * 6 + j + 3 ) ), 1.0E-7  );
+                BOOST_CHECK_SMALL( std::fabs( eliminationParameterError( i * 6 + j ) - parameterError( i * 6 + j ) ), 1E-3 );
+                BOOST_CHECK_SMALL( std::fabs( eliminationParameterError( i * 6 + j + 3 ) - parameterError( i * 6 + j + 3 ) ), 1.0E-9 );
+            }
+        }
+
+        BOOST_CHECK_SMALL( std::fabs( eliminationParameterError( parameterError.rows( ) - 3 ) ), 1.0E-17 );
+        BOOST_CHECK_SMALL( std::fabs( eliminationParameterError( parameterError.rows( ) - 2 ) ), 1.0E-9 );
+        BOOST_CHECK_SMALL( std::fabs( eliminationParameterError( parameterError.rows( ) - 1 ) ), 1.0E-9 );
+    }
+}
+
 template< typename ObservationScalarType = double , typename TimeType = double , typename StateScalarType  = double >
 Eigen::VectorXd  executeMultiBodyMultiArcParameterEstimation( )
 {
@@ -69,7 +69,8 @@ executeMultiArcEarthMoonSimulation(
         const std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > forcedArcInitialStates =
         std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >( ),
         const double arcDuration = 5.0E5,
-        const double arcOverlap  = 5.0E3 )
+        const double arcOverlap  = 5.0E3,
+        const unsigned int numberOfThreads = 1 )
 {
     // Define
     std::vector< std::string > bodyNames;
@@ -230,6 +231,7 @@ executeMultiArcEarthMoonSimulation(
         MultiArcVariationalEquationsSolver< StateScalarType, TimeType > variationalEquations =
                 MultiArcVariationalEquationsSolver< StateScalarType, TimeType >(
                     bodies, integratorSettings, multiArcPropagatorSettings, parametersToEstimate, arcStartTimes );
+        variationalEquations.setNumberOfThreads( numberOfThreads );
 
         // Propagate requested equations.
         if( propagateVariationalEquations )
@@ -424,6 +426,29 @@ BOOST_AUTO_TEST_CASE( testEarthMoonMultiArcVariationalEquationCalculation )
 }
 
 
+//! Test whether the multi-arc variational equations solution is independent of the number of threads used to process it
+BOOST_AUTO_TEST_CASE( testMultiArcVariationalEquationThreadIndependence )
+{
+    //Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    std::vector< std::string > centralBodies = { "Earth", "Sun" };
+
+    std::vector< Eigen::MatrixXd > serialStateTransitionMatrices = executeMultiArcEarthMoonSimulation< double, double >(
+                centralBodies, Eigen::Matrix< double, 12, 1 >::Zero( ), 0, 0, Eigen::Vector3d::Zero( ), 1,
+                std::vector< Eigen::VectorXd >( ), 5.0E5, 5.0E3, 1 ).first;
+    std::vector< Eigen::MatrixXd > parallelStateTransitionMatrices = executeMultiArcEarthMoonSimulation< double, double >(
+                centralBodies, Eigen::Matrix< double, 12, 1 >::Zero( ), 0, 0, Eigen::Vector3d::Zero( ), 1,
+                std::vector< Eigen::VectorXd >( ), 5.0E5, 5.0E3, 4 ).first;
+
+    // Check that results are identical
+    BOOST_CHECK_EQUAL( serialStateTransitionMatrices.size( ), parallelStateTransitionMatrices.size( ) );
+    for( unsigned int arc = 0; arc < serialStateTransitionMatrices.size( ); arc++ )
+    {
+        BOOST_CHECK( serialStateTransitionMatrices.at( arc ) == parallelStateTransitionMatrices.at( arc ) );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
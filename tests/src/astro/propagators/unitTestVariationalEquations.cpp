@@ -1252,6 +1252,79 @@ BOOST_AUTO_TEST_CASE( testMassRateVariationalEquations )
 
 }
 
+//! Test compressed storage of state transition and sensitivity matrix histories
+BOOST_AUTO_TEST_CASE( testCompressedStateTransitionMatrixStorage )
+{
+    // Create (smooth) state transition and sensitivity matrix histories, with columns of different magnitudes
+    std::map< double, Eigen::MatrixXd > stateTransitionSolution, sensitivitySolution;
+    std::vector< double > times;
+    for( int i = 0; i < 1000; i++ )
+    {
+        double currentTime = 1.0E7 + 60.0 * static_cast< double >( i );
+        double currentPhase = 2.0 * mathematical_constants::PI * ( currentTime - 1.0E7 ) / 20000.0;
+        Eigen::MatrixXd currentStateTransitionMatrix = Eigen::MatrixXd::Identity( 6, 6 );
+        Eigen::MatrixXd currentSensitivityMatrix = Eigen::MatrixXd::Zero( 6, 20 );
+        for( int j = 0; j < 6; j++ )
+        {
+            currentStateTransitionMatrix.row( j ) *= 1.0 + 0.1 * std::sin( currentPhase + j );
+            for( int k = 0; k < 20; k++ )
+            {
+                currentSensitivityMatrix( j, k ) = std::pow( 10.0, k - 10 ) * std::cos( ( 1.0 + 0.1 * j ) * currentPhase + k );
+            }
+        }
+        stateTransitionSolution[ currentTime ] = currentStateTransitionMatrix;
+        sensitivitySolution[ currentTime ] = currentSensitivityMatrix;
+        times.push_back( currentTime );
+    }
+
+    // Create interpolators without compression, with compression (to single precision and four times coarser grid), and
+    // with compression and an error tolerance that cannot be met by the compressed storage
+    std::vector< std::shared_ptr< StateTransitionMatrixStorageSettings > > storageSettingsList =
+    { nullptr, std::make_shared< StateTransitionMatrixStorageSettings >( 4, 8, true, 1.0E-5 ),
+      std::make_shared< StateTransitionMatrixStorageSettings >( 4, 8, true, 1.0E-12 ) };
+    std::vector< std::shared_ptr< OneDimensionalInterpolator< double, Eigen::MatrixXd > > >
+            stateTransitionMatrixInterpolators( storageSettingsList.size( ) ), sensitivityMatrixInterpolators( storageSettingsList.size( ) );
+    for( unsigned int i = 0; i < storageSettingsList.size( ); i++ )
+    {
+        std::map< double, Eigen::MatrixXd > stateTransitionSolutionToUse = stateTransitionSolution;
+        std::map< double, Eigen::MatrixXd > sensitivitySolutionToUse = sensitivitySolution;
+        createStateTransitionAndSensitivityMatrixInterpolator(
+                    stateTransitionMatrixInterpolators[ i ], sensitivityMatrixInterpolators[ i ],
+                    stateTransitionSolutionToUse, sensitivitySolutionToUse, true, storageSettingsList.at( i ) );
+        BOOST_CHECK_EQUAL( stateTransitionSolutionToUse.size( ), 0 );
+    }
+
+    // Check which storage is used
+    BOOST_CHECK_EQUAL( stateTransitionMatrixInterpolators.at( 0 )->getIndependentValues( ).size( ), times.size( ) );
+    BOOST_CHECK_EQUAL( stateTransitionMatrixInterpolators.at( 1 )->getIndependentValues( ).size( ), times.size( ) / 4 + 12 );
+    BOOST_CHECK_EQUAL( stateTransitionMatrixInterpolators.at( 2 )->getIndependentValues( ).size( ), times.size( ) );
+    BOOST_CHECK( std::dynamic_pointer_cast< SinglePrecisionLagrangeInterpolator >( sensitivityMatrixInterpolators.at( 0 ) ) == nullptr );
+    BOOST_CHECK( std::dynamic_pointer_cast< SinglePrecisionLagrangeInterpolator >( sensitivityMatrixInterpolators.at( 1 ) ) != nullptr );
+    BOOST_CHECK( std::dynamic_pointer_cast< SinglePrecisionLagrangeInterpolator >( sensitivityMatrixInterpolators.at( 2 ) ) == nullptr );
+
+    // Check interpolation error (relative to magnitude of columns) of compressed storage at epochs of numerical solution
+    for( unsigned int i = 0; i < times.size( ); i++ )
+    {
+        for( unsigned int j = 1; j < storageSettingsList.size( ); j++ )
+        {
+            Eigen::MatrixXd stateTransitionMatrixError =
+                    stateTransitionMatrixInterpolators.at( j )->interpolate( times.at( i ) ) - stateTransitionSolution.at( times.at( i ) );
+            Eigen::MatrixXd sensitivityMatrixError =
+                    sensitivityMatrixInterpolators.at( j )->interpolate( times.at( i ) ) - sensitivitySolution.at( times.at( i ) );
+            for( int k = 0; k < 6; k++ )
+            {
+                BOOST_CHECK_SMALL( stateTransitionMatrixError.col( k ).cwiseAbs( ).maxCoeff( ) / 1.1,
+                                   storageSettingsList.at( j )->maximumRelativeError_ );
+            }
+            for( int k = 0; k < 20; k++ )
+            {
+                BOOST_CHECK_SMALL( sensitivityMatrixError.col( k ).cwiseAbs( ).maxCoeff( ) / std::pow( 10.0, k - 10 ),
+                                   storageSettingsList.at( j )->maximumRelativeError_ );
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
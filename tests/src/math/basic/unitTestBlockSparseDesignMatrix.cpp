@@ -0,0 +1,155 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <stdexcept>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/basics/testMacros.h"
+#include "tudat/math/basic/blockSparseDesignMatrix.h"
+#include "tudat/math/basic/leastSquaresEstimation.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace linear_algebra;
+
+BOOST_AUTO_TEST_SUITE( test_block_sparse_design_matrix )
+
+//! Test whether block-sparse design matrix gives the same results as the equivalent dense matrix
+BOOST_AUTO_TEST_CASE( testBlockSparseDesignMatrix )
+{
+    const int numberOfRows = 30;
+    const int numberOfColumns = 12;
+
+    // Create dense matrix with three blocks of rows, each of which depends on the 'global' columns 0-2, and on its own
+    // 'local' columns (as for station or arc parameters)
+    std::srand( 11 );
+    Eigen::MatrixXd denseMatrix = Eigen::MatrixXd::Zero( numberOfRows, numberOfColumns );
+    std::vector< std::pair< int, int > > rowBlocks = { { 0, 10 }, { 10, 5 }, { 15, 15 } };
+    std::vector< std::vector< std::pair< int, int > > > parameterIndices =
+    { { { 0, 3 }, { 3, 2 } }, { { 0, 3 }, { 5, 3 } }, { { 0, 3 }, { 8, 2 }, { 10, 2 } } };
+    for( unsigned int i = 0; i < rowBlocks.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < parameterIndices.at( i ).size( ); j++ )
+        {
+            denseMatrix.block( rowBlocks.at( i ).first, parameterIndices.at( i ).at( j ).first,
+                               rowBlocks.at( i ).second, parameterIndices.at( i ).at( j ).second ) =
+                    Eigen::MatrixXd::Random( rowBlocks.at( i ).second, parameterIndices.at( i ).at( j ).second );
+        }
+    }
+
+    // Set column inside a candidate block to zero
+    denseMatrix.block( 15, 9, 15, 1 ).setZero( );
+
+    // Add blocks of rows in arbitrary order, to two matrices that are combined afterwards
+    BlockSparseDesignMatrix sparseMatrix( numberOfRows, numberOfColumns );
+    BlockSparseDesignMatrix secondSparseMatrix( numberOfRows, numberOfColumns );
+    for( int i = 2; i >= 0; i-- )
+    {
+        std::vector< std::pair< int, int > > columnBlocks = getNonZeroColumnBlocks(
+                    denseMatrix.middleRows( rowBlocks.at( i ).first, rowBlocks.at( i ).second ),
+                    parameterIndices.at( i ) );
+        ( ( i == 1 ) ? secondSparseMatrix : sparseMatrix ).addRowBlock(
+                    rowBlocks.at( i ).first, denseMatrix.middleRows( rowBlocks.at( i ).first, rowBlocks.at( i ).second ),
+                    columnBlocks );
+    }
+    sparseMatrix.addRowBlocks( secondSparseMatrix );
+
+    // Check stored structure
+    BOOST_CHECK_EQUAL( sparseMatrix.getNumberOfRowBlocks( ), 3 );
+    BOOST_CHECK_EQUAL( sparseMatrix.getRowBlockStartAndSize( ).at( 1 ).first, 10 );
+    BOOST_CHECK_EQUAL( sparseMatrix.getColumnBlocks( ).at( 0 ).size( ), 1 );
+    BOOST_CHECK_EQUAL( sparseMatrix.getColumnBlocks( ).at( 2 ).size( ), 3 );
+    BOOST_CHECK_EQUAL( sparseMatrix.getColumnBlocks( ).at( 2 ).at( 2 ).first, 10 );
+    BOOST_CHECK_EQUAL( sparseMatrix.getNumberOfStoredEntries( ), 10 * 5 + 5 * 6 + 15 * 6 );
+
+    // Check dense matrix and products
+    BOOST_CHECK( sparseMatrix.getDenseMatrix( ) == denseMatrix );
+
+    Eigen::VectorXd parameterVector = Eigen::VectorXd::Random( numberOfColumns );
+    Eigen::VectorXd observationVector = Eigen::VectorXd::Random( numberOfRows );
+    Eigen::VectorXd weights = Eigen::VectorXd::Random( numberOfRows ).cwiseAbs( ) +
+            Eigen::VectorXd::Constant( numberOfRows, 0.5 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                sparseMatrix.multiply( parameterVector ), Eigen::VectorXd( denseMatrix * parameterVector ), 1.0E-14 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                sparseMatrix.multiplyTranspose( observationVector ),
+                Eigen::VectorXd( denseMatrix.transpose( ) * observationVector ), 1.0E-14 );
+
+    // Check normal equations, from full matrix and from single blocks of rows
+    Eigen::MatrixXd expectedNormalMatrix = denseMatrix.transpose( ) * weights.asDiagonal( ) * denseMatrix;
+    Eigen::VectorXd expectedNormalRightHandSide = denseMatrix.transpose( ) * weights.asDiagonal( ) * observationVector;
+
+    Eigen::MatrixXd normalMatrix;
+    Eigen::VectorXd normalRightHandSide;
+    sparseMatrix.computeNormalEquations( observationVector, weights, normalMatrix, normalRightHandSide );
+
+    Eigen::MatrixXd accumulatedNormalMatrix = Eigen::MatrixXd::Zero( numberOfColumns, numberOfColumns );
+    Eigen::VectorXd accumulatedNormalRightHandSide = Eigen::VectorXd::Zero( numberOfColumns );
+    for( unsigned int i = 0; i < rowBlocks.size( ); i++ )
+    {
+        addObservationsToNormalEquations(
+                    denseMatrix.middleRows( rowBlocks.at( i ).first, rowBlocks.at( i ).second ),
+                    sparseMatrix.getColumnBlocks( ).at( i ),
+                    observationVector.segment( rowBlocks.at( i ).first, rowBlocks.at( i ).second ),
+                    weights.segment( rowBlocks.at( i ).first, rowBlocks.at( i ).second ),
+                    accumulatedNormalMatrix, accumulatedNormalRightHandSide );
+    }
+
+    for( int i = 0; i < numberOfColumns; i++ )
+    {
+        for( int j = 0; j < numberOfColumns; j++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( normalMatrix( i, j ) - expectedNormalMatrix( i, j ) ), 1.0E-13 );
+            BOOST_CHECK_SMALL( std::fabs( accumulatedNormalMatrix( i, j ) - expectedNormalMatrix( i, j ) ), 1.0E-13 );
+        }
+        BOOST_CHECK_SMALL( std::fabs( normalRightHandSide( i ) - expectedNormalRightHandSide( i ) ), 1.0E-13 );
+        BOOST_CHECK_SMALL( std::fabs( accumulatedNormalRightHandSide( i ) - expectedNormalRightHandSide( i ) ), 1.0E-13 );
+    }
+
+    // Check scaling and selection of columns
+    Eigen::VectorXd scalingFactors = Eigen::VectorXd::LinSpaced( numberOfColumns, 1.0, 12.0 );
+    std::vector< int > columnIndices = { 11, 0, 1, 4, 5, 6, 9 };
+    sparseMatrix.scaleColumns( scalingFactors );
+    BlockSparseDesignMatrix columnSubset = sparseMatrix.getColumnSubset( columnIndices );
+    Eigen::MatrixXd denseColumnSubset = columnSubset.getDenseMatrix( );
+    BOOST_CHECK_EQUAL( columnSubset.getNumberOfColumns( ), static_cast< int >( columnIndices.size( ) ) );
+    for( unsigned int i = 0; i < columnIndices.size( ); i++ )
+    {
+        BOOST_CHECK( denseColumnSubset.col( i ) == Eigen::VectorXd( denseMatrix.col( columnIndices.at( i ) ) * scalingFactors( columnIndices.at( i ) ) ) );
+    }
+
+    // Check that overlapping rows are detected
+    bool isExceptionCaught = false;
+    try
+    {
+        sparseMatrix.addRowBlock( 12, denseMatrix.middleRows( 12, 2 ) );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,170 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <limits>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/LU>
+
+#include "tudat/basics/testMacros.h"
+#include "tudat/math/basic/leastSquaresEstimation.h"
+#include "tudat/math/basic/squareRootInformationFilter.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace linear_algebra;
+
+BOOST_AUTO_TEST_SUITE( test_square_root_information_filter )
+
+//! Test whether observations added to filter in blocks give the same results as a batch least squares solution
+BOOST_AUTO_TEST_CASE( testSquareRootInformationFilterBatchEquivalence )
+{
+    const int numberOfParameters = 6;
+    const int numberOfObservations = 50;
+
+    std::srand( 42 );
+    Eigen::MatrixXd designMatrix = Eigen::MatrixXd::Random( numberOfObservations, numberOfParameters );
+    Eigen::VectorXd residuals = Eigen::VectorXd::Random( numberOfObservations );
+    Eigen::VectorXd weights = Eigen::VectorXd::Random( numberOfObservations ).cwiseAbs( ) +
+            Eigen::VectorXd::Constant( numberOfObservations, 0.5 );
+    Eigen::MatrixXd inverseAprioriCovariance = Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters );
+    inverseAprioriCovariance( 0, 0 ) = 10.0;
+    inverseAprioriCovariance( 4, 4 ) = 2.0;
+
+    // Compute batch solution
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > batchOutput = performLeastSquaresAdjustmentFromDesignMatrix(
+                designMatrix, residuals, weights, inverseAprioriCovariance );
+    double batchCost = ( residuals - designMatrix * batchOutput.first ).cwiseAbs2( ).dot( weights ) +
+            batchOutput.first.transpose( ) * inverseAprioriCovariance * batchOutput.first;
+
+    // Add observations in blocks of different size
+    SquareRootInformationFilter sequentialFilter( inverseAprioriCovariance );
+    std::vector< int > blockStartIndices = { 0, 1, 4, 20, numberOfObservations };
+    for( unsigned int i = 0; i < blockStartIndices.size( ) - 1; i++ )
+    {
+        int blockSize = blockStartIndices.at( i + 1 ) - blockStartIndices.at( i );
+        sequentialFilter.addObservations(
+                    designMatrix.block( blockStartIndices.at( i ), 0, blockSize, numberOfParameters ),
+                    residuals.segment( blockStartIndices.at( i ), blockSize ),
+                    weights.segment( blockStartIndices.at( i ), blockSize ) );
+    }
+
+    // Add observations to two filters, and combine them
+    SquareRootInformationFilter firstFilter( numberOfParameters );
+    SquareRootInformationFilter secondFilter( numberOfParameters );
+    firstFilter.addObservations( designMatrix.topRows( 30 ), residuals.head( 30 ), weights.head( 30 ) );
+    secondFilter.addObservations( designMatrix.bottomRows( 20 ), residuals.tail( 20 ), weights.tail( 20 ) );
+    firstFilter.addSquareRootInformation( secondFilter );
+    firstFilter.addAprioriInformation( inverseAprioriCovariance );
+
+    for( const SquareRootInformationFilter& filter : { sequentialFilter, firstFilter } )
+    {
+        BOOST_CHECK( filter.getSquareRootInformationMatrix( ).isUpperTriangular( 0.0 ) );
+
+        Eigen::VectorXd parameterEstimate = filter.getParameterEstimate( );
+        for( int i = 0; i < numberOfParameters; i++ )
+        {
+            BOOST_CHECK_CLOSE_FRACTION( parameterEstimate( i ), batchOutput.first( i ), 1.0E-10 );
+        }
+
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( filter.getInformationMatrix( ), batchOutput.second, 1.0E-12 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( filter.getCovarianceMatrix( ), Eigen::MatrixXd( batchOutput.second.inverse( ) ), 1.0E-10 );
+        BOOST_CHECK_CLOSE_FRACTION( filter.getResidualSumOfSquares( ), batchCost, 1.0E-10 );
+    }
+
+    // Check scaling of parameters
+    Eigen::VectorXd scalingFactors = Eigen::VectorXd::LinSpaced( numberOfParameters, 0.1, 100.0 );
+    sequentialFilter.scaleParameters( scalingFactors );
+    Eigen::VectorXd scaledParameterEstimate = sequentialFilter.getParameterEstimate( );
+    for( int i = 0; i < numberOfParameters; i++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( scaledParameterEstimate( i ), batchOutput.first( i ) * scalingFactors( i ), 1.0E-10 );
+    }
+
+    // Check that singular information is detected
+    SquareRootInformationFilter singularFilter( numberOfParameters );
+    singularFilter.addObservations( designMatrix.topRows( 3 ), residuals.head( 3 ), weights.head( 3 ) );
+    bool isExceptionCaught = false;
+    try
+    {
+        singularFilter.getParameterEstimate( );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
+//! Test addition of process noise between blocks of observations
+BOOST_AUTO_TEST_CASE( testSquareRootInformationFilterProcessNoise )
+{
+    const int numberOfParameters = 4;
+
+    std::srand( 7 );
+    Eigen::MatrixXd designMatrix = Eigen::MatrixXd::Random( 20, numberOfParameters );
+    Eigen::VectorXd residuals = Eigen::VectorXd::Random( 20 );
+    Eigen::VectorXd weights = Eigen::VectorXd::Constant( 20, 4.0 );
+
+    SquareRootInformationFilter filter( numberOfParameters );
+    filter.addObservations( designMatrix, residuals, weights );
+    Eigen::VectorXd parameterEstimateBeforeNoise = filter.getParameterEstimate( );
+    Eigen::MatrixXd covarianceBeforeNoise = filter.getCovarianceMatrix( );
+
+    // Add noise to (combinations of) the last two parameters
+    Eigen::MatrixXd noiseMapping = Eigen::MatrixXd::Zero( numberOfParameters, 2 );
+    noiseMapping( 2, 0 ) = 1.0;
+    noiseMapping( 3, 0 ) = 0.5;
+    noiseMapping( 3, 1 ) = 2.0;
+    Eigen::MatrixXd noiseCovariance = ( Eigen::MatrixXd( 2, 2 ) << 0.3, 0.1, 0.1, 0.2 ).finished( );
+    filter.addProcessNoise( noiseMapping, noiseCovariance );
+
+    // Check against covariance form of the time update
+    BOOST_CHECK( filter.getSquareRootInformationMatrix( ).isUpperTriangular( 0.0 ) );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                filter.getCovarianceMatrix( ),
+                Eigen::MatrixXd( covarianceBeforeNoise + noiseMapping * noiseCovariance * noiseMapping.transpose( ) ), 1.0E-10 );
+    Eigen::VectorXd parameterEstimateAfterNoise = filter.getParameterEstimate( );
+    for( int i = 0; i < numberOfParameters; i++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( parameterEstimateAfterNoise( i ), parameterEstimateBeforeNoise( i ), 1.0E-10 );
+    }
+
+    // Check that observations added after the noise are processed as for a filter with the updated covariance
+    Eigen::MatrixXd newDesignMatrix = Eigen::MatrixXd::Random( 5, numberOfParameters );
+    Eigen::VectorXd newResiduals = Eigen::VectorXd::Random( 5 );
+    Eigen::VectorXd newWeights = Eigen::VectorXd::Constant( 5, 1.0 );
+    Eigen::MatrixXd updatedInverseCovariance = filter.getInformationMatrix( );
+    filter.addObservations( newDesignMatrix, newResiduals, newWeights );
+
+    Eigen::VectorXd expectedParameterEstimate = ( updatedInverseCovariance + newDesignMatrix.transpose( ) * newDesignMatrix ).ldlt( ).solve(
+                updatedInverseCovariance * parameterEstimateAfterNoise + newDesignMatrix.transpose( ) * newResiduals );
+    Eigen::VectorXd parameterEstimate = filter.getParameterEstimate( );
+    for( int i = 0; i < numberOfParameters; i++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( parameterEstimate( i ), expectedParameterEstimate( i ), 1.0E-10 );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -18,6 +18,7 @@
 #include "tudat/math/basic/mathematicalConstants.h"
 
 #include "tudat/math/interpolators/lagrangeInterpolator.h"
+#include "tudat/math/interpolators/singlePrecisionLagrangeInterpolator.h"
 
 namespace tudat
 {
@@ -43,6 +44,29 @@ double evaluatePolynomial( const std::map< int, double >& coefficients,
     return polynomialValue;
 }
 
+//! Function to evaluate first derivative of polynomial
+/*!
+ *  Function to evaluate first derivative of polynomial with coefficients and independent variable as input.
+ *  \param coefficients Polynomial coefficients with the coefficient as map value and order as key.
+ *  \param evaluationPoint Independent variable at which polynomial derivative is to be evaluated.
+ *  \return Polynomial derivative value.
+ */
+double evaluatePolynomialDerivative( const std::map< int, double >& coefficients,
+                                     const double evaluationPoint )
+{
+    double polynomialDerivativeValue = 0.0;
+    for( std::map< int, double >::const_iterator it = coefficients.begin( );
+         it != coefficients.end( ) ; it++ )
+    {
+        if( it->first > 0 )
+        {
+            polynomialDerivativeValue += static_cast< double >( it->first ) * it->second *
+                    std::pow( evaluationPoint, it->first - 1 );
+        }
+    }
+    return polynomialDerivativeValue;
+}
+
 //! Function to retrieve polynomial coefficients
 /*!
  *  Function to retrieve quasi-random polynomial coefficients, up to a given maximum order.
@@ -181,6 +205,85 @@ BOOST_AUTO_TEST_CASE( test_lagrange_interpolation_polynomials )
     }
 }
 
+// Test whether Lagrange interpolator reproduces polynomial and its derivative, for equidistant and irregular grids
+BOOST_AUTO_TEST_CASE( test_lagrange_interpolation_derivatives )
+{
+    std::vector< double > irregularIndependentVariableVector = getIndependentVariableVector( );
+    std::vector< double > equidistantIndependentVariableVector;
+    for( unsigned int i = 0; i < 40; i++ )
+    {
+        equidistantIndependentVariableVector.push_back( 2.0 + 0.25 * static_cast< double >( i ) );
+    }
+
+    for( unsigned int stages = 4; stages < 11; stages += 2 )
+    {
+        std::map< int, double > coefficients = getPolynomialCoefficients( stages - 1 );
+        for( unsigned int gridType = 0; gridType < 2; gridType++ )
+        {
+            std::vector< double > independentVariableVector =
+                    ( gridType == 0 ) ? equidistantIndependentVariableVector : irregularIndependentVariableVector;
+
+            // Generate dependent variables
+            std::map< double, Eigen::Vector2d > dataMap;
+            for( unsigned int i = 0; i < independentVariableVector.size( ); i++ )
+            {
+                double polynomialValue = evaluatePolynomial( coefficients, independentVariableVector.at( i ) );
+                dataMap[ independentVariableVector.at( i ) ] = ( Eigen::Vector2d( ) << polynomialValue,
+                                                                 -2.0 * polynomialValue ).finished( );
+            }
+
+            interpolators::LagrangeInterpolator< double, Eigen::Vector2d > interpolator(
+                        dataMap, stages, interpolators::huntingAlgorithm,
+                        interpolators::lagrange_no_boundary_interpolation );
+            BOOST_CHECK_EQUAL( interpolator.getIsGridEquidistant( ), ( gridType == 0 ) );
+
+            // Iterate over all intervals inside allowed (i.e. non-boundary) range, including data points
+            int offsetEntries = stages / 2 - 1;
+            interpolators::LookUpCursor lookUpCursor;
+            for( unsigned int i = offsetEntries;
+                 i < independentVariableVector.size( ) - ( offsetEntries + 2 ); i++ )
+            {
+                double currentStepSize =  ( independentVariableVector.at( i + 1 ) -
+                                            independentVariableVector.at( i ) ) / 10.0;
+                for( unsigned j = 0; j < 10; j ++ )
+                {
+                    double currentDataPoint = independentVariableVector.at( i ) +
+                            static_cast< double >( j ) * currentStepSize;
+                    double polynomialValue = evaluatePolynomial( coefficients, currentDataPoint );
+                    double polynomialDerivative = evaluatePolynomialDerivative( coefficients, currentDataPoint );
+
+                    Eigen::Vector2d interpolatedDerivative;
+                    Eigen::Vector2d interpolatedValue = interpolator.interpolateWithFirstDerivative(
+                                currentDataPoint, interpolatedDerivative, lookUpCursor );
+
+                    BOOST_CHECK_CLOSE_FRACTION( interpolatedValue( 0 ), polynomialValue, 2.0E-14 );
+                    BOOST_CHECK_CLOSE_FRACTION( interpolatedValue( 1 ), -2.0 * polynomialValue, 2.0E-14 );
+                    BOOST_CHECK_CLOSE_FRACTION( interpolatedDerivative( 0 ), polynomialDerivative, 1.0E-10 );
+                    BOOST_CHECK_CLOSE_FRACTION( interpolatedDerivative( 1 ), -2.0 * polynomialDerivative, 1.0E-10 );
+
+                    // Check consistency with interpolation without derivative
+                    BOOST_CHECK_EQUAL( interpolatedValue( 0 ), interpolator.interpolate( currentDataPoint )( 0 ) );
+                }
+            }
+        }
+    }
+
+    // Check derivative near boundary, where cubic spline is used
+    std::map< double, double > dataMap;
+    for( unsigned int i = 0; i < 50; i++ )
+    {
+        dataMap[ 0.1 * static_cast< double >( i ) ] = std::sin( 0.1 * static_cast< double >( i ) );
+    }
+    interpolators::LagrangeInterpolator< double, double > interpolator( dataMap, 8 );
+    double testTime = 0.15;
+    double interpolatedDerivative;
+    BOOST_CHECK_EQUAL( interpolator.interpolateWithFirstDerivative( testTime, interpolatedDerivative ),
+                       interpolator.interpolate( testTime ) );
+    double numericalDerivative =
+            ( interpolator.interpolate( testTime + 1.0E-6 ) - interpolator.interpolate( testTime - 1.0E-6 ) ) / 2.0E-6;
+    BOOST_CHECK_CLOSE_FRACTION( interpolatedDerivative, numericalDerivative, 1.0E-8 );
+}
+
 // Test to check whether the various boundary handling methopds are properly implemented
 BOOST_AUTO_TEST_CASE( test_lagrange_interpolation_boundary )
 {
@@ -582,7 +685,61 @@ BOOST_AUTO_TEST_CASE( test_lagrange_error_checks )
     }
 }
 
+// Test whether Lagrange interpolator with single precision data points is consistent with double precision interpolator
+BOOST_AUTO_TEST_CASE( test_single_precision_lagrange_interpolation )
+{
+    // Create matrix history with columns of different magnitudes, on a long time grid
+    std::vector< double > independentVariables;
+    std::vector< Eigen::MatrixXd > dependentVariables;
+    for( int i = 0; i < 200; i++ )
+    {
+        independentVariables.push_back( 1.0E9 + 60.0 * static_cast< double >( i ) );
+        Eigen::MatrixXd currentMatrix = Eigen::MatrixXd( 3, 4 );
+        for( int j = 0; j < 3; j++ )
+        {
+            for( int k = 0; k < 4; k++ )
+            {
+                currentMatrix( j, k ) = std::pow( 10.0, 3 * k - 4 ) *
+                        std::sin( 1.0E-3 * static_cast< double >( ( j + 1 ) * ( k + 2 ) ) * 60.0 * static_cast< double >( i ) );
+            }
+        }
+        dependentVariables.push_back( currentMatrix );
+    }
+
+    interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > doublePrecisionInterpolator(
+                independentVariables, dependentVariables, 8 );
+    interpolators::SinglePrecisionLagrangeInterpolator singlePrecisionInterpolator(
+                independentVariables, dependentVariables, 8 );
+    BOOST_CHECK_EQUAL( singlePrecisionInterpolator.getDependentValues( ).size( ), 0 );
+    BOOST_CHECK( singlePrecisionInterpolator.getIndependentValues( ) == independentVariables );
+
+    // Compare interpolated values, relative to the magnitude of each column, using all interpolation functions
+    std::vector< double > interpolationTimes;
+    for( int i = 0; i < 597; i++ )
+    {
+        interpolationTimes.push_back( independentVariables.front( ) + 20.0 * static_cast< double >( i ) + 1.0 );
+    }
+    std::vector< Eigen::MatrixXd > batchInterpolatedValues;
+    singlePrecisionInterpolator.interpolateBatch( interpolationTimes, batchInterpolatedValues );
 
+    interpolators::LookUpCursor lookUpCursor;
+    for( unsigned int i = 0; i < interpolationTimes.size( ); i++ )
+    {
+        Eigen::MatrixXd expectedValue = doublePrecisionInterpolator.interpolate( interpolationTimes.at( i ) );
+        Eigen::MatrixXd interpolatedValue = singlePrecisionInterpolator.interpolate( interpolationTimes.at( i ) );
+        Eigen::MatrixXd cursorInterpolatedValue = singlePrecisionInterpolator.interpolate( interpolationTimes.at( i ), lookUpCursor );
+        BOOST_CHECK( interpolatedValue == cursorInterpolatedValue );
+        BOOST_CHECK( interpolatedValue == batchInterpolatedValues.at( i ) );
+        for( int k = 0; k < 4; k++ )
+        {
+            for( int j = 0; j < 3; j++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( interpolatedValue( j, k ) - expectedValue( j, k ) ) / std::pow( 10.0, 3 * k - 4 ),
+                                   1.0E-6 );
+            }
+        }
+    }
+}
 
 BOOST_AUTO_TEST_SUITE_END( )
 
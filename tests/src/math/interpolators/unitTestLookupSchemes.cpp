@@ -0,0 +1,332 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <algorithm>
+#include <random>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/math/interpolators/lookupScheme.h"
+#include "tudat/math/interpolators/createInterpolator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace interpolators;
+
+BOOST_AUTO_TEST_SUITE( test_lookup_schemes )
+
+//! Function to check whether equidistant lookup scheme produces the same results as binary search at a set of test values
+void compareEquidistantLookupWithBinarySearch( const std::vector< double >& grid )
+{
+    EquidistantLookupScheme< double > equidistantLookupScheme( grid );
+    BinarySearchLookupScheme< double > binarySearchLookupScheme( grid );
+
+    // Test at grid points, and just next to grid points
+    for( unsigned int i = 0; i < grid.size( ); i++ )
+    {
+        std::vector< double > testValues =
+        { grid.at( i ), std::nextafter( grid.at( i ), -1.0E10 ), std::nextafter( grid.at( i ), 1.0E10 ) };
+        for( unsigned int j = 0; j < testValues.size( ); j++ )
+        {
+            BOOST_CHECK_EQUAL( equidistantLookupScheme.findNearestLowerNeighbour( testValues.at( j ) ),
+                               binarySearchLookupScheme.findNearestLowerNeighbour( testValues.at( j ) ) );
+        }
+    }
+
+    // Test at random values, including values outside of grid
+    std::mt19937 randomNumberGenerator( 42 );
+    double gridRange = grid.back( ) - grid.front( );
+    std::uniform_real_distribution< double > distribution(
+                grid.front( ) - 0.1 * gridRange, grid.back( ) + 0.1 * gridRange );
+    for( unsigned int i = 0; i < 10000; i++ )
+    {
+        double testValue = distribution( randomNumberGenerator );
+        BOOST_CHECK_EQUAL( equidistantLookupScheme.findNearestLowerNeighbour( testValue ),
+                           binarySearchLookupScheme.findNearestLowerNeighbour( testValue ) );
+    }
+}
+
+// Test equidistant lookup scheme for equidistant and piecewise equidistant grids
+BOOST_AUTO_TEST_CASE( testEquidistantLookupScheme )
+{
+    // Create equidistant grid, with rounding errors from repeated addition
+    std::vector< double > equidistantGrid;
+    double currentValue = 1.0E4;
+    for( unsigned int i = 0; i < 1001; i++ )
+    {
+        equidistantGrid.push_back( currentValue );
+        currentValue += 0.1;
+    }
+    BOOST_CHECK_EQUAL( findEquidistantGridSegments( equidistantGrid ).size( ), 2 );
+    BOOST_CHECK_EQUAL( EquidistantLookupScheme< double >( equidistantGrid ).getNumberOfSegments( ), 1 );
+    compareEquidistantLookupWithBinarySearch( equidistantGrid );
+
+    // Create grid with three equidistant segments
+    std::vector< double > piecewiseEquidistantGrid;
+    for( unsigned int i = 0; i < 100; i++ )
+    {
+        piecewiseEquidistantGrid.push_back( static_cast< double >( i ) * 10.0 );
+    }
+    for( unsigned int i = 0; i < 100; i++ )
+    {
+        piecewiseEquidistantGrid.push_back( 1000.0 + static_cast< double >( i ) * 2.5 );
+    }
+    for( unsigned int i = 0; i < 50; i++ )
+    {
+        piecewiseEquidistantGrid.push_back( 1250.0 + static_cast< double >( i ) * 60.0 );
+    }
+    BOOST_CHECK_EQUAL( EquidistantLookupScheme< double >( piecewiseEquidistantGrid ).getNumberOfSegments( ), 3 );
+    compareEquidistantLookupWithBinarySearch( piecewiseEquidistantGrid );
+
+    // Check that irregular grid is not accepted
+    std::vector< double > irregularGrid;
+    for( unsigned int i = 0; i < 100; i++ )
+    {
+        irregularGrid.push_back( static_cast< double >( i * i ) );
+    }
+    BOOST_CHECK_EQUAL( findEquidistantGridSegments( irregularGrid ).size( ), 0 );
+    bool isExceptionCaught = false;
+    try
+    {
+        EquidistantLookupScheme< double > lookupScheme( irregularGrid );
+    }
+    catch( const std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+
+    // Check that equidistant lookup scheme is selected for interpolator, if possible
+    std::map< double, double > equidistantData, irregularData;
+    for( unsigned int i = 0; i < equidistantGrid.size( ); i++ )
+    {
+        equidistantData[ equidistantGrid.at( i ) ] = std::sin( equidistantGrid.at( i ) );
+    }
+    for( unsigned int i = 0; i < irregularGrid.size( ); i++ )
+    {
+        irregularData[ irregularGrid.at( i ) ] = std::sin( irregularGrid.at( i ) );
+    }
+    std::shared_ptr< InterpolatorSettings > interpolatorSettings =
+            std::make_shared< LagrangeInterpolatorSettings >( 6 );
+    BOOST_CHECK_EQUAL( ( createOneDimensionalInterpolator< double, double >(
+                             equidistantData, interpolatorSettings )->getSelectedLookupScheme( ) ), equidistantLookup );
+    BOOST_CHECK_EQUAL( ( createOneDimensionalInterpolator< double, double >(
+                             irregularData, interpolatorSettings )->getSelectedLookupScheme( ) ), huntingAlgorithm );
+}
+
+// Test whether interpolation with caller-owned look-up cursor reproduces stateful interpolation
+BOOST_AUTO_TEST_CASE( testInterpolationWithLookUpCursor )
+{
+    // Create irregular data set
+    std::map< double, double > dataMap;
+    for( unsigned int i = 0; i < 200; i++ )
+    {
+        double independentValue = static_cast< double >( i ) + 0.3 * std::sin( static_cast< double >( i ) );
+        dataMap[ independentValue ] = std::cos( 0.1 * independentValue );
+    }
+
+    std::vector< std::shared_ptr< InterpolatorSettings > > interpolatorSettingsList =
+    {
+        std::make_shared< InterpolatorSettings >( linear_interpolator ),
+        std::make_shared< InterpolatorSettings >( cubic_spline_interpolator ),
+        std::make_shared< InterpolatorSettings >( piecewise_constant_interpolator ),
+        std::make_shared< InterpolatorSettings >( hermite_spline_interpolator ),
+        std::make_shared< LagrangeInterpolatorSettings >( 8 )
+    };
+
+    // Create test values: ordered, and in random order (including values outside of domain)
+    std::vector< double > orderedTestValues, randomTestValues;
+    std::mt19937 randomNumberGenerator( 42 );
+    std::uniform_real_distribution< double > distribution( -5.0, 205.0 );
+    for( unsigned int i = 0; i < 1000; i++ )
+    {
+        orderedTestValues.push_back( 0.2 * static_cast< double >( i ) );
+        randomTestValues.push_back( distribution( randomNumberGenerator ) );
+    }
+
+    for( unsigned int i = 0; i < interpolatorSettingsList.size( ); i++ )
+    {
+        std::map< double, double > dataDerivativeMap;
+        if( interpolatorSettingsList.at( i )->getInterpolatorType( ) == hermite_spline_interpolator )
+        {
+            for( auto it : dataMap )
+            {
+                dataDerivativeMap[ it.first ] = -0.1 * std::sin( 0.1 * it.first );
+            }
+        }
+
+        std::shared_ptr< OneDimensionalInterpolator< double, double > > interpolator =
+                createOneDimensionalInterpolator< double, double >(
+                    dataMap, interpolatorSettingsList.at( i ),
+                    std::make_pair( TUDAT_NAN, TUDAT_NAN ), dataDerivativeMap.empty( ) ?
+                        std::vector< double >( ) : utilities::createVectorFromMapValues( dataDerivativeMap ) );
+
+        // Interleave two cursors, and check against stateful interpolation
+        LookUpCursor orderedCursor, randomCursor;
+        for( unsigned int j = 0; j < orderedTestValues.size( ); j++ )
+        {
+            BOOST_CHECK_EQUAL( interpolator->interpolate( orderedTestValues.at( j ), orderedCursor ),
+                               interpolator->interpolate( orderedTestValues.at( j ) ) );
+            BOOST_CHECK_EQUAL( interpolator->interpolate( randomTestValues.at( j ), randomCursor ),
+                               interpolator->interpolate( randomTestValues.at( j ) ) );
+        }
+    }
+}
+
+// Test whether batch interpolation reproduces interpolation at single values
+BOOST_AUTO_TEST_CASE( testBatchInterpolation )
+{
+    // Create irregular data set
+    std::map< double, Eigen::Vector3d > dataMap, dataDerivativeMap;
+    for( unsigned int i = 0; i < 200; i++ )
+    {
+        double independentValue = static_cast< double >( i ) + 0.3 * std::sin( static_cast< double >( i ) );
+        dataMap[ independentValue ] = ( Eigen::Vector3d( ) << std::cos( 0.1 * independentValue ),
+                                        std::sin( 0.1 * independentValue ), independentValue ).finished( );
+        dataDerivativeMap[ independentValue ] = ( Eigen::Vector3d( ) << -0.1 * std::sin( 0.1 * independentValue ),
+                                                  0.1 * std::cos( 0.1 * independentValue ), 1.0 ).finished( );
+    }
+
+    // Create sorted and unsorted test values (including values outside of domain and at data points)
+    std::vector< double > sortedTestValues, unsortedTestValues;
+    std::mt19937 randomNumberGenerator( 42 );
+    std::uniform_real_distribution< double > distribution( -5.0, 205.0 );
+    for( unsigned int i = 0; i < 1000; i++ )
+    {
+        unsortedTestValues.push_back( distribution( randomNumberGenerator ) );
+    }
+    unsortedTestValues.push_back( dataMap.begin( )->first );
+    unsortedTestValues.push_back( dataMap.rbegin( )->first );
+    unsortedTestValues.push_back( std::next( dataMap.begin( ), 100 )->first );
+    sortedTestValues = unsortedTestValues;
+    std::sort( sortedTestValues.begin( ), sortedTestValues.end( ) );
+
+    std::vector< InterpolatorTypes > interpolatorTypes =
+    { linear_interpolator, cubic_spline_interpolator, piecewise_constant_interpolator,
+      hermite_spline_interpolator, lagrange_interpolator };
+    std::vector< BoundaryInterpolationType > boundaryHandlings =
+    { extrapolate_at_boundary, use_boundary_value, use_default_value };
+    for( unsigned int i = 0; i < interpolatorTypes.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < boundaryHandlings.size( ); j++ )
+        {
+            std::shared_ptr< InterpolatorSettings > interpolatorSettings;
+            if( interpolatorTypes.at( i ) == lagrange_interpolator )
+            {
+                interpolatorSettings = std::make_shared< LagrangeInterpolatorSettings >(
+                            8, false, huntingAlgorithm, lagrange_cubic_spline_boundary_interpolation,
+                            boundaryHandlings.at( j ) );
+            }
+            else
+            {
+                interpolatorSettings = std::make_shared< InterpolatorSettings >(
+                            interpolatorTypes.at( i ), huntingAlgorithm, false, boundaryHandlings.at( j ) );
+            }
+
+            std::shared_ptr< OneDimensionalInterpolator< double, Eigen::Vector3d > > interpolator =
+                    createOneDimensionalInterpolator< double, Eigen::Vector3d >(
+                        dataMap, interpolatorSettings,
+                        std::make_pair( Eigen::Vector3d::Constant( -1.0 ), Eigen::Vector3d::Constant( 1.0 ) ),
+                        interpolatorTypes.at( i ) == hermite_spline_interpolator ?
+                            utilities::createVectorFromMapValues( dataDerivativeMap ) :
+                            std::vector< Eigen::Vector3d >( ) );
+
+            std::vector< std::vector< double > > testValueLists = { sortedTestValues, unsortedTestValues };
+            for( unsigned int k = 0; k < testValueLists.size( ); k++ )
+            {
+                std::vector< Eigen::Vector3d > batchInterpolatedValues;
+                interpolator->interpolateBatch( testValueLists.at( k ), batchInterpolatedValues );
+
+                BOOST_CHECK_EQUAL( batchInterpolatedValues.size( ), testValueLists.at( k ).size( ) );
+                for( unsigned int l = 0; l < testValueLists.at( k ).size( ); l++ )
+                {
+                    Eigen::Vector3d interpolatedValue = interpolator->interpolate( testValueLists.at( k ).at( l ) );
+                    for( unsigned int m = 0; m < 3; m++ )
+                    {
+                        BOOST_CHECK_EQUAL( batchInterpolatedValues.at( l )( m ), interpolatedValue( m ) );
+                    }
+                }
+            }
+        }
+    }
+}
+
+//! Interpolator implementing only the interpolate function without look-up cursor, as done by user-defined interpolators
+class CustomLinearInterpolator: public OneDimensionalInterpolator< double, double >
+{
+public:
+
+    using OneDimensionalInterpolator< double, double >::interpolate;
+
+    CustomLinearInterpolator( const std::vector< double >& independentValues,
+                              const std::vector< double >& dependentValues )
+    {
+        independentValues_ = independentValues;
+        dependentValues_ = dependentValues;
+        makeLookupScheme( huntingAlgorithm );
+    }
+
+    double interpolate( const double independentVariableValue )
+    {
+        int lowerIndex = lookUpScheme_->findNearestLowerNeighbour( independentVariableValue );
+        return dependentValues_.at( lowerIndex ) +
+                ( independentVariableValue - independentValues_.at( lowerIndex ) ) *
+                ( dependentValues_.at( lowerIndex + 1 ) - dependentValues_.at( lowerIndex ) ) /
+                ( independentValues_.at( lowerIndex + 1 ) - independentValues_.at( lowerIndex ) );
+    }
+
+    InterpolatorTypes getInterpolatorType( )
+    {
+        return linear_interpolator;
+    }
+};
+
+// Test whether default interpolation with look-up cursor reproduces interpolation for user-defined interpolator
+BOOST_AUTO_TEST_CASE( testDefaultInterpolationWithLookUpCursor )
+{
+    std::vector< double > independentValues, dependentValues;
+    for( unsigned int i = 0; i < 200; i++ )
+    {
+        independentValues.push_back( static_cast< double >( i ) + 0.3 * std::sin( static_cast< double >( i ) ) );
+        dependentValues.push_back( std::cos( 0.1 * independentValues.back( ) ) );
+    }
+    CustomLinearInterpolator interpolator( independentValues, dependentValues );
+
+    std::vector< double > testValues;
+    std::mt19937 randomNumberGenerator( 42 );
+    std::uniform_real_distribution< double > distribution( 0.0, 198.0 );
+    for( unsigned int i = 0; i < 1000; i++ )
+    {
+        testValues.push_back( distribution( randomNumberGenerator ) );
+    }
+
+    LookUpCursor lookUpCursor;
+    std::vector< double > batchInterpolatedValues;
+    interpolator.interpolateBatch( testValues, batchInterpolatedValues );
+    for( unsigned int i = 0; i < testValues.size( ); i++ )
+    {
+        double interpolatedValue = interpolator.interpolate( testValues.at( i ) );
+        BOOST_CHECK_EQUAL( interpolator.interpolate( testValues.at( i ), lookUpCursor ), interpolatedValue );
+        BOOST_CHECK_EQUAL( batchInterpolatedValues.at( i ), interpolatedValue );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
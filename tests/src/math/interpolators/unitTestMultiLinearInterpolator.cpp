@@ -619,6 +619,75 @@ BOOST_AUTO_TEST_CASE( test2DimensionsUserExtrapolationCase )
     }
 }
 
+// Test 7: Check that interpolation of vector with multiple components gives same result as separate scalar
+// interpolations, and that functions that are linear in each independent variable are reproduced.
+BOOST_AUTO_TEST_CASE( testMultipleComponentInterpolation )
+{
+    using namespace interpolators;
+
+    // Create irregular grid
+    std::vector< std::vector< double > > independentValues( 3 );
+    independentValues[ 0 ] = { 0.0, 0.3, 1.2, 1.5, 2.7 };
+    independentValues[ 1 ] = { -4.0, -1.0, 2.5, 3.0 };
+    independentValues[ 2 ] = { 10.0, 10.5, 13.0, 17.0, 17.5, 20.0 };
+
+    // Create data, with components that are linear in each independent variable
+    boost::multi_array< Eigen::Vector3d, 3 > vectorData( boost::extents[ 5 ][ 4 ][ 6 ] );
+    std::vector< boost::multi_array< double, 3 > > scalarData(
+                3, boost::multi_array< double, 3 >( boost::extents[ 5 ][ 4 ][ 6 ] ) );
+    for( unsigned int i = 0; i < 5; i++ )
+    {
+        for( unsigned int j = 0; j < 4; j++ )
+        {
+            for( unsigned int k = 0; k < 6; k++ )
+            {
+                double x = independentValues[ 0 ][ i ], y = independentValues[ 1 ][ j ], z = independentValues[ 2 ][ k ];
+                vectorData[ i ][ j ][ k ] << 1.0 + 2.0 * x - y + 0.5 * z, x * y * z, 3.0 * x * y - z;
+                for( unsigned int l = 0; l < 3; l++ )
+                {
+                    scalarData[ l ][ i ][ j ][ k ] = vectorData[ i ][ j ][ k ]( l );
+                }
+            }
+        }
+    }
+
+    MultiLinearInterpolator< double, Eigen::Vector3d, 3 > vectorInterpolator( independentValues, vectorData );
+
+    // Create interpolator from same data, with non-zero index bases
+    boost::multi_array< Eigen::Vector3d, 3 > reindexedVectorData = vectorData;
+    reindexedVectorData.reindex( 1 );
+    MultiLinearInterpolator< double, Eigen::Vector3d, 3 > reindexedVectorInterpolator(
+                independentValues, reindexedVectorData );
+    std::vector< std::shared_ptr< MultiLinearInterpolator< double, double, 3 > > > scalarInterpolators;
+    for( unsigned int l = 0; l < 3; l++ )
+    {
+        scalarInterpolators.push_back(
+                    std::make_shared< MultiLinearInterpolator< double, double, 3 > >( independentValues, scalarData[ l ] ) );
+    }
+
+    // Compare at grid of test points (including extrapolation)
+    for( double x = -0.5; x < 3.0; x += 0.37 )
+    {
+        for( double y = -4.5; y < 3.5; y += 0.91 )
+        {
+            for( double z = 9.0; z < 21.0; z += 1.3 )
+            {
+                std::vector< double > targetValue = { x, y, z };
+                Eigen::Vector3d interpolatedValue = vectorInterpolator.interpolate( targetValue );
+                Eigen::Vector3d expectedValue;
+                expectedValue << 1.0 + 2.0 * x - y + 0.5 * z, x * y * z, 3.0 * x * y - z;
+                for( unsigned int l = 0; l < 3; l++ )
+                {
+                    BOOST_CHECK_EQUAL( interpolatedValue( l ), scalarInterpolators.at( l )->interpolate( targetValue ) );
+                    BOOST_CHECK_EQUAL( interpolatedValue( l ),
+                                       reindexedVectorInterpolator.interpolate( targetValue )( l ) );
+                    BOOST_CHECK_SMALL( interpolatedValue( l ) - expectedValue( l ), 1.0E-12 );
+                }
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
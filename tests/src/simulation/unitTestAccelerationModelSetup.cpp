@@ -723,8 +723,9 @@ BOOST_AUTO_TEST_CASE( test_aerodynamicAccelerationModelSetupWithCoefficientIndep
 
 
     // Retrieve flight conditions and orientation angles
-    std::shared_ptr< aerodynamics::FlightConditions > vehicleFlightConditions =
-            bodies.at( "Vehicle" )->getFlightConditions( );
+    std::shared_ptr< aerodynamics::AtmosphericFlightConditions > vehicleFlightConditions =
+            std::dynamic_pointer_cast< aerodynamics::AtmosphericFlightConditions >(
+                bodies.at( "Vehicle" )->getFlightConditions( ) );
     std::shared_ptr< aerodynamics::AerodynamicCoefficientInterface > coefficientInterface =
             bodies.at( "Vehicle" )->getAerodynamicCoefficientInterface( );
 
@@ -788,9 +789,14 @@ BOOST_AUTO_TEST_CASE( test_aerodynamicAccelerationModelSetupWithCoefficientIndep
         vehicleRotationModel->setAerodynamicAngleFunction(
                     [=]( const double ){ return ( Eigen::Vector3d( ) << angleOfAttack, angleOfSideslip, bankAngle ).finished( ); } );
 
+        // Set coefficients to values at other conditions, to check that they are only updated when requested
+        coefficientInterface->updateFullCurrentCoefficients( { 10.0, 0.0, 0.0 } );
+        Eigen::Vector3d previousCoefficients = coefficientInterface->getCurrentForceCoefficients( );
+
         // Update flight conditions
         vehicleFlightConditions->resetCurrentTime( );
         vehicleFlightConditions->updateConditions( testTime );
+        BOOST_CHECK_EQUAL( ( coefficientInterface->getCurrentForceCoefficients( ) - previousCoefficients ).norm( ), 0.0 );
 
         // Calculate Mach number
         double velocity = vehicleBodyFixedState.segment( 3, 3 ).norm( );
@@ -799,7 +805,10 @@ BOOST_AUTO_TEST_CASE( test_aerodynamicAccelerationModelSetupWithCoefficientIndep
         double machNumber = velocity / speedOfSound;
 
         // Get manual and automatic coefficients and compare.
-        Eigen::Vector3d automaticCoefficients = coefficientInterface->getCurrentForceCoefficients( );
+        Eigen::Vector3d automaticCoefficients = vehicleFlightConditions->getCurrentForceCoefficients( );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    automaticCoefficients, coefficientInterface->getCurrentForceCoefficients( ),
+                    std::numeric_limits< double >::epsilon( ) );
         coefficientInterface->updateFullCurrentCoefficients(
         { machNumber, angleOfAttack, angleOfSideslip } );
         Eigen::Vector3d manualCoefficients = coefficientInterface->getCurrentForceCoefficients( );